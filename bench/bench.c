@@ -0,0 +1,421 @@
+/**
+ * ================================================================
+ * FRAMEWORK DE MICRO-BENCHMARK
+ * ================================================================
+ *
+ * @file bench.c
+ * @brief Registro, seleção, medição e exportação dos casos
+ *
+ *  CICLO DE UM CASO:
+ * ┌──────────────┐   ┌──────────────┐   ┌──────────────────┐   ┌───────────┐
+ * │ gera entrada │ → │ aquecimento  │ → │ repetições:      │ → │ confere   │
+ * │ (uma vez)    │   │ (descartado) │   │ copia + mede     │   │ ordenação │
+ * └──────────────┘   └──────────────┘   └──────────────────┘   └───────────┘
+ *
+ * A cópia da entrada fica fora da região medida; só a chamada ao
+ * algoritmo (executar_ordenacao) é cronometrada.
+ *
+ * ================================================================
+ */
+
+#include "bench.h"
+#include <string.h>  // Para memcpy, strchr, strstr
+#include <math.h>    // Para sqrt
+
+#if defined(__has_include)
+    #if __has_include(<regex.h>)
+        #include <regex.h>
+        #define BENCH_TEM_REGEX 1
+    #endif
+#endif
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+static CasoBench casos_bench[MAX_CASOS_BENCH];
+static int num_casos_bench = 0;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static const char* nome_versao_caso(const CasoBench *caso);
+static int indice_caso_qsort(const CasoBench *caso);
+static size_t tamanho_elemento(TipoElementoBench tipo);
+static CompareFn comparador_tipo(TipoElementoBench tipo);
+static void* gerar_entrada(const CasoBench *caso, uint64_t semente);
+static int comparar_double(const void *a, const void *b);
+static int conferir_ordenacao(const void *dados, int n, size_t elem_size, CompareFn cmp);
+static ResultadoBench medir_caso(const CasoBench *caso, const OpcoesBench *opcoes);
+static void escrever_json(FILE *arquivo, const ResultadoBench *resultados, int num_resultados,
+                          const OpcoesBench *opcoes);
+
+/* ================================================================
+ * REGISTRO
+ * ================================================================ */
+
+OpcoesBench opcoes_bench_padrao(void) {
+    OpcoesBench opcoes;
+    opcoes.filtro = NULL;
+    opcoes.repeticoes = REPETICOES_BENCH_PADRAO;
+    opcoes.aquecimento = AQUECIMENTO_BENCH_PADRAO;
+    opcoes.semente = SEMENTE_PADRAO_GERADOR;
+    opcoes.arquivo_json = NULL;
+    opcoes.apenas_listar = 0;
+    opcoes.custo_comparacao = 0;
+    return opcoes;
+}
+
+/**
+ * @brief "otimizada", "didatica", "libc", "unica" ou "plugin" (só os algoritmos têm versões)
+ */
+static const char* nome_versao_caso(const CasoBench *caso) {
+    if (caso->indice_algoritmo >= NUM_MOTORES_INTERNOS) return "plugin";
+    if (caso->indice_algoritmo >= INDICE_APRENDIDA) return "unica";
+    if (caso->indice_algoritmo >= NUM_ALGORITMOS) return "libc";
+    return caso->otimizada ? "otimizada" : "didatica";
+}
+
+const char* nome_tipo_bench(TipoElementoBench tipo) {
+    switch (tipo) {
+        case TIPO_BENCH_INT:   return "int";
+        case TIPO_BENCH_ALUNO: return "aluno";
+        default:               return "desconhecido";
+    }
+}
+
+int bench_registrar(int indice_algoritmo, int otimizada, DistribuicaoDados distribuicao,
+                    TipoElementoBench tipo, int tamanho) {
+    const AlgoritmoInfo *info = obter_info_motor(indice_algoritmo);
+    if (num_casos_bench >= MAX_CASOS_BENCH || !info) return -1;
+    // Ex.: plugin só de inteiros não recebe casos de Aluno
+    if (!motor_aceita_dados(info, tamanho_elemento(tipo), comparador_tipo(tipo))) return -1;
+
+    CasoBench *caso = &casos_bench[num_casos_bench++];
+    caso->indice_algoritmo = indice_algoritmo;
+    caso->otimizada = otimizada;
+    caso->distribuicao = distribuicao;
+    caso->tipo = tipo;
+    caso->tamanho = tamanho;
+
+    // Id do registro: "quick", "qsort" ou o id do plugin
+    snprintf(caso->nome, sizeof(caso->nome), "%s/%s/%s/%s/%d", info->id,
+             nome_versao_caso(caso), nome_distribuicao(distribuicao),
+             nome_tipo_bench(tipo), tamanho);
+    return 0;
+}
+
+/**
+ * @brief Caso do qsort com a mesma entrada (distribuição, tipo, tamanho), ou -1
+ */
+static int indice_caso_qsort(const CasoBench *caso) {
+    for (int i = 0; i < num_casos_bench; i++) {
+        const CasoBench *c = &casos_bench[i];
+        if (c->indice_algoritmo == INDICE_QSORT && c->distribuicao == caso->distribuicao &&
+            c->tipo == caso->tipo && c->tamanho == caso->tamanho) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int bench_num_casos(void) {
+    return num_casos_bench;
+}
+
+/* ================================================================
+ * ENTRADAS
+ * ================================================================ */
+
+static size_t tamanho_elemento(TipoElementoBench tipo) {
+    return tipo == TIPO_BENCH_ALUNO ? sizeof(Aluno) : sizeof(int);
+}
+
+static CompareFn comparador_tipo(TipoElementoBench tipo) {
+    return tipo == TIPO_BENCH_ALUNO ? comparar_alunos : comparar_inteiros;
+}
+
+/**
+ * @brief Gera a entrada do caso
+ *
+ * Para Aluno, a chave inteira vira o bairro (zeros à esquerda preservam a
+ * ordem numérica em strcmp), então a distribuição vale para os dois tipos.
+ */
+static void* gerar_entrada(const CasoBench *caso, uint64_t semente) {
+    int *chaves = malloc((size_t)caso->tamanho * sizeof(int));
+    if (!chaves) return NULL;
+    gerar_numeros(chaves, caso->tamanho, caso->distribuicao, semente);
+    if (caso->tipo == TIPO_BENCH_INT) return chaves;
+
+    Aluno *alunos = calloc((size_t)caso->tamanho, sizeof(Aluno));
+    if (alunos) {
+        for (int i = 0; i < caso->tamanho; i++) {
+            snprintf(alunos[i].bairro, sizeof(alunos[i].bairro), "Bairro %010d", chaves[i]);
+            snprintf(alunos[i].nome, sizeof(alunos[i].nome), "Aluno %08d", i);
+            snprintf(alunos[i].data_nascimento, sizeof(alunos[i].data_nascimento), "01/01/2000");
+            snprintf(alunos[i].cidade, sizeof(alunos[i].cidade), "Cidade");
+        }
+    }
+    free(chaves);
+    return alunos;
+}
+
+/* ================================================================
+ * MEDIÇÃO
+ * ================================================================ */
+
+static int comparar_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static int conferir_ordenacao(const void *dados, int n, size_t elem_size, CompareFn cmp) {
+    const char *base = (const char*)dados;
+    for (int i = 0; i + 1 < n; i++) {
+        if (cmp(base + (size_t)i * elem_size, base + (size_t)(i + 1) * elem_size) > 0) return 0;
+    }
+    return 1;
+}
+
+static ResultadoBench medir_caso(const CasoBench *caso, const OpcoesBench *opcoes) {
+    ResultadoBench resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    resultado.caso = caso;
+
+    AlgoritmoInfo *info = obter_info_motor(caso->indice_algoritmo);
+    size_t elem_size = tamanho_elemento(caso->tipo);
+    size_t bytes = (size_t)caso->tamanho * elem_size;
+    CompareFn comparador = comparador_tipo(caso->tipo);
+    CompareFn cmp = comparador;
+    if (opcoes->custo_comparacao > 0) {
+        // Comparador envolvido com custo sintético (custo.h)
+        configurar_custo_comparacao(comparador, opcoes->custo_comparacao);
+        cmp = comparar_com_custo;
+    }
+
+    void *entrada = gerar_entrada(caso, opcoes->semente);
+    void *trabalho = malloc(bytes);
+    double *tempos = malloc((size_t)opcoes->repeticoes * sizeof(double));
+    if (!entrada || !trabalho || !tempos) {
+        free(entrada);
+        free(trabalho);
+        free(tempos);
+        return resultado;
+    }
+
+    configurar_otimizacao(caso->otimizada);
+
+    for (int i = 0; i < opcoes->aquecimento; i++) {
+        memcpy(trabalho, entrada, bytes);
+        executar_ordenacao(info, trabalho, caso->tamanho, elem_size, cmp);
+    }
+
+    for (int i = 0; i < opcoes->repeticoes; i++) {
+        memcpy(trabalho, entrada, bytes);
+        contador_comparacoes = 0;
+        contador_movimentacoes = 0;
+
+        uint64_t inicio = cronometro_iniciar();
+        executar_ordenacao(info, trabalho, caso->tamanho, elem_size, cmp);
+        uint64_t fim = cronometro_parar();
+        tempos[i] = ticks_para_segundos(cronometro_decorrido(inicio, fim));
+    }
+
+    resultado.repeticoes = opcoes->repeticoes;
+    resultado.comparacoes = contador_comparacoes;
+    resultado.movimentacoes = contador_movimentacoes;
+    resultado.bytes_lidos = contador_movimentacoes * (long long)elem_size;
+    resultado.bytes_escritos = contador_movimentacoes * (long long)elem_size;
+    resultado.ordenado = conferir_ordenacao(trabalho, caso->tamanho, elem_size, comparador);
+
+    double soma = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) soma += tempos[i];
+    resultado.media = soma / opcoes->repeticoes;
+
+    double quadrados = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) {
+        quadrados += (tempos[i] - resultado.media) * (tempos[i] - resultado.media);
+    }
+    resultado.desvio = opcoes->repeticoes > 1 ? sqrt(quadrados / (opcoes->repeticoes - 1)) : 0.0;
+
+    qsort(tempos, (size_t)opcoes->repeticoes, sizeof(double), comparar_double);
+    resultado.minimo = tempos[0];
+    resultado.maximo = tempos[opcoes->repeticoes - 1];
+    int meio = opcoes->repeticoes / 2;
+    resultado.mediana = (opcoes->repeticoes % 2) ? tempos[meio] : (tempos[meio - 1] + tempos[meio]) / 2.0;
+    if (resultado.mediana > 0.0) {
+        resultado.banda = (double)(resultado.bytes_lidos + resultado.bytes_escritos) /
+                          resultado.mediana / 1e9;
+    }
+
+    free(entrada);
+    free(trabalho);
+    free(tempos);
+    return resultado;
+}
+
+/* ================================================================
+ * SAÍDA JSON
+ * ================================================================ */
+
+static void escrever_json(FILE *arquivo, const ResultadoBench *resultados, int num_resultados,
+                          const OpcoesBench *opcoes) {
+    char cronometro[96];
+    char parametros[96];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+    descrever_parametros_motores(obter_parametros_motores(), parametros, sizeof(parametros));
+
+    fprintf(arquivo, "{\n");
+    fprintf(arquivo, "  \"contexto\": {\n");
+    fprintf(arquivo, "    \"cronometro\": \"%s\",\n", cronometro);
+    fprintf(arquivo, "    \"repeticoes\": %d,\n", opcoes->repeticoes);
+    fprintf(arquivo, "    \"aquecimento\": %d,\n", opcoes->aquecimento);
+    fprintf(arquivo, "    \"semente\": %llu,\n", (unsigned long long)opcoes->semente);
+    fprintf(arquivo, "    \"custo_comparacao_ticks\": %llu,\n", (unsigned long long)opcoes->custo_comparacao);
+    fprintf(arquivo, "    \"banda_copia_gb_s\": %.3f,\n", obter_banda_memoria()->copia);
+    fprintf(arquivo, "    \"banda_escala_gb_s\": %.3f,\n", obter_banda_memoria()->escala);
+    fprintf(arquivo, "    \"parametros_motores\": \"%s\"\n", parametros);
+    fprintf(arquivo, "  },\n");
+    fprintf(arquivo, "  \"casos\": [\n");
+    for (int i = 0; i < num_resultados; i++) {
+        const ResultadoBench *r = &resultados[i];
+        const CasoBench *c = r->caso;
+        fprintf(arquivo, "    {\"nome\": \"%s\", \"algoritmo\": \"%s\", \"versao\": \"%s\", "
+                         "\"distribuicao\": \"%s\", \"tipo\": \"%s\", \"n\": %d, \"repeticoes\": %d, "
+                         "\"min_s\": %.9f, \"mediana_s\": %.9f, \"media_s\": %.9f, \"max_s\": %.9f, "
+                         "\"desvio_s\": %.9f, \"comparacoes\": %lld, \"movimentacoes\": %lld, "
+                         "\"bytes_lidos\": %lld, \"bytes_escritos\": %lld, \"gb_s\": %.4f, "
+                         "\"fracao_teto_banda\": %.4f, "
+                         "\"ordenado\": %s, \"aceleracao_qsort\": ",
+                c->nome, obter_info_motor(c->indice_algoritmo)->nome,
+                nome_versao_caso(c), nome_distribuicao(c->distribuicao),
+                nome_tipo_bench(c->tipo), c->tamanho, r->repeticoes,
+                r->minimo, r->mediana, r->media, r->maximo, r->desvio,
+                r->comparacoes, r->movimentacoes, r->bytes_lidos, r->bytes_escritos,
+                r->banda, fracao_teto_banda(r->banda), r->ordenado ? "true" : "false");
+        if (r->aceleracao_qsort > 0.0) {
+            fprintf(arquivo, "%.4f", r->aceleracao_qsort);
+        } else {
+            fprintf(arquivo, "null");
+        }
+        fprintf(arquivo, "}%s\n", i + 1 < num_resultados ? "," : "");
+    }
+    fprintf(arquivo, "  ]\n");
+    fprintf(arquivo, "}\n");
+}
+
+/* ================================================================
+ * EXECUÇÃO
+ * ================================================================ */
+
+int bench_executar(const OpcoesBench *opcoes) {
+    if (!opcoes || opcoes->repeticoes <= 0 || opcoes->aquecimento < 0) return -1;
+
+#ifdef BENCH_TEM_REGEX
+    regex_t expressao;
+    int usar_regex = opcoes->filtro && opcoes->filtro[0];
+    if (usar_regex && regcomp(&expressao, opcoes->filtro, REG_EXTENDED | REG_NOSUB) != 0) {
+        fprintf(stderr, "ERRO: filtro invalido: %s\n", opcoes->filtro);
+        return -1;
+    }
+#endif
+
+    // Seleciona os casos antes de medir, para saber o total
+    int *selecionados = malloc((size_t)(num_casos_bench > 0 ? num_casos_bench : 1) * sizeof(int));
+    char *marcados = calloc((size_t)(num_casos_bench > 0 ? num_casos_bench : 1), 1);
+    if (!selecionados || !marcados) {
+        free(selecionados);
+        free(marcados);
+        return -1;
+    }
+    for (int i = 0; i < num_casos_bench; i++) {
+        int passa = 1;
+#ifdef BENCH_TEM_REGEX
+        if (usar_regex) passa = regexec(&expressao, casos_bench[i].nome, 0, NULL, 0) == 0;
+#else
+        if (opcoes->filtro && opcoes->filtro[0]) passa = strstr(casos_bench[i].nome, opcoes->filtro) != NULL;
+#endif
+        if (!passa) continue;
+        marcados[i] = 1;
+
+        // Linha de base: o qsort da mesma entrada entra mesmo fora do filtro
+        int referencia = indice_caso_qsort(&casos_bench[i]);
+        if (referencia >= 0) marcados[referencia] = 1;
+    }
+#ifdef BENCH_TEM_REGEX
+    if (usar_regex) regfree(&expressao);
+#endif
+
+    // Ordem de registro: as referências vêm antes (sort_bench.c), então o
+    // qsort de cada entrada já está medido quando os demais casos aparecem
+    int num_selecionados = 0;
+    for (int i = 0; i < num_casos_bench; i++) {
+        if (marcados[i]) selecionados[num_selecionados++] = i;
+    }
+    free(marcados);
+
+    if (opcoes->apenas_listar) {
+        for (int i = 0; i < num_selecionados; i++) printf("%s\n", casos_bench[selecionados[i]].nome);
+        free(selecionados);
+        return 0;
+    }
+
+    ResultadoBench *resultados = calloc((size_t)(num_selecionados > 0 ? num_selecionados : 1),
+                                        sizeof(ResultadoBench));
+    if (!resultados) {
+        free(selecionados);
+        return -1;
+    }
+
+    // Com JSON na saída padrão, a tabela vai para stderr
+    FILE *tabela = (opcoes->arquivo_json && strcmp(opcoes->arquivo_json, "-") == 0) ? stderr : stdout;
+    int versao_original = usar_versao_otimizada;
+    int falhas = 0;
+
+    fprintf(tabela, "%-48s %12s %12s %12s %14s %9s %8s %s\n",
+            "Caso", "Mediana (s)", "Min (s)", "Desvio (s)", "Comparacoes", "x qsort", "GB/s", "OK");
+    for (int i = 0; i < num_selecionados; i++) {
+        const CasoBench *caso = &casos_bench[selecionados[i]];
+        resultados[i] = medir_caso(caso, opcoes);
+        if (!resultados[i].ordenado) falhas++;
+
+        // Mediana do qsort da mesma entrada, se já medido nesta execução
+        int referencia = indice_caso_qsort(caso);
+        for (int j = 0; j < i && referencia >= 0; j++) {
+            if (selecionados[j] == referencia) {
+                resultados[i].aceleracao_qsort =
+                    aceleracao_sobre_qsort(resultados[j].mediana, resultados[i].mediana);
+                break;
+            }
+        }
+        if (selecionados[i] == referencia) resultados[i].aceleracao_qsort = 1.0;
+
+        char aceleracao[16];
+        formatar_aceleracao(resultados[i].aceleracao_qsort, aceleracao, sizeof(aceleracao));
+        char banda[16];
+        formatar_banda(resultados[i].banda, banda, sizeof(banda));
+        fprintf(tabela, "%-48s %12.6f %12.6f %12.6f %14lld %9s %8s %s\n", caso->nome,
+                resultados[i].mediana, resultados[i].minimo, resultados[i].desvio,
+                resultados[i].comparacoes, aceleracao, banda, resultados[i].ordenado ? "sim" : "NAO");
+        fflush(tabela);
+    }
+    configurar_otimizacao(versao_original);
+    fprintf(tabela, "%d caso(s) medido(s), %d com saida fora de ordem\n", num_selecionados, falhas);
+
+    int erro = 0;
+    if (opcoes->arquivo_json) {
+        FILE *arquivo = strcmp(opcoes->arquivo_json, "-") == 0 ? stdout : fopen(opcoes->arquivo_json, "w");
+        if (arquivo) {
+            escrever_json(arquivo, resultados, num_selecionados, opcoes);
+            if (arquivo != stdout) fclose(arquivo);
+        } else {
+            fprintf(stderr, "ERRO: nao foi possivel criar %s\n", opcoes->arquivo_json);
+            erro = 1;
+        }
+    }
+
+    free(resultados);
+    free(selecionados);
+    return erro ? -1 : falhas;
+}
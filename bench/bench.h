@@ -0,0 +1,140 @@
+/**
+ * ==============================================================
+ * FRAMEWORK DE MICRO-BENCHMARK
+ * ==============================================================
+ *
+ * @file bench.h
+ * @brief Registro de casos, filtro por regex, repetições e saída JSON
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Mede os algoritmos isoladamente, fora do relatório interativo. Cada
+ * caso é uma combinação (algoritmo × versão × distribuição × tipo de
+ * elemento × tamanho) com um nome hierárquico:
+ *
+ *   quick/otimizada/aleatorios/int/10000
+ *   insertion/didatica/crescentes/aluno/1000
+ *   qsort/libc/aleatorios/int/10000        (referência, referencias.h)
+ *
+ * O filtro é uma expressão regular estendida POSIX aplicada ao nome
+ * (ex.: "^(quick|heap)/otimizada/aleatorios/int/"). Sem <regex.h> (Windows), o
+ * filtro vira busca por substring.
+ *
+ * Cada caso gera a entrada uma vez, descarta as execuções de aquecimento
+ * e mede as repetições com o cronômetro de ciclos (cronometro.h); a saída
+ * de cada caso é conferida (ordenação correta) ao final.
+ *
+ * O caso do qsort com a mesma distribuição, tipo e tamanho entra sempre na
+ * seleção, mesmo fora do filtro, e é medido antes: cada linha informa a
+ * aceleração sobre ele (mediana do qsort / mediana do caso).
+ *
+ * ==============================================================
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "sorts.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_CASOS_BENCH 1024        ///< Casos registrados
+#define REPETICOES_BENCH_PADRAO 5   ///< Repetições medidas por caso
+#define AQUECIMENTO_BENCH_PADRAO 1  ///< Execuções descartadas antes de medir
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Tipo dos elementos ordenados
+ */
+typedef enum {
+    TIPO_BENCH_INT = 0,  ///< int com comparar_inteiros
+    TIPO_BENCH_ALUNO,    ///< Aluno (220 bytes) com comparar_alunos
+    NUM_TIPOS_BENCH
+} TipoElementoBench;
+
+/**
+ * @brief Um caso registrado
+ */
+typedef struct {
+    char nome[96];                  ///< algoritmo/versao/distribuicao/tipo/n
+    int indice_algoritmo;           ///< Índice em obter_info_motor() (referências incluídas)
+    int otimizada;                  ///< 1 = versão otimizada, 0 = didática (ignorado nas referências)
+    DistribuicaoDados distribuicao;
+    TipoElementoBench tipo;
+    int tamanho;
+} CasoBench;
+
+/**
+ * @brief Parâmetros de uma execução do benchmark
+ */
+typedef struct {
+    const char *filtro;         ///< Regex sobre o nome do caso (NULL = todos)
+    int repeticoes;             ///< Execuções medidas por caso
+    int aquecimento;            ///< Execuções descartadas por caso
+    uint64_t semente;           ///< Semente do gerador de entradas
+    const char *arquivo_json;   ///< Caminho do JSON ("-" = saída padrão, NULL = nenhum)
+    int apenas_listar;          ///< 1 para só listar os casos selecionados
+    uint64_t custo_comparacao;  ///< Ticks extras por comparação (custo.h), 0 = nenhum
+} OpcoesBench;
+
+/**
+ * @brief Medição de um caso
+ */
+typedef struct {
+    const CasoBench *caso;
+    int repeticoes;
+    double minimo;          ///< Segundos
+    double mediana;
+    double media;
+    double maximo;
+    double desvio;          ///< Desvio padrão amostral
+    long long comparacoes;  ///< De uma única ordenação
+    long long movimentacoes;
+    long long bytes_lidos;  ///< movimentacoes × elem_size (banda.h)
+    long long bytes_escritos;
+    double banda;           ///< GB/s na mediana (0 = sem bytes conhecidos)
+    int ordenado;           ///< 1 se a saída conferiu
+    double aceleracao_qsort;///< Mediana do qsort / mediana do caso (0 = sem referência)
+} ResultadoBench;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Opções padrão (todos os casos, 5 repetições, 1 aquecimento)
+ */
+OpcoesBench opcoes_bench_padrao(void);
+
+/**
+ * @brief Registra um caso; o nome é montado a partir dos campos
+ *
+ * @return 0 em caso de sucesso, -1 se o registro estiver cheio ou o motor
+ *         não aceitar o tipo (motor_aceita_dados)
+ */
+int bench_registrar(int indice_algoritmo, int otimizada, DistribuicaoDados distribuicao,
+                    TipoElementoBench tipo, int tamanho);
+
+/**
+ * @brief Quantidade de casos registrados
+ */
+int bench_num_casos(void);
+
+/**
+ * @brief Nome curto de um tipo de elemento ("int", "aluno")
+ */
+const char* nome_tipo_bench(TipoElementoBench tipo);
+
+/**
+ * @brief Executa (ou lista) os casos que passam no filtro
+ *
+ * @return Casos cuja saída não ficou ordenada, ou -1 em erro de uso
+ *         (filtro inválido, JSON impossível de criar)
+ */
+int bench_executar(const OpcoesBench *opcoes);
+
+#endif // BENCH_H
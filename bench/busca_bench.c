@@ -0,0 +1,571 @@
+/**
+ * ==============================================================
+ * BUSCA_BENCH - BENCHMARK DAS ESTRUTURAS DE PESQUISA
+ * ==============================================================
+ *
+ * @file busca_bench.c
+ * @brief ns por consulta das buscas de busca.h, do L1 até além da LLC
+ *
+ * Os tamanhos vêm da hierarquia da máquina (configuracao_cache_padrao,
+ * simulador.h): metade do L1, metade do L2, metade da LLC e 4× a LLC,
+ * para que cada estrutura seja medida com os dados em cada nível. Cada
+ * caso tem um nome hierárquico:
+ *
+ *   eytzinger/lote/llc/4194304       (estrutura/modo/nivel/n)
+ *   arvore_b/unitaria/l1/6144
+ *
+ * Uso:
+ *   busca_bench [--filtro REGEX] [--repeticoes N] [--aquecimento N]
+ *               [--json ARQUIVO|-] [--listar] [--smoke]
+ *
+ * Exemplos:
+ *   busca_bench --smoke                       # n pequenos, confere tudo
+ *   busca_bench --filtro '/ram/' --json busca.json
+ *   busca_bench --filtro '^(binaria|eytzinger)/lote/'
+ *
+ *  CICLO DE UM CASO:
+ * ┌──────────────────┐   ┌──────────────────┐   ┌──────────────────┐   ┌──────────────┐
+ * │ chaves crescentes│ → │ constrói a       │ → │ NUM_CONSULTAS    │ → │ confere cada │
+ * │ (repetidas, com  │   │ estrutura (tempo │   │ consultas por    │   │ resultado    │
+ * │ INT_MIN/INT_MAX) │   │ medido à parte)  │   │ repetição        │   │ com uma      │
+ * │ e consultas      │   │                  │   │                  │   │ varredura    │
+ * └──────────────────┘   └──────────────────┘   └──────────────────┘   └──────────────┘
+ *
+ * O tamanho "ram" é limitado a MAXIMO_ELEMENTOS_BUSCA: com LLCs muito
+ * grandes ele pode não passar da LLC (o contexto do JSON traz a LLC).
+ *
+ * Código de saída: 0 se todos os resultados conferiram, 1 se algum
+ * divergiu da varredura (ou a estrutura não coube na memória),
+ * 2 em erro de uso.
+ *
+ * ==============================================================
+ */
+
+#include "sorts.h"
+#include <string.h>  // Para strcmp, strstr, memset
+#include <stdlib.h>  // Para strtol
+#include <math.h>    // Para sqrt
+#include <limits.h>  // Para INT_MIN e INT_MAX
+
+#if defined(__has_include)
+    #if __has_include(<regex.h>)
+        #include <regex.h>
+        #define BUSCA_BENCH_TEM_REGEX 1
+    #endif
+#endif
+
+/* ==============================================================
+ * CONSTANTES E ESTRUTURAS
+ * ============================================================== */
+
+#define MAX_CASOS_BUSCA 64
+#define NUM_CONSULTAS (1 << 20)             ///< Consultas por repetição
+#define MAXIMO_ELEMENTOS_BUSCA (1 << 26)    ///< 256 MB de chaves: limite do tamanho "ram"
+#define REPETICOES_BUSCA_PADRAO 5
+#define AQUECIMENTO_BUSCA_PADRAO 1
+#define SEMENTE_BUSCA 0x5EA2C42025ULL
+
+typedef enum {
+    ESTRUTURA_BINARIA = 0,
+    ESTRUTURA_EYTZINGER,
+    ESTRUTURA_ARVORE_B,
+    NUM_ESTRUTURAS
+} EstruturaBusca;
+
+/**
+ * @brief Um caso registrado
+ */
+typedef struct {
+    char nome[80];            ///< estrutura/modo/nivel/n
+    EstruturaBusca estrutura;
+    int lote;                 ///< 1 = buscas intercaladas (*_lote)
+    const char *nivel;        ///< "l1", "l2", "llc", "ram" (ou "smoke")
+    int tamanho;              ///< Chaves na estrutura
+} CasoBusca;
+
+/**
+ * @brief Medição de um caso
+ */
+typedef struct {
+    const CasoBusca *caso;
+    int repeticoes;
+    double construcao;        ///< Segundos para construir a estrutura
+    double minimo;            ///< Segundos por repetição (NUM_CONSULTAS consultas)
+    double mediana;
+    double desvio;
+    double ns_consulta;       ///< mediana / NUM_CONSULTAS, em ns
+    double consultas_s;
+    int ok;                   ///< 1 se todos os resultados bateram com a varredura
+} ResultadoBusca;
+
+/**
+ * @brief Consulta com a sua posição original (oráculo por varredura)
+ */
+typedef struct {
+    int valor;
+    int indice;
+} ConsultaIndexada;
+
+typedef struct {
+    const char *filtro;
+    int repeticoes;
+    int aquecimento;
+    const char *arquivo_json;
+    int apenas_listar;
+} OpcoesBusca;
+
+/* ==============================================================
+ * ESTADO
+ * ============================================================== */
+
+static const char *const NOMES_ESTRUTURAS[NUM_ESTRUTURAS] = { "binaria", "eytzinger", "arvore_b" };
+
+static CasoBusca casos_busca[MAX_CASOS_BUSCA];
+static int num_casos_busca = 0;
+
+/* ==============================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ============================================================== */
+
+static void registrar_caso(EstruturaBusca estrutura, int lote, const char *nivel, int tamanho);
+static void registrar_casos(int smoke);
+static void gerar_chaves_busca(int *ordenado, int *consultas, int n);
+static int comparar_consultas(const void *a, const void *b);
+static int calcular_esperados(const int *ordenado, int n, const int *consultas, int *esperados);
+static void executar_consultas(const CasoBusca *caso, const int *ordenado, const IndiceEytzinger *eytzinger,
+                               const IndiceArvoreB *arvore, const int *consultas, int *resultados);
+static int comparar_double(const void *a, const void *b);
+static ResultadoBusca medir_caso(const CasoBusca *caso, const OpcoesBusca *opcoes);
+static void escrever_json(FILE *arquivo, const ResultadoBusca *resultados, int num_resultados,
+                          const OpcoesBusca *opcoes);
+static int executar_casos(const OpcoesBusca *opcoes);
+static void imprimir_uso(const char *programa);
+
+/* ==============================================================
+ * CASOS REGISTRADOS
+ * ============================================================== */
+
+static void registrar_caso(EstruturaBusca estrutura, int lote, const char *nivel, int tamanho) {
+    if (num_casos_busca >= MAX_CASOS_BUSCA || tamanho <= 0) return;
+    CasoBusca *caso = &casos_busca[num_casos_busca++];
+    caso->estrutura = estrutura;
+    caso->lote = lote;
+    caso->nivel = nivel;
+    caso->tamanho = tamanho;
+    snprintf(caso->nome, sizeof(caso->nome), "%s/%s/%s/%d", NOMES_ESTRUTURAS[estrutura],
+             lote ? "lote" : "unitaria", nivel, tamanho);
+}
+
+/**
+ * @brief Estrutura × modo × tamanho; os tamanhos seguem a hierarquia de cache
+ */
+static void registrar_casos(int smoke) {
+    const char *niveis[4];
+    int tamanhos[4];
+    int num_tamanhos = 0;
+
+    if (smoke) {
+        // Bordas dos layouts (1 nó, camada incompleta) e tamanhos médios; o
+        // vazio é conferido junto do caso n = 1 (medir_caso)
+        static const int tamanhos_smoke[] = { 1, 15, 17, 1000, 100000 };
+        for (int e = 0; e < NUM_ESTRUTURAS; e++) {
+            for (int lote = 0; lote <= 1; lote++) {
+                for (int t = 0; t < (int)(sizeof(tamanhos_smoke) / sizeof(tamanhos_smoke[0])); t++) {
+                    registrar_caso((EstruturaBusca)e, lote, "smoke", tamanhos_smoke[t]);
+                }
+            }
+        }
+        return;
+    }
+
+    ConfiguracaoCache cache = configuracao_cache_padrao();
+    size_t bytes[4] = {
+        cache.niveis[0].tamanho / 2, cache.niveis[1].tamanho / 2,
+        cache.niveis[2].tamanho / 2, cache.niveis[2].tamanho * 4
+    };
+    static const char *const rotulos[4] = { "l1", "l2", "llc", "ram" };
+    for (int i = 0; i < 4; i++) {
+        size_t elementos = bytes[i] / sizeof(int);
+        if (elementos > MAXIMO_ELEMENTOS_BUSCA) elementos = MAXIMO_ELEMENTOS_BUSCA;
+        if (num_tamanhos > 0 && (int)elementos <= tamanhos[num_tamanhos - 1]) continue;  // Limite atingido
+        niveis[num_tamanhos] = rotulos[i];
+        tamanhos[num_tamanhos++] = (int)elementos;
+    }
+
+    for (int e = 0; e < NUM_ESTRUTURAS; e++) {
+        for (int lote = 0; lote <= 1; lote++) {
+            for (int t = 0; t < num_tamanhos; t++) registrar_caso((EstruturaBusca)e, lote, niveis[t], tamanhos[t]);
+        }
+    }
+}
+
+/* ==============================================================
+ * ENTRADAS
+ * ============================================================== */
+
+/**
+ * @brief Chaves crescentes (passos de 0 a 3) e NUM_CONSULTAS consultas
+ *
+ * O passo 0 repete a chave: o limite inferior tem de achar a primeira
+ * cópia. A partir de n = 3 as pontas são INT_MIN e INT_MAX (repetidas a
+ * partir de n = 4); INT_MAX é também o preenchimento da árvore B+.
+ * Metade das consultas é uma chave presente, 3/8 são um valor qualquer
+ * do intervalo (inclusive além das pontas) e 1/8 são extremos de int.
+ */
+static void gerar_chaves_busca(int *ordenado, int *consultas, int n) {
+    static const int extremos[4] = { INT_MIN, INT_MIN + 1, INT_MAX - 1, INT_MAX };
+    uint64_t estado = SEMENTE_BUSCA ^ (uint64_t)n;
+    int valor = -1;
+    for (int i = 0; i < n; i++) {
+        valor += (int)(gerador_proximo(&estado) % 4);
+        ordenado[i] = valor;
+    }
+    if (n >= 3) {
+        for (int i = 0; i < (n >= 4 ? 2 : 1); i++) {
+            ordenado[i] = INT_MIN;
+            ordenado[n - 1 - i] = INT_MAX;
+        }
+    }
+    for (int i = 0; i < NUM_CONSULTAS; i++) {
+        uint64_t r = gerador_proximo(&estado);
+        if (r % 8 < 4 && n > 0) consultas[i] = ordenado[(r >> 3) % (uint64_t)n];
+        else if (r % 8 < 7) consultas[i] = (int)((r >> 3) % ((uint64_t)(valor + 2) + 3)) - 2;
+        else consultas[i] = extremos[(r >> 3) % 4];
+    }
+}
+
+static int comparar_consultas(const void *a, const void *b) {
+    int x = ((const ConsultaIndexada*)a)->valor, y = ((const ConsultaIndexada*)b)->valor;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Limites inferiores esperados, sem nenhuma das buscas medidas
+ *
+ * As consultas são visitadas em ordem crescente e um único cursor
+ * percorre o vetor: O(n + q log q) em vez de n × q comparações.
+ *
+ * @return 0 em sucesso, -1 sem memória
+ */
+static int calcular_esperados(const int *ordenado, int n, const int *consultas, int *esperados) {
+    ConsultaIndexada *ordem = malloc((size_t)NUM_CONSULTAS * sizeof(ConsultaIndexada));
+    if (!ordem) return -1;
+    for (int i = 0; i < NUM_CONSULTAS; i++) {
+        ordem[i].valor = consultas[i];
+        ordem[i].indice = i;
+    }
+    qsort(ordem, NUM_CONSULTAS, sizeof(ConsultaIndexada), comparar_consultas);
+
+    int cursor = 0;  // Chaves em [0, cursor) são menores que a consulta atual
+    for (int i = 0; i < NUM_CONSULTAS; i++) {
+        while (cursor < n && ordenado[cursor] < ordem[i].valor) cursor++;
+        esperados[ordem[i].indice] = cursor;
+    }
+    free(ordem);
+    return 0;
+}
+
+/* ==============================================================
+ * MEDIÇÃO
+ * ============================================================== */
+
+static void executar_consultas(const CasoBusca *caso, const int *ordenado, const IndiceEytzinger *eytzinger,
+                               const IndiceArvoreB *arvore, const int *consultas, int *resultados) {
+    int n = caso->tamanho;
+    switch (caso->estrutura) {
+        case ESTRUTURA_EYTZINGER:
+            if (caso->lote) buscar_eytzinger_lote(eytzinger, consultas, NUM_CONSULTAS, resultados);
+            else for (int i = 0; i < NUM_CONSULTAS; i++) resultados[i] = buscar_eytzinger(eytzinger, consultas[i]);
+            break;
+        case ESTRUTURA_ARVORE_B:
+            if (caso->lote) buscar_arvore_b_lote(arvore, consultas, NUM_CONSULTAS, resultados);
+            else for (int i = 0; i < NUM_CONSULTAS; i++) resultados[i] = buscar_arvore_b(arvore, consultas[i]);
+            break;
+        case ESTRUTURA_BINARIA:
+        default:
+            if (caso->lote) busca_binaria_lote(ordenado, n, consultas, NUM_CONSULTAS, resultados);
+            else for (int i = 0; i < NUM_CONSULTAS; i++) resultados[i] = busca_binaria(ordenado, n, consultas[i]);
+            break;
+    }
+}
+
+static int comparar_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static ResultadoBusca medir_caso(const CasoBusca *caso, const OpcoesBusca *opcoes) {
+    ResultadoBusca resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    resultado.caso = caso;
+
+    int n = caso->tamanho;
+    int *ordenado = malloc((size_t)n * sizeof(int));
+    int *consultas = malloc((size_t)NUM_CONSULTAS * sizeof(int));
+    int *resultados = malloc((size_t)NUM_CONSULTAS * sizeof(int));
+    double *tempos = malloc((size_t)opcoes->repeticoes * sizeof(double));
+    IndiceEytzinger eytzinger = { NULL, NULL, 0 };
+    IndiceArvoreB arvore;
+    memset(&arvore, 0, sizeof(arvore));
+    int construido = 0;
+
+    if (ordenado && consultas && resultados && tempos) {
+        gerar_chaves_busca(ordenado, consultas, n);
+
+        uint64_t inicio = cronometro_iniciar();
+        if (caso->estrutura == ESTRUTURA_EYTZINGER) construido = construir_eytzinger(&eytzinger, ordenado, n) == 0;
+        else if (caso->estrutura == ESTRUTURA_ARVORE_B) construido = construir_arvore_b(&arvore, ordenado, n) == 0;
+        else construido = 1;  // A busca binária usa o próprio vetor
+        uint64_t fim = cronometro_parar();
+        resultado.construcao = ticks_para_segundos(cronometro_decorrido(inicio, fim));
+    }
+    if (!construido) {
+        fprintf(stderr, "ERRO: memoria insuficiente para %s\n", caso->nome);
+        liberar_eytzinger(&eytzinger);
+        liberar_arvore_b(&arvore);
+        free(ordenado);
+        free(consultas);
+        free(resultados);
+        free(tempos);
+        return resultado;
+    }
+
+    for (int i = 0; i < opcoes->aquecimento + opcoes->repeticoes; i++) {
+        uint64_t inicio = cronometro_iniciar();
+        executar_consultas(caso, ordenado, &eytzinger, &arvore, consultas, resultados);
+        uint64_t fim = cronometro_parar();
+        if (i >= opcoes->aquecimento) {
+            tempos[i - opcoes->aquecimento] = ticks_para_segundos(cronometro_decorrido(inicio, fim));
+        }
+    }
+
+    // Oráculo: varredura do vetor (fora da região cronometrada), independente das três buscas
+    int *esperados = malloc((size_t)NUM_CONSULTAS * sizeof(int));
+    resultado.ok = esperados && calcular_esperados(ordenado, n, consultas, esperados) == 0;
+    if (!resultado.ok) fprintf(stderr, "ERRO: memoria insuficiente para conferir %s\n", caso->nome);
+    for (int i = 0; resultado.ok && i < NUM_CONSULTAS; i++) {
+        if (resultados[i] != esperados[i]) {
+            fprintf(stderr, "FALHA %s: consulta %d = %d, esperado %d\n", caso->nome,
+                    consultas[i], resultados[i], esperados[i]);
+            resultado.ok = 0;
+        }
+    }
+    free(esperados);
+    if (n == 1) {
+        // Estruturas vazias: toda busca devolve 0
+        IndiceEytzinger vazio_e;
+        IndiceArvoreB vazio_b;
+        if (construir_eytzinger(&vazio_e, ordenado, 0) != 0 || construir_arvore_b(&vazio_b, ordenado, 0) != 0) {
+            resultado.ok = 0;
+        } else {
+            if (buscar_eytzinger(&vazio_e, consultas[0]) != 0 || buscar_arvore_b(&vazio_b, consultas[0]) != 0 ||
+                busca_binaria(ordenado, 0, consultas[0]) != 0) {
+                resultado.ok = 0;
+            }
+            liberar_eytzinger(&vazio_e);
+            liberar_arvore_b(&vazio_b);
+        }
+    }
+
+    resultado.repeticoes = opcoes->repeticoes;
+    double soma = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) soma += tempos[i];
+    double media = soma / opcoes->repeticoes;
+    double quadrados = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) quadrados += (tempos[i] - media) * (tempos[i] - media);
+    resultado.desvio = opcoes->repeticoes > 1 ? sqrt(quadrados / (opcoes->repeticoes - 1)) : 0.0;
+
+    qsort(tempos, (size_t)opcoes->repeticoes, sizeof(double), comparar_double);
+    resultado.minimo = tempos[0];
+    int meio = opcoes->repeticoes / 2;
+    resultado.mediana = (opcoes->repeticoes % 2) ? tempos[meio] : (tempos[meio - 1] + tempos[meio]) / 2.0;
+    if (resultado.mediana > 0.0) {
+        resultado.ns_consulta = resultado.mediana / NUM_CONSULTAS * 1e9;
+        resultado.consultas_s = NUM_CONSULTAS / resultado.mediana;
+    }
+
+    liberar_eytzinger(&eytzinger);
+    liberar_arvore_b(&arvore);
+    free(ordenado);
+    free(consultas);
+    free(resultados);
+    free(tempos);
+    return resultado;
+}
+
+/* ==============================================================
+ * SAÍDA JSON
+ * ============================================================== */
+
+static void escrever_json(FILE *arquivo, const ResultadoBusca *resultados, int num_resultados,
+                          const OpcoesBusca *opcoes) {
+    char cronometro[96];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+    ConfiguracaoCache cache = configuracao_cache_padrao();
+
+    fprintf(arquivo, "{\n");
+    fprintf(arquivo, "  \"contexto\": {\n");
+    fprintf(arquivo, "    \"cronometro\": \"%s\",\n", cronometro);
+    fprintf(arquivo, "    \"repeticoes\": %d,\n", opcoes->repeticoes);
+    fprintf(arquivo, "    \"aquecimento\": %d,\n", opcoes->aquecimento);
+    fprintf(arquivo, "    \"consultas\": %d,\n", NUM_CONSULTAS);
+    fprintf(arquivo, "    \"lote\": %d,\n", LOTE_BUSCA);
+    fprintf(arquivo, "    \"l1_bytes\": %zu,\n", cache.niveis[0].tamanho);
+    fprintf(arquivo, "    \"l2_bytes\": %zu,\n", cache.niveis[1].tamanho);
+    fprintf(arquivo, "    \"llc_bytes\": %zu\n", cache.niveis[2].tamanho);
+    fprintf(arquivo, "  },\n");
+    fprintf(arquivo, "  \"casos\": [\n");
+    for (int i = 0; i < num_resultados; i++) {
+        const ResultadoBusca *r = &resultados[i];
+        const CasoBusca *c = r->caso;
+        fprintf(arquivo, "    {\"nome\": \"%s\", \"estrutura\": \"%s\", \"modo\": \"%s\", \"nivel\": \"%s\", "
+                         "\"n\": %d, \"repeticoes\": %d, \"construcao_s\": %.9f, \"min_s\": %.9f, "
+                         "\"mediana_s\": %.9f, \"desvio_s\": %.9f, \"ns_consulta\": %.3f, "
+                         "\"consultas_s\": %.1f, \"ok\": %s}%s\n",
+                c->nome, NOMES_ESTRUTURAS[c->estrutura], c->lote ? "lote" : "unitaria", c->nivel,
+                c->tamanho, r->repeticoes, r->construcao, r->minimo, r->mediana, r->desvio,
+                r->ns_consulta, r->consultas_s, r->ok ? "true" : "false",
+                i + 1 < num_resultados ? "," : "");
+    }
+    fprintf(arquivo, "  ]\n");
+    fprintf(arquivo, "}\n");
+}
+
+/* ==============================================================
+ * EXECUÇÃO
+ * ============================================================== */
+
+static int executar_casos(const OpcoesBusca *opcoes) {
+#ifdef BUSCA_BENCH_TEM_REGEX
+    regex_t expressao;
+    int usar_regex = opcoes->filtro && opcoes->filtro[0];
+    if (usar_regex && regcomp(&expressao, opcoes->filtro, REG_EXTENDED | REG_NOSUB) != 0) {
+        fprintf(stderr, "ERRO: filtro invalido: %s\n", opcoes->filtro);
+        return -1;
+    }
+#endif
+
+    int selecionados[MAX_CASOS_BUSCA];
+    int num_selecionados = 0;
+    for (int i = 0; i < num_casos_busca; i++) {
+        int passa = 1;
+#ifdef BUSCA_BENCH_TEM_REGEX
+        if (usar_regex) passa = regexec(&expressao, casos_busca[i].nome, 0, NULL, 0) == 0;
+#else
+        if (opcoes->filtro && opcoes->filtro[0]) passa = strstr(casos_busca[i].nome, opcoes->filtro) != NULL;
+#endif
+        if (passa) selecionados[num_selecionados++] = i;
+    }
+#ifdef BUSCA_BENCH_TEM_REGEX
+    if (usar_regex) regfree(&expressao);
+#endif
+
+    if (opcoes->apenas_listar) {
+        for (int i = 0; i < num_selecionados; i++) printf("%s\n", casos_busca[selecionados[i]].nome);
+        return 0;
+    }
+
+    ResultadoBusca *resultados = calloc((size_t)(num_selecionados > 0 ? num_selecionados : 1),
+                                        sizeof(ResultadoBusca));
+    if (!resultados) return -1;
+
+    // Com JSON na saída padrão, a tabela vai para stderr
+    FILE *tabela = (opcoes->arquivo_json && strcmp(opcoes->arquivo_json, "-") == 0) ? stderr : stdout;
+    int falhas = 0;
+
+    fprintf(tabela, "%-36s %12s %12s %12s %10s %14s %s\n",
+            "Caso", "Mediana (s)", "Min (s)", "Construcao", "ns/busca", "Buscas/s", "OK");
+    for (int i = 0; i < num_selecionados; i++) {
+        const CasoBusca *caso = &casos_busca[selecionados[i]];
+        resultados[i] = medir_caso(caso, opcoes);
+        if (!resultados[i].ok) falhas++;
+        fprintf(tabela, "%-36s %12.6f %12.6f %12.6f %10.2f %14.0f %s\n", caso->nome,
+                resultados[i].mediana, resultados[i].minimo, resultados[i].construcao,
+                resultados[i].ns_consulta, resultados[i].consultas_s, resultados[i].ok ? "sim" : "NAO");
+        fflush(tabela);
+    }
+    fprintf(tabela, "%d caso(s) medido(s), %d com falha\n", num_selecionados, falhas);
+
+    if (opcoes->arquivo_json) {
+        FILE *arquivo = strcmp(opcoes->arquivo_json, "-") == 0 ? stdout : fopen(opcoes->arquivo_json, "w");
+        if (!arquivo) {
+            fprintf(stderr, "ERRO: nao foi possivel criar %s\n", opcoes->arquivo_json);
+            free(resultados);
+            return -1;
+        }
+        escrever_json(arquivo, resultados, num_selecionados, opcoes);
+        if (arquivo != stdout) fclose(arquivo);
+    }
+
+    free(resultados);
+    return falhas;
+}
+
+/* ==============================================================
+ * LINHA DE COMANDO
+ * ============================================================== */
+
+static void imprimir_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [--filtro REGEX] [--repeticoes N] [--aquecimento N]\n"
+            "       [--json ARQUIVO|-] [--listar] [--smoke]\n"
+            "  Casos: estrutura/modo/nivel/n (ex.: eytzinger/lote/llc/4194304)\n"
+            "  Estruturas: binaria, eytzinger, arvore_b; modos: unitaria, lote\n"
+            "  --smoke: n de 0 a 100000, 1 repeticao, sem aquecimento\n",
+            programa);
+}
+
+int main(int argc, char **argv) {
+    OpcoesBusca opcoes;
+    opcoes.filtro = NULL;
+    opcoes.repeticoes = REPETICOES_BUSCA_PADRAO;
+    opcoes.aquecimento = AQUECIMENTO_BUSCA_PADRAO;
+    opcoes.arquivo_json = NULL;
+    opcoes.apenas_listar = 0;
+    int smoke = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opcao = argv[i];
+        int com_valor = strcmp(opcao, "--filtro") == 0 || strcmp(opcao, "--repeticoes") == 0 ||
+                        strcmp(opcao, "--aquecimento") == 0 || strcmp(opcao, "--json") == 0;
+
+        if (com_valor) {
+            if (i + 1 >= argc) {
+                imprimir_uso(argv[0]);
+                return 2;
+            }
+            const char *valor = argv[++i];
+            if (strcmp(opcao, "--filtro") == 0)           opcoes.filtro = valor;
+            else if (strcmp(opcao, "--repeticoes") == 0)  opcoes.repeticoes = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--aquecimento") == 0) opcoes.aquecimento = (int)strtol(valor, NULL, 10);
+            else                                          opcoes.arquivo_json = valor;  // --json
+        } else if (strcmp(opcao, "--listar") == 0) {
+            opcoes.apenas_listar = 1;
+        } else if (strcmp(opcao, "--smoke") == 0) {
+            smoke = 1;
+        } else if (strcmp(opcao, "--ajuda") == 0 || strcmp(opcao, "-h") == 0) {
+            imprimir_uso(argv[0]);
+            return 0;
+        } else {
+            fprintf(stderr, "ERRO: opcao desconhecida: %s\n", opcao);
+            imprimir_uso(argv[0]);
+            return 2;
+        }
+    }
+
+    if (smoke) {
+        opcoes.repeticoes = 1;
+        opcoes.aquecimento = 0;
+    }
+    if (opcoes.repeticoes <= 0 || opcoes.aquecimento < 0) {
+        fprintf(stderr, "ERRO: repeticoes deve ser > 0 e aquecimento >= 0\n");
+        return 2;
+    }
+
+    inicializar_cronometro();
+    registrar_casos(smoke);
+
+    int falhas = executar_casos(&opcoes);
+    if (falhas < 0) return 2;
+    return falhas > 0 ? 1 : 0;
+}
@@ -0,0 +1,777 @@
+/**
+ * ==============================================================
+ * IO_BENCH - BENCHMARK DE LEITURA E GRAVAÇÃO
+ * ==============================================================
+ *
+ * @file io_bench.c
+ * @brief MB/s e registros/s dos leitores e gravadores de io.c e utils.c
+ *
+ * O sort_bench cobre os algoritmos; a E/S (ler_numeros, ler_alunos,
+ * salvar_numeros, salvar_alunos, salvar_arquivo_multiplos_locais) não
+ * tinha medição nenhuma. Cada caso tem um nome hierárquico:
+ *
+ *   ler_numeros/numeros/100000/4t/fria      (leitura, page cache descartado)
+ *   ler_alunos/pessoas/10000/1t/quente      (leitura, arquivo em cache)
+ *   salvar_multiplos/alunos/100000/2t       (gravação)
+ *
+ * Uso:
+ *   io_bench [--filtro REGEX] [--repeticoes N] [--aquecimento N]
+ *            [--json ARQUIVO|-] [--listar] [--smoke] [--dir DIR]
+ *
+ * Exemplos:
+ *   io_bench --smoke                          # n = 1000, 1 e 2 threads
+ *   io_bench --filtro '^ler_numeros/.+fria$' --json io.json
+ *   io_bench --dir /mnt/ssd/io_bench          # entradas em outro disco
+ *
+ *  CICLO DE UM CASO:
+ * ┌──────────────────┐   ┌──────────────────┐   ┌──────────────────┐   ┌──────────────┐
+ * │ entradas: um     │ → │ fria: fadvise    │ → │ T threads, cada  │ → │ confere a    │
+ * │ arquivo por      │   │ DONTNEED em cada │   │ uma com o seu    │   │ contagem e o │
+ * │ thread (fsync)   │   │ arquivo          │   │ arquivo; mede o  │   │ arquivo      │
+ * │                  │   │                  │   │ tempo total      │   │ gravado      │
+ * └──────────────────┘   └──────────────────┘   └──────────────────┘   └──────────────┘
+ *
+ * Formatos: "numeros" (contagem + um inteiro por linha, como data/),
+ * "alunos" (nome,data,bairro,cidade, como salvar_alunos grava) e
+ * "pessoas" (contagem + nome,sexo,data,cidade, como
+ * registros_pessoas_1000.txt).
+ *
+ * As mensagens que as funções de E/S imprimem vão para /dev/null
+ * durante a medição (fora da região cronometrada). Sem posix_fadvise
+ * (macOS, Windows) os casos "fria" não são registrados; sem pthreads,
+ * só 1 thread. Em tmpfs o descarte não tem efeito: use --dir em um disco.
+ *
+ * Código de saída: 0 se tudo conferiu, 1 se alguma leitura devolveu
+ * contagem errada ou algum arquivo não foi gravado, 2 em erro de uso.
+ *
+ * ==============================================================
+ */
+
+#if defined(__linux__)
+    #define _GNU_SOURCE      // Para posix_fadvise, fsync e dup com -std=c17
+#endif
+
+#include "sorts.h"
+#include <string.h>  // Para strcmp, strstr, memset
+#include <stdlib.h>  // Para strtol
+#include <math.h>    // Para sqrt
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <pthread.h>
+    #define IO_BENCH_POSIX 1
+    #if defined(POSIX_FADV_DONTNEED)
+        #define IO_BENCH_DESCARTE 1
+    #endif
+#endif
+
+#if defined(__has_include)
+    #if __has_include(<regex.h>)
+        #include <regex.h>
+        #define IO_BENCH_TEM_REGEX 1
+    #endif
+#endif
+
+/* ==============================================================
+ * CONSTANTES E ESTRUTURAS
+ * ============================================================== */
+
+#define MAX_CASOS_IO 256
+#define MAX_THREADS_IO 8
+#define MAX_ENTRADAS_IO 64          ///< Arquivos de entrada criados por execução
+#define REPETICOES_IO_PADRAO 5
+#define AQUECIMENTO_IO_PADRAO 1
+#define SEMENTE_IO 0x10BE2025ULL
+
+typedef enum {
+    OP_LER_NUMEROS = 0,
+    OP_LER_ALUNOS,
+    OP_SALVAR_NUMEROS,
+    OP_SALVAR_ALUNOS,
+    OP_SALVAR_MULTIPLOS,   ///< salvar_arquivo_multiplos_locais em relatorios/
+    NUM_OPERACOES_IO
+} OperacaoIO;
+
+typedef enum {
+    FORMATO_NUMEROS = 0,
+    FORMATO_ALUNOS,
+    FORMATO_PESSOAS
+} FormatoIO;
+
+/**
+ * @brief Um caso registrado
+ */
+typedef struct {
+    char nome[96];      ///< operacao/formato/n/Tt[/quente|fria]
+    OperacaoIO operacao;
+    FormatoIO formato;
+    int tamanho;        ///< Registros por arquivo
+    int threads;        ///< Arquivos processados simultaneamente
+    int fria;           ///< 1 = page cache descartado antes de cada leitura
+} CasoIO;
+
+/**
+ * @brief Medição de um caso
+ */
+typedef struct {
+    const CasoIO *caso;
+    int repeticoes;
+    double minimo;      ///< Segundos (todas as threads)
+    double mediana;
+    double media;
+    double maximo;
+    double desvio;
+    long long bytes;    ///< Bytes de arquivo por repetição (soma das threads)
+    double mb_s;        ///< bytes / mediana, em MB/s
+    double registros_s; ///< tamanho × threads / mediana
+    int ok;             ///< 1 se todas as contagens e arquivos conferiram
+} ResultadoIO;
+
+/**
+ * @brief Trabalho de uma thread em uma repetição
+ */
+typedef struct {
+    const CasoIO *caso;
+    const void *dados;        ///< Registros a gravar (gravadores)
+    char caminho[MAX_PATH];   ///< Entrada (leitores) ou nome do arquivo gravado
+    int processados;          ///< Registros lidos/gravados, -1 em falha
+} TrabalhoIO;
+
+typedef struct {
+    const char *filtro;
+    int repeticoes;
+    int aquecimento;
+    const char *arquivo_json;
+    int apenas_listar;
+    const char *diretorio;    ///< Onde ficam os arquivos de entrada
+} OpcoesIO;
+
+/* ==============================================================
+ * ESTADO
+ * ============================================================== */
+
+static const char *const NOMES_OPERACOES[NUM_OPERACOES_IO] = {
+    "ler_numeros", "ler_alunos", "salvar_numeros", "salvar_alunos", "salvar_multiplos"
+};
+static const char *const NOMES_FORMATOS[] = { "numeros", "alunos", "pessoas" };
+
+/// Onde cada gravador põe o arquivo (o primeiro local que todos tentam)
+static const char *const DESTINOS_GRAVACAO[NUM_OPERACOES_IO] = {
+    NULL, NULL, "output/numeros", "output/alunos", "output/relatorios"
+};
+
+static CasoIO casos_io[MAX_CASOS_IO];
+static int num_casos_io = 0;
+
+static char entradas_criadas[MAX_ENTRADAS_IO][MAX_PATH];
+static long long tamanhos_entradas[MAX_ENTRADAS_IO];
+static int num_entradas_criadas = 0;
+
+#ifdef IO_BENCH_POSIX
+static int saida_original = -1;
+#endif
+
+/* ==============================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ============================================================== */
+
+static int eh_leitura(OperacaoIO operacao);
+static void registrar_caso(OperacaoIO operacao, FormatoIO formato, int tamanho, int threads, int fria);
+static void registrar_casos(int smoke);
+static void gerar_aluno(Aluno *aluno, int indice, int chave);
+static long long preparar_entrada(const OpcoesIO *opcoes, FormatoIO formato, int tamanho,
+                                  int indice, char *caminho, size_t tamanho_caminho);
+static void* gerar_registros(FormatoIO formato, int tamanho);
+static long long tamanho_arquivo(const char *caminho);
+static int descartar_cache(const char *caminho);
+static void silenciar_saida(void);
+static void restaurar_saida(void);
+static void executar_trabalho(TrabalhoIO *trabalho);
+static void executar_threads(TrabalhoIO *trabalhos, int threads);
+static int comparar_double(const void *a, const void *b);
+static ResultadoIO medir_caso(const CasoIO *caso, const OpcoesIO *opcoes);
+static void escrever_json(FILE *arquivo, const ResultadoIO *resultados, int num_resultados,
+                          const OpcoesIO *opcoes);
+static int executar_casos(const OpcoesIO *opcoes);
+static void remover_entradas(void);
+static void imprimir_uso(const char *programa);
+
+/* ==============================================================
+ * CASOS REGISTRADOS
+ * ============================================================== */
+
+static const int tamanhos_numeros[] = { 10000, 100000, 1000000 };
+static const int tamanhos_alunos[] = { 10000, 100000 };   // 220 bytes por Aluno em memória
+static const int tamanhos_smoke[] = { 1000 };
+#ifdef IO_BENCH_POSIX
+static const int threads_completas[] = { 1, 2, 4 };
+static const int threads_smoke[] = { 1, 2 };
+#else
+static const int threads_completas[] = { 1 };
+static const int threads_smoke[] = { 1 };
+#endif
+
+static int eh_leitura(OperacaoIO operacao) {
+    return operacao == OP_LER_NUMEROS || operacao == OP_LER_ALUNOS;
+}
+
+static void registrar_caso(OperacaoIO operacao, FormatoIO formato, int tamanho, int threads, int fria) {
+    if (num_casos_io >= MAX_CASOS_IO) return;
+    CasoIO *caso = &casos_io[num_casos_io++];
+    caso->operacao = operacao;
+    caso->formato = formato;
+    caso->tamanho = tamanho;
+    caso->threads = threads;
+    caso->fria = fria;
+
+    int escrito = snprintf(caso->nome, sizeof(caso->nome), "%s/%s/%d/%dt",
+                           NOMES_OPERACOES[operacao], NOMES_FORMATOS[formato], tamanho, threads);
+    if (eh_leitura(operacao) && escrito > 0 && (size_t)escrito < sizeof(caso->nome)) {
+        snprintf(caso->nome + escrito, sizeof(caso->nome) - (size_t)escrito, "/%s",
+                 fria ? "fria" : "quente");
+    }
+}
+
+/**
+ * @brief Operação × formato × tamanho × threads (× cache, nas leituras)
+ */
+static void registrar_casos(int smoke) {
+    static const struct {
+        OperacaoIO operacao;
+        FormatoIO formato;
+    } COMBINACOES[] = {
+        { OP_LER_NUMEROS, FORMATO_NUMEROS },
+        { OP_LER_ALUNOS, FORMATO_ALUNOS },
+        { OP_LER_ALUNOS, FORMATO_PESSOAS },
+        { OP_SALVAR_NUMEROS, FORMATO_NUMEROS },
+        { OP_SALVAR_ALUNOS, FORMATO_ALUNOS },
+        { OP_SALVAR_MULTIPLOS, FORMATO_NUMEROS },
+        { OP_SALVAR_MULTIPLOS, FORMATO_ALUNOS },
+    };
+    const int *threads = smoke ? threads_smoke : threads_completas;
+    int num_threads = smoke ? (int)(sizeof(threads_smoke) / sizeof(threads_smoke[0]))
+                            : (int)(sizeof(threads_completas) / sizeof(threads_completas[0]));
+
+    for (size_t c = 0; c < sizeof(COMBINACOES) / sizeof(COMBINACOES[0]); c++) {
+        OperacaoIO operacao = COMBINACOES[c].operacao;
+        FormatoIO formato = COMBINACOES[c].formato;
+        const int *tamanhos = smoke ? tamanhos_smoke :
+                              formato == FORMATO_NUMEROS ? tamanhos_numeros : tamanhos_alunos;
+        int num_tamanhos = smoke ? (int)(sizeof(tamanhos_smoke) / sizeof(tamanhos_smoke[0])) :
+                           formato == FORMATO_NUMEROS
+                               ? (int)(sizeof(tamanhos_numeros) / sizeof(tamanhos_numeros[0]))
+                               : (int)(sizeof(tamanhos_alunos) / sizeof(tamanhos_alunos[0]));
+
+        for (int s = 0; s < num_tamanhos; s++) {
+            for (int t = 0; t < num_threads; t++) {
+                if (!eh_leitura(operacao)) {
+                    registrar_caso(operacao, formato, tamanhos[s], threads[t], 0);
+                    continue;
+                }
+                registrar_caso(operacao, formato, tamanhos[s], threads[t], 0);
+#ifdef IO_BENCH_DESCARTE
+                registrar_caso(operacao, formato, tamanhos[s], threads[t], 1);
+#endif
+            }
+        }
+    }
+}
+
+/* ==============================================================
+ * ENTRADAS
+ * ============================================================== */
+
+static void gerar_aluno(Aluno *aluno, int indice, int chave) {
+    snprintf(aluno->nome, sizeof(aluno->nome), "Aluno %08d", indice);
+    snprintf(aluno->data_nascimento, sizeof(aluno->data_nascimento), "01/01/2000");
+    snprintf(aluno->bairro, sizeof(aluno->bairro), "Bairro %010d", chave);
+    snprintf(aluno->cidade, sizeof(aluno->cidade), "Cidade");
+}
+
+/**
+ * @brief Arquivo de entrada de uma thread (criado uma vez por execução)
+ *
+ * Gravado com fsync: páginas sujas não saem do cache com DONTNEED.
+ *
+ * @return Tamanho em bytes, ou -1 em erro
+ */
+static long long preparar_entrada(const OpcoesIO *opcoes, FormatoIO formato, int tamanho,
+                                  int indice, char *caminho, size_t tamanho_caminho) {
+    snprintf(caminho, tamanho_caminho, "%s/io_bench_%s_%d_%d.txt", opcoes->diretorio,
+             NOMES_FORMATOS[formato], tamanho, indice);
+    for (int i = 0; i < num_entradas_criadas; i++) {
+        if (strcmp(entradas_criadas[i], caminho) == 0) return tamanhos_entradas[i];
+    }
+    if (num_entradas_criadas >= MAX_ENTRADAS_IO) return -1;
+
+    int *chaves = malloc((size_t)tamanho * sizeof(int));
+    FILE *arquivo = chaves ? fopen(caminho, "w") : NULL;
+    if (!arquivo) {
+        free(chaves);
+        return -1;
+    }
+    gerar_numeros(chaves, tamanho, DIST_ALEATORIA, SEMENTE_IO + (uint64_t)indice);
+
+    if (formato != FORMATO_ALUNOS) fprintf(arquivo, "%d\n", tamanho);
+    for (int i = 0; i < tamanho; i++) {
+        if (formato == FORMATO_NUMEROS) {
+            fprintf(arquivo, "%d\n", chaves[i]);
+        } else if (formato == FORMATO_ALUNOS) {
+            fprintf(arquivo, "Aluno %08d,01/01/2000,Bairro %010d,Cidade\n", i, chaves[i]);
+        } else {
+            fprintf(arquivo, "Pessoa %08d,%s,01/01/2000,Cidade %010d\n", i,
+                    (chaves[i] & 1) ? "feminino" : "masculino", chaves[i]);
+        }
+    }
+    free(chaves);
+
+    fflush(arquivo);
+#ifdef IO_BENCH_POSIX
+    fsync(fileno(arquivo));
+#endif
+    long long bytes = ftell(arquivo);
+    if (fclose(arquivo) != 0) bytes = -1;
+
+    snprintf(entradas_criadas[num_entradas_criadas], MAX_PATH, "%s", caminho);
+    tamanhos_entradas[num_entradas_criadas++] = bytes;
+    return bytes;
+}
+
+/**
+ * @brief Registros que os gravadores recebem (os mesmos para todas as threads)
+ */
+static void* gerar_registros(FormatoIO formato, int tamanho) {
+    int *chaves = malloc((size_t)tamanho * sizeof(int));
+    if (!chaves) return NULL;
+    gerar_numeros(chaves, tamanho, DIST_ALEATORIA, SEMENTE_IO);
+    if (formato == FORMATO_NUMEROS) return chaves;
+
+    Aluno *alunos = calloc((size_t)tamanho, sizeof(Aluno));
+    for (int i = 0; alunos && i < tamanho; i++) gerar_aluno(&alunos[i], i, chaves[i]);
+    free(chaves);
+    return alunos;
+}
+
+static void remover_entradas(void) {
+    for (int i = 0; i < num_entradas_criadas; i++) remove(entradas_criadas[i]);
+    num_entradas_criadas = 0;
+}
+
+static long long tamanho_arquivo(const char *caminho) {
+    FILE *arquivo = fopen(caminho, "rb");
+    if (!arquivo) return -1;
+    long long bytes = fseek(arquivo, 0, SEEK_END) == 0 ? ftell(arquivo) : -1;
+    fclose(arquivo);
+    return bytes;
+}
+
+/**
+ * @brief Tira o arquivo do page cache (posix_fadvise DONTNEED)
+ */
+static int descartar_cache(const char *caminho) {
+#ifdef IO_BENCH_DESCARTE
+    int fd = open(caminho, O_RDONLY);
+    if (fd < 0) return -1;
+    int status = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+    return status == 0 ? 0 : -1;
+#else
+    (void)caminho;
+    return -1;
+#endif
+}
+
+/* ==============================================================
+ * EXECUÇÃO DAS OPERAÇÕES
+ * ============================================================== */
+
+/// As funções de E/S imprimem uma linha por arquivo: mandadas para /dev/null
+static void silenciar_saida(void) {
+    fflush(stdout);
+#ifdef IO_BENCH_POSIX
+    saida_original = dup(STDOUT_FILENO);
+    int nulo = open("/dev/null", O_WRONLY);
+    if (saida_original >= 0 && nulo >= 0) dup2(nulo, STDOUT_FILENO);
+    if (nulo >= 0) close(nulo);
+#endif
+}
+
+static void restaurar_saida(void) {
+    fflush(stdout);
+#ifdef IO_BENCH_POSIX
+    if (saida_original >= 0) {
+        dup2(saida_original, STDOUT_FILENO);
+        close(saida_original);
+        saida_original = -1;
+    }
+#endif
+}
+
+static void executar_trabalho(TrabalhoIO *trabalho) {
+    const CasoIO *caso = trabalho->caso;
+    int lidos = -1;
+
+    switch (caso->operacao) {
+        case OP_LER_NUMEROS: {
+            int *numeros = ler_numeros(trabalho->caminho, &lidos);
+            if (!numeros) lidos = -1;
+            free(numeros);
+            break;
+        }
+        case OP_LER_ALUNOS: {
+            Aluno *alunos = ler_alunos(trabalho->caminho, &lidos);
+            if (!alunos) lidos = -1;
+            free(alunos);
+            break;
+        }
+        case OP_SALVAR_NUMEROS:
+            salvar_numeros(trabalho->caminho, (int*)trabalho->dados, caso->tamanho);
+            lidos = caso->tamanho;
+            break;
+        case OP_SALVAR_ALUNOS:
+            salvar_alunos(trabalho->caminho, (Aluno*)trabalho->dados, caso->tamanho);
+            lidos = caso->tamanho;
+            break;
+        case OP_SALVAR_MULTIPLOS:
+            salvar_arquivo_multiplos_locais("relatorios", trabalho->caminho,
+                                            caso->formato == FORMATO_ALUNOS
+                                                ? escrever_alunos_callback
+                                                : escrever_numeros_callback,
+                                            (void*)trabalho->dados, caso->tamanho);
+            lidos = caso->tamanho;
+            break;
+        default:
+            break;
+    }
+    trabalho->processados = lidos;
+}
+
+#ifdef IO_BENCH_POSIX
+static void* executar_trabalho_thread(void *arg) {
+    executar_trabalho((TrabalhoIO*)arg);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Uma thread por trabalho (a criação entra no tempo, como num servidor)
+ */
+static void executar_threads(TrabalhoIO *trabalhos, int threads) {
+#ifdef IO_BENCH_POSIX
+    if (threads > 1) {
+        pthread_t ids[MAX_THREADS_IO];
+        int criadas = 0;
+        for (; criadas < threads; criadas++) {
+            if (pthread_create(&ids[criadas], NULL, executar_trabalho_thread, &trabalhos[criadas]) != 0) break;
+        }
+        for (int t = criadas; t < threads; t++) executar_trabalho(&trabalhos[t]);
+        for (int t = 0; t < criadas; t++) pthread_join(ids[t], NULL);
+        return;
+    }
+#endif
+    for (int t = 0; t < threads; t++) executar_trabalho(&trabalhos[t]);
+}
+
+/* ==============================================================
+ * MEDIÇÃO
+ * ============================================================== */
+
+static int comparar_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static ResultadoIO medir_caso(const CasoIO *caso, const OpcoesIO *opcoes) {
+    ResultadoIO resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    resultado.caso = caso;
+
+    TrabalhoIO trabalhos[MAX_THREADS_IO];
+    void *registros = NULL;
+    long long bytes = 0;
+    int preparado = 1;
+
+    for (int t = 0; t < caso->threads; t++) {
+        trabalhos[t].caso = caso;
+        trabalhos[t].dados = NULL;
+        trabalhos[t].processados = -1;
+        if (eh_leitura(caso->operacao)) {
+            long long tamanho = preparar_entrada(opcoes, caso->formato, caso->tamanho, t,
+                                                 trabalhos[t].caminho, sizeof(trabalhos[t].caminho));
+            if (tamanho < 0) preparado = 0;
+            bytes += tamanho;
+        } else {
+            snprintf(trabalhos[t].caminho, sizeof(trabalhos[t].caminho), "io_bench_%d.txt", t);
+        }
+    }
+    if (!eh_leitura(caso->operacao)) {
+        registros = gerar_registros(caso->formato, caso->tamanho);
+        if (!registros) preparado = 0;
+        for (int t = 0; t < caso->threads; t++) trabalhos[t].dados = registros;
+    }
+
+    double *tempos = malloc((size_t)opcoes->repeticoes * sizeof(double));
+    if (!preparado || !tempos) {
+        free(registros);
+        free(tempos);
+        return resultado;
+    }
+
+    resultado.ok = 1;
+    for (int i = 0; i < opcoes->aquecimento + opcoes->repeticoes; i++) {
+        if (caso->fria) {
+            for (int t = 0; t < caso->threads; t++) {
+                if (descartar_cache(trabalhos[t].caminho) != 0) resultado.ok = 0;
+            }
+        }
+
+        silenciar_saida();
+        uint64_t inicio = cronometro_iniciar();
+        executar_threads(trabalhos, caso->threads);
+        uint64_t fim = cronometro_parar();
+        restaurar_saida();
+
+        for (int t = 0; t < caso->threads; t++) {
+            if (trabalhos[t].processados != caso->tamanho) resultado.ok = 0;
+        }
+        if (i >= opcoes->aquecimento) {
+            tempos[i - opcoes->aquecimento] = ticks_para_segundos(cronometro_decorrido(inicio, fim));
+        }
+    }
+
+    // Gravadores: o tamanho vem do arquivo produzido, que em seguida é apagado
+    if (!eh_leitura(caso->operacao)) {
+        for (int t = 0; t < caso->threads; t++) {
+            char destino[MAX_PATH];
+            int escrito = snprintf(destino, sizeof(destino), "%s/%s", DESTINOS_GRAVACAO[caso->operacao],
+                                   trabalhos[t].caminho);
+            if (escrito < 0 || (size_t)escrito >= sizeof(destino)) {
+                // Caminho truncado: medir ou apagar outro arquivo seria pior que falhar
+                fprintf(stderr, "ERRO: caminho de saida longo demais: %s/%s\n",
+                        DESTINOS_GRAVACAO[caso->operacao], trabalhos[t].caminho);
+                resultado.ok = 0;
+                continue;
+            }
+            long long tamanho = tamanho_arquivo(destino);
+            if (tamanho <= 0) resultado.ok = 0;
+            else bytes += tamanho;
+            remove(destino);
+        }
+    }
+
+    resultado.repeticoes = opcoes->repeticoes;
+    resultado.bytes = bytes;
+
+    double soma = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) soma += tempos[i];
+    resultado.media = soma / opcoes->repeticoes;
+
+    double quadrados = 0.0;
+    for (int i = 0; i < opcoes->repeticoes; i++) {
+        quadrados += (tempos[i] - resultado.media) * (tempos[i] - resultado.media);
+    }
+    resultado.desvio = opcoes->repeticoes > 1 ? sqrt(quadrados / (opcoes->repeticoes - 1)) : 0.0;
+
+    qsort(tempos, (size_t)opcoes->repeticoes, sizeof(double), comparar_double);
+    resultado.minimo = tempos[0];
+    resultado.maximo = tempos[opcoes->repeticoes - 1];
+    int meio = opcoes->repeticoes / 2;
+    resultado.mediana = (opcoes->repeticoes % 2) ? tempos[meio] : (tempos[meio - 1] + tempos[meio]) / 2.0;
+    if (resultado.mediana > 0.0) {
+        resultado.mb_s = (double)bytes / resultado.mediana / 1e6;
+        resultado.registros_s = (double)caso->tamanho * caso->threads / resultado.mediana;
+    }
+
+    free(registros);
+    free(tempos);
+    return resultado;
+}
+
+/* ==============================================================
+ * SAÍDA JSON
+ * ============================================================== */
+
+static void escrever_json(FILE *arquivo, const ResultadoIO *resultados, int num_resultados,
+                          const OpcoesIO *opcoes) {
+    char cronometro[96];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+
+#ifdef IO_BENCH_DESCARTE
+    const char *descarte = "posix_fadvise";
+#else
+    const char *descarte = "indisponivel";
+#endif
+
+    fprintf(arquivo, "{\n");
+    fprintf(arquivo, "  \"contexto\": {\n");
+    fprintf(arquivo, "    \"cronometro\": \"%s\",\n", cronometro);
+    fprintf(arquivo, "    \"repeticoes\": %d,\n", opcoes->repeticoes);
+    fprintf(arquivo, "    \"aquecimento\": %d,\n", opcoes->aquecimento);
+    fprintf(arquivo, "    \"diretorio\": \"%s\",\n", opcoes->diretorio);
+    fprintf(arquivo, "    \"descarte_cache\": \"%s\"\n", descarte);
+    fprintf(arquivo, "  },\n");
+    fprintf(arquivo, "  \"casos\": [\n");
+    for (int i = 0; i < num_resultados; i++) {
+        const ResultadoIO *r = &resultados[i];
+        const CasoIO *c = r->caso;
+        fprintf(arquivo, "    {\"nome\": \"%s\", \"operacao\": \"%s\", \"formato\": \"%s\", "
+                         "\"n\": %d, \"threads\": %d, \"cache\": \"%s\", \"repeticoes\": %d, "
+                         "\"min_s\": %.9f, \"mediana_s\": %.9f, \"media_s\": %.9f, \"max_s\": %.9f, "
+                         "\"desvio_s\": %.9f, \"bytes\": %lld, \"mb_s\": %.3f, \"registros_s\": %.1f, "
+                         "\"ok\": %s}%s\n",
+                c->nome, NOMES_OPERACOES[c->operacao], NOMES_FORMATOS[c->formato],
+                c->tamanho, c->threads,
+                eh_leitura(c->operacao) ? (c->fria ? "fria" : "quente") : "gravacao",
+                r->repeticoes, r->minimo, r->mediana, r->media, r->maximo, r->desvio,
+                r->bytes, r->mb_s, r->registros_s, r->ok ? "true" : "false",
+                i + 1 < num_resultados ? "," : "");
+    }
+    fprintf(arquivo, "  ]\n");
+    fprintf(arquivo, "}\n");
+}
+
+/* ==============================================================
+ * EXECUÇÃO
+ * ============================================================== */
+
+static int executar_casos(const OpcoesIO *opcoes) {
+#ifdef IO_BENCH_TEM_REGEX
+    regex_t expressao;
+    int usar_regex = opcoes->filtro && opcoes->filtro[0];
+    if (usar_regex && regcomp(&expressao, opcoes->filtro, REG_EXTENDED | REG_NOSUB) != 0) {
+        fprintf(stderr, "ERRO: filtro invalido: %s\n", opcoes->filtro);
+        return -1;
+    }
+#endif
+
+    int selecionados[MAX_CASOS_IO];
+    int num_selecionados = 0;
+    for (int i = 0; i < num_casos_io; i++) {
+        int passa = 1;
+#ifdef IO_BENCH_TEM_REGEX
+        if (usar_regex) passa = regexec(&expressao, casos_io[i].nome, 0, NULL, 0) == 0;
+#else
+        if (opcoes->filtro && opcoes->filtro[0]) passa = strstr(casos_io[i].nome, opcoes->filtro) != NULL;
+#endif
+        if (passa) selecionados[num_selecionados++] = i;
+    }
+#ifdef IO_BENCH_TEM_REGEX
+    if (usar_regex) regfree(&expressao);
+#endif
+
+    if (opcoes->apenas_listar) {
+        for (int i = 0; i < num_selecionados; i++) printf("%s\n", casos_io[selecionados[i]].nome);
+        return 0;
+    }
+
+    ResultadoIO *resultados = calloc((size_t)(num_selecionados > 0 ? num_selecionados : 1),
+                                     sizeof(ResultadoIO));
+    if (!resultados) return -1;
+
+    // Com JSON na saída padrão, a tabela vai para stderr
+    FILE *tabela = (opcoes->arquivo_json && strcmp(opcoes->arquivo_json, "-") == 0) ? stderr : stdout;
+    int falhas = 0;
+
+    fprintf(tabela, "%-40s %12s %12s %12s %10s %14s %s\n",
+            "Caso", "Mediana (s)", "Min (s)", "Desvio (s)", "MB/s", "Registros/s", "OK");
+    for (int i = 0; i < num_selecionados; i++) {
+        const CasoIO *caso = &casos_io[selecionados[i]];
+        resultados[i] = medir_caso(caso, opcoes);
+        if (!resultados[i].ok) falhas++;
+        fprintf(tabela, "%-40s %12.6f %12.6f %12.6f %10.1f %14.0f %s\n", caso->nome,
+                resultados[i].mediana, resultados[i].minimo, resultados[i].desvio,
+                resultados[i].mb_s, resultados[i].registros_s, resultados[i].ok ? "sim" : "NAO");
+        fflush(tabela);
+    }
+    fprintf(tabela, "%d caso(s) medido(s), %d com falha\n", num_selecionados, falhas);
+    remover_entradas();
+
+    if (opcoes->arquivo_json) {
+        FILE *arquivo = strcmp(opcoes->arquivo_json, "-") == 0 ? stdout : fopen(opcoes->arquivo_json, "w");
+        if (!arquivo) {
+            fprintf(stderr, "ERRO: nao foi possivel criar %s\n", opcoes->arquivo_json);
+            free(resultados);
+            return -1;
+        }
+        escrever_json(arquivo, resultados, num_selecionados, opcoes);
+        if (arquivo != stdout) fclose(arquivo);
+    }
+
+    free(resultados);
+    return falhas;
+}
+
+/* ==============================================================
+ * LINHA DE COMANDO
+ * ============================================================== */
+
+static void imprimir_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [--filtro REGEX] [--repeticoes N] [--aquecimento N]\n"
+            "       [--json ARQUIVO|-] [--listar] [--smoke] [--dir DIR]\n"
+            "  Casos: operacao/formato/n/Tt[/quente|fria] (ex.: ler_numeros/numeros/100000/4t/fria)\n"
+            "  --smoke: n = 1000, 1 e 2 threads, 1 repeticao, sem aquecimento\n"
+            "  --dir: onde criar os arquivos de entrada (padrao: output)\n",
+            programa);
+}
+
+int main(int argc, char **argv) {
+    OpcoesIO opcoes;
+    opcoes.filtro = NULL;
+    opcoes.repeticoes = REPETICOES_IO_PADRAO;
+    opcoes.aquecimento = AQUECIMENTO_IO_PADRAO;
+    opcoes.arquivo_json = NULL;
+    opcoes.apenas_listar = 0;
+    opcoes.diretorio = "output";
+    int smoke = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opcao = argv[i];
+        int com_valor = strcmp(opcao, "--filtro") == 0 || strcmp(opcao, "--repeticoes") == 0 ||
+                        strcmp(opcao, "--aquecimento") == 0 || strcmp(opcao, "--json") == 0 ||
+                        strcmp(opcao, "--dir") == 0;
+
+        if (com_valor) {
+            if (i + 1 >= argc) {
+                imprimir_uso(argv[0]);
+                return 2;
+            }
+            const char *valor = argv[++i];
+            if (strcmp(opcao, "--filtro") == 0)           opcoes.filtro = valor;
+            else if (strcmp(opcao, "--repeticoes") == 0)  opcoes.repeticoes = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--aquecimento") == 0) opcoes.aquecimento = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--json") == 0)        opcoes.arquivo_json = valor;
+            else                                          opcoes.diretorio = valor;  // --dir
+        } else if (strcmp(opcao, "--listar") == 0) {
+            opcoes.apenas_listar = 1;
+        } else if (strcmp(opcao, "--smoke") == 0) {
+            smoke = 1;
+        } else if (strcmp(opcao, "--ajuda") == 0 || strcmp(opcao, "-h") == 0) {
+            imprimir_uso(argv[0]);
+            return 0;
+        } else {
+            fprintf(stderr, "ERRO: opcao desconhecida: %s\n", opcao);
+            imprimir_uso(argv[0]);
+            return 2;
+        }
+    }
+
+    if (smoke) {
+        opcoes.repeticoes = 1;
+        opcoes.aquecimento = 0;
+    }
+    if (opcoes.repeticoes <= 0 || opcoes.aquecimento < 0) {
+        fprintf(stderr, "ERRO: repeticoes deve ser > 0 e aquecimento >= 0\n");
+        return 2;
+    }
+
+    // Os gravadores usam output/numeros, output/alunos e output/relatorios
+    criar_diretorios_output();
+    inicializar_cronometro();
+    registrar_casos(smoke);
+
+    int falhas = executar_casos(&opcoes);
+    if (falhas < 0) return 2;
+    return falhas > 0 ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * ==============================================================
+ * SORT_BENCH - MICRO-BENCHMARK DOS ALGORITMOS
+ * ==============================================================
+ *
+ * @file sort_bench.c
+ * @brief Registra os casos e interpreta a linha de comando
+ *
+ * Uso:
+ *   sort_bench [--filtro REGEX] [--repeticoes N] [--aquecimento N]
+ *              [--semente S] [--json ARQUIVO|-] [--listar] [--smoke]
+ *              [--custo-comparacao TICKS] [--sem-perfil]
+ *              [--plugin ARQ.so]... [--motores LISTA] [--listar-motores]
+ *
+ * Exemplos:
+ *   sort_bench --listar --filtro '^heap/'
+ *   sort_bench --filtro '^(quick|heap)/otimizada/aleatorios/int/' --json bench.json
+ *   sort_bench --smoke          # todos os casos com n = 500, em segundos
+ *   sort_bench --filtro '/int/1000$' --custo-comparacao 256   # comparador caro
+ *   sort_bench --motores 'n_log_n,-referencia' --smoke        # por etiqueta
+ *   sort_bench --plugin ./libmeu_sort.so --motores meu_sort,quick
+ *
+ * Sem --sem-perfil, os parâmetros dos motores vêm de output/perfil_ajuste.txt
+ * (menu de autoajuste), como no programa principal. Plugins também vêm
+ * de SORTS_PLUGINS (registro.h) e, com SORTS_METRICAS=arquivo.prom, os
+ * contadores por motor são exportados durante a execução (metricas.h).
+ *
+ * Código de saída: 0 se todas as saídas conferiram, 1 se alguma ficou
+ * fora de ordem, 2 em erro de uso. O modo --smoke serve como verificação
+ * rápida de que todos os algoritmos, versões e tipos ainda ordenam.
+ *
+ * ==============================================================
+ */
+
+#include "bench.h"
+#include <string.h>  // Para strcmp
+#include <stdlib.h>  // Para strtol, strtoull
+
+/* ==============================================================
+ * CASOS REGISTRADOS
+ * ============================================================== */
+
+static const int tamanhos_completos[] = { 1000, 10000, 100000 };
+static const int tamanhos_smoke[] = { 500 };
+
+#define TAMANHO_MAXIMO_QUADRATICO 10000  ///< Acima disso algoritmos O(n²) não são registrados
+
+/**
+ * @brief Distribuição × tipo × tamanho de um motor em uma versão
+ *
+ * bench_registrar recusa os tipos que o motor não aceita (só inteiros).
+ */
+static void registrar_motor_bench(int indice, int otimizada, const int *tamanhos, int num_tamanhos) {
+    int quadratico = strstr(obter_info_motor(indice)->complexidade_media, "n²") != NULL;
+    for (int d = 0; d < NUM_DISTRIBUICOES; d++) {
+        for (int t = 0; t < NUM_TIPOS_BENCH; t++) {
+            for (int s = 0; s < num_tamanhos; s++) {
+                if (quadratico && tamanhos[s] > TAMANHO_MAXIMO_QUADRATICO) continue;
+                bench_registrar(indice, otimizada, (DistribuicaoDados)d, (TipoElementoBench)t, tamanhos[s]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Produto motor × versão × distribuição × tipo × tamanho
+ *
+ * As referências da libc e os especializados (uma versão só) são
+ * registrados primeiro: assim o qsort é medido antes dos algoritmos e
+ * serve de base para a coluna x qsort. O qsort entra mesmo fora da
+ * seleção; plugins vêm por último, só na versão que têm.
+ *
+ * @param selecionado selecionado[i] != 0 se o motor i foi escolhido
+ */
+static void registrar_casos(int smoke, const int *selecionado) {
+    const int *tamanhos = smoke ? tamanhos_smoke : tamanhos_completos;
+    int num_tamanhos = smoke ? (int)(sizeof(tamanhos_smoke) / sizeof(tamanhos_smoke[0]))
+                             : (int)(sizeof(tamanhos_completos) / sizeof(tamanhos_completos[0]));
+
+    for (int r = NUM_ALGORITMOS; r < NUM_MOTORES_INTERNOS; r++) {
+        if (!selecionado[r] && r != INDICE_QSORT) continue;
+        registrar_motor_bench(r, 1, tamanhos, num_tamanhos);
+    }
+
+    for (int a = 0; a < NUM_ALGORITMOS; a++) {
+        if (!selecionado[a]) continue;
+        for (int otimizada = 1; otimizada >= 0; otimizada--) {
+            registrar_motor_bench(a, otimizada, tamanhos, num_tamanhos);
+        }
+    }
+
+    for (int p = NUM_MOTORES_INTERNOS; p < num_motores(); p++) {
+        if (selecionado[p]) registrar_motor_bench(p, 1, tamanhos, num_tamanhos);
+    }
+}
+
+/* ==============================================================
+ * LINHA DE COMANDO
+ * ============================================================== */
+
+static void imprimir_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [--filtro REGEX] [--repeticoes N] [--aquecimento N]\n"
+            "       [--semente S] [--json ARQUIVO|-] [--listar] [--smoke]\n"
+            "       [--custo-comparacao TICKS] [--sem-perfil]\n"
+            "       [--plugin ARQ.so]... [--motores LISTA] [--listar-motores]\n"
+            "  Casos: algoritmo/versao/distribuicao/tipo/n (ex.: quick/otimizada/aleatorios/int/10000)\n"
+            "  Referencias: qsort/libc/... (sempre medida junto de cada caso selecionado)\n"
+            "  --smoke: todos os casos com n = 500, 1 repeticao, sem aquecimento\n"
+            "  --custo-comparacao: espera ativa de TICKS em cada comparacao\n"
+            "  --sem-perfil: ignora output/perfil_ajuste.txt (parametros padrao)\n"
+            "  --plugin: carrega motores de um .so (repetivel; ver registro.h)\n"
+            "  --motores: ids, nomes ou etiquetas separados por virgula; '-' exclui\n"
+            "             (ex.: 'n_log_n,-referencia', 'quick,heap', 'plugin')\n",
+            programa);
+}
+
+int main(int argc, char **argv) {
+    OpcoesBench opcoes = opcoes_bench_padrao();
+    int smoke = 0;
+    int sem_perfil = 0;
+    int listar_motores_registrados = 0;
+    const char *seletor_motores = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opcao = argv[i];
+        int com_valor = strcmp(opcao, "--filtro") == 0 || strcmp(opcao, "--repeticoes") == 0 ||
+                        strcmp(opcao, "--aquecimento") == 0 || strcmp(opcao, "--semente") == 0 ||
+                        strcmp(opcao, "--json") == 0 || strcmp(opcao, "--custo-comparacao") == 0 ||
+                        strcmp(opcao, "--plugin") == 0 || strcmp(opcao, "--motores") == 0;
+
+        if (com_valor) {
+            if (i + 1 >= argc) {
+                imprimir_uso(argv[0]);
+                return 2;
+            }
+            const char *valor = argv[++i];
+            if (strcmp(opcao, "--filtro") == 0)           opcoes.filtro = valor;
+            else if (strcmp(opcao, "--repeticoes") == 0)  opcoes.repeticoes = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--aquecimento") == 0) opcoes.aquecimento = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--semente") == 0)     opcoes.semente = strtoull(valor, NULL, 10);
+            else if (strcmp(opcao, "--custo-comparacao") == 0) opcoes.custo_comparacao = strtoull(valor, NULL, 10);
+            else if (strcmp(opcao, "--motores") == 0)     seletor_motores = valor;
+            else if (strcmp(opcao, "--json") == 0)        opcoes.arquivo_json = valor;
+            else if (carregar_plugin_motores(valor) < 0)  return 2;  // --plugin
+        } else if (strcmp(opcao, "--listar") == 0) {
+            opcoes.apenas_listar = 1;
+        } else if (strcmp(opcao, "--smoke") == 0) {
+            smoke = 1;
+        } else if (strcmp(opcao, "--sem-perfil") == 0) {
+            sem_perfil = 1;
+        } else if (strcmp(opcao, "--listar-motores") == 0) {
+            listar_motores_registrados = 1;
+        } else if (strcmp(opcao, "--ajuda") == 0 || strcmp(opcao, "-h") == 0) {
+            imprimir_uso(argv[0]);
+            return 0;
+        } else {
+            fprintf(stderr, "ERRO: opcao desconhecida: %s\n", opcao);
+            imprimir_uso(argv[0]);
+            return 2;
+        }
+    }
+
+    if (smoke) {
+        opcoes.repeticoes = 1;
+        opcoes.aquecimento = 0;
+    }
+    if (opcoes.repeticoes <= 0 || opcoes.aquecimento < 0) {
+        fprintf(stderr, "ERRO: repeticoes deve ser > 0 e aquecimento >= 0\n");
+        return 2;
+    }
+
+    carregar_plugins_ambiente();
+    if (iniciar_metricas_ambiente() < 0) return 2;
+    if (listar_motores_registrados) {
+        listar_motores(stdout);
+        return 0;
+    }
+
+    int indices[MAX_MOTORES];
+    int num_selecionados = selecionar_motores(seletor_motores, indices, MAX_MOTORES);
+    if (num_selecionados < 0) return 2;
+    int selecionado[MAX_MOTORES] = {0};
+    for (int i = 0; i < num_selecionados; i++) selecionado[indices[i]] = 1;
+
+    inicializar_cronometro();
+    medir_banda_memoria();
+    if (!sem_perfil) carregar_perfil_ajuste(NULL, 0);
+    registrar_casos(smoke, selecionado);
+
+    int falhas = bench_executar(&opcoes);
+    liberar_buffer_troca();
+    if (falhas < 0) return 2;
+    return falhas > 0 ? 1 : 0;
+}
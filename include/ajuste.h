@@ -0,0 +1,160 @@
+/**
+ * ==============================================================
+ * AUTOAJUSTE DOS PARÂMETROS DOS MOTORES
+ * ==============================================================
+ *
+ * @file ajuste.h
+ * @brief Mede limiares dos motores otimizados nesta máquina e grava um perfil
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * O melhor corte do Quick Sort para o Insertion Sort, a sequência de gaps
+ * do Shell Sort e a aridade do heap dependem da máquina (linha de cache,
+ * custo de desvio mal previsto, latência da L1), não do algoritmo. Em vez
+ * de fixá-los no código, o autoajuste varre candidatos com execuções
+ * curtas em entradas sintéticas e grava os vencedores:
+ *
+ *  ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ *  │ Para cada parâmetro: │ → │ Mediana de R execuç. │ → │ Vence o mais rápido, │
+ *  │ candidatos, demais   │   │ por distribuição     │   │ se bater o padrão    │
+ *  │ no valor padrão      │   │ (aleatória/crescente)│   │ por GANHO_MINIMO     │
+ *  └──────────────────────┘   └──────────────────────┘   └──────────┬───────────┘
+ *                                                                   ↓
+ *  ┌──────────────────────┐   ┌────────────────────────────────────────────┐
+ *  │ output/perfil_ajuste │ ← │ Compara padrão × ajustado em outros        │
+ *  │ .txt (chave = valor) │   │ tamanhos e outra semente (relatório)       │
+ *  └──────────────────────┘   └────────────────────────────────────────────┘
+ *
+ * Cada parâmetro pertence a um único motor, então são varridos um de cada
+ * vez (busca coordenada): não há interação a explorar.
+ *
+ * O programa e o sort_bench carregam o perfil na inicialização; sem
+ * perfil valem os padrões históricos (parametros_motores_padrao()).
+ *
+ * ==============================================================
+ */
+
+#ifndef AJUSTE_H
+#define AJUSTE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "algoritmos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define ARQUIVO_PERFIL_AJUSTE "perfil_ajuste.txt"  ///< Em output/ (ou ../output, ../../output)
+#define VERSAO_PERFIL_AJUSTE 1
+
+#define TAMANHO_AJUSTE_PADRAO 20000        ///< Elementos por execução da varredura
+#define REPETICOES_AJUSTE_PADRAO 7         ///< Mediana de 7 execuções por candidato
+#define GANHO_MINIMO_AJUSTE 0.03           ///< Abaixo de 3% o padrão é mantido (ruído)
+#define TOLERANCIA_FREQUENCIA_PERFIL 0.02  ///< Frequência do cronômetro diferente: outra máquina
+
+#define NUM_PARAMETROS_AJUSTE 3            ///< Corte do Quick, gaps do Shell, aridade do heap
+#define MAX_CANDIDATOS_AJUSTE 16
+#define NUM_TAMANHOS_COMPARACAO_AJUSTE 3   ///< 1000, tamanho da varredura, 10× o tamanho
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Parâmetros de uma execução do autoajuste
+ */
+typedef struct {
+    int tamanho;              ///< Elementos (ints) por execução da varredura
+    int repeticoes;           ///< Execuções por candidato e distribuição (mediana)
+    double ganho_minimo;      ///< Fração que um candidato precisa ganhar do padrão
+    uint64_t semente;         ///< Semente das entradas da varredura
+} ConfiguracaoAjuste;
+
+/**
+ * @brief Candidatos de um parâmetro e o tempo de cada um
+ */
+typedef struct {
+    const char *chave;                      ///< Chave no perfil (ex.: "aridade_heap")
+    int indice_motor;                       ///< Índice em obter_info_motor()
+    int num_candidatos;
+    int valores[MAX_CANDIDATOS_AJUSTE];
+    double tempos[MAX_CANDIDATOS_AJUSTE];   ///< Soma das medianas das distribuições (s)
+    int indice_padrao;                      ///< Candidato igual ao valor padrão
+    int indice_escolhido;                   ///< Vencedor (ou o padrão, se não ganhou o bastante)
+} VarreduraParametro;
+
+/**
+ * @brief Padrão × ajustado para um motor em um tamanho
+ */
+typedef struct {
+    int indice_motor;
+    int tamanho;
+    double tempo_padrao;      ///< Mediana (s)
+    double tempo_ajustado;    ///< Mediana (s)
+} ComparacaoAjuste;
+
+/**
+ * @brief Resultado completo
+ */
+typedef struct {
+    ConfiguracaoAjuste config;
+    ParametrosMotores padrao;
+    ParametrosMotores ajustado;
+    VarreduraParametro varreduras[NUM_PARAMETROS_AJUSTE];
+    int num_comparacoes;
+    ComparacaoAjuste comparacoes[NUM_PARAMETROS_AJUSTE * NUM_TAMANHOS_COMPARACAO_AJUSTE];
+} RelatorioAjuste;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief 20000 ints, mediana de 7, ganho mínimo de 3%
+ */
+ConfiguracaoAjuste configuracao_ajuste_padrao(void);
+
+/**
+ * @brief Varre os candidatos e compara padrão × ajustado
+ *
+ * Restaura os parâmetros em vigor ao terminar: quem decide aplicar o
+ * resultado é o chamador (configurar_parametros_motores).
+ *
+ * @return Resultado alocado (liberar com free), ou NULL se faltar memória
+ */
+RelatorioAjuste* executar_autoajuste(const ConfiguracaoAjuste *config);
+
+/**
+ * @brief Lê um perfil "chave = valor"; chaves ausentes ficam no padrão
+ *
+ * @return 0 se válido, -1 se o arquivo não abre ou tem valor inválido
+ */
+int ler_perfil_ajuste(const char *caminho, ParametrosMotores *destino);
+
+/**
+ * @brief Procura o perfil em output/, ../output e ../../output e o aplica
+ *
+ * Avisa (e aplica mesmo assim) se o cronômetro que gerou o perfil tinha
+ * outra frequência: provavelmente o perfil veio de outra máquina.
+ *
+ * @param caminho_usado Recebe o caminho carregado (pode ser NULL)
+ * @return 1 se carregado, 0 se não existe, -1 se inválido (padrões mantidos)
+ */
+int carregar_perfil_ajuste(char *caminho_usado, size_t tamanho_caminho);
+
+/**
+ * @brief Grava os parâmetros em output/perfil_ajuste.txt
+ */
+void salvar_perfil_ajuste(const ParametrosMotores *parametros);
+
+/**
+ * @brief Salva ajuste_motores.txt em output/relatorios/
+ */
+void gerar_relatorio_ajuste(const RelatorioAjuste *relatorio);
+
+/**
+ * @brief Ponto de entrada do menu: ajusta, aplica, grava o perfil e o relatório
+ */
+void executar_autoajuste_completo(void);
+
+#endif // AJUSTE_H
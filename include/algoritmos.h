@@ -384,4 +384,91 @@ void heapify_naive(void *arr, int n, int i, size_t elem_size, CompareFn cmp);
 int partition_optimized(void *arr, int inicio, int fim, size_t elem_size, CompareFn cmp);
 int partition_naive(void *arr, int inicio, int fim, size_t elem_size, CompareFn cmp);
 
+/**
+ * @brief Comparador instrumentado: conta a comparação e delega ao comparador atual
+ *
+ * Pode ser passado a ordenações externas (ex.: qsort da libc) depois de
+ * configurar_comparacao_contada(), para que as comparações delas também
+ * sejam contadas.
+ */
+int comparar_e_contar(const void *a, const void *b);
+
+/**
+ * @brief Define o comparador ao qual comparar_e_contar() delega (na thread atual)
+ */
+void configurar_comparacao_contada(CompareFn cmp);
+
+/**
+ * @brief Libera o buffer temporário de trocas da thread chamadora
+ *
+ * Cada thread mantém seu próprio buffer (reutilizado entre trocas). Threads
+ * de trabalho devem chamar esta função antes de terminar; a thread principal
+ * pode ignorá-la, pois o buffer é liberado no fim do programa.
+ */
+void liberar_buffer_troca(void);
+
+/* ==============================================================
+ * PARÂMETROS AJUSTÁVEIS DAS VERSÕES OTIMIZADAS
+ * ==============================================================
+ *
+ * Limiares que dependem da máquina (tamanho de linha de cache, custo de
+ * desvio, latência da L1). Os valores padrão reproduzem exatamente o
+ * comportamento histórico dos algoritmos (mesmos contadores); o menu de
+ * autoajuste mede alternativas e grava um perfil que é carregado na
+ * inicialização (ver ajuste.h). As versões didáticas ignoram estes
+ * parâmetros.
+ */
+
+/**
+ * @brief Sequência de gaps do Shell Sort otimizado
+ */
+typedef enum {
+    SEQUENCIA_SHELL_KNUTH = 0,  ///< 1, 4, 13, 40, ... (padrão)
+    SEQUENCIA_SHELL_CIURA,      ///< 1, 4, 10, 23, 57, 132, 301, 701, 1750, depois ×2.25
+    SEQUENCIA_SHELL_TOKUDA,     ///< h = ⌈2.25·h' + 1⌉: 1, 4, 9, 20, 46, 103, ...
+    NUM_SEQUENCIAS_SHELL
+} SequenciaShell;
+
+#define LIMITE_INSERCAO_QUICK_MAXIMO 256  ///< Teto aceito para o corte do Quick Sort
+#define ARIDADE_HEAP_MAXIMA 16            ///< Teto aceito para a aridade do heap
+
+/**
+ * @brief Parâmetros dos motores otimizados
+ */
+typedef struct {
+    int limite_insercao_quick;      ///< Subarrays com até este tamanho vão para o Insertion Sort (0 = nunca)
+    SequenciaShell sequencia_shell; ///< Gaps do Shell Sort
+    int aridade_heap;               ///< Filhos por nó do heap (2 = binário recursivo)
+} ParametrosMotores;
+
+/**
+ * @brief Parâmetros históricos: sem corte, Knuth, heap binário
+ */
+ParametrosMotores parametros_motores_padrao(void);
+
+/**
+ * @brief Instala novos parâmetros (valores fora da faixa são rejeitados)
+ *
+ * Os parâmetros são globais, não por thread: configure antes de iniciar
+ * medições paralelas.
+ *
+ * @return 0 se aplicados, -1 se algum valor for inválido (nada muda)
+ */
+int configurar_parametros_motores(const ParametrosMotores *parametros);
+
+/**
+ * @brief Parâmetros em vigor
+ */
+const ParametrosMotores* obter_parametros_motores(void);
+
+/**
+ * @brief Nome curto da sequência ("knuth", "ciura", "tokuda") ou NULL se inválida
+ */
+const char* nome_sequencia_shell(SequenciaShell sequencia);
+
+/**
+ * @brief Descreve parâmetros (ex.: "corte quick 16, shell ciura, heap 4-ario")
+ */
+void descrever_parametros_motores(const ParametrosMotores *parametros, char *buffer, size_t tamanho_buffer);
+
 #endif // ALGORITMOS_H
@@ -94,6 +94,42 @@ ResultadoTempo medir_algoritmo(AlgoritmoInfo *algoritmo_info, void *dados,
                               int tamanho, size_t elem_size, CompareFn cmp,
                               const char *tipo_dados);
 
+/**
+ * @brief Executa um motor uma vez (algoritmo, referência ou plugin)
+ *
+ * Chama `ordenar` com o `contexto` do motor; o Quick Sort, com sua
+ * assinatura de início/fim, já chega adaptado pela tabela. Plugins
+ * recebem comparar_e_contar no lugar de `cmp`, para que as comparações
+ * entrem nos contadores.
+ *
+ * @param algoritmo_info Algoritmo a executar
+ * @param arr Array a ser ordenado (modificado in-place)
+ * @param n Número de elementos
+ * @param elem_size Tamanho de cada elemento em bytes
+ * @param cmp Função de comparação
+ */
+void executar_ordenacao(const AlgoritmoInfo *algoritmo_info, void *arr, int n,
+                        size_t elem_size, CompareFn cmp);
+
+/**
+ * @brief Retorna a base de conhecimento com todos os algoritmos implementados
+ *
+ * @return Array estático com NUM_ALGORITMOS entradas
+ * @see AlgoritmoInfo Estrutura de cada entrada
+ */
+AlgoritmoInfo* obter_info_algoritmos(void);
+
+/**
+ * @brief Determina quantas execuções repetidas usar para um tamanho de conjunto
+ *
+ * Conjuntos pequenos executam rápido demais para uma medição única confiável;
+ * nesses casos o tempo reportado é a média de várias execuções.
+ *
+ * @param tamanho_conjunto Número de elementos
+ * @return Número recomendado de execuções (10, 5, 3 ou 1)
+ */
+int determinar_num_execucoes(int tamanho_conjunto);
+
 /**
  * @brief Testa um algoritmo em todos os datasets disponíveis
  *
@@ -210,7 +246,7 @@ void executar_analise_completa_todos(void);
  * - Essencial para dados com múltiplos critérios de ordenação
  *
  * @see verificar_estabilidade() Função auxiliar para testar um algoritmo específico
- * @see AlgoritmoInfo.eh_estavel Campo que indica se algoritmo deveria ser estável
+ * @see AlgoritmoInfo.capacidades CAPACIDADE_ESTAVEL indica se o algoritmo deveria ser estável
  */
 void analisar_estabilidade_algoritmos(void);
 
@@ -450,6 +486,36 @@ void formatar_tempo(double tempo, char *buffer, size_t tamanho_buffer);
  */
 void formatar_numero_grande(long long numero, char *buffer, size_t tamanho_buffer);
 
+/**
+ * @brief Ajusta uma reta y = a·x + b por mínimos quadrados
+ *
+ * @param x Valores da variável independente
+ * @param y Valores da variável dependente
+ * @param n Quantidade de pontos
+ * @return Coeficientes e R² do ajuste (inclinacao = 0 se n < 2)
+ * @see AjusteLinear Estrutura de retorno
+ */
+AjusteLinear ajustar_reta(const double *x, const double *y, int n);
+
+/**
+ * @brief Ajusta uma lei de potência y = c·n^k em escala log-log
+ *
+ * A inclinação do ajuste é o expoente empírico k. Pontos com valor
+ * não-positivo são ignorados (log indefinido).
+ *
+ * **Exemplo de uso:**
+ * ```c
+ * AjusteLinear a = ajustar_lei_potencia(tamanhos, tempos, 10);
+ * printf("Tempo cresce como n^%.2f\n", a.inclinacao);
+ * ```
+ *
+ * @param tamanhos Tamanhos de entrada (n)
+ * @param valores Grandeza medida em cada tamanho (tempo, comparações, ...)
+ * @param num_pontos Quantidade de pontos
+ * @return Ajuste com inclinacao = expoente e intercepto = log2(c)
+ */
+AjusteLinear ajustar_lei_potencia(const int *tamanhos, const double *valores, int num_pontos);
+
 /* ==============================================================
  * ORQUESTRAÇÃO DE EXECUÇÃO E ANÁLISE COMPARATIVA
  * ============================================================== */
@@ -530,12 +596,12 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
  *
  * **Exemplo de uso:**
  * ```c
- * double tempo_medio = medir_tempo_multiplo(bubble_sort, dados, 1000,
+ * double tempo_medio = medir_tempo_multiplo(buscar_motor("bubble"), dados, 1000,
  *                                          sizeof(int), comparar_inteiros, 5);
- * // Executa bubble_sort 5 vezes e retorna a média
+ * // Executa o Bubble Sort 5 vezes e retorna a média
  * ```
  *
- * @param sort_fn Ponteiro para função do algoritmo a ser testado
+ * @param info Motor a ser testado
  * @param dados_originais Dados de entrada (não são modificados)
  * @param n Quantidade de elementos nos dados
  * @param elem_size Tamanho de cada elemento em bytes
@@ -545,7 +611,7 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
  * @see obter_tempo_preciso() Função usada para cronometragem
  * @see medir_algoritmo() Para medição única com métricas completas
  */
-double medir_tempo_multiplo(void (*sort_fn)(void*, int, size_t, CompareFn),
+double medir_tempo_multiplo(const AlgoritmoInfo *info,
                            const void *dados_originais, int n, size_t elem_size,
                            CompareFn cmp, int num_execucoes);
 
@@ -0,0 +1,71 @@
+/**
+ * ==============================================================
+ * ORDENAÇÃO APRENDIDA (MODELO DE CDF) PARA INTEIROS
+ * ==============================================================
+ *
+ * @file aprendida.h
+ * @brief Learned Sort: modelo linear por partes da distribuição das chaves
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Os numeros_aleatorios_* são quase uniformes em [0, 10^6): conhecendo
+ * a função de distribuição acumulada (CDF) das chaves, a posição final
+ * de cada uma é aproximadamente CDF(chave) × n, sem comparações. O motor
+ * aprende essa CDF em uma amostra e espalha as chaves de uma vez:
+ *
+ *  ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ *  │ Amostra (~1%),       │ → │ Uma passada: balde = │ → │ Baldes em ordem →    │
+ *  │ ordenada; nós nos    │   │ CDF(chave) × baldes; │   │ array; inserção      │
+ *  │ quantis → CDF linear │   │ balde cheio →        │   │ final; transbordo    │
+ *  │ por partes           │   │ transbordo           │   │ ordenado e intercal. │
+ *  └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * O modelo é monotônico, então a ordem entre baldes já é a ordem final:
+ * a inserção só desfaz inversões dentro de cada balde (capacidade fixa).
+ *
+ * **Quando o modelo erra:** poucas chaves distintas na amostra (Zipf,
+ * muitas repetições) ou transbordo acima de LIMITE_TRANSBORDO_APRENDIDA
+ * indicam que a CDF não separa as chaves; o motor desiste e usa um
+ * Radix LSD (dígitos de 8 bits, passadas triviais puladas), que não
+ * depende da distribuição.
+ *
+ * No registro (registro.h) o motor fica depois das referências da libc,
+ * com versão única e CAPACIDADE_SO_INTEIROS: só recebe int com
+ * comparar_inteiros, e o comparador não é chamado.
+ *
+ * ==============================================================
+ */
+
+#ifndef APRENDIDA_H
+#define APRENDIDA_H
+
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define NUM_ESPECIALIZADOS 1                ///< Motores internos de versão única após as referências
+
+#define LIMIAR_INSERCAO_APRENDIDA 64        ///< Abaixo disso, só inserção
+#define AMOSTRA_MINIMA_APRENDIDA 256        ///< Chaves amostradas (1% de n, nesta faixa)
+#define AMOSTRA_MAXIMA_APRENDIDA 16384
+#define SEGMENTOS_CDF_APRENDIDA 128         ///< Segmentos do modelo linear por partes
+#define OCUPACAO_BALDE_APRENDIDA 8          ///< Chaves esperadas por balde
+#define CAPACIDADE_BALDE_APRENDIDA 16       ///< Além disso, a chave vai para o transbordo
+#define LIMITE_TRANSBORDO_APRENDIDA 0.10    ///< Fração de n; acima, Radix LSD
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Learned Sort na assinatura uniforme (só int; cmp é ignorado)
+ */
+void ordenacao_aprendida(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto);
+
+/**
+ * @brief Tabela estática com NUM_ESPECIALIZADOS entradas (a ordenação aprendida)
+ */
+AlgoritmoInfo* obter_info_especializados(void);
+
+#endif // APRENDIDA_H
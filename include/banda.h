@@ -0,0 +1,110 @@
+/**
+ * ==============================================================
+ * BANDA DE MEMÓRIA E ROOFLINE
+ * ==============================================================
+ *
+ * @file banda.h
+ * @brief Sonda ao estilo STREAM (cópia e escala) e fração do teto por algoritmo
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Tempo e contadores dizem quanto um algoritmo custou, mas não se ele
+ * esbarrou no limite da máquina. A sonda mede na inicialização a banda
+ * sustentável de UMA thread (as ordenações rodam em uma thread) com os
+ * dois núcleos mais simples do STREAM, em arrays bem maiores que a LLC:
+ *
+ *   cópia:  b[i] = a[i]        16 bytes por elemento (8 lidos + 8 escritos)
+ *   escala: a[i] = q · b[i]    16 bytes por elemento
+ *
+ * Cada medição de ordenação registra bytes lidos e escritos derivados
+ * das movimentações (cada movimentação lê e escreve elem_size bytes):
+ *
+ *   banda atingida = (bytes lidos + bytes escritos) / tempo
+ *   fração do teto = banda atingida / max(cópia, escala)
+ *
+ *  ┌──────────────┬──────────────────────────────────────────────┐
+ *  │ fração ~ 1   │ limitado pela memória: só menos bytes ajudam │
+ *  │ fração << 1  │ limitado por comparações/desvios: há folga   │
+ *  │ fração > 1   │ dados na cache: o teto da DRAM não se aplica │
+ *  └──────────────┴──────────────────────────────────────────────┘
+ *
+ * As leituras feitas pelas comparações não entram: em geral vêm de
+ * registradores ou da L1 e dominariam a conta sem gerar tráfego real.
+ *
+ * ==============================================================
+ */
+
+#ifndef BANDA_H
+#define BANDA_H
+
+#include <stddef.h>
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define ELEMENTOS_SONDA_BANDA (1 << 22)   ///< 4M doubles = 32 MB por array
+#define ELEMENTOS_MINIMOS_SONDA (1 << 19)  ///< 4 MB: abaixo disso a sonda desiste
+#define REPETICOES_SONDA_BANDA 5          ///< Melhor de 5, como o STREAM
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Resultado da sonda (GB/s = 1e9 bytes por segundo)
+ */
+typedef struct {
+    int medida;            ///< 0 se a sonda não pôde rodar (sem memória)
+    double copia;          ///< GB/s do núcleo de cópia
+    double escala;         ///< GB/s do núcleo de escala
+    double teto;           ///< max(copia, escala): teto do roofline
+    size_t bytes_array;    ///< Tamanho de cada um dos dois arrays
+} BandaMemoria;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Executa a sonda uma única vez (chamadas seguintes retornam na hora)
+ *
+ * Chamada no início do programa; segura para chamadas concorrentes.
+ */
+void medir_banda_memoria(void);
+
+/**
+ * @brief Resultado da sonda (mede na primeira chamada, se preciso)
+ */
+const BandaMemoria* obter_banda_memoria(void);
+
+/**
+ * @brief (bytes lidos + escritos) / tempo da medição, em GB/s
+ *
+ * @return 0 se a medição não tem bytes conhecidos (projetada ou referência da libc)
+ */
+double banda_atingida(const ResultadoTempo *resultado);
+
+/**
+ * @brief Banda atingida / teto da sonda (0 se a sonda não rodou)
+ */
+double fracao_teto_banda(double gb_por_segundo);
+
+/**
+ * @brief Formata a banda para tabelas: "3.42" ou "-" se 0
+ */
+void formatar_banda(double gb_por_segundo, char *buffer, size_t tamanho_buffer);
+
+/**
+ * @brief Formata a fração do teto: "12.5%", "134.0%*" acima do teto ou "-" se 0
+ *
+ * O asterisco marca medições cujos dados cabiam na cache.
+ */
+void formatar_fracao_banda(double fracao, char *buffer, size_t tamanho_buffer);
+
+/**
+ * @brief Descreve a sonda (ex.: "copia 9.81 GB/s, escala 9.64 GB/s, 2 x 32 MB, 1 thread")
+ */
+void descrever_banda_memoria(char *buffer, size_t tamanho_buffer);
+
+#endif // BANDA_H
@@ -0,0 +1,154 @@
+/**
+ * ==============================================================
+ * PESQUISA EM VETORES ORDENADOS - LAYOUTS AMIGÁVEIS À CACHE
+ * ==============================================================
+ *
+ * @file busca.h
+ * @brief Busca binária sem desvios, layout de Eytzinger e árvore B+ estática
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Toda busca devolve o limite inferior: a posição, no vetor ordenado
+ * original, da primeira chave >= a procurada (n se não houver). As três
+ * estruturas fazem a mesma pergunta com padrões de acesso diferentes:
+ *
+ *  ┌────────────┬────────────────────────────────┬─────────────────────────────┐
+ *  │ Estrutura  │ Layout                         │ Linhas de cache por busca   │
+ *  ├────────────┼────────────────────────────────┼─────────────────────────────┤
+ *  │ binaria    │ o próprio vetor ordenado       │ ~log2(n); prefetch só do    │
+ *  │            │                                │ passo seguinte              │
+ *  │ eytzinger  │ árvore em largura: filhos de k │ ~log2(n), mas os 16 netos   │
+ *  │            │ em 2k e 2k+1                   │ de 4 níveis abaixo ficam em │
+ *  │            │                                │ uma linha → prefetch        │
+ *  │ arvore_b   │ nós de 16 chaves (64 bytes);   │ log17(n): um nó por nível,  │
+ *  │            │ folhas = vetor ordenado        │ comparado com SIMD          │
+ *  └────────────┴────────────────────────────────┴─────────────────────────────┘
+ *
+ * **Buscas em lote:** as funções *_lote avançam LOTE_BUSCA consultas
+ * em sequência, um nível por vez: enquanto a consulta i espera a
+ * memória, as outras já pediram as suas linhas, e a latência da RAM se
+ * sobrepõe em vez de se somar.
+ *
+ * As estruturas copiam as chaves na construção; o vetor original pode ser
+ * liberado. Construção e busca não alteram estado global (thread-safe
+ * para leitura concorrente). Medidas pelo alvo busca_bench.
+ *
+ * ==============================================================
+ */
+
+#ifndef BUSCA_H
+#define BUSCA_H
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define LOTE_BUSCA 16            ///< Consultas intercaladas nas buscas em lote
+#define CHAVES_NO_ARVORE_B 16    ///< Chaves por nó: 16 × 4 bytes = uma linha de cache
+#define ALINHAMENTO_BUSCA 64     ///< Alinhamento das estruturas (linha de cache)
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Vetor em ordem de Eytzinger (busca em largura), base 1
+ *
+ * nos[0] não é usado; a raiz fica em nos[1] e os filhos de k em 2k e
+ * 2k + 1. posicoes[k] guarda a posição da chave nos[k] no vetor
+ * ordenado (lida uma vez, no fim de cada busca).
+ */
+typedef struct {
+    int *nos;        ///< n + 1 chaves, alinhadas a ALINHAMENTO_BUSCA
+    int *posicoes;   ///< n + 1 posições no vetor ordenado
+    int n;
+} IndiceEytzinger;
+
+/**
+ * @brief Árvore B+ estática (S+ tree) com nós de CHAVES_NO_ARVORE_B chaves
+ *
+ * A camada 0 (folhas) é o vetor ordenado completado com INT_MAX até um
+ * múltiplo de 16. Na camada h > 0, a chave j do nó i é a maior chave
+ * do filho 16i + j; para descer basta contar as chaves menores que a
+ * procurada. As camadas ficam em um único bloco, raiz primeiro.
+ * Chaves maiores que `maior` são respondidas antes da descida: os
+ * filhos completados com INT_MAX não existem na camada de baixo.
+ */
+typedef struct {
+    int *chaves;          ///< Todas as camadas, alinhadas a ALINHAMENTO_BUSCA
+    int inicio[8];        ///< Deslocamento (em chaves) de cada camada; 8 níveis cobrem 2^31
+    int camadas;          ///< Número de camadas (>= 1)
+    int maior;            ///< Última chave real; acima dela a resposta é n
+    int n;
+} IndiceArvoreB;
+
+/* ==============================================================
+ * BUSCA BINÁRIA SEM DESVIOS
+ * ============================================================== */
+
+/**
+ * @brief Limite inferior de `chave` em `ordenado` (0..n)
+ *
+ * O laço tem sempre ceil(log2 n) iterações e a escolha da metade é
+ * aritmética: nenhuma predição de desvio a errar. Sem desvio também não
+ * há execução especulativa adiantando a próxima leitura, então as duas
+ * sondas possíveis do passo seguinte são pedidas com prefetch.
+ */
+int busca_binaria(const int *ordenado, int n, int chave);
+
+/**
+ * @brief busca_binaria para num_consultas chaves, LOTE_BUSCA por vez
+ *
+ * @param resultados resultados[i] = busca_binaria(ordenado, n, consultas[i])
+ */
+void busca_binaria_lote(const int *ordenado, int n, const int *consultas, int num_consultas,
+                        int *resultados);
+
+/* ==============================================================
+ * LAYOUT DE EYTZINGER
+ * ============================================================== */
+
+/**
+ * @brief Constrói o layout a partir de um vetor ordenado (percurso em ordem)
+ *
+ * @return 0 em sucesso, -1 sem memória (indice fica vazio)
+ */
+int construir_eytzinger(IndiceEytzinger *indice, const int *ordenado, int n);
+
+/**
+ * @brief Limite inferior (posição no vetor ordenado) com prefetch 4 níveis à frente
+ */
+int buscar_eytzinger(const IndiceEytzinger *indice, int chave);
+
+/**
+ * @brief buscar_eytzinger para num_consultas chaves, LOTE_BUSCA por vez
+ */
+void buscar_eytzinger_lote(const IndiceEytzinger *indice, const int *consultas, int num_consultas,
+                           int *resultados);
+
+void liberar_eytzinger(IndiceEytzinger *indice);
+
+/* ==============================================================
+ * ÁRVORE B+ ESTÁTICA
+ * ============================================================== */
+
+/**
+ * @brief Constrói as camadas a partir de um vetor ordenado
+ *
+ * @return 0 em sucesso, -1 sem memória (indice fica vazio)
+ */
+int construir_arvore_b(IndiceArvoreB *indice, const int *ordenado, int n);
+
+/**
+ * @brief Limite inferior; cada nó é comparado com SSE2 (4 comparações de 4 chaves)
+ */
+int buscar_arvore_b(const IndiceArvoreB *indice, int chave);
+
+/**
+ * @brief buscar_arvore_b para num_consultas chaves, LOTE_BUSCA por vez
+ */
+void buscar_arvore_b_lote(const IndiceArvoreB *indice, const int *consultas, int num_consultas,
+                          int *resultados);
+
+void liberar_arvore_b(IndiceArvoreB *indice);
+
+#endif // BUSCA_H
@@ -0,0 +1,115 @@
+/**
+ * ==============================================================
+ * CACHE DE RESULTADOS E RETOMADA DO RELATÓRIO COMPLETO
+ * ==============================================================
+ *
+ * @file cache_resultados.h
+ * @brief Reaproveita células já medidas e permite retomar a análise completa
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * A análise completa mede cada (conjunto, motor, versão) do zero e leva
+ * minutos; uma queda ou um Ctrl-C no meio jogava tudo fora. Cada célula
+ * medida vira uma linha do arquivo de cache, gravada e descarregada
+ * assim que a medição termina, então o próprio cache é o ponto de
+ * retomada:
+ *
+ *  ┌────────────────────────────┐   ┌──────────────────────────────┐
+ *  │ Chave: checksum dos dados, │ → │ Achou: reaproveita tempo e   │
+ *  │ n, elem_size, id do motor, │   │ contadores (não mede)        │
+ *  │ variante, parâmetros,      │   ├──────────────────────────────┤
+ *  │ isolamento, build, máquina │   │ Não achou: mede e acrescenta │
+ *  └────────────────────────────┘   │ a linha (fflush imediato)    │
+ *                                   └──────────────────────────────┘
+ *
+ * Invalidação: o build (hash do executável) e a máquina ficam na chave;
+ * ao abrir, o arquivo é compactado e só mantém entradas deste build
+ * nesta máquina. Os parâmetros do autoajuste só entram na chave da
+ * variante otimizada, a única que os usa: um novo perfil remede só
+ * essas células. A configuração de isolamento (fixação, pré-falha,
+ * mlock, cache quente/fria) entra na chave de todas as variantes.
+ * Motores de plugin (código fora do executável) nunca
+ * entram no cache.
+ *
+ * Células reaproveitadas não geram fases nem arrays ordenados: ambos
+ * vieram da execução que as mediu. O resumo de fases lista essas
+ * células (fases_registrar_celula_cache).
+ *
+ * SORTS_SEM_CACHE=1 desliga o cache; apagar output/cache_resultados.tsv
+ * força a remedição de tudo.
+ *
+ * ==============================================================
+ */
+
+#ifndef CACHE_RESULTADOS_H
+#define CACHE_RESULTADOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define ARQUIVO_CACHE_RESULTADOS "cache_resultados.tsv"  ///< Em output/ (ou ../output, ../../output)
+#define VERSAO_CACHE_RESULTADOS 2
+#define VARIAVEL_AMBIENTE_SEM_CACHE "SORTS_SEM_CACHE"
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Carrega e compacta o cache; a partir daqui as buscas valem
+ *
+ * @return Entradas válidas carregadas, ou -1 se desligado/indisponível
+ *         (as medições seguem normalmente, sem cache)
+ */
+int abrir_cache_resultados(void);
+
+/**
+ * @brief Fecha o arquivo e imprime quantas células foram reaproveitadas
+ */
+void fechar_cache_resultados(void);
+
+/**
+ * @brief 1 entre abrir_cache_resultados() e fechar_cache_resultados()
+ */
+int cache_resultados_ativo(void);
+
+/**
+ * @brief Procura a célula do motor na versão em vigor
+ *
+ * Preenche em `destino` tempo, ticks, contadores, bytes, modo de
+ * isolamento e `projetado`; nome, tipo e tamanho ficam com o chamador.
+ *
+ * @return 1 se achou, 0 caso contrário (ou motor que não é cacheado)
+ */
+int buscar_resultado_cache(const AlgoritmoInfo *info, uint64_t checksum, int tamanho,
+                           size_t elem_size, ResultadoTempo *destino);
+
+/**
+ * @brief Acrescenta uma célula (medida ou projetada) ao arquivo
+ */
+void gravar_resultado_cache(const AlgoritmoInfo *info, uint64_t checksum, int tamanho,
+                            size_t elem_size, const ResultadoTempo *resultado);
+
+/**
+ * @brief Instala o tratador de SIGINT da análise completa
+ *
+ * O primeiro Ctrl-C só pede a parada: a célula em andamento termina e
+ * é gravada. O segundo restaura o comportamento padrão e encerra.
+ */
+void instalar_interrupcao_relatorio(void);
+
+/**
+ * @brief Devolve o tratador anterior e zera o pedido de parada
+ */
+void restaurar_interrupcao_relatorio(void);
+
+/**
+ * @brief 1 se um Ctrl-C pediu a parada da análise
+ */
+int relatorio_interrompido(void);
+
+#endif // CACHE_RESULTADOS_H
@@ -0,0 +1,111 @@
+/**
+ * ==============================================================
+ * REGISTRO DE CONJUNTOS DE DADOS E POOL DE BUFFERS
+ * ==============================================================
+ *
+ * @file conjuntos.h
+ * @brief Conjuntos carregados uma vez, com checksum e perfil de desordem
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * A análise completa lia cada arquivo numérico duas vezes (uma por
+ * versão) e a matriz paralela lia tudo de novo; cada medição ainda
+ * alocava e liberava suas cópias de trabalho. O registro carrega cada
+ * conjunto uma única vez e calcula o que só depende dos dados:
+ *
+ *  ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ *  │ 12 arquivos numéricos│ → │ Checksum FNV-1a,     │ → │ Visões somente       │
+ *  │ + registros de       │   │ métricas de desordem │   │ leitura para fases,  │
+ *  │ pessoas (alunos)     │   │ e categoria          │   │ versões e motores    │
+ *  └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * Os numéricos vêm do estágio fundido de io.h: checksum, extremos,
+ * corridas, histograma e assinatura saem da própria leitura.
+ *
+ * Quem ordena nunca escreve na visão: copia para um buffer emprestado
+ * do pool e o devolve ao terminar. O pool guarda os buffers entre
+ * medições (e entre threads da matriz), então o regime estável não
+ * chama malloc.
+ *
+ * Os dados ficam carregados até o fim do programa.
+ *
+ * ==============================================================
+ */
+
+#ifndef CONJUNTOS_H
+#define CONJUNTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tipos.h"
+#include "desordem.h"
+#include "io.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_CONJUNTOS_DADOS 16          ///< 12 numéricos + alunos, com folga
+#define ARQUIVO_ALUNOS "registros_pessoas_1000.txt"  ///< Em data/ (ou ../data, ../../data)
+#define NUM_BUFFERS_POOL 16             ///< Buffers guardados; além disso, malloc/free
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Visão somente leitura de um conjunto carregado
+ */
+typedef struct {
+    char nome[64];              ///< Arquivo de origem (ex.: "numeros_aleatorios_500.txt")
+    char tipo_dados[20];        ///< "numeros" ou "alunos"
+    char categoria[40];         ///< Família para projeções (extrair_categoria_dados)
+    const void *dados;          ///< Elementos originais (nunca modificados)
+    int tamanho;                ///< Número de elementos
+    size_t elem_size;           ///< Tamanho de cada elemento
+    CompareFn cmp;              ///< Comparador adequado ao tipo
+    uint64_t checksum;          ///< checksum_dados() dos bytes (chave do cache de resultados)
+    MetricasDesordem desordem;  ///< Pré-ordenação da entrada
+    EstatisticasCarga carga;    ///< Do estágio fundido (só numéricos; senão calculadas = 0)
+} ConjuntoDados;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Carrega os conjuntos na primeira chamada; depois só devolve a contagem
+ *
+ * Arquivos ausentes geram aviso e ficam de fora. Chame antes de criar
+ * threads de medição.
+ *
+ * @return Conjuntos disponíveis
+ */
+int carregar_conjuntos_dados(void);
+
+/**
+ * @brief Conjunto pelo índice (numéricos primeiro, na ordem de obter_arquivos_numeros)
+ *
+ * @return NULL se o índice estiver fora da faixa
+ */
+const ConjuntoDados* obter_conjunto_dados(int indice);
+
+/**
+ * @brief Metadados do conjunto cuja visão é `dados`, ou NULL se não for uma
+ */
+const ConjuntoDados* conjunto_da_visao(const void *dados);
+
+/**
+ * @brief Buffer de pelo menos `bytes` para cópias de trabalho (thread-safe)
+ *
+ * O conteúdo é indefinido. Devolva com devolver_buffer_trabalho().
+ *
+ * @return NULL se faltar memória
+ */
+void* emprestar_buffer_trabalho(size_t bytes);
+
+/**
+ * @brief Devolve ao pool um buffer de emprestar_buffer_trabalho() (NULL é ignorado)
+ */
+void devolver_buffer_trabalho(void *buffer);
+
+#endif // CONJUNTOS_H
@@ -0,0 +1,137 @@
+/**
+ * ==============================================================
+ * VAZÃO SOB CONTENÇÃO
+ * ==============================================================
+ *
+ * @file contencao.h
+ * @brief T threads ordenando arrays próprios ao mesmo tempo, T = 1..núcleos
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * A matriz paralela limita a concorrência justamente para que as threads
+ * não disputem banda de memória e LLC. Em produção essa disputa é a
+ * regra: muitas ordenações independentes rodam ao mesmo tempo. Aqui cada
+ * thread, fixada em um núcleo físico, repete "copia o seu array → ordena"
+ * por uma janela fixa, e T cresce em potências de 2 até o número de
+ * núcleos:
+ *
+ *  ┌──────────┐ ┌──────────┐       ┌──────────┐
+ *  │ thread 0 │ │ thread 1 │  ...  │ thread T │   largada simultânea
+ *  │ array 0  │ │ array 1  │       │ array T  │   (n ints cada, sementes
+ *  └────┬─────┘ └────┬─────┘       └────┬─────┘    distintas)
+ *       └────────────┴───── LLC / DRAM ─┘          ← recurso disputado
+ *
+ * **Métricas por (motor, T):**
+ * - Vazão agregada: elementos ordenados por segundo somando as threads
+ * - Eficiência: vazão(T) / (T × vazão(1)); 1 = escala perfeitamente
+ * - Lentidão por thread: latência média da thread / latência média do
+ *   mesmo motor rodando sozinho (T = 1); média e pior thread
+ * - Percentis p50/p99/p99.9 das ordenações de todas as threads
+ *
+ * Só entram motores com complexidade média abaixo de n²: com o tamanho
+ * padrão, um O(n²) levaria segundos por ordenação e a janela teria uma
+ * única amostra.
+ *
+ * **Plataformas:**
+ * Sem pthreads/sched_setaffinity (não-Linux) apenas T = 1 é medido.
+ *
+ * ==============================================================
+ */
+
+#ifndef CONTENCAO_H
+#define CONTENCAO_H
+
+#include <stdint.h>
+#include "tipos.h"
+#include "registro.h"
+#include "paralelo.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define TAMANHO_CONTENCAO_PADRAO 65536       ///< 256 KB por array: acima da L2 típica
+#define DURACAO_PONTO_CONTENCAO 1.0          ///< Janela de medição de cada T (s)
+#define MAX_AMOSTRAS_THREAD_CONTENCAO 16384  ///< Latências guardadas por thread
+#define MAX_PONTOS_CONTENCAO 8               ///< 1, 2, 4, ..., 64 e o total de núcleos
+#define AMOSTRAS_MINIMAS_P999 1000           ///< Abaixo disso o p99.9 é o máximo
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Parâmetros de uma execução
+ */
+typedef struct {
+    int tamanho_array;        ///< Elementos do array de cada thread
+    double duracao_ponto;     ///< Segundos de medição por (motor, T)
+    int max_threads;          ///< 0 = núcleos físicos; acima disso há sobreinscrição
+    uint64_t semente;         ///< Semente base (thread i usa semente + i)
+} ConfiguracaoContencao;
+
+/**
+ * @brief Um valor de T para um motor
+ */
+typedef struct {
+    int threads;
+    long long ordenacoes;     ///< Somando todas as threads
+    int amostras;             ///< Latências usadas nos percentis
+    double janela;            ///< Maior janela entre as threads (s)
+    double vazao;             ///< Elementos por segundo, agregado
+    double eficiencia;        ///< vazao / (threads × vazao com T = 1)
+    double lentidao_media;    ///< Média entre threads de latência / latência isolada
+    double lentidao_pior;     ///< Pior thread
+    double media;             ///< Latência média (ns)
+    double p50;               ///< ns
+    double p99;               ///< ns
+    double p999;              ///< ns (0 se amostras < AMOSTRAS_MINIMAS_P999)
+    double maximo;            ///< ns
+} PontoContencao;
+
+/**
+ * @brief Todos os valores de T medidos para um motor
+ */
+typedef struct {
+    int indice_motor;         ///< Índice em obter_info_motor()
+    int num_pontos;
+    PontoContencao pontos[MAX_PONTOS_CONTENCAO];
+} CurvaContencao;
+
+/**
+ * @brief Resultado completo
+ */
+typedef struct {
+    ConfiguracaoContencao config;
+    int nucleos_fisicos;
+    int cpus[MAX_TRABALHADORES];  ///< Thread t roda em cpus[t % nucleos_fisicos]
+    int num_curvas;
+    CurvaContencao curvas[MAX_MOTORES];
+} ResultadoContencao;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief 65536 elementos por thread, 1 s por ponto, até o total de núcleos físicos
+ */
+ConfiguracaoContencao configuracao_contencao_padrao(void);
+
+/**
+ * @brief Mede todos os motores sub-quadráticos para T = 1, 2, 4, ..., max_threads
+ *
+ * @return Resultado alocado (liberar com free), ou NULL se faltar memória
+ */
+ResultadoContencao* executar_contencao(const ConfiguracaoContencao *config);
+
+/**
+ * @brief Salva contencao_threads.txt e contencao_threads.csv em output/relatorios/
+ */
+void gerar_relatorio_contencao(const ResultadoContencao *resultado);
+
+/**
+ * @brief Ponto de entrada do menu: mede, resume e salva os relatórios
+ */
+void executar_contencao_completa(void);
+
+#endif // CONTENCAO_H
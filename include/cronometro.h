@@ -0,0 +1,105 @@
+/**
+ * ==============================================================
+ * CRONÔMETRO DE CICLOS COM CALIBRAÇÃO DE OVERHEAD
+ * ==============================================================
+ *
+ * @file cronometro.h
+ * @brief Medição em ticks inteiros via TSC invariante (ou relógio do SO)
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * obter_timestamp_precisao() devolve segundos em double a partir de
+ * clock_gettime: cada leitura custa dezenas de nanossegundos e o valor
+ * perde resolução conforme o uptime cresce. Ao ordenar 500 elementos
+ * (poucos microssegundos) isso já é uma fração visível do resultado.
+ *
+ * **Fontes de tempo (escolhidas uma vez, na inicialização):**
+ * - TSC invariante (x86): lfence+rdtsc no início, rdtscp+lfence no fim;
+ *   frequência calibrada contra CLOCK_MONOTONIC_RAW
+ * - Relógio do SO: nanossegundos de CLOCK_MONOTONIC_RAW (ou QPC no
+ *   Windows) quando o TSC não é invariante ou a arquitetura não tem TSC
+ *
+ * **Overhead:**
+ * O custo de uma região vazia (início seguido de fim) é medido na
+ * inicialização e subtraído de cada intervalo por cronometro_decorrido().
+ *
+ * ==============================================================
+ */
+
+#ifndef CRONOMETRO_H
+#define CRONOMETRO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ==============================================================
+ * CONSTANTES DE CALIBRAÇÃO
+ * ============================================================== */
+
+#define CALIBRACAO_TSC_NS 20000000ULL   ///< Janela de calibração do TSC (20 ms)
+#define AMOSTRAS_OVERHEAD 1000          ///< Regiões vazias medidas para o overhead
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Fonte de ticks em uso
+ */
+typedef enum {
+    FONTE_RELOGIO_SO = 0,  ///< Nanossegundos do relógio monotônico do sistema
+    FONTE_TSC              ///< Contador de ciclos invariante (x86)
+} FonteCronometro;
+
+/**
+ * @brief Parâmetros determinados na inicialização
+ */
+typedef struct {
+    FonteCronometro fonte;       ///< Fonte escolhida
+    double ticks_por_segundo;    ///< Frequência dos ticks
+    uint64_t overhead_ticks;     ///< Custo mínimo de uma região vazia
+} InfoCronometro;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Escolhe a fonte, calibra a frequência e mede o overhead
+ *
+ * Chamada automaticamente na primeira leitura; chamar explicitamente
+ * antes de iniciar threads evita que a calibração caia dentro de uma
+ * medição. Segura para chamadas concorrentes.
+ */
+void inicializar_cronometro(void);
+
+/**
+ * @brief Retorna a fonte, a frequência e o overhead em uso
+ */
+const InfoCronometro* obter_info_cronometro(void);
+
+/**
+ * @brief Lê os ticks no início de uma região (serializa instruções anteriores)
+ */
+uint64_t cronometro_iniciar(void);
+
+/**
+ * @brief Lê os ticks no fim de uma região (espera a região terminar)
+ */
+uint64_t cronometro_parar(void);
+
+/**
+ * @brief Ticks entre início e fim já descontado o overhead (nunca negativo)
+ */
+uint64_t cronometro_decorrido(uint64_t inicio, uint64_t fim);
+
+/**
+ * @brief Converte ticks em segundos
+ */
+double ticks_para_segundos(uint64_t ticks);
+
+/**
+ * @brief Descreve a fonte em texto (ex.: "TSC invariante 2.995 GHz, overhead 28 ticks")
+ */
+void descrever_cronometro(char *buffer, size_t tamanho_buffer);
+
+#endif // CRONOMETRO_H
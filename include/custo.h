@@ -0,0 +1,150 @@
+/**
+ * ==============================================================
+ * MODELO DE CUSTO: COMPARAÇÕES × BYTES MOVIDOS
+ * ==============================================================
+ *
+ * @file custo.h
+ * @brief Comparador com custo sintético, varredura de elem_size e ajuste
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Se o gargalo são as comparações ou as cópias depende do tipo ordenado:
+ * um int compara e copia quase de graça, um registro de 1 KB com chave
+ * em string não. Para cada algoritmo (versão otimizada) e cada plugin
+ * que aceita registros genéricos, a análise mede a mesma entrada em uma
+ * grade
+ *
+ *   n: 250, 500, 1000 chaves (entradas aleatórias diferentes)
+ *   tamanho do elemento: 4, 8, 16, ..., 1024 bytes (interface genérica)
+ *   custo da comparação: 0, 32, 256 ticks extras por chamada
+ *
+ * e ajusta, para cada custo de comparação (27 pontos):
+ *
+ *   tempo ≈ k + a · comparações + b · bytes_movidos
+ *
+ * com bytes_movidos = movimentações × elem_size. `k` é o custo fixo da
+ * chamada, `a` o de uma comparação (inclui o custo sintético) e `b` o de
+ * um byte copiado. Com um só n, C seria a mesma constante em todos os
+ * pontos e a·C viraria um intercepto: são os três tamanhos de n que
+ * fazem C variar e separam `a` de `k`. Se C ainda assim não variar
+ * VARIACAO_MINIMA_COMPARACOES_CUSTO, `a` não é ajustado nem reportado.
+ *
+ * O ponto de equilíbrio a·C = b·M·S dá o tamanho de elemento a partir do
+ * qual as cópias dominam; a tabela de escolha aplica o modelo para
+ * indicar o algoritmo mais barato para um tipo de registro novo.
+ *
+ * ==============================================================
+ */
+
+#ifndef CUSTO_H
+#define CUSTO_H
+
+#include <stdint.h>
+#include "tipos.h"
+#include "registro.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define TAMANHO_MODELO_CUSTO 1000      ///< Maior n da grade (e o n da tabela de escolha)
+#define NUM_TAMANHOS_N_CUSTO 3         ///< n/4, n/2 e n: fazem as comparações variarem
+#define NUM_TAMANHOS_ELEMENTO_CUSTO 9  ///< 4, 8, 16, ..., 1024 bytes
+#define NUM_PONTOS_AJUSTE_CUSTO (NUM_TAMANHOS_N_CUSTO * NUM_TAMANHOS_ELEMENTO_CUSTO)
+#define VARIACAO_MINIMA_COMPARACOES_CUSTO 0.05  ///< Sem 5% de variação em C, `a` não é identificável
+#define NUM_CUSTOS_COMPARACAO 3        ///< Níveis de custo sintético da comparação
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Uma medição da grade
+ */
+typedef struct {
+    int n;
+    size_t elem_size;
+    uint64_t custo_ticks;       ///< Ticks extras gastos em cada comparação
+    long long comparacoes;
+    long long movimentacoes;
+    double bytes_movidos;       ///< movimentacoes × elem_size
+    double tempo;               ///< Segundos (média de medir_algoritmo)
+} PontoCusto;
+
+/**
+ * @brief tempo ≈ k + a·comparações + b·bytes_movidos
+ */
+typedef struct {
+    double k;      ///< Segundos fixos por chamada (intercepto)
+    double a;      ///< Segundos por comparação
+    double b;      ///< Segundos por byte movido
+    double r2;     ///< Coeficiente de determinação do ajuste
+    int pontos;
+    int a_identificado;  ///< 0 se C não variou no ajuste (a fica em 0 e não é reportado)
+} ModeloCusto;
+
+/**
+ * @brief Grade e modelos de um algoritmo
+ */
+typedef struct {
+    char algoritmo[30];
+    PontoCusto pontos[NUM_CUSTOS_COMPARACAO][NUM_TAMANHOS_N_CUSTO][NUM_TAMANHOS_ELEMENTO_CUSTO];
+    ModeloCusto modelos[NUM_CUSTOS_COMPARACAO];
+} CustoAlgoritmo;
+
+/**
+ * @brief Resultado completo da análise
+ */
+typedef struct {
+    int tamanho;                ///< Maior n (o da tabela de escolha)
+    int tamanhos_n[NUM_TAMANHOS_N_CUSTO];
+    size_t tamanhos_elemento[NUM_TAMANHOS_ELEMENTO_CUSTO];
+    uint64_t custos_ticks[NUM_CUSTOS_COMPARACAO];
+    CustoAlgoritmo algoritmos[MAX_MOTORES];
+    int num_algoritmos;
+} RelatorioCusto;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Define o comparador envolvido e o custo extra (na thread atual)
+ *
+ * O custo é gasto em um laço de espera calibrado contra o cronômetro:
+ * ticks são ciclos de referência com TSC, nanossegundos sem TSC.
+ */
+void configurar_custo_comparacao(CompareFn base, uint64_t ticks);
+
+/**
+ * @brief Gasta o custo configurado e delega ao comparador base
+ */
+int comparar_com_custo(const void *a, const void *b);
+
+/**
+ * @brief Mínimos quadrados não negativos de tempo = k + a·C + b·B
+ *
+ * Cada ponto pesa 1/tempo², de modo que o erro relativo conta igual em
+ * elementos de 4 bytes e de 1 KB. Coeficientes negativos não têm
+ * significado físico: vence o subconjunto de termos com coeficientes
+ * >= 0 e menor resíduo. O termo `a` só entra se C variar entre os pontos.
+ */
+ModeloCusto ajustar_modelo_custo(const PontoCusto *pontos, int num_pontos);
+
+/**
+ * @brief Mede a grade completa e ajusta os modelos de todos os algoritmos
+ *
+ * @return 0 em caso de sucesso, -1 se faltar memória
+ */
+int medir_modelo_custo(RelatorioCusto *relatorio);
+
+/**
+ * @brief Salva modelo_custo.txt e modelo_custo.csv em output/relatorios/
+ */
+void gerar_relatorio_custo(const RelatorioCusto *relatorio);
+
+/**
+ * @brief Ponto de entrada do menu: mede, resume na tela e salva os relatórios
+ */
+void executar_analise_custo(void);
+
+#endif // CUSTO_H
@@ -0,0 +1,100 @@
+/**
+ * ==============================================================
+ * MÉTRICAS DE PRÉ-ORDENAÇÃO DAS ENTRADAS
+ * ==============================================================
+ *
+ * @file desordem.h
+ * @brief Inversões, corridas, LNDS, chaves distintas e entropia por conjunto
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * O rótulo do arquivo ("aleatorios", "crescentes", "decrescentes") não
+ * diz quão ordenada a entrada realmente está. Estas métricas medem isso
+ * e acompanham cada linha de resultado (ResultadoTempo.desordem):
+ *
+ * | Métrica             | Explica                                        |
+ * |---------------------|------------------------------------------------|
+ * | inversões           | deslocamentos do Insertion Sort, trocas do Bubble |
+ * | corridas            | passes de algoritmos que param cedo            |
+ * | maior subsequência  | n - LNDS = elementos fora do lugar (Rem)       |
+ * | razão de distintos  | partições degeneradas no Quick Sort            |
+ * | entropia            | limite inferior de comparações com repetições  |
+ *
+ * Todas usam a função de comparação da própria ordenação e não alteram
+ * os contadores globais de comparações.
+ *
+ * O relatório completo acumula uma linha por (versão, conjunto, algoritmo)
+ * e grava desordem_entradas.csv, pronto para regressão do tempo contra as
+ * propriedades da entrada.
+ *
+ * ==============================================================
+ */
+
+#ifndef DESORDEM_H
+#define DESORDEM_H
+
+#include <stdio.h>
+#include "tipos.h"
+#include "io.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_LINHAS_DESORDEM 512  ///< Linhas acumuladas para desordem_entradas.csv
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Calcula todas as métricas em O(n log n)
+ *
+ * Uma ordenação por intercalação de uma cópia conta as inversões e deixa
+ * as chaves agrupadas para distintos e entropia; a maior subsequência não
+ * decrescente usa busca binária sobre as caudas (paciência).
+ *
+ * @return 0 em caso de sucesso, -1 se faltar memória (metricas->calculadas = 0)
+ */
+int calcular_metricas_desordem(const void *dados, int n, size_t elem_size, CompareFn cmp,
+                               MetricasDesordem *metricas);
+
+/**
+ * @brief Mesmas métricas para int com comparar_inteiros, partindo da carga
+ *
+ * As corridas contadas na leitura dispensam a passada delas; com uma só
+ * corrida a entrada já está ordenada e nada é reordenado (inversões 0,
+ * LNDS = n), e mínimo == máximo dispensa até o agrupamento das chaves.
+ * Sem estatísticas (carga NULL ou não calculada) equivale a
+ * calcular_metricas_desordem().
+ */
+int calcular_metricas_desordem_carga(const int *dados, int n, const EstatisticasCarga *carga,
+                                     MetricasDesordem *metricas);
+
+/**
+ * @brief Resumo de uma linha (ex.: "inversoes 12.3%, 4 corridas, ...")
+ */
+void descrever_metricas_desordem(const MetricasDesordem *metricas, int n,
+                                 char *buffer, size_t tamanho_buffer);
+
+/**
+ * @brief Bloco "PERFIL DA ENTRADA" dos relatórios de tempo
+ */
+void escrever_metricas_desordem(FILE *arquivo, const MetricasDesordem *metricas, int n);
+
+/**
+ * @brief Descarta as linhas acumuladas para o CSV
+ */
+void desordem_limpar(void);
+
+/**
+ * @brief Acumula uma linha de resultado para desordem_entradas.csv
+ */
+void registrar_resultado_desordem(const ResultadoTempo *resultado, const char *arquivo,
+                                  const char *versao);
+
+/**
+ * @brief Salva desordem_entradas.csv em output/relatorios/
+ */
+void gerar_relatorio_desordem(void);
+
+#endif // DESORDEM_H
@@ -0,0 +1,131 @@
+/**
+ * ==============================================================
+ * INSTRUMENTAÇÃO POR FASES DOS ALGORITMOS
+ * ==============================================================
+ *
+ * @file fases.h
+ * @brief Cronômetros de fase internos aos algoritmos e exportação Chrome trace
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * O tempo total de um algoritmo não diz onde ele é gasto. As macros deste
+ * cabeçalho marcam fases dentro das implementações:
+ * - Heap Sort: construção do heap × extração
+ * - Quick Sort: escolha do pivô × partição × recursão
+ * - Shell Sort: uma fase por gap (o valor do gap vai junto no evento)
+ *
+ * **Custo zero quando desligado:**
+ * Sem SORTS_INSTRUMENTAR_FASES (opção CMake de mesmo nome, OFF por padrão)
+ * as macros viram ((void)0) e nada é compilado nos algoritmos.
+ *
+ * **Saídas (gerar_relatorio_fases):**
+ * - fases_trace.json: eventos "X" do formato Chrome trace, abre no Perfetto
+ *   (ui.perfetto.dev) ou em chrome://tracing
+ * - fases_resumo.txt: chamadas, tempo inclusivo e exclusivo por fase
+ *
+ * Células reaproveitadas do cache de resultados não rodam e não geram
+ * fases; o resumo as lista (e o trace as conta) para que a ausência
+ * delas não passe por custo zero.
+ *
+ * Cada fase deve ter um FASE_FIM() correspondente no mesmo escopo.
+ *
+ * ==============================================================
+ */
+
+#ifndef FASES_H
+#define FASES_H
+
+#include <stdint.h>
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_EVENTOS_FASE 200000         ///< Eventos de trace guardados por thread
+#define MAX_PROFUNDIDADE_FASES 256      ///< Fases aninhadas acompanhadas por thread
+#define PROFUNDIDADE_MAXIMA_TRACE 8     ///< Níveis exportados para o trace (o resumo usa todos)
+#define MAX_FASES_DISTINTAS 64          ///< Pares (fase, versão) no resumo
+#define MAX_CELULAS_CACHE_FASES 256     ///< Células do cache listadas no resumo (as demais só contam)
+
+/* ==============================================================
+ * MACROS DE INSTRUMENTAÇÃO
+ * ============================================================== */
+
+#ifdef SORTS_INSTRUMENTAR_FASES
+    #define FASE_INICIO(nome)              fase_iniciar((nome), -1)
+    #define FASE_INICIO_VALOR(nome, valor) fase_iniciar((nome), (long long)(valor))
+    #define FASE_FIM()                     fase_encerrar()
+#else
+    #define FASE_INICIO(nome)              ((void)0)
+    #define FASE_INICIO_VALOR(nome, valor) ((void)0)
+    #define FASE_FIM()                     ((void)0)
+#endif
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Totais de uma fase em uma versão dos algoritmos
+ *
+ * O tempo inclusivo de fases recursivas (ex.: "quick: recursao") conta o
+ * mesmo intervalo uma vez por nível; o exclusivo desconta as fases filhas
+ * e é o que deve ser somado.
+ */
+typedef struct {
+    const char *nome;          ///< Nome da fase (literal de string)
+    int otimizada;             ///< Versão ativa quando a fase rodou
+    long long chamadas;        ///< Quantidade de vezes que a fase foi aberta
+    uint64_t ticks_inclusivo;  ///< Ticks entre início e fim, somados
+    uint64_t ticks_exclusivo;  ///< Ticks sem as fases aninhadas
+} ResumoFase;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Abre uma fase na thread corrente (use FASE_INICIO)
+ *
+ * @param nome Literal de string com o nome da fase
+ * @param valor Argumento exportado no trace (ex.: gap); -1 para nenhum
+ */
+void fase_iniciar(const char *nome, long long valor);
+
+/**
+ * @brief Fecha a fase aberta mais recente da thread corrente (use FASE_FIM)
+ */
+void fase_encerrar(void);
+
+/**
+ * @brief Retorna 1 se o programa foi compilado com SORTS_INSTRUMENTAR_FASES
+ */
+int fases_instrumentacao_ativa(void);
+
+/**
+ * @brief Descarta eventos e totais de todas as threads
+ *
+ * Só deve ser chamada sem threads de medição em andamento.
+ */
+void fases_limpar(void);
+
+/**
+ * @brief Anota uma célula reaproveitada do cache (sem fases nesta execução)
+ *
+ * Chamada pela thread da análise, fora das medições paralelas.
+ */
+void fases_registrar_celula_cache(const char *algoritmo, int otimizada,
+                                  const char *arquivo, int tamanho);
+
+/**
+ * @brief Soma os totais de todas as threads por (fase, versão)
+ *
+ * @return Quantidade de entradas escritas em `resumo`
+ */
+int fases_resumir(ResumoFase *resumo, int max_fases);
+
+/**
+ * @brief Salva fases_trace.json e fases_resumo.txt em output/relatorios/
+ */
+void gerar_relatorio_fases(void);
+
+#endif // FASES_H
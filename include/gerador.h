@@ -0,0 +1,85 @@
+/**
+ * ==============================================================
+ * GERADOR DE DADOS SINTÉTICOS - ENTRADAS PARA EXPERIMENTOS
+ * ==============================================================
+ *
+ * @file gerador.h
+ * @brief Geração reprodutível de conjuntos numéricos em tamanhos arbitrários
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Os arquivos em `data/` cobrem apenas quatro tamanhos (500 a 50000).
+ * Para estudar o crescimento dos algoritmos é preciso gerar entradas em
+ * qualquer tamanho, com as mesmas distribuições dos arquivos originais:
+ *
+ * - **aleatorios**: valores uniformes em [0, VALOR_MAXIMO_GERADO)
+ * - **crescentes**: sequência não-decrescente com passos aleatórios
+ * - **decrescentes**: sequência não-crescente com passos aleatórios
+ * - **zipf**: cauda longa (P(k) ∝ 1/k^s), sem arquivo equivalente
+ * - **agrupados**: aglomerados estreitos, sem arquivo equivalente
+ *
+ * **Reprodutibilidade:**
+ * Toda geração é determinística a partir de uma semente de 64 bits,
+ * usando o gerador SplitMix64 (rápido, sem estado global e portátil).
+ *
+ * ==============================================================
+ */
+
+#ifndef GERADOR_H
+#define GERADOR_H
+
+#include <stdint.h>
+#include "tipos.h"
+
+/**
+ * @brief Limite superior (exclusivo) dos valores gerados
+ *
+ * Mesmo intervalo observado nos arquivos `numeros_*` da pasta `data/`.
+ */
+#define VALOR_MAXIMO_GERADO 1000000
+
+/**
+ * @brief Semente padrão usada quando o chamador não especifica uma
+ */
+#define SEMENTE_PADRAO_GERADOR 0x5EED2025ULL
+
+/**
+ * @brief Avança o gerador SplitMix64 e retorna o próximo valor de 64 bits
+ *
+ * **Como funciona:**
+ * - Soma uma constante de Weyl ao estado
+ * - Embaralha o resultado com multiplicações e deslocamentos
+ *
+ * @param estado Ponteiro para o estado do gerador (modificado a cada chamada)
+ * @return Próximo valor pseudoaleatório de 64 bits
+ */
+uint64_t gerador_proximo(uint64_t *estado);
+
+/**
+ * @brief Preenche um array de inteiros segundo a distribuição pedida
+ *
+ * **Exemplo de uso:**
+ * ```c
+ * int *dados = malloc(1024 * sizeof(int));
+ * gerar_numeros(dados, 1024, DIST_ALEATORIA, SEMENTE_PADRAO_GERADOR);
+ * ```
+ *
+ * @param destino Array de destino (deve ter espaço para n inteiros)
+ * @param n Quantidade de elementos a gerar
+ * @param distribuicao Distribuição desejada
+ * @param semente Semente do gerador (mesma semente → mesmos dados)
+ */
+void gerar_numeros(int *destino, int n, DistribuicaoDados distribuicao, uint64_t semente);
+
+/**
+ * @brief Retorna o rótulo textual da distribuição
+ *
+ * Os rótulos coincidem com os nomes dos arquivos de `data/`
+ * ("aleatorios", "crescentes", "decrescentes"); os sintéticos são
+ * "zipf" e "agrupados".
+ *
+ * @param distribuicao Distribuição a ser nomeada
+ * @return String constante com o rótulo
+ */
+const char* nome_distribuicao(DistribuicaoDados distribuicao);
+
+#endif // GERADOR_H
@@ -41,8 +41,33 @@
 #ifndef IO_H
 #define IO_H
 
+#include <stdint.h>
 #include "tipos.h"
 
+/* ================================================================
+ * ESTATÍSTICAS CALCULADAS DURANTE A CARGA
+ * ================================================================ */
+
+#define BALDES_DIGITO_SUPERIOR 256  ///< Byte mais alto de uma chave de 32 bits
+
+/**
+ * @brief O que o parser de números já sabe ao terminar a leitura
+ *
+ * Cada valor convertido por strtol ainda está em registrador: atualizar
+ * mínimo, máximo, corridas, histograma e checksums ali custa algumas
+ * instruções por elemento e poupa uma passada O(n) a cada consumidor
+ * (registro de conjuntos, conferência das saídas, perfil da entrada).
+ */
+typedef struct {
+    int calculadas;             ///< 1 se preenchidas por ler_numeros_com_estatisticas()
+    int minimo;
+    int maximo;
+    int corridas;               ///< Trechos não decrescentes maximais (1 = já ordenado)
+    int histograma[BALDES_DIGITO_SUPERIOR]; ///< Contagem por byte alto de (x ^ 0x80000000)
+    uint64_t checksum;          ///< Igual a checksum_dados() do array, na ordem lida
+    uint64_t assinatura;        ///< Soma de um hash por valor: independe da ordem
+} EstatisticasCarga;
+
 /* ================================================================
  * SUBSISTEMA DE CARREGAMENTO E LEITURA DE DATASETS
  * ================================================================ */
@@ -110,6 +135,25 @@ int* carregar_dados_numericos(const char *nome_arquivo, int *tamanho);
  */
 int* ler_numeros(const char* caminho_arquivo, int* tamanho);
 
+/**
+ * @brief ler_numeros() com as estatísticas calculadas na mesma passada
+ *
+ * @param estatisticas Recebe as estatísticas dos valores lidos (pode ser NULL)
+ */
+int* ler_numeros_com_estatisticas(const char* caminho_arquivo, int* tamanho,
+                                  EstatisticasCarga *estatisticas);
+
+/**
+ * @brief Confere uma saída ordenada contra as estatísticas da entrada
+ *
+ * Uma passada: ordem não decrescente, extremos e assinatura de
+ * multiconjunto (a saída é uma permutação da entrada), sem cópia nem
+ * qsort de referência.
+ *
+ * @return 0 se correta; 1 fora de ordem; 2 não é permutação da entrada
+ */
+int conferir_saida_ordenada(const int *saida, int tamanho, const EstatisticasCarga *estatisticas);
+
 /**
  * @brief Carrega registros de alunos de um arquivo de dados
  *
@@ -131,7 +175,7 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho);
  * **Exemplo de uso:**
  * ```c
  * int quantidade;
- * Aluno* turma = carregar_dados_alunos("alunos.txt", &quantidade);
+ * Aluno* turma = carregar_dados_alunos("registros_pessoas_1000.txt", &quantidade);
  * if (turma != NULL) {
  *     printf("Nome do primeiro aluno: %s\n", turma[0].nome);
  *     free(turma); // Liberar memória após uso
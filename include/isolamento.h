@@ -0,0 +1,138 @@
+/**
+ * ==============================================================
+ * CONTROLES DE ISOLAMENTO DAS MEDIÇÕES
+ * ==============================================================
+ *
+ * @file isolamento.h
+ * @brief Fixação de CPU, pré-falha de páginas, mlock e modos de cache
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Sem isolamento, o tempo medido mistura o custo do algoritmo com efeitos
+ * do sistema operacional e do hardware:
+ * - Falhas de página no primeiro acesso a buffers recém-alocados
+ * - Estado de cache deixado pelo memcpy anterior (quente por acidente)
+ * - Migração da thread entre núcleos durante a medição
+ *
+ * Este módulo permite controlar cada um desses fatores e registra em
+ * ResultadoTempo.modo_isolamento o que foi efetivamente aplicado.
+ *
+ * **Modos de cache:**
+ * - NEUTRO: comportamento original (estado deixado pela restauração)
+ * - QUENTE: os dados são lidos por inteiro imediatamente antes da medição
+ * - FRIO: um buffer várias vezes maior que a LLC é varrido antes da medição
+ *
+ * ==============================================================
+ */
+
+#ifndef ISOLAMENTO_H
+#define ISOLAMENTO_H
+
+#include <stddef.h>
+
+/* ==============================================================
+ * FLAGS DE MODO (ResultadoTempo.modo_isolamento)
+ * ============================================================== */
+
+#define ISOLAMENTO_FIXADO       0x01u  ///< Thread fixada em uma única CPU
+#define ISOLAMENTO_PREFAULT     0x02u  ///< Páginas dos buffers tocadas antes da medição
+#define ISOLAMENTO_MLOCK        0x04u  ///< Buffers travados em RAM com mlock
+#define ISOLAMENTO_CACHE_QUENTE 0x08u  ///< Dados lidos logo antes de cada execução
+#define ISOLAMENTO_CACHE_FRIO   0x10u  ///< Cache varrida logo antes de cada execução
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define TAMANHO_VARREDURA_MINIMO (16u * 1024u * 1024u)   ///< Menor buffer de expulsão
+#define TAMANHO_VARREDURA_MAXIMO (256u * 1024u * 1024u)  ///< Maior buffer de expulsão
+#define FATOR_VARREDURA_LLC 4                             ///< Buffer = 4 × tamanho da LLC
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Estado da cache imediatamente antes de cada execução medida
+ */
+typedef enum {
+    CACHE_NEUTRO = 0,  ///< Sem preparação (comportamento original)
+    CACHE_QUENTE,      ///< Dados aquecidos por leitura completa
+    CACHE_FRIO         ///< Cache expulsa por varredura de buffer grande
+} ModoCache;
+
+/**
+ * @brief Opções de isolamento aplicadas por medir_algoritmo()
+ */
+typedef struct {
+    int fixar_cpu;        ///< 1 para fixar a thread de medição
+    int cpu;              ///< CPU alvo (-1 = primeiro núcleo físico disponível)
+    int pre_falhar;       ///< 1 para tocar todas as páginas antes de medir
+    int travar_memoria;   ///< 1 para mlock dos buffers durante a medição
+    ModoCache modo_cache; ///< Preparação de cache antes de cada execução
+} ConfiguracaoIsolamento;
+
+/* ==============================================================
+ * CONFIGURAÇÃO
+ * ============================================================== */
+
+/**
+ * @brief Configuração sem isolamento (reproduz o comportamento original)
+ */
+ConfiguracaoIsolamento configuracao_isolamento_padrao(void);
+
+/**
+ * @brief Aplica uma configuração de isolamento
+ *
+ * Fixa (ou libera) a thread chamadora e prepara o buffer de expulsão
+ * quando o modo de cache é FRIO.
+ */
+void configurar_isolamento(const ConfiguracaoIsolamento *config);
+
+/**
+ * @brief Retorna a configuração de isolamento em vigor
+ */
+const ConfiguracaoIsolamento* obter_isolamento(void);
+
+/* ==============================================================
+ * GANCHOS USADOS POR medir_algoritmo()
+ * ============================================================== */
+
+/**
+ * @brief Retorna ISOLAMENTO_FIXADO se a thread chamadora roda em uma única CPU
+ */
+unsigned estado_fixacao_thread(void);
+
+/**
+ * @brief Pré-falha e trava um buffer conforme a configuração
+ *
+ * @return Flags efetivamente aplicadas (ISOLAMENTO_PREFAULT / ISOLAMENTO_MLOCK)
+ */
+unsigned isolar_buffer(void *buffer, size_t bytes);
+
+/**
+ * @brief Desfaz o mlock de um buffer isolado por isolar_buffer()
+ */
+void liberar_buffer_isolado(void *buffer, size_t bytes, unsigned modo);
+
+/**
+ * @brief Aquece ou esfria a cache antes de uma execução
+ *
+ * @return ISOLAMENTO_CACHE_QUENTE, ISOLAMENTO_CACHE_FRIO ou 0
+ */
+unsigned preparar_cache(const void *dados, size_t bytes);
+
+/**
+ * @brief Descreve as flags em texto curto (ex.: "fixado+prefault+frio")
+ */
+void descrever_modo_isolamento(unsigned modo, char *buffer, size_t tamanho_buffer);
+
+/* ==============================================================
+ * INTERFACE DO MENU
+ * ============================================================== */
+
+/**
+ * @brief Submenu de escolha do modo de isolamento
+ */
+void menu_isolamento(void);
+
+#endif // ISOLAMENTO_H
@@ -0,0 +1,163 @@
+/**
+ * ==============================================================
+ * LATÊNCIA DE ORDENAÇÕES PEQUENAS
+ * ==============================================================
+ *
+ * @file latencia.h
+ * @brief Percentis p50/p99/p99.9/máximo de milhões de ordenações de 16-512
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * O relatório completo mede a vazão em arrays de até 50 mil elementos;
+ * no caminho de uma requisição o que importa é quanto demora ordenar um
+ * array pequeno, e principalmente quanto demora no pior 0,1% das vezes.
+ * Cada célula (motor × tamanho × variante) cronometra ordenações
+ * individuais, cada uma sobre uma entrada nova tirada de um pool:
+ *
+ *  ┌──────────────────┐   ┌────────────────────┐   ┌──────────────────┐
+ *  │ pool de entradas │ → │ copia a próxima    │ → │ [expulsa L1i]    │
+ *  │ (geradas uma vez)│   │ (fora da medição)  │   │ (variante fria)  │
+ *  └──────────────────┘   └────────────────────┘   └────────┬─────────┘
+ *                                                           ↓
+ *  ┌──────────────────┐   ┌────────────────────────────────────────────┐
+ *  │ percentis por    │ ← │ cronometro_iniciar → ordena → parar        │
+ *  │ ordenação        │   │ (overhead do cronômetro descontado)        │
+ *  └──────────────────┘   └────────────────────────────────────────────┘
+ *
+ * **Variantes:**
+ * - Quente: o código do algoritmo fica na cache de instruções entre
+ *   ordenações seguidas (servidor ordenando em laço)
+ * - Fria: antes de cada ordenação executa ~200 KB de código distinto,
+ *   expulsando a L1i e boa parte do preditor de desvios (ordenação
+ *   esporádica no meio de outro trabalho)
+ *
+ * Cada célula para no teto de amostras ou no orçamento de tempo, mas
+ * nunca antes de AMOSTRAS_MINIMAS_LATENCIA (o p99.9 precisa de mais de
+ * mil amostras para não ser o máximo).
+ *
+ * ==============================================================
+ */
+
+#ifndef LATENCIA_H
+#define LATENCIA_H
+
+#include <stdint.h>
+#include "tipos.h"
+#include "registro.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define NUM_TAMANHOS_LATENCIA 6               ///< 16, 32, 64, 128, 256, 512
+#define AMOSTRAS_MAXIMAS_LATENCIA 1000000     ///< Teto de ordenações por célula
+#define AMOSTRAS_MINIMAS_LATENCIA 2000        ///< Piso, mesmo acima do orçamento
+#define ORCAMENTO_CELULA_LATENCIA 0.25        ///< Segundos por célula
+#define TAMANHO_POOL_LATENCIA 256             ///< Entradas distintas por tamanho
+#define AQUECIMENTO_LATENCIA 64               ///< Ordenações descartadas por célula
+
+#define VARIANTE_LATENCIA_QUENTE 0x1u  ///< Cache de instruções quente
+#define VARIANTE_LATENCIA_FRIA   0x2u  ///< L1i expulsa antes de cada ordenação
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Parâmetros de uma execução
+ */
+typedef struct {
+    int amostras_maximas;     ///< Teto de ordenações medidas por célula
+    double orcamento_celula;  ///< Segundos por célula (respeitado o piso de amostras)
+    int tamanho_pool;         ///< Entradas distintas por tamanho
+    unsigned variantes;       ///< Combinação de VARIANTE_LATENCIA_*
+    uint64_t semente;         ///< Semente do pool de entradas
+} ConfiguracaoLatencia;
+
+/**
+ * @brief Distribuição das latências de uma célula (nanossegundos)
+ */
+typedef struct {
+    int indice_motor;         ///< Índice em obter_info_motor()
+    int tamanho;
+    int fria;                 ///< 1 = variante com L1i expulsa
+    int amostras;
+    int abaixo_resolucao;     ///< Amostras que zeraram ao descontar o overhead
+    double p50;
+    double p99;
+    double p999;
+    double maximo;
+    double media;
+} ResultadoLatencia;
+
+/**
+ * @brief Todas as células de uma execução
+ */
+typedef struct {
+    ConfiguracaoLatencia config;
+    int tamanhos[NUM_TAMANHOS_LATENCIA];
+    int num_motores;          ///< Motores do registro no momento da medição
+    ResultadoLatencia celulas[2][MAX_MOTORES][NUM_TAMANHOS_LATENCIA];  ///< [fria][motor][tamanho]
+    long long total_ordenacoes;
+    double overhead_ns;       ///< Overhead do cronômetro descontado de cada amostra
+    unsigned modo_isolamento; ///< estado_fixacao_thread() durante a medição
+} RelatorioLatencia;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief 1M amostras no máximo, 0.25 s por célula, pool de 256, ambas as variantes
+ */
+ConfiguracaoLatencia configuracao_latencia_padrao(void);
+
+/**
+ * @brief Executa ~200 KB de código distinto, expulsando a cache de instruções
+ */
+void expulsar_cache_instrucoes(void);
+
+/**
+ * @brief Ordena amostras de ticks em ordem crescente
+ */
+void ordenar_ticks(uint64_t *amostras, int n);
+
+/**
+ * @brief Percentil pelo posto mais próximo, em nanossegundos
+ *
+ * Sem interpolação: o p99.9 é sempre uma latência que de fato ocorreu.
+ *
+ * @param ordenadas Ticks já ordenados por ordenar_ticks()
+ * @param p         Fração (0.5, 0.99, 0.999)
+ * @return 0 se n <= 0
+ */
+double percentil_ticks_ns(const uint64_t *ordenadas, int n, double p);
+
+/**
+ * @brief Mede uma célula (versão otimizada dos algoritmos)
+ *
+ * @param pool     tamanho_pool entradas de `tamanho` ints, contíguas
+ * @param amostras Buffer de trabalho com config->amostras_maximas posições
+ * @return 0 em caso de sucesso, -1 se faltar memória
+ */
+int medir_latencia(const AlgoritmoInfo *info, const int *pool, int tamanho, int fria,
+                   const ConfiguracaoLatencia *config, uint64_t *amostras,
+                   ResultadoLatencia *resultado);
+
+/**
+ * @brief Mede todas as células habilitadas por config->variantes
+ *
+ * @return 0 em caso de sucesso, -1 se faltar memória
+ */
+int medir_latencias(const ConfiguracaoLatencia *config, RelatorioLatencia *relatorio);
+
+/**
+ * @brief Salva latencia_pequenos.txt e latencia_pequenos.csv em output/relatorios/
+ */
+void gerar_relatorio_latencia(const RelatorioLatencia *relatorio);
+
+/**
+ * @brief Ponto de entrada do menu: mede as duas variantes e salva os relatórios
+ */
+void executar_latencia_pequenos(void);
+
+#endif // LATENCIA_H
@@ -0,0 +1,87 @@
+/**
+ * ==============================================================
+ * ANÁLISE DE ACESSOS À MEMÓRIA
+ * ==============================================================
+ *
+ * @file memoria.h
+ * @brief Rastreia cada algoritmo e reexecuta o rastro no simulador de cache
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Para cada algoritmo (versão otimizada, inteiros aleatórios):
+ * 1. mede o tempo sem rastro, como no relatório completo
+ * 2. ordena a mesma entrada com um rastro ativo
+ * 3. grava o rastro em output/rastros/<algoritmo>_<n>.bin
+ * 4. reexecuta o rastro em L1/L2/LLC + TLB (simulador.h)
+ *
+ * O relatório cache_simulada.txt junta taxas de falha por nível e o
+ * histograma de distância de reuso de todos os algoritmos. Os arquivos
+ * .bin podem ser reexecutados com outras geometrias pela ferramenta
+ * simular_cache, sem rodar os algoritmos de novo.
+ *
+ * ==============================================================
+ */
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <stdint.h>
+#include "tipos.h"
+#include "simulador.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define TAMANHO_RASTRO_NLOGN 50000      ///< Elementos para algoritmos O(n log n) e Shell Sort
+#define TAMANHO_RASTRO_QUADRATICO 2000  ///< Elementos para algoritmos O(n²)
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Rastro e simulação de um algoritmo
+ */
+typedef struct {
+    char algoritmo[30];
+    int tamanho;                      ///< Elementos ordenados
+    double tempo_execucao;            ///< Tempo medido sem rastro (segundos)
+    long long comparacoes;
+    long long movimentacoes;
+    uint64_t acessos_totais;          ///< Acessos registrados
+    uint64_t acessos_retidos;         ///< Acessos no buffer (janela final, se menor)
+    int simulado;                     ///< 1 se o rastro foi gravado e simulado
+    EstatisticasCache estatisticas;
+} ResultadoMemoria;
+
+/**
+ * @brief Resultado completo da análise de memória
+ */
+typedef struct {
+    ConfiguracaoCache cache;
+    ResultadoMemoria algoritmos[NUM_ALGORITMOS];
+    int num_algoritmos;
+} RelatorioMemoria;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Rastreia e simula todos os algoritmos com a hierarquia dada
+ *
+ * @return 0 em caso de sucesso, -1 se faltar memória para a entrada
+ */
+int analisar_memoria(const ConfiguracaoCache *cache, RelatorioMemoria *relatorio);
+
+/**
+ * @brief Salva cache_simulada.txt em output/relatorios/
+ */
+void gerar_relatorio_memoria(const RelatorioMemoria *relatorio);
+
+/**
+ * @brief Ponto de entrada do menu: hierarquia da máquina, relatório e rastros
+ */
+void executar_analise_memoria(void);
+
+#endif // MEMORIA_H
@@ -0,0 +1,120 @@
+/**
+ * ==============================================================
+ * MÉTRICAS OPENMETRICS PARA EXECUÇÕES LONGAS
+ * ==============================================================
+ *
+ * @file metricas.h
+ * @brief Contadores e histogramas por motor exportados em textfile Prometheus
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Uma análise completa ou um sort_bench longo só mostravam resultados no
+ * fim. Com SORTS_METRICAS=<arquivo.prom>, toda ordenação que passa por
+ * executar_ordenacao() é contada por motor e versão, e uma thread grava
+ * o arquivo periodicamente para o coletor textfile do node_exporter:
+ *
+ *  ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ *  │ executar_ordenacao() │ → │ Bloco da thread:     │ → │ Exportador (a cada   │
+ *  │ cronometra e anota   │   │ só a dona escreve    │   │ N s): soma os blocos │
+ *  │ n, bytes, latência   │   │ (load + store relax.)│   │ e grava .tmp+rename  │
+ *  └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * Séries (rótulos motor="quick", versao="otimizada|didatica|unica"):
+ *   sorts_ordenacoes_total, sorts_elementos_ordenados_total,
+ *   sorts_bytes_processados_total, sorts_latencia_segundos (histograma),
+ *   sorts_buffers_emprestados_total e sorts_alocacoes_total (pool de
+ *   conjuntos.h), sorts_threads_instrumentadas.
+ *
+ * Sem escrita compartilhada: cada thread tem seu bloco de contadores e
+ * ninguém trava nada no caminho da ordenação. Blocos de threads que
+ * terminaram são reaproveitados pela próxima (os totais continuam
+ * monotônicos).
+ *
+ * Desligado (padrão), o custo é uma leitura relaxada e um desvio
+ * previsível por ordenação; com -DSORTS_METRICAS=OFF no CMake
+ * (SORTS_SEM_METRICAS) nem isso. Ligado,
+ * cada ordenação ganha duas leituras do cronômetro: meça latências de
+ * arrays minúsculos com as métricas desligadas.
+ *
+ * ==============================================================
+ */
+
+#ifndef METRICAS_H
+#define METRICAS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define VARIAVEL_AMBIENTE_METRICAS "SORTS_METRICAS"                     ///< Caminho do .prom
+#define VARIAVEL_AMBIENTE_INTERVALO_METRICAS "SORTS_METRICAS_INTERVALO" ///< Segundos entre gravações
+#define INTERVALO_METRICAS_PADRAO 5.0
+#define NUM_BALDES_LATENCIA 9   ///< 1 µs, 10 µs, ... 10 s e +Inf
+
+/* ==============================================================
+ * ESTADO GLOBAL
+ * ============================================================== */
+
+/// 1 enquanto a exportação está ligada (lido a cada ordenação)
+extern atomic_int metricas_ativas;
+
+#ifdef SORTS_SEM_METRICAS
+    #define METRICAS_HABILITADAS() 0
+#else
+    #define METRICAS_HABILITADAS() \
+        atomic_load_explicit(&metricas_ativas, memory_order_relaxed)
+#endif
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Liga a coleta e a exportação periódica para `caminho`
+ *
+ * Sem threads (fora do Linux), o arquivo só é gravado por
+ * exportar_metricas() e ao parar.
+ *
+ * @return 0 se ligada, -1 se o arquivo não pode ser gravado
+ */
+int iniciar_metricas(const char *caminho, double intervalo_segundos);
+
+/**
+ * @brief Lê SORTS_METRICAS e SORTS_METRICAS_INTERVALO e liga a exportação
+ *
+ * Registra parar_metricas() com atexit(), garantindo a gravação final.
+ *
+ * @return 1 se ligada, 0 se a variável não está definida, -1 em erro
+ */
+int iniciar_metricas_ambiente(void);
+
+/**
+ * @brief Para a thread de exportação e grava o arquivo uma última vez
+ */
+void parar_metricas(void);
+
+/**
+ * @brief Grava o arquivo agora (.tmp + rename: o coletor nunca lê pela metade)
+ *
+ * @return 0 se gravou, -1 se desligada ou em erro
+ */
+int exportar_metricas(void);
+
+/**
+ * @brief Anota uma ordenação no bloco da thread chamadora
+ *
+ * @param indice_motor Índice em obter_info_motor() (fora da faixa: ignorada)
+ * @param otimizada Versão em vigor (motores sem versão didática usam "unica")
+ */
+void metricas_registrar_ordenacao(int indice_motor, int otimizada, int n,
+                                  size_t elem_size, uint64_t ticks);
+
+/**
+ * @brief Anota um empréstimo do pool de buffers e se ele exigiu malloc
+ */
+void metricas_registrar_emprestimo(int alocou);
+
+#endif // METRICAS_H
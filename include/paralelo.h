@@ -0,0 +1,151 @@
+/**
+ * ==============================================================
+ * MATRIZ DE BENCHMARK PARALELA EM NÚCLEOS FIXADOS
+ * ==============================================================
+ *
+ * @file paralelo.h
+ * @brief Distribui células (algoritmo, versão, conjunto) entre threads fixadas
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * O relatório completo executa 7 algoritmos × 2 versões × 13 conjuntos em
+ * série, em um único núcleo. As células são independentes entre si, então
+ * podem ser medidas ao mesmo tempo em núcleos físicos distintos.
+ *
+ * **Garantias de medição:**
+ * - Cada thread de trabalho é fixada (sched_setaffinity) em um núcleo
+ *   FÍSICO próprio: irmãos de hyper-threading nunca medem ao mesmo tempo
+ * - Contadores, comparador e versão são THREAD_LOCAL (ver tipos.h)
+ * - Um limite de concorrência reduz a disputa por banda de memória e LLC
+ * - Uma reexecução serial de todas as células confere os tempos paralelos
+ *
+ * **Plataformas:**
+ * Em sistemas sem sched_setaffinity (não-Linux) a matriz roda em série na
+ * thread chamadora, preservando o mesmo relatório.
+ *
+ * ==============================================================
+ */
+
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include "tipos.h"
+#include "registro.h"
+
+/* ==============================================================
+ * CONSTANTES DA MATRIZ
+ * ============================================================== */
+
+#define MAX_TRABALHADORES 64            ///< Máximo de threads de trabalho
+#define LIMITE_CONCORRENCIA_PADRAO 4    ///< Threads simultâneas por padrão
+#define MAX_CONJUNTOS_MATRIZ 16         ///< Máximo de conjuntos de dados carregados
+
+/// Células possíveis: (versões didáticas + todos os motores) × conjuntos
+#define MAX_CELULAS_MATRIZ ((NUM_ALGORITMOS + MAX_MOTORES) * MAX_CONJUNTOS_MATRIZ)
+
+/// Desvio relativo (paralelo vs. serial) acima do qual a célula é destacada
+#define DESVIO_MAXIMO_ACEITO 0.25
+
+/* ==============================================================
+ * ESTRUTURAS DA MATRIZ
+ * ============================================================== */
+
+/**
+ * @brief Conjunto de dados carregado uma vez e compartilhado (somente leitura)
+ */
+typedef struct {
+    char nome[64];          ///< Nome do arquivo de origem
+    char tipo_dados[20];    ///< "numeros" ou "alunos"
+    const void *dados;      ///< Visão do registro de conjuntos (nunca modificada)
+    int tamanho;            ///< Número de elementos
+    size_t elem_size;       ///< Tamanho de cada elemento
+    CompareFn cmp;          ///< Comparador adequado ao tipo
+} ConjuntoMatriz;
+
+/**
+ * @brief Uma célula da matriz: um algoritmo, uma versão, um conjunto
+ */
+typedef struct {
+    int indice_algoritmo;   ///< Índice em obter_info_motor() (referências incluídas)
+    int otimizada;          ///< 1 = versão otimizada, 0 = didática
+    int indice_conjunto;    ///< Índice em ResultadoMatriz.conjuntos
+    double custo_estimado;  ///< n^k da complexidade média (ordem de despacho)
+    int cpu;                ///< CPU lógica onde rodou em paralelo (-1 = sem fixação)
+    ResultadoTempo paralelo;///< Medição feita pela thread de trabalho
+    ResultadoTempo serial;  ///< Medição de conferência em modo serial
+} CelulaMatriz;
+
+/**
+ * @brief Parâmetros da execução paralela
+ */
+typedef struct {
+    int limite_concorrencia;    ///< Máximo de threads simultâneas (<= 0 usa o padrão)
+    int verificar_serial;       ///< 1 para reexecutar tudo em série e comparar
+} ConfiguracaoParalela;
+
+/**
+ * @brief Resultado completo da matriz
+ */
+typedef struct {
+    int num_conjuntos;                              ///< Conjuntos carregados
+    ConjuntoMatriz conjuntos[MAX_CONJUNTOS_MATRIZ]; ///< Dados compartilhados
+    int num_celulas;                                ///< Células executadas
+    CelulaMatriz celulas[MAX_CELULAS_MATRIZ];       ///< Células em ordem de despacho
+    int nucleos_fisicos;                            ///< Núcleos físicos disponíveis
+    int num_trabalhadores;                          ///< Threads efetivamente usadas
+    int cpus[MAX_TRABALHADORES];                    ///< CPU lógica de cada thread
+    double tempo_parede_paralelo;                   ///< Duração da fase paralela (s)
+    double tempo_parede_serial;                     ///< Duração da conferência serial (s)
+    int verificado;                                 ///< 1 se a conferência serial rodou
+} ResultadoMatriz;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Lista uma CPU lógica por núcleo físico, dentro da afinidade atual
+ *
+ * Lê /sys/devices/system/cpu/cpuN/topology para agrupar irmãos de
+ * hyper-threading; sem essa informação, cada CPU conta como um núcleo.
+ *
+ * @param cpus Recebe os identificadores das CPUs escolhidas
+ * @param max_cpus Capacidade de `cpus`
+ * @return Quantidade de núcleos físicos (>= 1); em não-Linux retorna 1 com cpus[0] = -1
+ */
+int detectar_nucleos_fisicos(int *cpus, int max_cpus);
+
+/**
+ * @brief Fixa a thread chamadora em uma CPU lógica
+ *
+ * @return 0 em caso de sucesso, -1 se não suportado ou se falhar
+ */
+int fixar_thread_cpu(int cpu);
+
+/**
+ * @brief Retorna a configuração padrão (limite de 4 threads, com conferência serial)
+ */
+ConfiguracaoParalela configuracao_paralela_padrao(void);
+
+/**
+ * @brief Carrega os conjuntos, executa a matriz em paralelo e, se pedido, em série
+ *
+ * @return Resultado alocado (liberar com liberar_resultado_matriz), ou NULL se erro
+ */
+ResultadoMatriz* executar_matriz_paralela(const ConfiguracaoParalela *config);
+
+/**
+ * @brief Salva output/relatorios/matriz_paralela.txt
+ */
+void gerar_relatorio_matriz(const ResultadoMatriz *resultado);
+
+/**
+ * @brief Libera o resultado (os conjuntos pertencem ao registro de conjuntos)
+ */
+void liberar_resultado_matriz(ResultadoMatriz *resultado);
+
+/**
+ * @brief Ponto de entrada do menu: matriz paralela com conferência serial
+ */
+void executar_matriz_paralela_completa(void);
+
+#endif // PARALELO_H
@@ -0,0 +1,144 @@
+/**
+ * ==============================================================
+ * PROJEÇÃO DE TEMPOS E ORÇAMENTO POR ALGORITMO
+ * ==============================================================
+ *
+ * @file projecao.h
+ * @brief Extrapolação de tempos para evitar execuções proibitivamente longas
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Algoritmos O(n²) didáticos (Bubble, Selection) levam horas em entradas
+ * de 10^6 elementos e bloqueiam o relatório inteiro. Este módulo mantém um
+ * histórico das medições já feitas e, antes de cada execução, projeta o
+ * tempo esperado ajustando t ≈ c·n^k aos tamanhos menores do mesmo
+ * algoritmo, variante e família de dados.
+ *
+ * **Política:**
+ * - Projeção acima do orçamento → algoritmo não é executado e o resultado
+ *   é marcado como PROJETADO (ResultadoTempo.projetado = 1)
+ * - Opcionalmente, uma execução parcial (prefixo da entrada) valida a
+ *   projeção e refina o ajuste antes da decisão final
+ *
+ * ==============================================================
+ */
+
+#ifndef PROJECAO_H
+#define PROJECAO_H
+
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES DE PROJEÇÃO
+ * ============================================================== */
+
+#define ORCAMENTO_TEMPO_PADRAO 10.0      ///< Orçamento padrão (s) por execução
+#define MAX_HISTORICO_MEDICOES 1024      ///< Capacidade do histórico de medições
+#define PONTOS_MINIMOS_PROJECAO 2        ///< Tamanhos distintos necessários para projetar
+#define FRACAO_ORCAMENTO_AMOSTRA 0.25    ///< Fração do orçamento usada pela amostra
+#define TAMANHO_MINIMO_AMOSTRA 256       ///< Menor prefixo aceito para validação
+
+/* ==============================================================
+ * ESTRUTURAS DE PROJEÇÃO
+ * ============================================================== */
+
+/**
+ * @brief Resultado da extrapolação de tempo para um tamanho n
+ */
+typedef struct {
+    int valida;                     ///< 1 se havia pontos suficientes para projetar
+    int tamanho;                    ///< n para o qual o tempo foi projetado
+    double tempo_projetado;         ///< Tempo estimado (s)
+    double expoente;                ///< k do ajuste t ≈ c·n^k
+    double r2;                      ///< Qualidade do ajuste
+    int pontos;                     ///< Medições usadas no ajuste
+
+    int tamanho_amostra;            ///< Prefixo executado na validação (0 = sem validação)
+    double tempo_amostra_medido;    ///< Tempo real da execução parcial
+    double tempo_amostra_projetado; ///< Tempo que o ajuste previa para a amostra
+    double erro_relativo_amostra;   ///< (medido - previsto) / previsto
+} ProjecaoTempo;
+
+/* ==============================================================
+ * CONFIGURAÇÃO E HISTÓRICO
+ * ============================================================== */
+
+/**
+ * @brief Define o orçamento de tempo (s) de uma execução; valores <= 0 desativam os cortes
+ */
+void configurar_orcamento_tempo(double segundos);
+
+/**
+ * @brief Retorna o orçamento de tempo atual em segundos
+ */
+double obter_orcamento_tempo(void);
+
+/**
+ * @brief Ativa (1) ou desativa (0) a validação por execução parcial
+ */
+void configurar_validacao_amostra(int ativa);
+
+/**
+ * @brief Descarta todas as medições registradas
+ */
+void limpar_historico_medicoes(void);
+
+/**
+ * @brief Registra uma medição real para uso em projeções futuras
+ *
+ * @param algoritmo Nome do algoritmo
+ * @param otimizada Variante (1 = otimizada, 0 = didática)
+ * @param categoria Família de dados (ex.: "numeros_aleatorios")
+ * @param tamanho Número de elementos
+ * @param tempo Tempo medido em segundos
+ */
+void registrar_medicao(const char *algoritmo, int otimizada, const char *categoria,
+                       int tamanho, double tempo);
+
+/**
+ * @brief Projeta o tempo de execução para n a partir do histórico
+ *
+ * @return Projeção com valida = 0 se o histórico não tem pontos suficientes
+ */
+ProjecaoTempo projetar_tempo(const char *algoritmo, int otimizada, const char *categoria,
+                             int tamanho);
+
+/**
+ * @brief Extrai a família de dados de um nome de arquivo
+ *
+ * Exemplo: "numeros_aleatorios_50000.txt" → "numeros_aleatorios".
+ */
+void extrair_categoria_dados(const char *arquivo, char *categoria, size_t tamanho_categoria);
+
+/* ==============================================================
+ * DECISÃO DE CORTE
+ * ============================================================== */
+
+/**
+ * @brief Decide se a execução excede o orçamento, validando com uma amostra se ativo
+ *
+ * **Como funciona:**
+ * 1. Projeta o tempo para n; se não exceder o orçamento, retorna 0
+ * 2. Com validação ativa, executa o algoritmo no maior prefixo cuja
+ *    projeção cabe em FRACAO_ORCAMENTO_AMOSTRA do orçamento, registra a
+ *    medição e refaz a projeção com o ponto novo
+ * 3. Retorna 1 se a projeção (refinada) ainda exceder o orçamento
+ *
+ * @param info Algoritmo a executar
+ * @param dados Entrada completa (não é modificada)
+ * @param tamanho Número de elementos
+ * @param elem_size Tamanho de cada elemento
+ * @param cmp Função de comparação
+ * @param categoria Família de dados usada no histórico
+ * @param projecao Recebe a projeção calculada (pode ser NULL)
+ * @return 1 se o algoritmo deve ser pulado, 0 caso contrário
+ */
+int excede_orcamento(AlgoritmoInfo *info, const void *dados, int tamanho, size_t elem_size,
+                     CompareFn cmp, const char *categoria, ProjecaoTempo *projecao);
+
+/**
+ * @brief Monta um ResultadoTempo marcado como projetado (sem contadores)
+ */
+ResultadoTempo resultado_projetado(const AlgoritmoInfo *info, const ProjecaoTempo *projecao,
+                                   const char *tipo_dados);
+
+#endif // PROJECAO_H
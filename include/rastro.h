@@ -0,0 +1,120 @@
+/**
+ * ==============================================================
+ * RASTRO DE ACESSOS À MEMÓRIA
+ * ==============================================================
+ *
+ * @file rastro.h
+ * @brief Buffer circular binário com os endereços tocados pelos algoritmos
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Contadores de comparações e trocas não explicam por que o Heap Sort
+ * perde para o Quick Sort em 50000 elementos: a diferença está em QUAIS
+ * endereços são tocados. Com um rastro ativo na thread, a camada de
+ * comparação/movimentação (comparar_e_contar, swap_elements,
+ * mover_elemento) registra cada endereço lido ou escrito.
+ *
+ * **Formato compacto (8 bytes por acesso):**
+ *   entrada = (endereço << 1) | escrita
+ *
+ * O buffer é circular: ao encher, os acessos mais antigos são
+ * sobrescritos e `total` continua contando. O arquivo .bin gravado por
+ * salvar_rastro() é lido pela ferramenta offline simular_cache.
+ *
+ * ==============================================================
+ */
+
+#ifndef RASTRO_H
+#define RASTRO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define CAPACIDADE_RASTRO_PADRAO (1u << 23)   ///< 8 Mi acessos (64 MiB)
+#define ASSINATURA_RASTRO 0x52545253u         ///< "SRTR" em little-endian
+#define VERSAO_RASTRO 1u                      ///< Versão do formato .bin
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Buffer circular de acessos
+ */
+typedef struct {
+    uint64_t *entradas;     ///< (endereço << 1) | escrita
+    size_t capacidade;      ///< Potência de 2
+    uint64_t total;         ///< Acessos registrados desde o início (pode exceder a capacidade)
+    uint32_t elem_size;     ///< Bytes tocados por acesso
+} RastroMemoria;
+
+/* ==============================================================
+ * GANCHO DA CAMADA DE MOVIMENTAÇÃO
+ * ============================================================== */
+
+/// Rastro da thread corrente (NULL = desligado)
+extern THREAD_LOCAL RastroMemoria *rastro_ativo;
+
+/**
+ * @brief Registra um acesso se houver rastro ativo (uma comparação de ponteiro quando desligado)
+ */
+#define RASTREAR_ACESSO(endereco, escrita)                                        \
+    do {                                                                          \
+        if (rastro_ativo) rastro_registrar(rastro_ativo, (endereco), (escrita));  \
+    } while (0)
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Aloca um rastro (capacidade arredondada para potência de 2)
+ *
+ * @return Rastro alocado, ou NULL se faltar memória
+ */
+RastroMemoria* criar_rastro(size_t capacidade, size_t elem_size);
+
+/**
+ * @brief Libera o rastro e suas entradas
+ */
+void liberar_rastro(RastroMemoria *rastro);
+
+/**
+ * @brief Ativa o rastro na thread chamadora (NULL desativa)
+ */
+void ativar_rastro(RastroMemoria *rastro);
+
+/**
+ * @brief Acrescenta um acesso ao buffer circular
+ */
+void rastro_registrar(RastroMemoria *rastro, const void *endereco, int escrita);
+
+/**
+ * @brief Quantidade de acessos ainda presentes no buffer
+ */
+size_t rastro_retidos(const RastroMemoria *rastro);
+
+/**
+ * @brief i-ésimo acesso retido, do mais antigo para o mais recente
+ */
+uint64_t rastro_entrada(const RastroMemoria *rastro, size_t i);
+
+/**
+ * @brief Grava cabeçalho + acessos retidos em um arquivo binário
+ *
+ * @return 0 em caso de sucesso, -1 se falhar
+ */
+int salvar_rastro(const RastroMemoria *rastro, const char *caminho);
+
+/**
+ * @brief Lê um arquivo gravado por salvar_rastro()
+ *
+ * @return Rastro alocado (capacidade = acessos lidos), ou NULL se inválido
+ */
+RastroMemoria* carregar_rastro(const char *caminho);
+
+#endif // RASTRO_H
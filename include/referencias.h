@@ -0,0 +1,110 @@
+/**
+ * ==============================================================
+ * ORDENAÇÕES DE REFERÊNCIA (LIBC)
+ * ==============================================================
+ *
+ * @file referencias.h
+ * @brief qsort da libc (e mergesort/heapsort BSD) como linhas de base
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Os relatórios comparam os sete algoritmos entre si; sem uma linha de
+ * base externa, um Quick Sort "otimizado" mais lento que a biblioteca
+ * padrão passa despercebido. As referências entram nas mesmas tabelas,
+ * com a mesma interface (AlgoritmoInfo), e cada linha informa a
+ * aceleração sobre o qsort:
+ *
+ *   aceleração = tempo do qsort / tempo do algoritmo
+ *
+ *   > 1  mais rápido que a libc
+ *   < 1  mais lento (regressão visível)
+ *
+ * No registro de motores (registro.h), índices 0..NUM_ALGORITMOS-1 são
+ * os algoritmos implementados; a partir de INDICE_QSORT vêm as
+ * referências e, depois delas, os plugins carregados.
+ *
+ *  ┌──────────────────┬───────────────────────────────────────┐
+ *  │ qsort libc       │ sempre (C padrão)                     │
+ *  │ mergesort BSD    │ só em BSD/macOS (estável)             │
+ *  │ heapsort BSD     │ só em BSD/macOS                       │
+ *  └──────────────────┴───────────────────────────────────────┘
+ *
+ * As comparações passam por comparar_e_contar e são contadas; trocas e
+ * movimentações internas da libc não são visíveis e ficam em zero. As
+ * referências não têm versão didática: usar_versao_otimizada é ignorado.
+ *
+ * ==============================================================
+ */
+
+#ifndef REFERENCIAS_H
+#define REFERENCIAS_H
+
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || \
+    defined(__OpenBSD__) || defined(__DragonFly__)
+    #define SORTS_REFERENCIAS_BSD 1
+    #define NUM_REFERENCIAS 3  ///< qsort, mergesort e heapsort
+#else
+    #define NUM_REFERENCIAS 1  ///< Apenas qsort (glibc/MSVC não têm as variantes BSD)
+#endif
+
+/// Índice do qsort em obter_info_motor()
+#define INDICE_QSORT NUM_ALGORITMOS
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief qsort da libc com comparações contadas (assinatura OrdenacaoFn)
+ */
+void referencia_qsort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto);
+
+#ifdef SORTS_REFERENCIAS_BSD
+/**
+ * @brief mergesort(3) BSD: estável, usa memória auxiliar O(n)
+ */
+void referencia_mergesort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto);
+
+/**
+ * @brief heapsort(3) BSD: in-place, O(n log n) no pior caso
+ */
+void referencia_heapsort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto);
+#endif
+
+/**
+ * @brief Tabela estática com NUM_REFERENCIAS entradas (qsort primeiro)
+ */
+AlgoritmoInfo* obter_info_referencias(void);
+
+/**
+ * @brief 1 se `info` aponta para uma das referências (não para um plugin)
+ */
+int eh_referencia(const AlgoritmoInfo *info);
+
+/**
+ * @brief tempo_qsort / tempo, ou 0 se algum dos tempos for inválido
+ */
+double aceleracao_sobre_qsort(double tempo_qsort, double tempo);
+
+/**
+ * @brief Formata a aceleração para tabelas: "1.35x", "0.0042x" ou "-" se 0
+ *
+ * Algoritmos O(n²) ficam centenas de vezes mais lentos; abaixo de 0.1 a
+ * aceleração ganha casas decimais para não virar "0.00x". Cabe em 8
+ * caracteres.
+ */
+void formatar_aceleracao(double aceleracao, char *buffer, size_t tamanho_buffer);
+
+/**
+ * @brief Tempo da linha do qsort em um conjunto de resultados
+ *
+ * @return Segundos, ou 0 se nenhuma linha for do qsort
+ */
+double tempo_qsort_resultados(const ResultadoTempo *resultados, int num_resultados);
+
+#endif // REFERENCIAS_H
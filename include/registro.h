@@ -0,0 +1,172 @@
+/**
+ * ==============================================================
+ * REGISTRO DE MOTORES DE ORDENAÇÃO
+ * ==============================================================
+ *
+ * @file registro.h
+ * @brief Registro em tempo de execução de algoritmos, referências e plugins
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Todo código que mede "todos os motores" percorre este registro em vez
+ * de uma contagem fixa. Cada motor traz nome, id curto, etiquetas,
+ * capacidades (CAPACIDADE_*) e a implementação na assinatura uniforme
+ * OrdenacaoFn; nenhum chamador precisa saber qual algoritmo é qual.
+ *
+ *  ┌──────────────────────────┬────────────────────────────────────┐
+ *  │ 0 .. NUM_ALGORITMOS-1    │ algoritmos implementados (analise) │
+ *  │ INDICE_QSORT ..          │ referências da libc                │
+ *  │ INDICE_APRENDIDA ..      │ especializados (versão única)      │
+ *  │ NUM_MOTORES_INTERNOS ..  │ plugins (.so) e motores externos   │
+ *  └──────────────────────────┴────────────────────────────────────┘
+ *
+ * Os índices internos são fixos; os ponteiros devolvidos por
+ * obter_info_motor() são os das tabelas estáticas, então comparar
+ * ponteiros identifica um motor.
+ *
+ * PLUGINS: uma biblioteca compartilhada exporta
+ *
+ *   int sorts_registrar_plugin(int versao_api, RegistrarMotorFn registrar);
+ *
+ * e chama registrar() uma vez por motor. O plugin compila contra
+ * tipos.h; versao_api muda quando AlgoritmoInfo muda. Plugins vêm de
+ * --plugin no sort_bench ou da variável SORTS_PLUGINS (caminhos
+ * separados por ':').
+ *
+ * SELEÇÃO: "quick,heap", "n_log_n,-referencia", "todos": cada termo é
+ * um id, um nome completo ou uma etiqueta; "-" exclui.
+ *
+ * O registro não é thread-safe para escrita: registre motores e
+ * carregue plugins antes de criar threads de medição.
+ *
+ * ==============================================================
+ */
+
+#ifndef REGISTRO_H
+#define REGISTRO_H
+
+#include <stdio.h>
+#include "tipos.h"
+#include "referencias.h"
+#include "aprendida.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_MOTORES 32  ///< Internos + referências + plugins
+
+/// Algoritmos implementados, referências e especializados (sempre presentes)
+#define NUM_MOTORES_INTERNOS (NUM_ALGORITMOS + NUM_REFERENCIAS + NUM_ESPECIALIZADOS)
+
+/// Primeiro especializado: a ordenação aprendida (aprendida.h)
+#define INDICE_APRENDIDA (NUM_ALGORITMOS + NUM_REFERENCIAS)
+
+#define VERSAO_API_PLUGIN_MOTORES 1
+#define SIMBOLO_PLUGIN_MOTORES "sorts_registrar_plugin"
+#define VARIAVEL_AMBIENTE_PLUGINS "SORTS_PLUGINS"
+
+/* ==============================================================
+ * TIPOS
+ * ============================================================== */
+
+/**
+ * @brief Registra um motor; o registro copia `info` (devolve o índice ou -1)
+ */
+typedef int (*RegistrarMotorFn)(const AlgoritmoInfo *info);
+
+/**
+ * @brief Ponto de entrada exportado por um plugin (0 = sucesso)
+ */
+typedef int (*PontoEntradaPluginFn)(int versao_api, RegistrarMotorFn registrar);
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Total de motores registrados (>= NUM_MOTORES_INTERNOS)
+ */
+int num_motores(void);
+
+/**
+ * @brief Motor pelo índice no registro
+ *
+ * @return NULL se o índice estiver fora da faixa
+ */
+AlgoritmoInfo* obter_info_motor(int indice);
+
+/**
+ * @brief Índice de `info` (inverso de obter_info_motor), -1 se desconhecido
+ */
+int indice_motor(const AlgoritmoInfo *info);
+
+/**
+ * @brief Copia `info` para o registro
+ *
+ * Exige nome e implementação; sem id, deriva um do nome ("Tim Sort" →
+ * "tim_sort"). Motores externos ganham a etiqueta "plugin".
+ *
+ * @return Índice do novo motor, ou -1 (registro cheio, nome/id repetido)
+ */
+int registrar_motor(const AlgoritmoInfo *info);
+
+/**
+ * @brief Motor pelo id ou nome completo (sem diferenciar maiúsculas)
+ *
+ * @return NULL se não houver
+ */
+AlgoritmoInfo* buscar_motor(const char *nome_ou_id);
+
+/**
+ * @brief 1 se `etiqueta` está na lista de etiquetas do motor
+ */
+int motor_tem_etiqueta(const AlgoritmoInfo *info, const char *etiqueta);
+
+/**
+ * @brief Índices dos motores que casam com o seletor, em ordem do registro
+ *
+ * @param seletor Termos separados por vírgula; NULL ou "" equivale a "todos"
+ * @return Quantidade escrita em `indices`, ou -1 se algum termo não casa
+ */
+int selecionar_motores(const char *seletor, int *indices, int max_indices);
+
+/**
+ * @brief 0 se o motor não sabe ordenar este tipo de dado
+ *
+ * Motores CAPACIDADE_SO_INTEIROS só aceitam int com comparar_inteiros.
+ */
+int motor_aceita_dados(const AlgoritmoInfo *info, size_t elem_size, CompareFn cmp);
+
+/**
+ * @brief 1 se `info` veio de um plugin (ou de registrar_motor)
+ */
+int eh_plugin(const AlgoritmoInfo *info);
+
+/**
+ * @brief "estavel,em_lugar" etc., ou "-" sem capacidades
+ */
+void descrever_capacidades(unsigned capacidades, char *buffer, size_t tamanho_buffer);
+
+/**
+ * @brief Abre um .so e chama seu SIMBOLO_PLUGIN_MOTORES
+ *
+ * Se o ponto de entrada falha, os motores que ele já registrou são
+ * descartados. Em plataformas sem dlopen sempre falha.
+ *
+ * @return Motores registrados pelo plugin, ou -1 em erro (já reportado)
+ */
+int carregar_plugin_motores(const char *caminho);
+
+/**
+ * @brief Carrega cada caminho de SORTS_PLUGINS (separados por ':')
+ *
+ * @return Total de motores registrados
+ */
+int carregar_plugins_ambiente(void);
+
+/**
+ * @brief Tabela de motores: índice, id, nome, capacidades, etiquetas
+ */
+void listar_motores(FILE *saida);
+
+#endif // REGISTRO_H
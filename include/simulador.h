@@ -0,0 +1,127 @@
+/**
+ * ==============================================================
+ * SIMULADOR OFFLINE DE CACHE E TLB
+ * ==============================================================
+ *
+ * @file simulador.h
+ * @brief Reexecuta um rastro de endereços em L1/L2/LLC + TLB configuráveis
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Cada nível é associativo por conjunto com substituição LRU. Um acesso
+ * desce na hierarquia até acertar (L1 → L2 → LLC → memória) e a linha é
+ * instalada em todos os níveis que falharam. A TLB é simulada com o mesmo
+ * modelo, usando a página como "linha".
+ *
+ * **Distância de reuso:**
+ * Para cada acesso, a quantidade de linhas distintas tocadas desde o
+ * acesso anterior à mesma linha (distância de pilha LRU). Uma cache
+ * totalmente associativa de C linhas acerta exatamente os acessos com
+ * distância < C, então o histograma mostra que tamanho de cache cada
+ * algoritmo precisaria. Primeiros acessos caem no balde "frio".
+ *
+ * Histograma em potências de 2: balde 0 = distância 0, balde k (k ≥ 1)
+ * = distâncias em [2^(k-1), 2^k).
+ *
+ * ==============================================================
+ */
+
+#ifndef SIMULADOR_H
+#define SIMULADOR_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "rastro.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define MAX_NIVEIS_CACHE 3       ///< L1, L2 e LLC
+#define BALDES_REUSO 33          ///< Distância 0, 31 faixas log2 e o balde frio
+#define BALDE_REUSO_FRIO (BALDES_REUSO - 1)
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Geometria de um nível de cache (ou da TLB)
+ *
+ * Para a TLB: tamanho = entradas × página e linha = página.
+ */
+typedef struct {
+    char nome[8];            ///< "L1", "L2", "LLC", "TLB"
+    size_t tamanho;          ///< Capacidade em bytes
+    int associatividade;     ///< Vias por conjunto
+    int linha;               ///< Bytes por linha (potência de 2)
+} NivelCache;
+
+/**
+ * @brief Hierarquia simulada
+ */
+typedef struct {
+    NivelCache niveis[MAX_NIVEIS_CACHE];
+    int num_niveis;
+    NivelCache tlb;
+} ConfiguracaoCache;
+
+/**
+ * @brief Resultado da reexecução de um rastro
+ */
+typedef struct {
+    uint64_t acessos;                          ///< Acessos do rastro
+    uint64_t escritas;                         ///< Dos quais são escritas
+    uint64_t acessos_nivel[MAX_NIVEIS_CACHE];  ///< Acessos que chegaram a cada nível (em linhas)
+    uint64_t falhas_nivel[MAX_NIVEIS_CACHE];   ///< Falhas em cada nível
+    uint64_t acessos_tlb;
+    uint64_t falhas_tlb;
+    uint64_t linhas_distintas;                 ///< Linhas do L1 tocadas ao menos uma vez
+    uint64_t reuso[BALDES_REUSO];              ///< Histograma de distância de reuso
+} EstatisticasCache;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Hierarquia da máquina atual (sysconf), ou 32K/8, 1M/16, 8M/16 e TLB 64/4
+ */
+ConfiguracaoCache configuracao_cache_padrao(void);
+
+/**
+ * @brief Interpreta "tamanho:associatividade:linha" (ex.: "32K:8:64", "8M:16:64")
+ *
+ * @return 0 se válido, -1 caso contrário (nivel não é alterado)
+ */
+int interpretar_nivel_cache(const char *texto, NivelCache *nivel);
+
+/**
+ * @brief Reexecuta o rastro na hierarquia
+ *
+ * @return 0 em caso de sucesso, -1 se a configuração for inválida ou faltar memória
+ */
+int simular_rastro(const RastroMemoria *rastro, const ConfiguracaoCache *config,
+                   EstatisticasCache *estatisticas);
+
+/**
+ * @brief Falhas por mil acessos do rastro (comparável entre níveis e algoritmos)
+ *
+ * A taxa local (falhas / acessos que chegaram ao nível) de L2 e LLC fica
+ * perto de 100% sempre que só falhas compulsórias chegam até eles; por mil
+ * acessos mostra o custo real de cada nível.
+ */
+double falhas_por_mil_acessos(const EstatisticasCache *estatisticas, uint64_t falhas);
+
+/**
+ * @brief Escreve a geometria simulada, uma linha por nível
+ */
+void escrever_configuracao_cache(FILE *arquivo, const ConfiguracaoCache *config);
+
+/**
+ * @brief Escreve taxas de falha e histograma de reuso de um rastro
+ */
+void escrever_estatisticas_cache(FILE *arquivo, const char *titulo,
+                                 const ConfiguracaoCache *config,
+                                 const EstatisticasCache *estatisticas);
+
+#endif // SIMULADOR_H
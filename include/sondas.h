@@ -0,0 +1,123 @@
+/**
+ * ==============================================================
+ * SONDAS USDT (TRACEPOINTS ESTÁTICOS)
+ * ==============================================================
+ *
+ * @file sondas.h
+ * @brief Pontos de rastreamento para bpftrace/perf sem recompilar
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Cada sonda é uma única instrução NOP no binário mais uma nota ELF
+ * (.note.stapsdt) com a localização dos argumentos. Sem ninguém anexado,
+ * o custo é esse NOP; com bpftrace ou perf anexado, o kernel troca o NOP
+ * por um breakpoint e lê os argumentos.
+ *
+ * **Provedor "sorts":**
+ * | Sonda               | Argumentos                                    |
+ * |---------------------|-----------------------------------------------|
+ * | ordenacao-inicio    | id do algoritmo, n, elem_size, otimizada      |
+ * | ordenacao-fim       | id do algoritmo, n, elem_size, otimizada      |
+ * | particao            | profundidade, início, fim, posição do pivô    |
+ * | gap                 | gap, n (um passe do Shell Sort)               |
+ * | medicao-inicio      | id do algoritmo, n, execução                  |
+ * | medicao-fim         | id do algoritmo, n, execução, ticks           |
+ * | io-inicio           | operação, elem_size                           |
+ * | io-fim              | operação, n (-1 em erro), elem_size           |
+ *
+ * Exemplo (histograma de latência por algoritmo):
+ *   bpftrace -e 'usdt:./trabalho_po_1:sorts:ordenacao-inicio { @t[tid] = nsecs; }
+ *                usdt:./trabalho_po_1:sorts:ordenacao-fim /@t[tid]/ {
+ *                    @lat[arg0] = hist(nsecs - @t[tid]); delete(@t[tid]); }'
+ *
+ * **Disponibilidade:**
+ * As sondas dependem de <sys/sdt.h> (pacote systemtap-sdt-dev). Se o
+ * cabeçalho não existir, ou com a opção CMake SORTS_SONDAS_USDT=OFF, todas
+ * as macros viram ((void)0).
+ *
+ * ==============================================================
+ */
+
+#ifndef SONDAS_H
+#define SONDAS_H
+
+/* ==============================================================
+ * DETECÇÃO DE <sys/sdt.h>
+ * ============================================================== */
+
+#if !defined(SORTS_SEM_SONDAS) && defined(__has_include)
+    #if __has_include(<sys/sdt.h>)
+        #include <sys/sdt.h>
+        #define SORTS_SONDAS_ATIVAS 1
+    #endif
+#endif
+
+/* ==============================================================
+ * IDENTIFICADORES
+ * ============================================================== */
+
+/// Algoritmos e referências, na mesma ordem de obter_info_motor()
+#define SONDA_ID_INSERTION 0
+#define SONDA_ID_BUBBLE    1
+#define SONDA_ID_SELECTION 2
+#define SONDA_ID_SHAKER    3
+#define SONDA_ID_SHELL     4
+#define SONDA_ID_QUICK     5
+#define SONDA_ID_HEAP      6
+#define SONDA_ID_QSORT     7  ///< Referência da libc (referencias.h)
+
+/// Operações de E/S
+#define SONDA_IO_LER_NUMEROS    0
+#define SONDA_IO_LER_ALUNOS     1
+#define SONDA_IO_SALVAR_NUMEROS 2
+#define SONDA_IO_SALVAR_ALUNOS  3
+#define SONDA_IO_SALVAR_ARQUIVO 4  ///< salvar_arquivo_multiplos_locais (elem_size = 0)
+
+/* ==============================================================
+ * MACROS DAS SONDAS
+ * ============================================================== */
+
+#ifdef SORTS_SONDAS_ATIVAS
+
+/// Profundidade de recursão do Quick Sort (mantida só quando há sondas)
+extern THREAD_LOCAL int profundidade_sonda;
+
+#define SONDA_ORDENACAO_INICIO(id, n, elem_size) \
+    DTRACE_PROBE4(sorts, ordenacao__inicio, (int)(id), (int)(n), (long)(elem_size), usar_versao_otimizada)
+#define SONDA_ORDENACAO_FIM(id, n, elem_size) \
+    DTRACE_PROBE4(sorts, ordenacao__fim, (int)(id), (int)(n), (long)(elem_size), usar_versao_otimizada)
+#define SONDA_PARTICAO(inicio, fim, pivo) \
+    DTRACE_PROBE4(sorts, particao, profundidade_sonda, (int)(inicio), (int)(fim), (int)(pivo))
+#define SONDA_GAP(gap, n) \
+    DTRACE_PROBE2(sorts, gap, (int)(gap), (int)(n))
+#define SONDA_MEDICAO_INICIO(id, n, execucao) \
+    DTRACE_PROBE3(sorts, medicao__inicio, (int)(id), (int)(n), (int)(execucao))
+#define SONDA_MEDICAO_FIM(id, n, execucao, ticks) \
+    DTRACE_PROBE4(sorts, medicao__fim, (int)(id), (int)(n), (int)(execucao), (unsigned long long)(ticks))
+#define SONDA_IO_INICIO(operacao, elem_size) \
+    DTRACE_PROBE2(sorts, io__inicio, (int)(operacao), (long)(elem_size))
+#define SONDA_IO_FIM(operacao, n, elem_size) \
+    DTRACE_PROBE3(sorts, io__fim, (int)(operacao), (int)(n), (long)(elem_size))
+#define SONDA_ENTRAR_NIVEL() (profundidade_sonda++)
+#define SONDA_SAIR_NIVEL()   (profundidade_sonda--)
+
+#else
+
+#define SONDA_ORDENACAO_INICIO(id, n, elem_size)   ((void)0)
+#define SONDA_ORDENACAO_FIM(id, n, elem_size)      ((void)0)
+#define SONDA_PARTICAO(inicio, fim, pivo)          ((void)0)
+#define SONDA_GAP(gap, n)                          ((void)0)
+#define SONDA_MEDICAO_INICIO(id, n, execucao)      ((void)0)
+#define SONDA_MEDICAO_FIM(id, n, execucao, ticks)  ((void)0)
+#define SONDA_IO_INICIO(operacao, elem_size)       ((void)0)
+#define SONDA_IO_FIM(operacao, n, elem_size)       ((void)0)
+#define SONDA_ENTRAR_NIVEL()                       ((void)0)
+#define SONDA_SAIR_NIVEL()                         ((void)0)
+
+#endif
+
+/**
+ * @brief Retorna 1 se o binário foi compilado com sondas USDT
+ */
+int sondas_usdt_ativas(void);
+
+#endif // SONDAS_H
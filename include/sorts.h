@@ -50,6 +50,31 @@
 #include "analise.h"    ///< Sistema completo de análise e benchmarking
 #include "io.h"         ///< Subsistema de entrada/saída e persistência
 #include "utils.h"      ///< Biblioteca de utilitários e funções auxiliares
+#include "gerador.h"    ///< Geração sintética de entradas em qualquer tamanho
+#include "varredura.h"  ///< Varredura de escala e complexidade empírica
+#include "projecao.h"   ///< Projeção de tempos e cortes por orçamento
+#include "paralelo.h"   ///< Matriz de benchmark paralela em núcleos fixados
+#include "isolamento.h" ///< Fixação, prefault, mlock e modos de cache das medições
+#include "cronometro.h" ///< Cronômetro de ciclos (TSC invariante) com desconto de overhead
+#include "fases.h"      ///< Instrumentação por fases e exportação Chrome trace
+#include "sondas.h"     ///< Sondas USDT para bpftrace/perf
+#include "rastro.h"     ///< Rastro binário de endereços lidos e escritos
+#include "simulador.h"  ///< Simulador offline de cache L1/L2/LLC + TLB
+#include "memoria.h"    ///< Rastreamento dos algoritmos e relatório de cache simulada
+#include "desordem.h"   ///< Métricas de pré-ordenação das entradas
+#include "verificacao.h" ///< Verificação diferencial contra o qsort da libc
+#include "custo.h"      ///< Modelo de custo: comparações × bytes movidos
+#include "referencias.h" ///< qsort da libc (e BSD) como linhas de base
+#include "registro.h"   ///< Registro de motores: seleção por nome/etiqueta e plugins .so
+#include "latencia.h"   ///< Percentis de latência de ordenações de 16-512 elementos
+#include "contencao.h"  ///< Vazão de ordenações simultâneas em T threads
+#include "banda.h"      ///< Sonda de banda de memória e roofline por algoritmo
+#include "ajuste.h"     ///< Autoajuste dos parâmetros dos motores e perfil persistido
+#include "cache_resultados.h" ///< Cache de células medidas e retomada da análise completa
+#include "conjuntos.h"  ///< Conjuntos carregados uma vez e pool de buffers de trabalho
+#include "metricas.h"   ///< Contadores por motor exportados em textfile Prometheus
+#include "aprendida.h"  ///< Learned Sort: CDF aprendida em amostra, baldes e Radix de reserva
+#include "busca.h"      ///< Busca binária sem desvios, Eytzinger e árvore B+ estática
 
 /* ================================================================
  * CONSTANTES GLOBAIS E CONFIGURAÇÕES DO SISTEMA
@@ -104,6 +104,24 @@ typedef struct {
     char cidade[50];          ///< Cidade de residência (máx. 49 caracteres + '\0')
 } Aluno;
 
+/**
+ * @brief Grau de pré-ordenação de uma entrada (calculado uma vez por conjunto)
+ *
+ * Explica o comportamento de algoritmos adaptativos por propriedades da
+ * entrada, e não pelo rótulo do arquivo (aleatorios/crescentes/decrescentes).
+ * Calculado por calcular_metricas_desordem() (desordem.h) com a mesma
+ * função de comparação usada na ordenação.
+ */
+typedef struct {
+    int calculadas;              ///< 1 se as métricas foram calculadas para a entrada
+    long long inversoes;         ///< Pares i < j com a[i] > a[j] (contagem exata)
+    double inversoes_relativas;  ///< inversoes / (n(n-1)/2): 0 = ordenada, 1 = invertida
+    int corridas;                ///< Corridas ascendentes (não decrescentes) maximais
+    int maior_subsequencia;      ///< Maior subsequência não decrescente
+    double razao_distintos;      ///< Chaves distintas / n
+    double entropia;             ///< Entropia das frequências das chaves, em bits
+} MetricasDesordem;
+
 /**
  * @brief Estrutura de métricas abrangentes para análise de performance de algoritmos
  *
@@ -139,8 +157,31 @@ typedef struct {
     long long comparacoes;   ///< Contador de operações de comparação realizadas
     long long trocas;        ///< Contador de operações de troca/swap executadas
     long long movimentacoes; ///< Contador total de movimentações de elementos
+    long long bytes_lidos;   ///< movimentacoes × elem_size (ver banda.h)
+    long long bytes_escritos;///< movimentacoes × elem_size (ver banda.h)
+    int projetado;           ///< 1 se o tempo foi extrapolado (execução pulada pelo orçamento)
+    unsigned modo_isolamento;///< Flags ISOLAMENTO_* aplicadas na medição (ver isolamento.h)
+    unsigned long long ticks;///< Ticks médios do cronômetro, já sem overhead (ver cronometro.h)
+    MetricasDesordem desordem;///< Pré-ordenação da entrada medida (ver desordem.h)
 } ResultadoTempo;
 
+/**
+ * @brief Assinatura uniforme de um motor de ordenação
+ *
+ * @param arr       Array a ordenar (in-place do ponto de vista do chamador)
+ * @param n         Número de elementos
+ * @param elem_size Tamanho de cada elemento em bytes
+ * @param cmp       Comparador (ver CompareFn)
+ * @param contexto  Ponteiro opaco do motor (AlgoritmoInfo.contexto)
+ */
+typedef void (*OrdenacaoFn)(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto);
+
+/* Capacidades declaradas por um motor (AlgoritmoInfo.capacidades) */
+#define CAPACIDADE_ESTAVEL     0x1u  ///< Preserva a ordem relativa de elementos iguais
+#define CAPACIDADE_EM_LUGAR    0x2u  ///< Memória auxiliar O(1) ou O(log n)
+#define CAPACIDADE_SO_INTEIROS 0x4u  ///< Só ordena int com comparar_inteiros (ignora cmp)
+#define CAPACIDADE_PARALELO    0x8u  ///< Usa várias threads internamente
+
 /**
  * @brief Registro descritivo completo de um algoritmo de ordenação
  *
@@ -160,12 +201,10 @@ typedef struct {
  * - Localidade: padrão de acesso à memória (importante para cache)
  *
  * **Design pattern Strategy implementado:**
- * Os ponteiros de função permitem trocar algoritmos em runtime sem
- * modificar o código cliente, seguindo o princípio aberto/fechado.
- *
- * **Tratamento especial para Quick Sort:**
- * Quick Sort usa assinatura diferente (início/fim em vez de tamanho)
- * devido à natureza recursiva e necessidade de particionamento.
+ * Todo motor (algoritmo, referência da libc ou plugin) expõe a mesma
+ * assinatura OrdenacaoFn; o Quick Sort, cuja interface recursiva usa
+ * início/fim, entra por um adaptador. O registro de motores (registro.h)
+ * guarda estas estruturas e permite selecioná-las por nome ou etiqueta.
  *
  * @note Ponteiros de função devem ser inicializados para versões adequadas
  * @see configurar_otimizacao() Para alternar entre versões otimizadas/didáticas
@@ -175,15 +214,49 @@ typedef struct {
     char complexidade_melhor[15];     ///< Notação Big-O melhor caso (ex: "O(n)")
     char complexidade_media[15];      ///< Notação Big-O caso médio (ex: "O(n log n)")
     char complexidade_pior[15];       ///< Notação Big-O pior caso (ex: "O(n²)")
-    int eh_estavel;                   ///< Flag de estabilidade: 1=estável, 0=não-estável
+    unsigned capacidades;             ///< Combinação de CAPACIDADE_* (estável, in-place, ...)
 
-    /// Ponteiro para implementação padrão (assinatura genérica)
-    void (*sort_fn)(void*, int, size_t, CompareFn);
-    /// Ponteiro específico para Quick Sort (assinatura com início/fim)
-    void (*quick_sort_fn)(void*, int, int, size_t, CompareFn);
-    int eh_quick;                     ///< Identificador Quick Sort: 1=sim, 0=não
+    OrdenacaoFn ordenar;              ///< Implementação (assinatura uniforme)
+    void *contexto;                   ///< Repassado a `ordenar` (NULL nos motores internos)
+
+    char id[16];                      ///< Nome curto para seleção e casos do sort_bench (ex: "quick")
+    char etiquetas[48];               ///< Etiquetas separadas por vírgula (ex: "interno,n_log_n")
 } AlgoritmoInfo;
 
+/**
+ * @brief Distribuições de entrada suportadas pelo gerador sintético
+ *
+ * As três primeiras reproduzem as famílias de arquivos numéricos da
+ * pasta `data/` em qualquer tamanho; Zipf e agrupada existem só no
+ * gerador e estressam motores que modelam a distribuição das chaves.
+ *
+ * @see gerar_numeros() Função que materializa cada distribuição
+ */
+typedef enum {
+    DIST_ALEATORIA = 0,   ///< Valores uniformes (equivale a numeros_aleatorios_*)
+    DIST_CRESCENTE,       ///< Sequência não-decrescente (equivale a numeros_crescentes_*)
+    DIST_DECRESCENTE,     ///< Sequência não-crescente (equivale a numeros_decrescentes_*)
+    DIST_ZIPF,            ///< Cauda longa: poucos valores pequenos dominam (muitas repetições)
+    DIST_AGRUPADA,        ///< Aglomerados estreitos em torno de centros uniformes
+    NUM_DISTRIBUICOES     ///< Quantidade de distribuições (sentinela)
+} DistribuicaoDados;
+
+/**
+ * @brief Resultado de um ajuste por mínimos quadrados y = inclinacao·x + intercepto
+ *
+ * Usado na validação experimental de complexidade: ajustando log(tempo)
+ * contra log(n), a inclinação é o expoente empírico do algoritmo
+ * (≈1 para O(n), ≈2 para O(n²), ligeiramente acima de 1 para O(n log n)).
+ *
+ * @see ajustar_lei_potencia() Ajuste em escala log-log
+ */
+typedef struct {
+    double inclinacao;   ///< Coeficiente angular da reta ajustada
+    double intercepto;   ///< Coeficiente linear da reta ajustada
+    double r2;           ///< Coeficiente de determinação (qualidade do ajuste, 0..1)
+    int pontos;          ///< Quantidade de pontos usados no ajuste
+} AjusteLinear;
+
 /* ==============================================================
  * CONFIGURAÇÕES E CONSTANTES
  * ============================================================== */
@@ -192,11 +265,26 @@ typedef struct {
  * @brief Número de algoritmos de ordenação disponíveis no sistema
  *
  * Esta constante define quantos algoritmos de ordenação estão implementados
- * e disponíveis para análise. É usada para dimensionar arrays da estrutura
- * AlgoritmoInfo e controlar loops de iteração pelos algoritmos.
+ * (com versões otimizada e didática) e disponíveis para análise. Ocupam os
+ * primeiros índices do registro de motores; referências da libc e plugins
+ * vêm depois e são contados em tempo de execução (num_motores()).
  */
 #define NUM_ALGORITMOS 7
 
+/**
+ * @brief Qualificador de armazenamento por thread
+ *
+ * O estado usado durante uma ordenação (contadores, comparador corrente,
+ * versão selecionada) é privado de cada thread. Assim a matriz paralela
+ * (paralelo.c) mede várias células ao mesmo tempo sem que uma thread
+ * contamine os contadores da outra; em execução serial nada muda.
+ */
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL _Thread_local
+#endif
+
 /**
  * @brief Flag global para controlar otimizações
  *
@@ -205,7 +293,7 @@ typedef struct {
  * eficientes, enquanto as didáticas são mais lentas, mas podem ser mais
  * fáceis de entender e depurar.
  */
-extern int usar_versao_otimizada;
+extern THREAD_LOCAL int usar_versao_otimizada;
 
 /**
  * @brief Contadores globais para métricas de desempenho
@@ -213,11 +301,11 @@ extern int usar_versao_otimizada;
  * Estas variáveis são usadas para contar o número de operações realizadas
  * durante a execução dos algoritmos, como comparações, trocas e movimentações. Os valores
  * são armazenados globalmente para permitir o acesso e análise posterior
- * após a execução dos algoritmos.
+ * após a execução dos algoritmos. Cada thread possui sua própria cópia.
  */
-extern long long contador_comparacoes;
-extern long long contador_trocas;
-extern long long contador_movimentacoes;
+extern THREAD_LOCAL long long contador_comparacoes;
+extern THREAD_LOCAL long long contador_trocas;
+extern THREAD_LOCAL long long contador_movimentacoes;
 
 /* ==============================================================
  * FUNÇÕES DE CONFIGURAÇÃO
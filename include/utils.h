@@ -32,6 +32,7 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stdint.h>
 #include "tipos.h"
 
 /* ================================================================
@@ -252,6 +253,23 @@ void copiar_elemento(void *destino, const void *origem, size_t elem_size);
  */
 void copiar_array(const void *origem, void *destino, int tamanho, size_t elem_size);
 
+#define CHECKSUM_DADOS_INICIAL 0xcbf29ce484222325ULL  ///< Base FNV-1a de 64 bits
+
+/**
+ * @brief FNV-1a de 64 bits sobre os bytes de um conjunto
+ *
+ * Identifica os dados carregados (chave do cache de resultados,
+ * EstatisticasCarga.checksum da leitura).
+ */
+uint64_t checksum_dados(const void *dados, size_t bytes);
+
+/**
+ * @brief Continua um checksum_dados() parcial (carga em blocos ou elemento a elemento)
+ *
+ * continuar_checksum_dados(CHECKSUM_DADOS_INICIAL, d, n) == checksum_dados(d, n).
+ */
+uint64_t continuar_checksum_dados(uint64_t parcial, const void *dados, size_t bytes);
+
 /* ================================================================
  * SUBSISTEMA DE INTERFACE E CONTROLE DE TERMINAL
  * ================================================================ */
@@ -444,6 +462,14 @@ void salvar_arquivo_multiplos_locais(const char* subdir, const char* nome_arquiv
  * ORQUESTRADOR PRINCIPAL DE EXPERIMENTOS E ANÁLISES
  * ================================================================ */
 
+/**
+ * @brief Retorna a lista de arquivos numéricos da pasta data/
+ *
+ * @param quantidade Recebe o número de arquivos (pode ser NULL)
+ * @return Array estático com os nomes (família e tamanho crescente)
+ */
+const char* const* obter_arquivos_numeros(int *quantidade);
+
 /**
  * @brief Executa bateria completa de testes com versões otimizadas e didáticas
  *
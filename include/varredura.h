@@ -0,0 +1,168 @@
+/**
+ * ==============================================================
+ * VARREDURA DE ESCALA - VALIDAÇÃO EMPÍRICA DE COMPLEXIDADE
+ * ==============================================================
+ *
+ * @file varredura.h
+ * @brief Medição em tamanhos geométricos e ajuste de complexidade empírica
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * As complexidades em [`AlgoritmoInfo`](include/tipos.h:173) são strings
+ * declaradas à mão. Este módulo as confronta com a realidade: cada algoritmo
+ * é executado em entradas de tamanho 2^8, 2^9, ..., 2^26 para cada
+ * distribuição, e o crescimento observado é ajustado por mínimos quadrados.
+ *
+ * **Resultados produzidos:**
+ * - Expoente empírico (inclinação log-log) de tempo e de comparações
+ * - Constante c do modelo t ≈ c·n·log2(n)
+ * - Veredito: o expoente observado confere com a complexidade declarada?
+ * - Pontos de cruzamento: tamanho n em que um algoritmo passa a vencer outro
+ *
+ * **Uso dos cruzamentos:**
+ * Os cruzamentos indicam limiares práticos (ex.: abaixo de qual tamanho o
+ * Insertion Sort supera o Quick Sort), úteis para calibrar algoritmos híbridos.
+ *
+ * ==============================================================
+ */
+
+#ifndef VARREDURA_H
+#define VARREDURA_H
+
+#include <stdint.h>
+#include "tipos.h"
+#include "registro.h"
+
+/* ==============================================================
+ * CONSTANTES DA VARREDURA
+ * ============================================================== */
+
+#define EXPOENTE_MINIMO_VARREDURA 8   ///< Menor tamanho: 2^8 = 256 elementos
+#define EXPOENTE_MAXIMO_VARREDURA 26  ///< Maior tamanho: 2^26 ≈ 67 milhões de elementos
+
+/// Número máximo de tamanhos medidos por curva
+#define MAX_PONTOS_VARREDURA (EXPOENTE_MAXIMO_VARREDURA - EXPOENTE_MINIMO_VARREDURA + 1)
+
+/// Limite padrão (segundos) de uma medição antes de encerrar a curva
+#define LIMITE_TEMPO_VARREDURA_PADRAO 0.5
+
+/// Capacidade máxima da lista de pontos de cruzamento
+#define MAX_CRUZAMENTOS_VARREDURA 1024
+
+/// Número máximo de curvas: distribuições × (versões didáticas + todos os motores)
+#define MAX_CURVAS_VARREDURA (NUM_DISTRIBUICOES * (NUM_ALGORITMOS + MAX_MOTORES))
+
+/* ==============================================================
+ * ESTRUTURAS DA VARREDURA
+ * ============================================================== */
+
+/**
+ * @brief Parâmetros de uma execução da varredura de escala
+ */
+typedef struct {
+    int expoente_minimo;    ///< Primeiro tamanho medido: 2^expoente_minimo
+    int expoente_maximo;    ///< Último tamanho medido: 2^expoente_maximo
+    double limite_tempo;    ///< Medição acima deste tempo (s) encerra a curva
+    int incluir_didaticas;  ///< 1 para medir também as versões didáticas
+    uint64_t semente;       ///< Semente do gerador de dados
+} ConfiguracaoVarredura;
+
+/**
+ * @brief Série de medições de um algoritmo em uma distribuição e variante
+ *
+ * Os pontos são sempre tamanhos consecutivos a partir de 2^expoente_minimo;
+ * a série termina quando uma medição ultrapassa o limite de tempo.
+ */
+typedef struct {
+    int indice_algoritmo;                         ///< Índice em obter_info_motor()
+    int otimizada;                                ///< 1 = versão otimizada, 0 = didática
+    DistribuicaoDados distribuicao;               ///< Distribuição das entradas
+    int num_pontos;                               ///< Quantidade de tamanhos medidos
+    int tamanhos[MAX_PONTOS_VARREDURA];           ///< n de cada ponto
+    double tempos[MAX_PONTOS_VARREDURA];          ///< Tempo médio (s) de cada ponto
+    unsigned long long ticks[MAX_PONTOS_VARREDURA];///< Ticks médios do cronômetro de cada ponto
+    long long comparacoes[MAX_PONTOS_VARREDURA];  ///< Comparações de cada ponto
+    long long trocas[MAX_PONTOS_VARREDURA];       ///< Trocas de cada ponto
+    long long movimentacoes[MAX_PONTOS_VARREDURA];///< Movimentações de cada ponto
+    unsigned modos_isolamento[MAX_PONTOS_VARREDURA];///< Flags ISOLAMENTO_* de cada ponto
+    AjusteLinear ajuste_tempo;                    ///< Ajuste log-log do tempo
+    AjusteLinear ajuste_comparacoes;              ///< Ajuste log-log das comparações
+    double constante_nlogn;                       ///< Média de t/(n·log2 n), em segundos
+    double variacao_nlogn;                        ///< Coeficiente de variação da constante
+    int interrompida;                             ///< 1 se encerrada pelo limite de tempo
+    int tamanho_projetado;                        ///< Primeiro n não medido (0 = nenhum)
+    double tempo_projetado;                       ///< Tempo extrapolado para tamanho_projetado
+} CurvaEscala;
+
+/**
+ * @brief Tamanho em que a ordem de velocidade entre dois algoritmos se inverte
+ */
+typedef struct {
+    int algoritmo_a;                 ///< Índice do primeiro algoritmo
+    int algoritmo_b;                 ///< Índice do segundo algoritmo
+    int otimizada;                   ///< Variante dos dois algoritmos
+    DistribuicaoDados distribuicao;  ///< Distribuição em que ocorre o cruzamento
+    double tamanho;                  ///< n estimado do cruzamento (interpolação log-log)
+    int a_vence_acima;               ///< 1 se A é mais rápido acima do cruzamento
+} PontoCruzamento;
+
+/**
+ * @brief Conjunto completo de resultados de uma varredura
+ */
+typedef struct {
+    ConfiguracaoVarredura config;                         ///< Parâmetros utilizados
+    int num_curvas;                                       ///< Curvas preenchidas
+    CurvaEscala curvas[MAX_CURVAS_VARREDURA];             ///< Séries medidas
+    int num_cruzamentos;                                  ///< Cruzamentos encontrados
+    PontoCruzamento cruzamentos[MAX_CRUZAMENTOS_VARREDURA]; ///< Lista de cruzamentos
+} ResultadoVarredura;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Retorna a configuração padrão (2^8..2^26, limite de 0.5 s, ambas as versões)
+ */
+ConfiguracaoVarredura configuracao_varredura_padrao(void);
+
+/**
+ * @brief Executa a varredura de escala e calcula ajustes e cruzamentos
+ *
+ * **Como funciona:**
+ * 1. Para cada distribuição, gera entradas de tamanho 2^k (k crescente)
+ * 2. Mede cada algoritmo ainda ativo com medir_algoritmo()
+ * 3. Um algoritmo deixa a curva quando a projeção do próximo tamanho (ou uma
+ *    medição) excede o limite de tempo; o tempo projetado fica registrado
+ * 4. Ajusta expoentes empíricos e detecta pontos de cruzamento
+ *
+ * @param config Parâmetros da varredura
+ * @return Resultado alocado dinamicamente (liberar com free), ou NULL se erro
+ */
+ResultadoVarredura* executar_varredura_escala(const ConfiguracaoVarredura *config);
+
+/**
+ * @brief Salva o relatório textual e o CSV bruto da varredura em output/relatorios
+ *
+ * Arquivos gerados: `varredura_escala.txt` e `varredura_escala.csv`.
+ *
+ * @param resultado Resultado de executar_varredura_escala()
+ */
+void gerar_relatorio_varredura(const ResultadoVarredura *resultado);
+
+/**
+ * @brief Converte uma notação Big-O declarada em expoente de n
+ *
+ * Exemplos: "O(n²)" → 2, "O(n^1.25)" → 1.25, "O(n log n)" → 1 (com log).
+ *
+ * @param notacao String no formato usado em AlgoritmoInfo
+ * @param tem_logaritmo Recebe 1 se a notação inclui fator log n (pode ser NULL)
+ * @return Expoente de n da notação
+ */
+double expoente_declarado(const char *notacao, int *tem_logaritmo);
+
+/**
+ * @brief Ponto de entrada do menu: executa a varredura padrão e gera os relatórios
+ */
+void executar_varredura_completa(void);
+
+#endif // VARREDURA_H
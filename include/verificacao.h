@@ -0,0 +1,175 @@
+/**
+ * ==============================================================
+ * VERIFICAÇÃO DIFERENCIAL DOS ALGORITMOS
+ * ==============================================================
+ *
+ * @file verificacao.h
+ * @brief Casos aleatórios conferidos contra o qsort da libc
+ * @author Sistema de Análise de Performance de Algoritmos de Ordenação
+ *
+ * Cada caso sorteia tamanho, padrão da entrada, tamanho do elemento e
+ * função de comparação, e roda todos os algoritmos nas duas versões:
+ *
+ *  ┌──────────────┐    ┌────────────────────┐    ┌──────────────────────┐
+ *  │ entrada      │ →  │ algoritmo × versão │ →  │ ordem (vs qsort)     │
+ *  │ (semente do  │    └────────────────────┘    │ permutação (bytes)   │
+ *  │  caso)       │ →  qsort (referência)    →   │ estabilidade (se     │
+ *  └──────────────┘                              │ CAPACIDADE_ESTAVEL)  │
+ *                                                └──────────────────────┘
+ *
+ * Os elementos são registros de `elem_size` bytes: chave int nos 4
+ * primeiros, índice original nos 4 seguintes (quando cabe) e o resto
+ * preenchido a partir do índice. Assim uma troca parcial, uma cópia
+ * truncada ou um elemento duplicado aparecem na conferência de bytes, e
+ * o índice revela reordenação de chaves iguais.
+ *
+ * Um em cada FRACAO_INTEIROS_VERIFICACAO casos é int puro (elem_size 4,
+ * comparar_inteiros): só esses casos alcançam os motores
+ * CAPACIDADE_SO_INTEIROS, como a ordenação aprendida.
+ *
+ * Toda falha informa a semente do caso, que reproduz a entrada exata.
+ * Com -DSORTS_SANITIZERS=ON a mesma verificação roda sob ASan/UBSan.
+ *
+ * ==============================================================
+ */
+
+#ifndef VERIFICACAO_H
+#define VERIFICACAO_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "tipos.h"
+
+/* ==============================================================
+ * CONSTANTES
+ * ============================================================== */
+
+#define CASOS_VERIFICACAO_PADRAO 300     ///< Casos sorteados por execução
+#define TAMANHO_MAXIMO_VERIFICACAO 600   ///< Maior n sorteado (algoritmos O(n²) incluídos)
+#define MAX_ELEM_SIZE_VERIFICACAO 256    ///< Maior elemento (bytes) aceito por um caso
+#define FRACAO_INTEIROS_VERIFICACAO 4    ///< 1 em 4 casos: int puro com comparar_inteiros
+#define NUM_PARAMETROS_VERIFICACAO 4     ///< ParametrosMotores alternativos conferidos por caso
+
+/* ==============================================================
+ * ESTRUTURAS
+ * ============================================================== */
+
+/**
+ * @brief Forma da sequência de chaves
+ */
+typedef enum {
+    PADRAO_ALEATORIO = 0,     ///< Chaves uniformes em toda a faixa de int
+    PADRAO_CRESCENTE,         ///< Já ordenada
+    PADRAO_DECRESCENTE,       ///< Ordem inversa
+    PADRAO_POUCOS_DISTINTOS,  ///< Até 4 chaves diferentes (muitos empates)
+    PADRAO_CONSTANTE,         ///< Uma única chave
+    PADRAO_SERRA,             ///< Sobe e desce (organ pipe)
+    PADRAO_EXTREMOS,          ///< Aleatórias com INT_MIN e INT_MAX intercalados
+    NUM_PADROES_VERIFICACAO
+} PadraoVerificacao;
+
+/**
+ * @brief Função de comparação usada no caso
+ */
+typedef enum {
+    COMPARADOR_CRESCENTE = 0,  ///< Chave crescente
+    COMPARADOR_DECRESCENTE,    ///< Chave decrescente
+    COMPARADOR_RESTO,          ///< Chave módulo 8 (empates mesmo em entradas aleatórias)
+    COMPARADOR_INTEIROS,       ///< comparar_inteiros do programa (lê a chave no início do registro)
+    NUM_COMPARADORES_VERIFICACAO
+} ComparadorVerificacao;
+
+/**
+ * @brief Um caso completamente determinado pela semente
+ */
+typedef struct {
+    uint64_t semente;
+    int tamanho;
+    size_t elem_size;
+    PadraoVerificacao padrao;
+    ComparadorVerificacao comparador;
+} CasoVerificacao;
+
+/**
+ * @brief Parâmetros de uma execução
+ */
+typedef struct {
+    uint64_t semente;     ///< Semente mestra (cada caso deriva a sua)
+    int casos;            ///< Quantidade de casos sorteados
+    int tamanho_maximo;   ///< Maior n sorteado
+    int verboso;          ///< 1 para imprimir cada caso
+} OpcoesVerificacao;
+
+/**
+ * @brief Totais de uma execução
+ */
+typedef struct {
+    int casos;
+    int execucoes;              ///< Casos × algoritmos × versões
+    int falhas_ordem;           ///< Saída diverge da ordem do qsort
+    int falhas_permutacao;      ///< Bytes perdidos, duplicados ou corrompidos
+    int falhas_estabilidade;    ///< Algoritmo estável reordenou chaves iguais
+} ResultadoVerificacao;
+
+/* ==============================================================
+ * INTERFACE PÚBLICA
+ * ============================================================== */
+
+/**
+ * @brief Opções padrão (300 casos, n até 600, semente do gerador)
+ */
+OpcoesVerificacao opcoes_verificacao_padrao(void);
+
+/**
+ * @brief Sorteia os parâmetros de um caso a partir da semente
+ */
+CasoVerificacao sortear_caso_verificacao(uint64_t semente, int tamanho_maximo);
+
+/**
+ * @brief Roda um algoritmo (na versão pedida) sobre `entrada` e confere
+ *
+ * @param chaves Chaves da entrada (n valores); o restante de cada registro
+ *               é preenchido a partir do índice
+ * @param saida  Onde descrever a falha (NULL = silencioso)
+ * @return 0 se passou; senão combinação de bits 1 = ordem, 2 = permutação,
+ *         4 = estabilidade; -1 se faltar memória
+ */
+int verificar_algoritmo(const AlgoritmoInfo *algoritmo, int otimizada, const int *chaves,
+                        int tamanho, size_t elem_size, ComparadorVerificacao comparador,
+                        FILE *saida);
+
+/**
+ * @brief Gera a entrada de um caso e confere todos os algoritmos nas duas versões
+ *
+ * As versões otimizadas internas rodam também sob alguns ParametrosMotores
+ * além dos em vigor (cortes do Quick, gaps Ciura/Tokuda, heaps 3/4/8/16-ários);
+ * os parâmetros em vigor são restaurados ao final.
+ *
+ * @return Quantidade de execuções que falharam, ou -1 se faltar memória
+ */
+int verificar_caso(const CasoVerificacao *caso, ResultadoVerificacao *resultado, FILE *saida);
+
+/**
+ * @brief Executa `opcoes->casos` casos e imprime o resumo
+ *
+ * @return Quantidade total de execuções que falharam, ou -1 em erro
+ */
+int verificar_algoritmos(const OpcoesVerificacao *opcoes, ResultadoVerificacao *resultado,
+                         FILE *saida);
+
+/**
+ * @brief Nome curto de um padrão ("aleatorio", "serra", ...)
+ */
+const char* nome_padrao_verificacao(PadraoVerificacao padrao);
+
+/**
+ * @brief Nome curto de um comparador ("crescente", "resto8", ...)
+ */
+const char* nome_comparador_verificacao(ComparadorVerificacao comparador);
+
+/**
+ * @brief Função de comparação de um comparador (para motor_aceita_dados)
+ */
+CompareFn funcao_comparador_verificacao(ComparadorVerificacao comparador);
+
+#endif // VERIFICACAO_H
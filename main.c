@@ -35,6 +35,34 @@ int main(void) {
     limpar_terminal();
     imprimir_cabecalho();
 
+    // Calibra o cronômetro antes de qualquer medição (e antes de criar threads)
+    inicializar_cronometro();
+
+    // Teto do roofline: banda sustentável de cópia/escala (banda.c)
+    medir_banda_memoria();
+    char banda[128];
+    descrever_banda_memoria(banda, sizeof(banda));
+    printf("Banda de memoria: %s\n", banda);
+
+    // Parâmetros dos motores ajustados para esta máquina (ajuste.c), se houver perfil
+    char perfil[MAX_PATH];
+    char parametros[96];
+    if (carregar_perfil_ajuste(perfil, sizeof(perfil)) > 0) {
+        descrever_parametros_motores(obter_parametros_motores(), parametros, sizeof(parametros));
+        printf("Perfil de ajuste: %s (%s)\n", perfil, parametros);
+    }
+
+    // Motores extras de plugins .so listados em SORTS_PLUGINS (registro.c)
+    int plugins = carregar_plugins_ambiente();
+    if (plugins > 0) {
+        printf("Plugins: %d motor(es) registrado(s), %d no total\n", plugins, num_motores());
+    }
+
+    // Exportação periódica de contadores por motor em SORTS_METRICAS (metricas.c)
+    if (iniciar_metricas_ambiente() > 0) {
+        printf("Metricas: %s\n", getenv(VARIAVEL_AMBIENTE_METRICAS));
+    }
+
     int opcao;
 
     // Loop principal do programa
@@ -51,6 +79,70 @@ int main(void) {
                 pausar();
                 break;
 
+            case 2:
+                // Valida complexidades declaradas em tamanhos crescentes
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_varredura_completa();
+                pausar();
+                break;
+
+            case 3:
+                // Distribui as células do benchmark entre núcleos físicos
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_matriz_paralela_completa();
+                pausar();
+                break;
+
+            case 4:
+                // Escolhe fixação, prefault/mlock e modo de cache das medições
+                limpar_terminal();
+                imprimir_cabecalho();
+                menu_isolamento();
+                pausar();
+                break;
+
+            case 5:
+                // Rastreia acessos e reexecuta no simulador de cache
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_analise_memoria();
+                pausar();
+                break;
+
+            case 6:
+                // Ajusta tempo = a·comparações + b·bytes movidos por algoritmo
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_analise_custo();
+                pausar();
+                break;
+
+            case 7:
+                // Percentis de latência de ordenações individuais de 16-512 elementos
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_latencia_pequenos();
+                pausar();
+                break;
+
+            case 8:
+                // T threads ordenando arrays próprios ao mesmo tempo
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_contencao_completa();
+                pausar();
+                break;
+
+            case 9:
+                // Ajusta corte, gaps e aridade nesta máquina e grava o perfil
+                limpar_terminal();
+                imprimir_cabecalho();
+                executar_autoajuste_completo();
+                pausar();
+                break;
+
             case 0:
                 printf("\n=== ENCERRANDO O PROGRAMA ===\n");
                 printf("Obrigado por usar o Sistema de Analise de Algoritmos!\n");
@@ -59,7 +151,7 @@ int main(void) {
 
             default:
                 printf("\nOPCAO INVALIDA! Por favor, escolha uma opcao valida.\n");
-                printf("Dica: Digite apenas numeros (1 ou 0)\n");
+                printf("Dica: Digite apenas numeros (0 a 9)\n");
                 pausar();
                 break;
         }
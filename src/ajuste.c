@@ -0,0 +1,581 @@
+/**
+ * ================================================================
+ * AUTOAJUSTE DOS PARÂMETROS DOS MOTORES
+ * ================================================================
+ *
+ * @file ajuste.c
+ * @brief Varredura de candidatos, perfil persistido e comparação padrão × ajustado
+ *
+ *  UM CANDIDATO:
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ Instala o valor (os  │ → │ Por distribuição:    │ → │ Tempo do candidato = │
+ * │ outros no padrão)    │   │ 1 aquecimento + R    │   │ soma das medianas    │
+ * │                      │   │ ordenações medidas   │   │ das distribuições    │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * A mediana (não a média) descarta interrupções; somar aleatória e
+ * crescente evita escolher um corte que só ganha em um tipo de entrada.
+ *
+ *  PERFIL (texto, uma chave por linha):
+ * ┌──────────────────────────────────────────────────────────────┐
+ * │ # comentário                                                 │
+ * │ versao = 1                                                   │
+ * │ frequencia_cronometro_hz = 2100000000                        │
+ * │ limite_insercao_quick = 16                                   │
+ * │ sequencia_shell = ciura                                      │
+ * │ aridade_heap = 4                                             │
+ * └──────────────────────────────────────────────────────────────┘
+ *
+ * Chaves ausentes ficam no padrão; chaves desconhecidas geram aviso e
+ * são ignoradas (perfis de versões futuras continuam carregando).
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy, strcmp, strchr
+#include <ctype.h>   // Para isspace
+
+/* ================================================================
+ * CONSTANTES INTERNAS
+ * ================================================================ */
+
+#define PARAMETRO_CORTE_QUICK 0
+#define PARAMETRO_SEQUENCIA_SHELL 1
+#define PARAMETRO_ARIDADE_HEAP 2
+
+static const int candidatos_corte_quick[] = {0, 4, 8, 12, 16, 24, 32, 48, 64};
+static const int candidatos_aridade_heap[] = {2, 3, 4, 8};
+
+/// Entradas da varredura: o caso típico e o caso já ordenado
+static const DistribuicaoDados distribuicoes_ajuste[] = {DIST_ALEATORIA, DIST_CRESCENTE};
+#define NUM_DISTRIBUICOES_AJUSTE 2
+
+#define TAMANHO_LINHA_PERFIL 256
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int indice_motor_ajustado(int parametro);
+static void aplicar_candidato(ParametrosMotores *parametros, int parametro, int valor);
+static void formatar_valor_parametro(int parametro, int valor, char *buffer, size_t tamanho_buffer);
+static double medir_mediana(const AlgoritmoInfo *info, const int *original, int *trabalho,
+                            int n, int repeticoes, uint64_t *amostras);
+static void montar_varredura(VarreduraParametro *varredura, int parametro);
+static void varrer_parametro(VarreduraParametro *varredura, int parametro, const ConfiguracaoAjuste *config,
+                             int **entradas, int *trabalho, uint64_t *amostras);
+static char* aparar(char *texto);
+static int ler_inteiro(const char *texto, long minimo, long maximo, int *destino);
+static int ler_perfil(const char *caminho, ParametrosMotores *destino, double *frequencia);
+static void imprimir_resumo_ajuste(const RelatorioAjuste *relatorio);
+static void escrever_perfil_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_ajuste_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+ConfiguracaoAjuste configuracao_ajuste_padrao(void) {
+    ConfiguracaoAjuste config;
+    config.tamanho = TAMANHO_AJUSTE_PADRAO;
+    config.repeticoes = REPETICOES_AJUSTE_PADRAO;
+    config.ganho_minimo = GANHO_MINIMO_AJUSTE;
+    config.semente = SEMENTE_PADRAO_GERADOR;
+    return config;
+}
+
+/* ================================================================
+ * PARÂMETROS
+ * ================================================================ */
+
+/**
+ * @brief Motor afetado por cada parâmetro (procurado pelo id, não pela posição)
+ */
+static int indice_motor_ajustado(int parametro) {
+    const char *id = parametro == PARAMETRO_CORTE_QUICK ? "quick" :
+                     parametro == PARAMETRO_SEQUENCIA_SHELL ? "shell" : "heap";
+    return indice_motor(buscar_motor(id));
+}
+
+static void aplicar_candidato(ParametrosMotores *parametros, int parametro, int valor) {
+    switch (parametro) {
+        case PARAMETRO_CORTE_QUICK:     parametros->limite_insercao_quick = valor; break;
+        case PARAMETRO_SEQUENCIA_SHELL: parametros->sequencia_shell = (SequenciaShell)valor; break;
+        default:                        parametros->aridade_heap = valor; break;
+    }
+}
+
+static void formatar_valor_parametro(int parametro, int valor, char *buffer, size_t tamanho_buffer) {
+    if (parametro == PARAMETRO_SEQUENCIA_SHELL) {
+        const char *nome = nome_sequencia_shell((SequenciaShell)valor);
+        snprintf(buffer, tamanho_buffer, "%s", nome ? nome : "?");
+    } else if (parametro == PARAMETRO_CORTE_QUICK && valor == 0) {
+        snprintf(buffer, tamanho_buffer, "0 (sem corte)");
+    } else {
+        snprintf(buffer, tamanho_buffer, "%d", valor);
+    }
+}
+
+/* ================================================================
+ * MEDIÇÃO
+ * ================================================================ */
+
+/**
+ * @brief Mediana (s) de `repeticoes` ordenações de uma cópia de `original`
+ */
+static double medir_mediana(const AlgoritmoInfo *info, const int *original, int *trabalho,
+                            int n, int repeticoes, uint64_t *amostras) {
+    // Aquecimento: código e dados na cache, páginas de `trabalho` já mapeadas
+    memcpy(trabalho, original, (size_t)n * sizeof(int));
+    executar_ordenacao(info, trabalho, n, sizeof(int), comparar_inteiros);
+
+    for (int r = 0; r < repeticoes; r++) {
+        memcpy(trabalho, original, (size_t)n * sizeof(int));
+        uint64_t inicio = cronometro_iniciar();
+        executar_ordenacao(info, trabalho, n, sizeof(int), comparar_inteiros);
+        uint64_t fim = cronometro_parar();
+        amostras[r] = cronometro_decorrido(inicio, fim);
+    }
+
+    ordenar_ticks(amostras, repeticoes);
+    return percentil_ticks_ns(amostras, repeticoes, 0.5) / 1e9;
+}
+
+static void montar_varredura(VarreduraParametro *varredura, int parametro) {
+    const ParametrosMotores padrao = parametros_motores_padrao();
+    int valor_padrao;
+
+    memset(varredura, 0, sizeof(*varredura));
+    varredura->indice_motor = indice_motor_ajustado(parametro);
+
+    if (parametro == PARAMETRO_CORTE_QUICK) {
+        varredura->chave = "limite_insercao_quick";
+        varredura->num_candidatos = (int)(sizeof(candidatos_corte_quick) / sizeof(candidatos_corte_quick[0]));
+        memcpy(varredura->valores, candidatos_corte_quick, sizeof(candidatos_corte_quick));
+        valor_padrao = padrao.limite_insercao_quick;
+    } else if (parametro == PARAMETRO_SEQUENCIA_SHELL) {
+        varredura->chave = "sequencia_shell";
+        varredura->num_candidatos = NUM_SEQUENCIAS_SHELL;
+        for (int s = 0; s < NUM_SEQUENCIAS_SHELL; s++) varredura->valores[s] = s;
+        valor_padrao = (int)padrao.sequencia_shell;
+    } else {
+        varredura->chave = "aridade_heap";
+        varredura->num_candidatos = (int)(sizeof(candidatos_aridade_heap) / sizeof(candidatos_aridade_heap[0]));
+        memcpy(varredura->valores, candidatos_aridade_heap, sizeof(candidatos_aridade_heap));
+        valor_padrao = padrao.aridade_heap;
+    }
+
+    for (int c = 0; c < varredura->num_candidatos; c++) {
+        if (varredura->valores[c] == valor_padrao) varredura->indice_padrao = c;
+    }
+    varredura->indice_escolhido = varredura->indice_padrao;
+}
+
+/**
+ * @brief Mede todos os candidatos de um parâmetro (demais parâmetros no padrão)
+ */
+static void varrer_parametro(VarreduraParametro *varredura, int parametro, const ConfiguracaoAjuste *config,
+                             int **entradas, int *trabalho, uint64_t *amostras) {
+    const AlgoritmoInfo *info = obter_info_motor(varredura->indice_motor);
+    char valor[32];
+
+    for (int c = 0; c < varredura->num_candidatos; c++) {
+        ParametrosMotores candidato = parametros_motores_padrao();
+        aplicar_candidato(&candidato, parametro, varredura->valores[c]);
+        configurar_parametros_motores(&candidato);
+
+        double tempo = 0.0;
+        for (int d = 0; d < NUM_DISTRIBUICOES_AJUSTE; d++) {
+            tempo += medir_mediana(info, entradas[d], trabalho, config->tamanho,
+                                   config->repeticoes, amostras);
+        }
+        varredura->tempos[c] = tempo;
+
+        formatar_valor_parametro(parametro, varredura->valores[c], valor, sizeof(valor));
+        printf("  %-22s %-14s %10.3f ms\n", varredura->chave, valor, tempo * 1e3);
+    }
+
+    // O vencedor precisa ganhar do padrão por uma margem acima do ruído
+    int melhor = varredura->indice_padrao;
+    for (int c = 0; c < varredura->num_candidatos; c++) {
+        if (varredura->tempos[c] < varredura->tempos[melhor]) melhor = c;
+    }
+    double limite = varredura->tempos[varredura->indice_padrao] * (1.0 - config->ganho_minimo);
+    varredura->indice_escolhido = varredura->tempos[melhor] < limite ? melhor : varredura->indice_padrao;
+}
+
+/* ================================================================
+ * AUTOAJUSTE
+ * ================================================================ */
+
+RelatorioAjuste* executar_autoajuste(const ConfiguracaoAjuste *config) {
+    if (config->tamanho < 2 || config->repeticoes < 1) {
+        printf("ERRO: tamanho deve ser >= 2 e repeticoes >= 1\n");
+        return NULL;
+    }
+
+    const int tamanhos_comparacao[NUM_TAMANHOS_COMPARACAO_AJUSTE] = {
+        1000, config->tamanho, 10 * config->tamanho
+    };
+    int maior = tamanhos_comparacao[NUM_TAMANHOS_COMPARACAO_AJUSTE - 1];
+
+    RelatorioAjuste *relatorio = calloc(1, sizeof(RelatorioAjuste));
+    int *entradas[NUM_DISTRIBUICOES_AJUSTE] = {NULL};
+    int *original = malloc((size_t)maior * sizeof(int));
+    int *trabalho = malloc((size_t)maior * sizeof(int));
+    uint64_t *amostras = malloc((size_t)config->repeticoes * sizeof(uint64_t));
+    int falta_memoria = !relatorio || !original || !trabalho || !amostras;
+    for (int d = 0; d < NUM_DISTRIBUICOES_AJUSTE && !falta_memoria; d++) {
+        entradas[d] = malloc((size_t)config->tamanho * sizeof(int));
+        falta_memoria = !entradas[d];
+    }
+    if (falta_memoria) {
+        printf("ERRO: memoria insuficiente para o autoajuste\n");
+        for (int d = 0; d < NUM_DISTRIBUICOES_AJUSTE; d++) free(entradas[d]);
+        free(original);
+        free(trabalho);
+        free(amostras);
+        free(relatorio);
+        return NULL;
+    }
+
+    for (int d = 0; d < NUM_DISTRIBUICOES_AJUSTE; d++) {
+        gerar_numeros(entradas[d], config->tamanho, distribuicoes_ajuste[d], config->semente);
+    }
+
+    const ParametrosMotores em_vigor = *obter_parametros_motores();
+    int versao_original = usar_versao_otimizada;
+    configurar_otimizacao(1);
+
+    relatorio->config = *config;
+    relatorio->padrao = parametros_motores_padrao();
+    relatorio->ajustado = relatorio->padrao;
+
+    // 1. Varredura: um parâmetro por vez, os outros no padrão
+    printf("\nVarredura (%d ints, mediana de %d, aleatoria + crescente):\n",
+           config->tamanho, config->repeticoes);
+    for (int p = 0; p < NUM_PARAMETROS_AJUSTE; p++) {
+        VarreduraParametro *varredura = &relatorio->varreduras[p];
+        montar_varredura(varredura, p);
+        if (varredura->indice_motor < 0) continue;
+        varrer_parametro(varredura, p, config, entradas, trabalho, amostras);
+        aplicar_candidato(&relatorio->ajustado, p, varredura->valores[varredura->indice_escolhido]);
+    }
+
+    // 2. Validação: padrão × ajustado em tamanhos e semente que a varredura não viu
+    printf("\nComparando padrao x ajustado (outra semente, %d tamanhos)...\n",
+           NUM_TAMANHOS_COMPARACAO_AJUSTE);
+    for (int t = 0; t < NUM_TAMANHOS_COMPARACAO_AJUSTE; t++) {
+        int n = tamanhos_comparacao[t];
+        gerar_numeros(original, n, DIST_ALEATORIA, config->semente + 1);
+        for (int p = 0; p < NUM_PARAMETROS_AJUSTE; p++) {
+            const VarreduraParametro *varredura = &relatorio->varreduras[p];
+            if (varredura->indice_motor < 0) continue;
+            const AlgoritmoInfo *info = obter_info_motor(varredura->indice_motor);
+
+            ComparacaoAjuste *comparacao = &relatorio->comparacoes[relatorio->num_comparacoes++];
+            comparacao->indice_motor = varredura->indice_motor;
+            comparacao->tamanho = n;
+
+            configurar_parametros_motores(&relatorio->padrao);
+            comparacao->tempo_padrao = medir_mediana(info, original, trabalho, n,
+                                                     config->repeticoes, amostras);
+            configurar_parametros_motores(&relatorio->ajustado);
+            comparacao->tempo_ajustado = medir_mediana(info, original, trabalho, n,
+                                                       config->repeticoes, amostras);
+        }
+    }
+
+    configurar_parametros_motores(&em_vigor);
+    configurar_otimizacao(versao_original);
+
+    for (int d = 0; d < NUM_DISTRIBUICOES_AJUSTE; d++) free(entradas[d]);
+    free(original);
+    free(trabalho);
+    free(amostras);
+    return relatorio;
+}
+
+/* ================================================================
+ * PERFIL
+ * ================================================================ */
+
+static char* aparar(char *texto) {
+    while (isspace((unsigned char)*texto)) texto++;
+    char *fim = texto + strlen(texto);
+    while (fim > texto && isspace((unsigned char)fim[-1])) fim--;
+    *fim = '\0';
+    return texto;
+}
+
+/**
+ * @brief Converte o texto inteiro (sem sobras) para int dentro de [minimo, maximo]
+ */
+static int ler_inteiro(const char *texto, long minimo, long maximo, int *destino) {
+    char *fim;
+    long valor = strtol(texto, &fim, 10);
+    if (fim == texto || *fim != '\0' || valor < minimo || valor > maximo) return -1;
+    *destino = (int)valor;
+    return 0;
+}
+
+static int ler_perfil(const char *caminho, ParametrosMotores *destino, double *frequencia) {
+    FILE *arquivo = fopen(caminho, "r");
+    if (!arquivo) return -1;
+
+    ParametrosMotores lidos = parametros_motores_padrao();
+    double frequencia_lida = 0.0;
+    char linha[TAMANHO_LINHA_PERFIL];
+    int numero_linha = 0;
+    int valido = 1;
+
+    while (valido && fgets(linha, sizeof(linha), arquivo)) {
+        numero_linha++;
+        char *comentario = strchr(linha, '#');
+        if (comentario) *comentario = '\0';
+        char *conteudo = aparar(linha);
+        if (*conteudo == '\0') continue;
+
+        char *igual = strchr(conteudo, '=');
+        if (!igual) {
+            printf("AVISO: %s:%d: linha sem '='\n", caminho, numero_linha);
+            valido = 0;
+            break;
+        }
+        *igual = '\0';
+        const char *chave = aparar(conteudo);
+        const char *valor = aparar(igual + 1);
+        int inteiro;
+
+        if (strcmp(chave, "versao") == 0) {
+            valido = ler_inteiro(valor, 1, VERSAO_PERFIL_AJUSTE, &inteiro) == 0;
+        } else if (strcmp(chave, "frequencia_cronometro_hz") == 0) {
+            char *fim;
+            frequencia_lida = strtod(valor, &fim);
+            valido = fim != valor && *fim == '\0' && frequencia_lida >= 0.0;
+        } else if (strcmp(chave, "limite_insercao_quick") == 0) {
+            valido = ler_inteiro(valor, 0, LIMITE_INSERCAO_QUICK_MAXIMO, &lidos.limite_insercao_quick) == 0;
+        } else if (strcmp(chave, "sequencia_shell") == 0) {
+            valido = 0;
+            for (int s = 0; s < NUM_SEQUENCIAS_SHELL; s++) {
+                if (strcmp(valor, nome_sequencia_shell((SequenciaShell)s)) == 0) {
+                    lidos.sequencia_shell = (SequenciaShell)s;
+                    valido = 1;
+                }
+            }
+        } else if (strcmp(chave, "aridade_heap") == 0) {
+            valido = ler_inteiro(valor, 2, ARIDADE_HEAP_MAXIMA, &lidos.aridade_heap) == 0;
+        } else {
+            printf("AVISO: %s:%d: chave desconhecida '%s' ignorada\n", caminho, numero_linha, chave);
+        }
+
+        if (!valido) {
+            printf("AVISO: %s:%d: valor invalido para '%s': '%s'\n", caminho, numero_linha, chave, valor);
+        }
+    }
+    fclose(arquivo);
+
+    if (!valido) return -1;
+    *destino = lidos;
+    if (frequencia) *frequencia = frequencia_lida;
+    return 0;
+}
+
+int ler_perfil_ajuste(const char *caminho, ParametrosMotores *destino) {
+    return ler_perfil(caminho, destino, NULL);
+}
+
+int carregar_perfil_ajuste(char *caminho_usado, size_t tamanho_caminho) {
+    const char *caminhos_base[] = {"output", "../output", "../../output"};
+    char caminho[MAX_PATH];
+
+    for (int i = 0; i < 3; i++) {
+        snprintf(caminho, sizeof(caminho), "%s/%s", caminhos_base[i], ARQUIVO_PERFIL_AJUSTE);
+        FILE *teste = fopen(caminho, "r");
+        if (!teste) continue;
+        fclose(teste);
+
+        ParametrosMotores parametros;
+        double frequencia = 0.0;
+        if (ler_perfil(caminho, &parametros, &frequencia) != 0 ||
+            configurar_parametros_motores(&parametros) != 0) {
+            printf("AVISO: perfil %s invalido; mantidos os parametros padrao\n", caminho);
+            return -1;
+        }
+
+        double atual = obter_info_cronometro()->ticks_por_segundo;
+        if (frequencia > 0.0 && atual > 0.0 &&
+            (frequencia / atual > 1.0 + TOLERANCIA_FREQUENCIA_PERFIL ||
+             frequencia / atual < 1.0 - TOLERANCIA_FREQUENCIA_PERFIL)) {
+            printf("AVISO: perfil %s gerado com cronometro de %.3f GHz (atual %.3f GHz);\n",
+                   caminho, frequencia / 1e9, atual / 1e9);
+            printf("       provavelmente de outra maquina - rode o autoajuste novamente\n");
+        }
+
+        if (caminho_usado) snprintf(caminho_usado, tamanho_caminho, "%s", caminho);
+        return 1;
+    }
+    return 0;
+}
+
+static void escrever_perfil_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ParametrosMotores *parametros = (const ParametrosMotores*)dados;
+    char cronometro[128];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+
+    fprintf(arquivo, "# Perfil de ajuste dos motores otimizados (gerado pelo menu de autoajuste)\n");
+    fprintf(arquivo, "# Cronometro: %s\n", cronometro);
+    fprintf(arquivo, "# Apague este arquivo para voltar aos parametros padrao.\n");
+    fprintf(arquivo, "versao = %d\n", VERSAO_PERFIL_AJUSTE);
+    fprintf(arquivo, "frequencia_cronometro_hz = %.0f\n", obter_info_cronometro()->ticks_por_segundo);
+    fprintf(arquivo, "limite_insercao_quick = %d\n", parametros->limite_insercao_quick);
+    fprintf(arquivo, "sequencia_shell = %s\n", nome_sequencia_shell(parametros->sequencia_shell));
+    fprintf(arquivo, "aridade_heap = %d\n", parametros->aridade_heap);
+}
+
+void salvar_perfil_ajuste(const ParametrosMotores *parametros) {
+    salvar_arquivo_multiplos_locais("", ARQUIVO_PERFIL_AJUSTE, escrever_perfil_callback,
+                                    (void*)parametros, 1);
+}
+
+/* ================================================================
+ * RESUMO NO TERMINAL
+ * ================================================================ */
+
+static void imprimir_resumo_ajuste(const RelatorioAjuste *relatorio) {
+    char padrao[96];
+    char ajustado[96];
+    descrever_parametros_motores(&relatorio->padrao, padrao, sizeof(padrao));
+    descrever_parametros_motores(&relatorio->ajustado, ajustado, sizeof(ajustado));
+
+    printf("\nPadrao:   %s\n", padrao);
+    printf("Ajustado: %s\n", ajustado);
+    printf("+-----------------+---------+-------------+---------------+---------+\n");
+    printf("| Motor           |       n | Padrao (ms) | Ajustado (ms) | Ganho   |\n");
+    printf("+-----------------+---------+-------------+---------------+---------+\n");
+    for (int i = 0; i < relatorio->num_comparacoes; i++) {
+        const ComparacaoAjuste *c = &relatorio->comparacoes[i];
+        double ganho = c->tempo_ajustado > 0.0 ? c->tempo_padrao / c->tempo_ajustado : 0.0;
+        printf("| %-15s | %7d | %11.3f | %13.3f | %6.2fx |\n",
+               obter_info_motor(c->indice_motor)->nome, c->tamanho,
+               c->tempo_padrao * 1e3, c->tempo_ajustado * 1e3, ganho);
+    }
+    printf("+-----------------+---------+-------------+---------------+---------+\n");
+}
+
+/* ================================================================
+ * RELATÓRIO
+ * ================================================================ */
+
+static void escrever_ajuste_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const RelatorioAjuste *relatorio = (const RelatorioAjuste*)dados;
+    char cronometro[128];
+    char padrao[96];
+    char ajustado[96];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+    descrever_parametros_motores(&relatorio->padrao, padrao, sizeof(padrao));
+    descrever_parametros_motores(&relatorio->ajustado, ajustado, sizeof(ajustado));
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "          AUTOAJUSTE DOS PARAMETROS DOS MOTORES                 \n");
+    fprintf(arquivo, "================================================================\n\n");
+    fprintf(arquivo, "Cronometro: %s\n", cronometro);
+    fprintf(arquivo, "Varredura: %d ints, mediana de %d execucoes, aleatoria + crescente (semente 0x%llX)\n",
+            relatorio->config.tamanho, relatorio->config.repeticoes,
+            (unsigned long long)relatorio->config.semente);
+    fprintf(arquivo, "Ganho minimo para trocar o padrao: %.0f%%\n", relatorio->config.ganho_minimo * 100.0);
+    fprintf(arquivo, "Padrao:   %s\n", padrao);
+    fprintf(arquivo, "Ajustado: %s\n", ajustado);
+
+    fprintf(arquivo, "\nVARREDURA (soma das medianas das duas distribuicoes):\n");
+    for (int p = 0; p < NUM_PARAMETROS_AJUSTE; p++) {
+        const VarreduraParametro *varredura = &relatorio->varreduras[p];
+        if (varredura->indice_motor < 0) continue;
+        double base = varredura->tempos[varredura->indice_padrao];
+
+        fprintf(arquivo, "\n%s (%s)\n", varredura->chave, obter_info_motor(varredura->indice_motor)->nome);
+        fprintf(arquivo, "+----------------+------------+------------+-----------+\n");
+        fprintf(arquivo, "| Valor          | Tempo (ms) | x padrao   |           |\n");
+        fprintf(arquivo, "+----------------+------------+------------+-----------+\n");
+        for (int c = 0; c < varredura->num_candidatos; c++) {
+            char valor[32];
+            formatar_valor_parametro(p, varredura->valores[c], valor, sizeof(valor));
+            const char *marca = c == varredura->indice_escolhido ? "escolhido"
+                              : c == varredura->indice_padrao ? "padrao" : "";
+            double ganho = varredura->tempos[c] > 0.0 ? base / varredura->tempos[c] : 0.0;
+            fprintf(arquivo, "| %-14s | %10.3f | %9.2fx | %-9s |\n",
+                    valor, varredura->tempos[c] * 1e3, ganho, marca);
+        }
+        fprintf(arquivo, "+----------------+------------+------------+-----------+\n");
+    }
+
+    fprintf(arquivo, "\nPADRAO x AJUSTADO (aleatoria, semente 0x%llX, mediana de %d):\n",
+            (unsigned long long)(relatorio->config.semente + 1), relatorio->config.repeticoes);
+    fprintf(arquivo, "+-----------------+---------+-------------+---------------+---------+----------------+\n");
+    fprintf(arquivo, "| Motor           |       n | Padrao (ms) | Ajustado (ms) | Ganho   | Parametro      |\n");
+    fprintf(arquivo, "+-----------------+---------+-------------+---------------+---------+----------------+\n");
+    for (int i = 0; i < relatorio->num_comparacoes; i++) {
+        const ComparacaoAjuste *c = &relatorio->comparacoes[i];
+        double ganho = c->tempo_ajustado > 0.0 ? c->tempo_padrao / c->tempo_ajustado : 0.0;
+        char valor[32] = "-";
+        for (int p = 0; p < NUM_PARAMETROS_AJUSTE; p++) {
+            const VarreduraParametro *varredura = &relatorio->varreduras[p];
+            if (varredura->indice_motor != c->indice_motor) continue;
+            if (varredura->indice_escolhido == varredura->indice_padrao) {
+                snprintf(valor, sizeof(valor), "padrao mantido");
+            } else {
+                formatar_valor_parametro(p, varredura->valores[varredura->indice_escolhido],
+                                         valor, sizeof(valor));
+            }
+        }
+        fprintf(arquivo, "| %-15s | %7d | %11.3f | %13.3f | %6.2fx | %-14s |\n",
+                obter_info_motor(c->indice_motor)->nome, c->tamanho,
+                c->tempo_padrao * 1e3, c->tempo_ajustado * 1e3, ganho, valor);
+    }
+    fprintf(arquivo, "+-----------------+---------+-------------+---------------+---------+----------------+\n");
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Cada parametro e varrido com os demais no padrao (cada um afeta um so motor)\n");
+    fprintf(arquivo, "- Um candidato so substitui o padrao se for %.0f%% mais rapido; abaixo disso\n",
+            relatorio->config.ganho_minimo * 100.0);
+    fprintf(arquivo, "  a diferenca e indistinguivel do ruido de medicao\n");
+    fprintf(arquivo, "- A comparacao usa outra semente e tamanhos fora da varredura: ganho\n");
+    fprintf(arquivo, "  ~1.00x em n distante indica que o ajuste nao generaliza para esse tamanho;\n");
+    fprintf(arquivo, "  em \"padrao mantido\" as duas colunas rodam o mesmo codigo (so ruido)\n");
+    fprintf(arquivo, "- Ajustado em ints com comparar_inteiros; comparadores caros ou registros\n");
+    fprintf(arquivo, "  grandes (Aluno) deslocam os otimos (ver o modelo de custo)\n");
+    fprintf(arquivo, "- Perfil gravado em output/%s e carregado na inicializacao\n", ARQUIVO_PERFIL_AJUSTE);
+}
+
+void gerar_relatorio_ajuste(const RelatorioAjuste *relatorio) {
+    if (!relatorio) return;
+
+    salvar_arquivo_multiplos_locais("relatorios", "ajuste_motores.txt",
+                                    escrever_ajuste_callback, (void*)relatorio,
+                                    relatorio->num_comparacoes);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_autoajuste_completo(void) {
+    ConfiguracaoAjuste config = configuracao_ajuste_padrao();
+
+    printf("\n=== AUTOAJUSTE DOS PARAMETROS DOS MOTORES ===\n");
+    printf("Corte do Quick Sort, gaps do Shell Sort e aridade do Heap Sort nesta maquina.\n");
+
+    criar_diretorios_output();
+
+    RelatorioAjuste *relatorio = executar_autoajuste(&config);
+    if (!relatorio) return;
+
+    imprimir_resumo_ajuste(relatorio);
+    configurar_parametros_motores(&relatorio->ajustado);
+    salvar_perfil_ajuste(&relatorio->ajustado);
+    gerar_relatorio_ajuste(relatorio);
+    free(relatorio);
+}
@@ -71,7 +71,23 @@
  * pode alternar entre a "engrenagem de precisão" (didática) e a "engrenagem
  * turbo" (otimizada) conforme a necessidade.
  */
-int usar_versao_otimizada = 1;
+THREAD_LOCAL int usar_versao_otimizada = 1;
+
+#ifdef SORTS_SONDAS_ATIVAS
+/// Nível de recursão do Quick Sort informado pela sonda sorts:particao
+THREAD_LOCAL int profundidade_sonda = 0;
+#endif
+
+/**
+ * @brief Informa se as sondas USDT foram compiladas (ver sondas.h)
+ */
+int sondas_usdt_ativas(void) {
+#ifdef SORTS_SONDAS_ATIVAS
+    return 1;
+#else
+    return 0;
+#endif
+}
 
 /**
  * @brief Configura dinamicamente a versão dos algoritmos que será executada
@@ -95,13 +111,65 @@ int usar_versao_otimizada = 1;
  *                  - 1: Ativa versões otimizadas (foco em performance)
  *                  - 0: Ativa versões didáticas (foco em clareza)
  *
- * @note A alteração é global e afeta todas as chamadas subsequentes.
- *       Para isolar testes, salve a configuração atual antes de alterá-la.
+ * @note A alteração vale para a thread chamadora e afeta todas as chamadas
+ *       subsequentes dela. Para isolar testes, salve a configuração atual
+ *       antes de alterá-la.
  */
 void configurar_otimizacao(int otimizada) {
     usar_versao_otimizada = otimizada;
 }
 
+/* ================================================================
+ * PARÂMETROS AJUSTÁVEIS DAS VERSÕES OTIMIZADAS
+ * ================================================================ */
+
+/**
+ * @brief Parâmetros em vigor (globais: o perfil da máquina vale para todas as threads)
+ */
+static ParametrosMotores parametros_motores = {0, SEQUENCIA_SHELL_KNUTH, 2};
+
+ParametrosMotores parametros_motores_padrao(void) {
+    ParametrosMotores padrao = {0, SEQUENCIA_SHELL_KNUTH, 2};
+    return padrao;
+}
+
+int configurar_parametros_motores(const ParametrosMotores *parametros) {
+    if (!parametros) return -1;
+    if (parametros->limite_insercao_quick < 0 ||
+        parametros->limite_insercao_quick > LIMITE_INSERCAO_QUICK_MAXIMO) return -1;
+    if ((int)parametros->sequencia_shell < 0 ||
+        parametros->sequencia_shell >= NUM_SEQUENCIAS_SHELL) return -1;
+    if (parametros->aridade_heap < 2 || parametros->aridade_heap > ARIDADE_HEAP_MAXIMA) return -1;
+
+    parametros_motores = *parametros;
+    return 0;
+}
+
+const ParametrosMotores* obter_parametros_motores(void) {
+    return &parametros_motores;
+}
+
+const char* nome_sequencia_shell(SequenciaShell sequencia) {
+    switch (sequencia) {
+        case SEQUENCIA_SHELL_KNUTH:  return "knuth";
+        case SEQUENCIA_SHELL_CIURA:  return "ciura";
+        case SEQUENCIA_SHELL_TOKUDA: return "tokuda";
+        default:                     return NULL;
+    }
+}
+
+void descrever_parametros_motores(const ParametrosMotores *parametros, char *buffer, size_t tamanho_buffer) {
+    const char *sequencia = nome_sequencia_shell(parametros->sequencia_shell);
+    char corte[32];
+    if (parametros->limite_insercao_quick > 0) {
+        snprintf(corte, sizeof(corte), "corte quick %d", parametros->limite_insercao_quick);
+    } else {
+        snprintf(corte, sizeof(corte), "quick sem corte");
+    }
+    snprintf(buffer, tamanho_buffer, "%s, shell %s, heap %d-ario",
+             corte, sequencia ? sequencia : "?", parametros->aridade_heap);
+}
+
 /* ================================================================
  * SISTEMA DE MÉTRICAS E ANÁLISE DE PERFORMANCE DOS ALGORITMOS
  * ================================================================ */
@@ -125,7 +193,7 @@ void configurar_otimizacao(int otimizada) {
  *
  * @note Resetado a zero antes de cada execução de algoritmo
  */
-long long contador_comparacoes = 0;
+THREAD_LOCAL long long contador_comparacoes = 0;
 
 /**
  * @brief Contador global de operações de troca (swap) de elementos
@@ -148,7 +216,7 @@ long long contador_comparacoes = 0;
  *
  * @note Incrementado pela função [`swap_elements()`](src/algoritmos.c:122)
  */
-long long contador_trocas = 0;
+THREAD_LOCAL long long contador_trocas = 0;
 
 /**
  * @brief Contador global de movimentações físicas de memória
@@ -173,7 +241,7 @@ long long contador_trocas = 0;
  *
  * @note Crítico para análise de performance em sistemas com memória limitada
  */
-long long contador_movimentacoes = 0;
+THREAD_LOCAL long long contador_movimentacoes = 0;
 
 /**
  * @brief Ponteiro para função de comparação em uso pelo sistema de métricas
@@ -193,7 +261,7 @@ long long contador_movimentacoes = 0;
  *
  * @note Configurada automaticamente no início de cada algoritmo
  */
-static CompareFn funcao_comparacao_atual = NULL;
+static THREAD_LOCAL CompareFn funcao_comparacao_atual = NULL;
 
 /* ================================================================
  * FUNÇÕES AUXILIARES E INFRAESTRUTURA DO SISTEMA DE MÉTRICAS
@@ -233,9 +301,37 @@ static CompareFn funcao_comparacao_atual = NULL;
  */
 int comparar_e_contar(const void *a, const void *b) {
     contador_comparacoes++;
+    RASTREAR_ACESSO(a, 0);
+    RASTREAR_ACESSO(b, 0);
     return funcao_comparacao_atual(a, b);
 }
 
+/**
+ * @brief Configura o comparador de comparar_e_contar() fora dos algoritmos
+ *
+ * Os algoritmos deste arquivo fazem isso no início de cada ordenação; as
+ * referências da libc (referencias.c) usam esta função antes de chamar o
+ * qsort com comparar_e_contar.
+ */
+void configurar_comparacao_contada(CompareFn cmp) {
+    funcao_comparacao_atual = cmp;
+}
+
+/**
+ * @brief Buffer temporário de swap_elements(), um por thread
+ *
+ * Fica fora da função para que liberar_buffer_troca() possa devolvê-lo
+ * quando uma thread de trabalho da matriz paralela termina.
+ */
+static THREAD_LOCAL char* buffer_troca = NULL;
+static THREAD_LOCAL size_t tamanho_buffer_troca = 0;
+
+void liberar_buffer_troca(void) {
+    free(buffer_troca);
+    buffer_troca = NULL;
+    tamanho_buffer_troca = 0;
+}
+
 /**
  * @brief Sistema otimizado de troca de elementos com buffer reutilizável
  *
@@ -253,7 +349,7 @@ int comparar_e_contar(const void *a, const void *b) {
  *  GESTÃO INTELIGENTE DE MEMÓRIA:
  * - Buffer cresce automaticamente para acomodar elementos maiores
  * - Nunca shrink - mantém o maior tamanho já usado (evita realocações)
- * - Fallback seguro em caso de falha de alocação
+ * - Tenta uma alocação nova se o realloc falhar; sem memória, encerra
  * - Memória liberada automaticamente no fim do programa
  *
  *  CONTABILIZAÇÃO DUPLA:
@@ -261,20 +357,20 @@ int comparar_e_contar(const void *a, const void *b) {
  * - contador_movimentacoes += 3: Registra as 3 operações físicas memcpy
  *
  *  ROBUSTEZ:
- * - Detecta e trata falhas de alocação graciosamente
+ * - Falha de alocação nunca devolve o vetor parcialmente ordenado
  * - Funciona com elementos de qualquer tamanho
- * - Thread-safe para buffer estático (sem concorrência real no projeto)
+ * - Buffer próprio de cada thread (THREAD_LOCAL), seguro na matriz paralela
  *
  * @param a Ponteiro para o primeiro elemento (será modificado)
  * @param b Ponteiro para o segundo elemento (será modificado)
  * @param elem_size Tamanho em bytes de cada elemento
  *
- * @note Em caso de falha na alocação de memória, a função retorna sem
- *       realizar a troca, mantendo os dados originais intactos
+ * @note Se o buffer não puder ser alocado, o programa é encerrado com
+ *       erro: uma troca não feita deixaria a saída fora de ordem em silêncio
  */
 void swap_elements(void *a, void *b, size_t elem_size) {
-    static char* temp = NULL;
-    static size_t temp_size = 0;
+    char* temp = buffer_troca;
+    size_t temp_size = tamanho_buffer_troca;
 
     // Realoca buffer apenas se necessário (elemento maior que o buffer atual)
     if (temp_size < elem_size) {
@@ -284,13 +380,17 @@ void swap_elements(void *a, void *b, size_t elem_size) {
             free(temp);
             temp = malloc(elem_size);
             if (!temp) {
-                temp_size = 0;
-                return; // Falha crítica: abort da operação
+                // Falha crítica: retornar sem trocar deixaria a ordenação
+                // errada em silêncio, então encerra como no Quick Sort
+                fprintf(stderr, "ERRO CRÍTICO: Falha na alocação do buffer de troca (%zu bytes)\n", elem_size);
+                exit(EXIT_FAILURE);
             }
         } else {
             temp = new_temp;
         }
         temp_size = elem_size;
+        buffer_troca = temp;
+        tamanho_buffer_troca = temp_size;
     }
 
     // Sequência clássica de troca em 3 passos com contabilização
@@ -300,6 +400,30 @@ void swap_elements(void *a, void *b, size_t elem_size) {
 
     contador_trocas++;               // Contabiliza 1 operação lógica de troca
     contador_movimentacoes += 3;     // Contabiliza 3 operações físicas de memória
+
+    // Rastro: só os elementos do array (o buffer temporário fica sempre na L1)
+    RASTREAR_ACESSO(a, 0);
+    RASTREAR_ACESSO(b, 0);
+    RASTREAR_ACESSO(a, 1);
+    RASTREAR_ACESSO(b, 1);
+}
+
+/**
+ * @brief Copia um elemento e contabiliza uma movimentação
+ *
+ * Usada pelos deslocamentos do Insertion Sort e do Shell Sort, que movem
+ * elementos um a um em vez de trocá-los. Com um rastro ativo, registra a
+ * leitura da origem e a escrita do destino.
+ *
+ * @param destino Posição que recebe o elemento
+ * @param origem Posição copiada
+ * @param elem_size Tamanho em bytes de cada elemento
+ */
+void mover_elemento(void *destino, const void *origem, size_t elem_size) {
+    memcpy(destino, origem, elem_size);
+    contador_movimentacoes++;
+    RASTREAR_ACESSO(origem, 0);
+    RASTREAR_ACESSO(destino, 1);
 }
 
 /**
@@ -342,6 +466,22 @@ void mediana_de_tres(void *arr, int inicio, int fim, size_t elem_size, CompareFn
     swap_elements(base + meio * elem_size, base + (fim - 1) * elem_size, elem_size);
 }
 
+/**
+ * @brief Buffer de um elemento para chave/pivô/temporário; encerra sem memória
+ *
+ * Retornar com o vetor intocado faria o chamador relatar tempos e
+ * resultados de uma ordenação que não aconteceu, então a falha é tratada
+ * como em swap_elements() e nos pivôs do Quick Sort.
+ */
+static char* alocar_elemento(size_t elem_size, const char *finalidade) {
+    char *buffer = malloc(elem_size);
+    if (!buffer) {
+        fprintf(stderr, "ERRO CRÍTICO: Falha na alocação de %zu bytes para %s\n", elem_size, finalidade);
+        exit(EXIT_FAILURE);
+    }
+    return buffer;
+}
+
 /* ==============================================================
  * IMPLEMENTAÇÕES NÃO OTIMIZADAS (DIDÁTICAS)
  * ============================================================== */
@@ -351,26 +491,22 @@ void insertion_sort_naive(void *arr, int n, size_t elem_size, CompareFn cmp) {
     char *base = (char *)arr;
 
     // Alocação única de memória para melhor performance
-    char *key = malloc(elem_size);
-    if (!key) return;
+    char *key = alocar_elemento(elem_size, "a chave do Insertion Sort");
 
     for (int i = 1; i < n; i++) {
-        memcpy(key, base + i * elem_size, elem_size);
-        contador_movimentacoes++; // Corrigido: usar movimentacoes ao invés de trocas
+        mover_elemento(key, base + i * elem_size, elem_size);
         int j = i - 1;
 
         while (j >= 0) {
             if (comparar_e_contar(base + j * elem_size, key) > 0) {
-                memcpy(base + (j + 1) * elem_size, base + j * elem_size, elem_size);
-                contador_movimentacoes++; // Corrigido: usar movimentacoes
+                mover_elemento(base + (j + 1) * elem_size, base + j * elem_size, elem_size);
                 j--;
             } else {
                 break;
             }
         }
 
-        memcpy(base + (j + 1) * elem_size, key, elem_size);
-        contador_movimentacoes++; // Corrigido: usar movimentacoes
+        mover_elemento(base + (j + 1) * elem_size, key, elem_size);
     }
 
     // Liberação única de memória
@@ -410,7 +546,7 @@ void shaker_sort_naive(void *arr, int n, size_t elem_size, CompareFn cmp) {
     char *base = (char *)arr;
 
     // CORRIGIDO: Versão naive agora com parada antecipada básica
-    for (int pass = 0; pass < (n - 1) / 2; pass++) {
+    for (int pass = 0; pass < n / 2; pass++) {
         int houve_troca = 0; // Flag para detectar se houve trocas
 
         // Passagem da esquerda para a direita
@@ -439,28 +575,27 @@ void shell_sort_naive(void *arr, int n, size_t elem_size, CompareFn cmp) {
     char *base = (char *)arr;
 
     // Alocação única de memória para melhor performance
-    char *temp = malloc(elem_size);
-    if (!temp) return;
+    char *temp = alocar_elemento(elem_size, "o temporario do Shell Sort");
 
     // Usando sequência de Shell simples (gap = n/2, n/4, ..., 1)
     for (int gap = n / 2; gap > 0; gap = gap / 2) {
+        FASE_INICIO_VALOR("shell: gap", gap);
+        SONDA_GAP(gap, n);
         for (int i = gap; i < n; i++) {
-            memcpy(temp, base + i * elem_size, elem_size);
-            contador_movimentacoes++; // Corrigido: usar movimentacoes
+            mover_elemento(temp, base + i * elem_size, elem_size);
             int j;
 
             for (j = i; j >= gap; j -= gap) {
                 if (comparar_e_contar(base + (j - gap) * elem_size, temp) > 0) {
-                    memcpy(base + j * elem_size, base + (j - gap) * elem_size, elem_size);
-                    contador_movimentacoes++; // Corrigido: usar movimentacoes
+                    mover_elemento(base + j * elem_size, base + (j - gap) * elem_size, elem_size);
                 } else {
                     break;
                 }
             }
 
-            memcpy(base + j * elem_size, temp, elem_size);
-            contador_movimentacoes++; // Corrigido: usar movimentacoes
+            mover_elemento(base + j * elem_size, temp, elem_size);
         }
+        FASE_FIM();
     }
 
     // Liberação única de memória
@@ -470,9 +605,17 @@ void shell_sort_naive(void *arr, int n, size_t elem_size, CompareFn cmp) {
 void quick_sort_naive(void *arr, int inicio, int fim, size_t elem_size, CompareFn cmp) {
     if (inicio < fim) {
         funcao_comparacao_atual = cmp;
+        FASE_INICIO("quick: particao");
         int pi = partition_naive(arr, inicio, fim, elem_size, cmp);
+        FASE_FIM();
+        SONDA_PARTICAO(inicio, fim, pi);
+
+        FASE_INICIO("quick: recursao");
+        SONDA_ENTRAR_NIVEL();
         quick_sort_naive(arr, inicio, pi - 1, elem_size, cmp);
         quick_sort_naive(arr, pi + 1, fim, elem_size, cmp);
+        SONDA_SAIR_NIVEL();
+        FASE_FIM();
     }
     // cmp é usado indiretamente através do ponteiro de função global 'funcao_comparacao_atual'
     (void)cmp; // Suppress unused parameter warning
@@ -514,15 +657,19 @@ void heap_sort_naive(void *arr, int n, size_t elem_size, CompareFn cmp) {
 
     // CORREÇÃO CRÍTICA: Usar construção bottom-up eficiente O(n)
     // ao invés da construção ineficiente O(n log n) anterior
+    FASE_INICIO("heap: construcao");
     for (int i = n / 2 - 1; i >= 0; i--) {
         heapify_naive(arr, n, i, elem_size, cmp);
     }
+    FASE_FIM();
 
     // Fase de extração permanece igual
+    FASE_INICIO("heap: extracao");
     for (int i = n - 1; i >= 0; i--) {
         swap_elements(arr, (char*)arr + i * elem_size, elem_size);
         heapify_naive(arr, i, 0, elem_size, cmp);
     }
+    FASE_FIM();
 }
 
 void heapify_naive(void *arr, int n, int i, size_t elem_size, CompareFn cmp) {
@@ -570,25 +717,21 @@ void heapify_naive(void *arr, int n, int i, size_t elem_size, CompareFn cmp) {
 void insertion_sort_optimized(void *arr, int n, size_t elem_size, CompareFn cmp) {
     funcao_comparacao_atual = cmp;
     char *base = (char *)arr;
-    char *key = malloc(elem_size);
-    if (!key) return;
+    char *key = alocar_elemento(elem_size, "a chave do Insertion Sort otimizado");
 
     for (int i = 1; i < n; i++) {
         // 1. Movimentação para salvar a chave
-        memcpy(key, base + i * elem_size, elem_size);
-        contador_movimentacoes++;
+        mover_elemento(key, base + i * elem_size, elem_size);
         int j = i - 1;
 
         while (j >= 0 && comparar_e_contar(base + j * elem_size, key) > 0) {
             // 2. Movimentação de deslocamento
-            memcpy(base + (j + 1) * elem_size, base + j * elem_size, elem_size);
-            contador_movimentacoes++;
+            mover_elemento(base + (j + 1) * elem_size, base + j * elem_size, elem_size);
             j--;
         }
 
         // 3. Movimentação para inserir a chave
-        memcpy(base + (j + 1) * elem_size, key, elem_size);
-        contador_movimentacoes++;
+        mover_elemento(base + (j + 1) * elem_size, key, elem_size);
     }
     free(key);
 }
@@ -629,61 +772,39 @@ void selection_sort_optimized(void *arr, int n, size_t elem_size, CompareFn cmp)
      */
 
     int inicio = 0;
-    char *bingo = malloc(elem_size);  // Valor "bingo" (menor encontrado)
-    char *proximo_bingo = malloc(elem_size);  // Próximo menor valor
-
-    if (!bingo || !proximo_bingo) {
-        free(bingo);
-        free(proximo_bingo);
-        return;
-    }
+    char *bingo = alocar_elemento(elem_size, "o bingo do Selection Sort");  // Menor entre os restantes
+    char *proximo_bingo = alocar_elemento(elem_size, "o bingo do Selection Sort");  // Menor valor maior que o bingo
 
     // Encontra o menor valor inicial
-    memcpy(bingo, base, elem_size);
-    memcpy(proximo_bingo, base, elem_size);
-
+    if (n > 0) memcpy(bingo, base, elem_size);
     for (int i = 1; i < n; i++) {
         if (comparar_e_contar(base + i * elem_size, bingo) < 0) {
-            memcpy(proximo_bingo, bingo, elem_size);
             memcpy(bingo, base + i * elem_size, elem_size);
-        } else if (comparar_e_contar(base + i * elem_size, bingo) > 0 &&
-                   comparar_e_contar(base + i * elem_size, proximo_bingo) < 0) {
-            memcpy(proximo_bingo, base + i * elem_size, elem_size);
         }
     }
 
     // Loop principal do Bingo Sort
+    // CORRIGIDO: o próximo bingo é o menor entre os NÃO movidos nesta mesma
+    // passagem; a versão anterior podia repetir o bingo atual e parar cedo
     while (inicio < n - 1) {
-        int posicao_inicio = inicio;
+        int tem_proximo = 0;
 
-        // Encontra e move todos os elementos com valor "bingo" para o início
+        // Move todos os elementos iguais ao bingo para o início e, entre os
+        // demais (todos maiores que o bingo), procura o menor
         for (int i = inicio; i < n; i++) {
             if (comparar_e_contar(base + i * elem_size, bingo) == 0) {
                 swap_elements(base + inicio * elem_size, base + i * elem_size, elem_size);
                 inicio++;
-            } else if (comparar_e_contar(base + i * elem_size, proximo_bingo) < 0) {
+            } else if (!tem_proximo || comparar_e_contar(base + i * elem_size, proximo_bingo) < 0) {
                 memcpy(proximo_bingo, base + i * elem_size, elem_size);
+                tem_proximo = 1;
             }
         }
 
-        // Se nenhum elemento foi movido, todos os elementos restantes são iguais
-        if (inicio == posicao_inicio) {
-            break;
-        }
+        // Sem valores maiores que o bingo: o restante já está no lugar
+        if (!tem_proximo) break;
 
-        // Atualiza o valor bingo para a próxima iteração
         memcpy(bingo, proximo_bingo, elem_size);
-
-        // Encontra o próximo valor após o atual bingo
-        int encontrou_proximo = 0;
-        for (int i = inicio; i < n; i++) {
-            if (comparar_e_contar(base + i * elem_size, bingo) > 0) {
-                if (!encontrou_proximo || comparar_e_contar(base + i * elem_size, proximo_bingo) < 0) {
-                    memcpy(proximo_bingo, base + i * elem_size, elem_size);
-                    encontrou_proximo = 1;
-                }
-            }
-        }
     }
 
     free(bingo);
@@ -719,37 +840,80 @@ void shaker_sort_optimized(void *arr, int n, size_t elem_size, CompareFn cmp) {
     }
 }
 
+/// Gaps suficientes para qualquer int (Knuth cresce ×3, Ciura/Tokuda ×2.25)
+#define MAX_GAPS_SHELL 64
+
+/**
+ * @brief Preenche `gaps` em ordem DECRESCENTE (termina em 1) e retorna quantos
+ *
+ * Knuth mantém a regra histórica (maior gap < n/3); Ciura e Tokuda usam
+ * todos os gaps menores que n.
+ */
+static int montar_gaps_shell(int n, SequenciaShell sequencia, int *gaps) {
+    static const int ciura[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+    int crescentes[MAX_GAPS_SHELL];
+    int total = 0;
+
+    if (sequencia == SEQUENCIA_SHELL_CIURA) {
+        double gap = 1.0;
+        for (int k = 0; total < MAX_GAPS_SHELL; k++) {
+            gap = k < (int)(sizeof(ciura) / sizeof(ciura[0])) ? ciura[k] : gap * 2.25;
+            if (total > 0 && gap >= n) break;
+            crescentes[total++] = (int)gap;
+        }
+    } else if (sequencia == SEQUENCIA_SHELL_TOKUDA) {
+        double h = 1.0;
+        crescentes[total++] = 1;
+        while (total < MAX_GAPS_SHELL) {
+            h = 2.25 * h + 1.0;
+            int gap = (int)h;
+            if (gap < h) gap++;  // Teto
+            if (gap >= n) break;
+            crescentes[total++] = gap;
+        }
+    } else {
+        // h = (3^k - 1) / 2: 1, 4, 13, 40, 121, 364, ...
+        int gap = 1;
+        crescentes[total++] = gap;
+        while (gap < n / 3 && total < MAX_GAPS_SHELL) {
+            gap = gap * 3 + 1;
+            crescentes[total++] = gap;
+        }
+    }
+
+    for (int i = 0; i < total; i++) {
+        gaps[i] = crescentes[total - 1 - i];
+    }
+    return total;
+}
+
 void shell_sort_optimized(void *arr, int n, size_t elem_size, CompareFn cmp) {
     funcao_comparacao_atual = cmp;
     char *base = (char *)arr;
-    char *temp = malloc(elem_size);
-    if (!temp) return;
+    char *temp = alocar_elemento(elem_size, "o temporario do Shell Sort otimizado");
 
-    // MELHORIA: Usar sequência de Knuth para melhor performance
-    // h = (3^k - 1) / 2: 1, 4, 13, 40, 121, 364, ...
-    int gap = 1;
-    while (gap < n / 3) {
-        gap = gap * 3 + 1; // Calcula o maior gap da sequência de Knuth
-    }
+    // MELHORIA: Sequência de gaps configurável (Knuth por padrão)
+    int gaps[MAX_GAPS_SHELL];
+    int num_gaps = montar_gaps_shell(n, parametros_motores.sequencia_shell, gaps);
 
-    while (gap >= 1) {
+    for (int g = 0; g < num_gaps; g++) {
+        int gap = gaps[g];
+        FASE_INICIO_VALOR("shell: gap", gap);
+        SONDA_GAP(gap, n);
         for (int i = gap; i < n; i++) {
             // 1. Movimentação para salvar o elemento
-            memcpy(temp, base + i * elem_size, elem_size);
-            contador_movimentacoes++;
+            mover_elemento(temp, base + i * elem_size, elem_size);
             int j;
 
             for (j = i; j >= gap && comparar_e_contar(base + (j - gap) * elem_size, temp) > 0; j -= gap) {
                 // 2. Movimentação de deslocamento
-                memcpy(base + j * elem_size, base + (j - gap) * elem_size, elem_size);
-                contador_movimentacoes++;
+                mover_elemento(base + j * elem_size, base + (j - gap) * elem_size, elem_size);
             }
 
             // 3. Movimentação para inserir o elemento
-            memcpy(base + j * elem_size, temp, elem_size);
-            contador_movimentacoes++;
+            mover_elemento(base + j * elem_size, temp, elem_size);
         }
-        gap = gap / 3; // Próximo gap da sequência de Knuth
+        FASE_FIM();
     }
     free(temp);
 }
@@ -758,14 +922,32 @@ void quick_sort_optimized(void *arr, int inicio, int fim, size_t elem_size, Comp
     if (inicio < fim) {
         funcao_comparacao_atual = cmp;
 
+        // OTIMIZAÇÃO: Subarrays pequenos vão para o Insertion Sort (corte configurável)
+        if (fim - inicio + 1 <= parametros_motores.limite_insercao_quick) {
+            FASE_INICIO("quick: insercao");
+            insertion_sort_optimized((char*)arr + inicio * elem_size, fim - inicio + 1, elem_size, cmp);
+            FASE_FIM();
+            return;
+        }
+
         // OTIMIZAÇÃO: Aplicar estratégia "Mediana de Três" para evitar pior caso O(n²)
         if (fim - inicio >= 3) {
+            FASE_INICIO("quick: pivo");
             mediana_de_tres(arr, inicio, fim, elem_size, cmp);
+            FASE_FIM();
         }
 
+        FASE_INICIO("quick: particao");
         int pi = partition_optimized(arr, inicio, fim, elem_size, cmp);
+        FASE_FIM();
+        SONDA_PARTICAO(inicio, fim, pi);
+
+        FASE_INICIO("quick: recursao");
+        SONDA_ENTRAR_NIVEL();
         quick_sort_optimized(arr, inicio, pi - 1, elem_size, cmp);
         quick_sort_optimized(arr, pi + 1, fim, elem_size, cmp);
+        SONDA_SAIR_NIVEL();
+        FASE_FIM();
     }
     (void)cmp; // Suppress unused parameter warning
 }
@@ -796,18 +978,67 @@ int partition_optimized(void *arr, int inicio, int fim, size_t elem_size, Compar
     return (i + 1);
 }
 
+/**
+ * @brief Desce o elemento `i` num heap d-ário (iterativo)
+ *
+ * Com d > 2 a árvore fica mais rasa (log_d n níveis): menos trocas e
+ * saltos de memória, ao custo de d - 1 comparações por nível. Os d filhos
+ * são contíguos, então tendem a cair na mesma linha de cache.
+ */
+static void heapify_aridade(char *base, int n, int i, int aridade, size_t elem_size) {
+    for (;;) {
+        int primeiro = aridade * i + 1;
+        if (primeiro >= n) break;
+
+        int ultimo = primeiro + aridade;
+        if (ultimo > n) ultimo = n;
+
+        int maior = i;
+        for (int filho = primeiro; filho < ultimo; filho++) {
+            if (comparar_e_contar(base + filho * elem_size, base + maior * elem_size) > 0)
+                maior = filho;
+        }
+        if (maior == i) break;
+
+        swap_elements(base + i * elem_size, base + maior * elem_size, elem_size);
+        i = maior;
+    }
+}
+
 void heap_sort_optimized(void *arr, int n, size_t elem_size, CompareFn cmp) {
     funcao_comparacao_atual = cmp;
+    int aridade = parametros_motores.aridade_heap;
+
+    if (aridade != 2) {
+        char *base = (char*)arr;
+
+        FASE_INICIO("heap: construcao");
+        for (int i = (n - 2) / aridade; i >= 0 && n > 1; i--)
+            heapify_aridade(base, n, i, aridade, elem_size);
+        FASE_FIM();
+
+        FASE_INICIO("heap: extracao");
+        for (int i = n - 1; i > 0; i--) {
+            swap_elements(base, base + i * elem_size, elem_size);
+            heapify_aridade(base, i, 0, aridade, elem_size);
+        }
+        FASE_FIM();
+        return;
+    }
 
     // Fase 1: Construção do heap (bottom-up) - O(n)
+    FASE_INICIO("heap: construcao");
     for (int i = n / 2 - 1; i >= 0; i--)
         heapify_optimized(arr, n, i, elem_size, cmp);
+    FASE_FIM();
 
     // Fase 2: Extração - O(n log n)
+    FASE_INICIO("heap: extracao");
     for (int i = n - 1; i >= 0; i--) {
         swap_elements(arr, (char*)arr + i * elem_size, elem_size);
         heapify_optimized(arr, i, 0, elem_size, cmp);
     }
+    FASE_FIM();
 }
 
 void heapify_optimized(void *arr, int n, int i, size_t elem_size, CompareFn cmp) {
@@ -848,59 +1079,73 @@ void heapify_optimized(void *arr, int n, int i, size_t elem_size, CompareFn cmp)
  * ============================================================== */
 
 void insertion_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_INSERTION, n, elem_size);
     if (usar_versao_otimizada) {
         insertion_sort_optimized(arr, n, elem_size, cmp);
     } else {
         insertion_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_INSERTION, n, elem_size);
 }
 
 void bubble_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_BUBBLE, n, elem_size);
     if (usar_versao_otimizada) {
         bubble_sort_optimized(arr, n, elem_size, cmp);
     } else {
         bubble_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_BUBBLE, n, elem_size);
 }
 
 void selection_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_SELECTION, n, elem_size);
     if (usar_versao_otimizada) {
         selection_sort_optimized(arr, n, elem_size, cmp);
     } else {
         selection_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_SELECTION, n, elem_size);
 }
 
 void shaker_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_SHAKER, n, elem_size);
     if (usar_versao_otimizada) {
         shaker_sort_optimized(arr, n, elem_size, cmp);
     } else {
         shaker_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_SHAKER, n, elem_size);
 }
 
 void shell_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_SHELL, n, elem_size);
     if (usar_versao_otimizada) {
         shell_sort_optimized(arr, n, elem_size, cmp);
     } else {
         shell_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_SHELL, n, elem_size);
 }
 
 void quick_sort(void *arr, int inicio, int fim, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_QUICK, fim - inicio + 1, elem_size);
     if (usar_versao_otimizada) {
         quick_sort_optimized(arr, inicio, fim, elem_size, cmp);
     } else {
         quick_sort_naive(arr, inicio, fim, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_QUICK, fim - inicio + 1, elem_size);
 }
 
 void heap_sort(void *arr, int n, size_t elem_size, CompareFn cmp) {
+    SONDA_ORDENACAO_INICIO(SONDA_ID_HEAP, n, elem_size);
     if (usar_versao_otimizada) {
         heap_sort_optimized(arr, n, elem_size, cmp);
     } else {
         heap_sort_naive(arr, n, elem_size, cmp);
     }
+    SONDA_ORDENACAO_FIM(SONDA_ID_HEAP, n, elem_size);
 }
 
 int partition(void *arr, int inicio, int fim, size_t elem_size, CompareFn cmp) {
@@ -47,6 +47,7 @@
 #include <time.h>    // Para time, localtime
 #include <stdio.h>   // Para printf, fprintf, FILE
 #include <stdlib.h>  // Para malloc, free
+#include <math.h>    // Para log2 nos ajustes de complexidade
 
 // Headers específicos para medição de alta precisão por plataforma
 #ifdef _WIN32
@@ -65,10 +66,12 @@
 int determinar_num_execucoes(int tamanho_conjunto);
 void gerar_relatorio_tempos(ResultadoTempo resultados[], int num_resultados, const char* arquivo_saida);
 void escrever_relatorio_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_roofline_banda(FILE *arquivo, const ResultadoTempo *resultados, int tamanho);
 void escrever_estabilidade_callback(FILE* arquivo, void* dados, int tamanho);
 AlgoritmoInfo* obter_info_algoritmos(void);
 void analisar_estabilidade(void);
 void gerar_relatorio_comparativo_final(void);
+static void imprimir_aceleracoes_qsort(const ResultadoTempo *resultados, int num_resultados);
 
 /* ================================================================
  * NÚCLEO DE MEDIÇÃO TEMPORAL MULTIPLATAFORMA DE ALTA PRECISÃO
@@ -163,6 +166,13 @@ double obter_timestamp_precisao(void) {
     #endif
 }
 
+/**
+ * @brief Interface pública do relógio de alta precisão (ver analise.h)
+ */
+double obter_tempo_preciso(void) {
+    return obter_timestamp_precisao();
+}
+
 /**
  * @brief Sistema inteligente de medição temporal com estratégia adaptativa
  *
@@ -199,7 +209,7 @@ double obter_timestamp_precisao(void) {
  * - Detecta e adapta-se automaticamente à velocidade do algoritmo
  * - Mantém alta precisão mesmo para execuções muito rápidas
  *
- * @param sort_fn Ponteiro para função de algoritmo de ordenação padrão
+ * @param info Motor a medir (a assinatura uniforme cobre também o Quick Sort)
  * @param arr Array a ser ordenado (pode ser modificado, será restaurado entre execuções)
  * @param n Número de elementos no array (deve ser > 0)
  * @param elem_size Tamanho em bytes de cada elemento (deve ser > 0)
@@ -212,11 +222,11 @@ double obter_timestamp_precisao(void) {
  * @note Array de entrada pode ser modificado durante a medição, mas para
  *       múltiplas execuções é restaurado ao estado original entre elas
  */
-double medir_tempo_ordenacao(void (*sort_fn)(void*, int, size_t, CompareFn),
+double medir_tempo_ordenacao(const AlgoritmoInfo *info,
                             void *arr, int n, size_t elem_size, CompareFn cmp) {
 
     // Validação de parâmetros
-    if (!sort_fn || !arr || !cmp || n <= 0 || elem_size == 0) {
+    if (!info || !arr || !cmp || n <= 0 || elem_size == 0) {
         return 0.000001; // Tempo mínimo para parâmetros inválidos
     }
 
@@ -232,7 +242,7 @@ double medir_tempo_ordenacao(void (*sort_fn)(void*, int, size_t, CompareFn),
         if (total_size / elem_size != (size_t)n) {
             // Overflow detectado - usa medição única
             double tempo_inicio = obter_timestamp_precisao();
-            sort_fn(arr, n, elem_size, cmp);
+            executar_ordenacao(info, arr, n, elem_size, cmp);
             double tempo_fim = obter_timestamp_precisao();
             double tempo_decorrido = tempo_fim - tempo_inicio;
             return (tempo_decorrido > 0.0) ? tempo_decorrido : 0.000001;
@@ -243,7 +253,7 @@ double medir_tempo_ordenacao(void (*sort_fn)(void*, int, size_t, CompareFn),
         if (!dados_backup) {
             // Fallback para medição única se falhar alocação
             double tempo_inicio = obter_timestamp_precisao();
-            sort_fn(arr, n, elem_size, cmp);
+            executar_ordenacao(info, arr, n, elem_size, cmp);
             double tempo_fim = obter_timestamp_precisao();
 
             double tempo_decorrido = tempo_fim - tempo_inicio;
@@ -259,7 +269,7 @@ double medir_tempo_ordenacao(void (*sort_fn)(void*, int, size_t, CompareFn),
 
             // Medição individual
             double tempo_inicio = obter_timestamp_precisao();
-            sort_fn(arr, n, elem_size, cmp);
+            executar_ordenacao(info, arr, n, elem_size, cmp);
             double tempo_fim = obter_timestamp_precisao();
 
             tempo_total += (tempo_fim - tempo_inicio);
@@ -274,89 +284,7 @@ double medir_tempo_ordenacao(void (*sort_fn)(void*, int, size_t, CompareFn),
     } else {
         // Para conjuntos grandes: uma execução é suficiente para precisão adequada
         double tempo_inicio = obter_timestamp_precisao();
-        sort_fn(arr, n, elem_size, cmp);
-        double tempo_fim = obter_timestamp_precisao();
-
-        double tempo_decorrido = tempo_fim - tempo_inicio;
-        return (tempo_decorrido > 0.0) ? tempo_decorrido : 0.000001;
-    }
-}
-
-/**
- * @brief Versão especializada de medição de tempo para Quick Sort
- *
- * O Quick Sort requer interface especial devido à sua natureza recursiva
- * e parâmetros adicionais (índices de início e fim). Esta função adapta
- * a medição de alta precisão para esta interface específica.
- *
- * @param quick_fn Ponteiro para a função Quick Sort
- * @param arr Ponteiro para o array a ser ordenado
- * @param n Número de elementos no array
- * @param elem_size Tamanho de cada elemento em bytes
- * @param cmp Função de comparação entre elementos
- * @return Tempo de execução em segundos (nunca retorna zero)
- */
-double medir_tempo_quick_sort(void (*quick_fn)(void*, int, int, size_t, CompareFn),
-                            void *arr, int n, size_t elem_size, CompareFn cmp) {
-
-    // Validação de parâmetros
-    if (!quick_fn || !arr || !cmp || n <= 0 || elem_size == 0) {
-        return 0.000001; // Tempo mínimo para parâmetros inválidos
-    }
-
-    int num_execucoes = determinar_num_execucoes(n);
-
-    if (num_execucoes > 1) {
-        // Múltiplas execuções para conjuntos pequenos
-        double tempo_total = 0.0;
-
-        // Verifica overflow na multiplicação
-        size_t total_size = (size_t)n * elem_size;
-        if (total_size / elem_size != (size_t)n) {
-            // Overflow detectado - usa medição única
-            double tempo_inicio = obter_timestamp_precisao();
-            quick_fn(arr, 0, n - 1, elem_size, cmp);
-            double tempo_fim = obter_timestamp_precisao();
-            double tempo_decorrido = tempo_fim - tempo_inicio;
-            return (tempo_decorrido > 0.0) ? tempo_decorrido : 0.000001;
-        }
-
-        void *dados_backup = malloc(total_size);
-
-        if (!dados_backup) {
-            // Fallback para medição única
-            double tempo_inicio = obter_timestamp_precisao();
-            quick_fn(arr, 0, n - 1, elem_size, cmp);
-            double tempo_fim = obter_timestamp_precisao();
-
-            double tempo_decorrido = tempo_fim - tempo_inicio;
-            return (tempo_decorrido > 0.0) ? tempo_decorrido : 0.000001;
-        }
-
-        memcpy(dados_backup, arr, n * elem_size);
-
-        for (int i = 0; i < num_execucoes; i++) {
-            // Restaura dados originais para cada execução
-            memcpy(arr, dados_backup, n * elem_size);
-
-            // Mede tempo desta execução específica
-            double tempo_inicio = obter_timestamp_precisao();
-            quick_fn(arr, 0, n - 1, elem_size, cmp);
-            double tempo_fim = obter_timestamp_precisao();
-
-            tempo_total += (tempo_fim - tempo_inicio);
-        }
-
-        free(dados_backup);
-
-        // Retorna tempo médio, garantindo que nunca seja zero
-        double tempo_medio = tempo_total / num_execucoes;
-        return (tempo_medio > 0.0) ? tempo_medio : 0.000001;
-
-    } else {
-        // Para conjuntos grandes, uma execução é suficiente
-        double tempo_inicio = obter_timestamp_precisao();
-        quick_fn(arr, 0, n - 1, elem_size, cmp);
+        executar_ordenacao(info, arr, n, elem_size, cmp);
         double tempo_fim = obter_timestamp_precisao();
 
         double tempo_decorrido = tempo_fim - tempo_inicio;
@@ -370,7 +298,7 @@ double medir_tempo_quick_sort(void (*quick_fn)(void*, int, int, size_t, CompareF
  * Para algoritmos muito rápidos, executa múltiplas medições e calcula
  * a média para obter resultados mais confiáveis e reduzir variabilidade.
  *
- * @param sort_fn Ponteiro para a função do algoritmo
+ * @param info Motor a medir
  * @param dados_originais Dados originais (não serão modificados)
  * @param n Número de elementos
  * @param elem_size Tamanho de cada elemento
@@ -378,7 +306,7 @@ double medir_tempo_quick_sort(void (*quick_fn)(void*, int, int, size_t, CompareF
  * @param num_execucoes Número de execuções para média (padrão: 3)
  * @return Tempo médio de execução
  */
-double medir_tempo_multiplo(void (*sort_fn)(void*, int, size_t, CompareFn),
+double medir_tempo_multiplo(const AlgoritmoInfo *info,
                            const void *dados_originais, int n, size_t elem_size,
                            CompareFn cmp, int num_execucoes) {
     if (num_execucoes < 1) num_execucoes = 1;
@@ -388,7 +316,7 @@ double medir_tempo_multiplo(void (*sort_fn)(void*, int, size_t, CompareFn),
 
     if (!dados_copia) {
         // Fallback para medição única se falhar alocação
-        return medir_tempo_ordenacao(sort_fn, (void*)dados_originais, n, elem_size, cmp);
+        return medir_tempo_ordenacao(info, (void*)dados_originais, n, elem_size, cmp);
     }
 
     for (int i = 0; i < num_execucoes; i++) {
@@ -396,7 +324,7 @@ double medir_tempo_multiplo(void (*sort_fn)(void*, int, size_t, CompareFn),
         memcpy(dados_copia, dados_originais, n * elem_size);
 
         // Mede tempo desta execução
-        double tempo_execucao = medir_tempo_ordenacao(sort_fn, dados_copia, n, elem_size, cmp);
+        double tempo_execucao = medir_tempo_ordenacao(info, dados_copia, n, elem_size, cmp);
         tempo_total += tempo_execucao;
     }
 
@@ -433,10 +361,147 @@ int determinar_num_execucoes(int tamanho_conjunto) {
     }
 }
 
+/**
+ * @brief Executa o motor uma vez pela assinatura uniforme
+ *
+ * Com as métricas ligadas (metricas.h), a chamada é cronometrada e
+ * anotada no bloco da thread; desligadas, o custo é um desvio. Plugins
+ * comparam por comparar_e_contar, então suas comparações também contam.
+ */
+void executar_ordenacao(const AlgoritmoInfo *algoritmo_info, void *arr, int n,
+                        size_t elem_size, CompareFn cmp) {
+    // Plugins não enxergam contador_comparacoes: como as referências da
+    // libc, recebem comparar_e_contar, que conta e delega a cmp
+    if (eh_plugin(algoritmo_info)) {
+        configurar_comparacao_contada(cmp);
+        cmp = comparar_e_contar;
+    }
+
+    if (!METRICAS_HABILITADAS()) {
+        algoritmo_info->ordenar(arr, n, elem_size, cmp, algoritmo_info->contexto);
+        return;
+    }
+
+    uint64_t inicio = cronometro_iniciar();
+    algoritmo_info->ordenar(arr, n, elem_size, cmp, algoritmo_info->contexto);
+    uint64_t fim = cronometro_parar();
+    metricas_registrar_ordenacao(indice_motor(algoritmo_info), usar_versao_otimizada,
+                                 n, elem_size, cronometro_decorrido(inicio, fim));
+}
+
+/**
+ * @brief Mede tempo e contadores de um algoritmo em uma única chamada
+ *
+ *  DIFERENÇA EM RELAÇÃO A medir_tempo_ordenacao():
+ * Os contadores globais são zerados antes de CADA execução repetida, então
+ * comparações, trocas e movimentações correspondem a uma única ordenação,
+ * enquanto o tempo é a média das execuções (o algoritmo é determinístico
+ * e os dados são restaurados entre as execuções).
+ *
+ * Ao final, `dados` contém o resultado ordenado.
+ */
+ResultadoTempo medir_algoritmo(AlgoritmoInfo *algoritmo_info, void *dados,
+                              int tamanho, size_t elem_size, CompareFn cmp,
+                              const char *tipo_dados) {
+    ResultadoTempo resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    snprintf(resultado.algoritmo, sizeof(resultado.algoritmo), "%s", algoritmo_info->nome);
+    snprintf(resultado.tipo_dados, sizeof(resultado.tipo_dados), "%s", tipo_dados);
+    resultado.tamanho_dados = tamanho;
+
+    // Validação de parâmetros
+    if (!dados || !cmp || tamanho <= 0 || elem_size == 0) {
+        resultado.tempo_execucao = 0.000001;
+        return resultado;
+    }
+
+    int num_execucoes = determinar_num_execucoes(tamanho);
+    size_t total_size = (size_t)tamanho * elem_size;
+    void *dados_backup = NULL;
+
+    if (num_execucoes > 1) {
+        dados_backup = emprestar_buffer_trabalho(total_size);
+        if (dados_backup) {
+            memcpy(dados_backup, dados, total_size);
+        } else {
+            num_execucoes = 1; // Fallback: medição única
+        }
+    }
+
+    // Isolamento (isolamento.c): páginas materializadas e travadas antes de medir
+    unsigned modo_dados = isolar_buffer(dados, total_size);
+    unsigned modo_backup = isolar_buffer(dados_backup, dados_backup ? total_size : 0);
+    unsigned modo_cache = 0;
+
+    // Ticks inteiros (cronometro.c): sem perda de resolução ao somar execuções curtas
+    uint64_t ticks_total = 0;
+    for (int exec = 0; exec < num_execucoes; exec++) {
+        if (exec > 0) {
+            memcpy(dados, dados_backup, total_size);
+        }
+
+        contador_comparacoes = 0;
+        contador_trocas = 0;
+        contador_movimentacoes = 0;
+
+        // Aquece ou esfria a cache depois da restauração, que a deixaria quente por acaso
+        modo_cache = preparar_cache(dados, total_size);
+
+        FASE_INICIO_VALOR(algoritmo_info->nome, tamanho);  // Raiz das fases no trace
+        SONDA_MEDICAO_INICIO(indice_motor(algoritmo_info), tamanho, exec);
+        uint64_t inicio = cronometro_iniciar();
+        executar_ordenacao(algoritmo_info, dados, tamanho, elem_size, cmp);
+        uint64_t fim = cronometro_parar();
+        SONDA_MEDICAO_FIM(indice_motor(algoritmo_info), tamanho, exec, fim - inicio);
+        FASE_FIM();
+
+        ticks_total += cronometro_decorrido(inicio, fim);
+    }
+
+    liberar_buffer_isolado(dados_backup, total_size, modo_backup);
+    liberar_buffer_isolado(dados, total_size, modo_dados);
+    devolver_buffer_trabalho(dados_backup);
+
+    // Registra apenas o que valeu para os próprios dados medidos
+    resultado.modo_isolamento = estado_fixacao_thread() | modo_dados | modo_cache;
+
+    resultado.ticks = ticks_total / (uint64_t)num_execucoes;
+    double tempo_medio = ticks_para_segundos(ticks_total) / num_execucoes;
+    resultado.tempo_execucao = (tempo_medio > 0.0) ? tempo_medio : 0.000001;
+    resultado.comparacoes = contador_comparacoes;
+    resultado.trocas = contador_trocas;
+    resultado.movimentacoes = contador_movimentacoes;
+    // Cada movimentação (memcpy de um elemento) lê e escreve elem_size bytes
+    resultado.bytes_lidos = contador_movimentacoes * (long long)elem_size;
+    resultado.bytes_escritos = contador_movimentacoes * (long long)elem_size;
+    return resultado;
+}
+
 /* ================================================================
  * BASE DE CONHECIMENTO DOS ALGORITMOS
  * ================================================================ */
 
+/* Adaptadores para a assinatura uniforme OrdenacaoFn (o contexto não é usado) */
+#define ADAPTADOR_MOTOR(adaptador, funcao)                                             \
+    static void adaptador(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) { \
+        (void)contexto;                                                                \
+        funcao(arr, n, elem_size, cmp);                                                \
+    }
+
+ADAPTADOR_MOTOR(motor_insertion, insertion_sort)
+ADAPTADOR_MOTOR(motor_bubble, bubble_sort)
+ADAPTADOR_MOTOR(motor_selection, selection_sort)
+ADAPTADOR_MOTOR(motor_shaker, shaker_sort)
+ADAPTADOR_MOTOR(motor_shell, shell_sort)
+ADAPTADOR_MOTOR(motor_heap, heap_sort)
+
+/// Quick Sort: a interface recursiva recebe início/fim
+static void motor_quick(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)contexto;
+    quick_sort(arr, 0, n - 1, elem_size, cmp);
+}
+
+
 /**
  * @brief Retorna array com informações completas de todos os algoritmos
  *
@@ -447,9 +512,9 @@ int determinar_num_execucoes(int tamanho_conjunto) {
  * Informações incluídas para cada algoritmo:
  * - Nome identificador único
  * - Complexidades teóricas (melhor, médio, pior caso)
- * - Propriedade de estabilidade
- * - Ponteiros para as implementações
- * - Flags de controle para execução diferenciada
+ * - Capacidades (estável, em lugar, ...)
+ * - Adaptador com a assinatura uniforme OrdenacaoFn
+ * - Id curto e etiquetas usados pelo registro de motores (registro.h)
  *
  * @return Ponteiro para array estático com dados dos algoritmos
  */
@@ -457,53 +522,164 @@ AlgoritmoInfo* obter_info_algoritmos(void) {
     // Array estático - mantém dados entre chamadas
     static AlgoritmoInfo algoritmos[NUM_ALGORITMOS] = {
         {
-            "Insertion Sort", "O(n)", "O(n²)", "O(n²)", 1,
-            insertion_sort, NULL, 0
+            "Insertion Sort", "O(n)", "O(n²)", "O(n²)", CAPACIDADE_ESTAVEL | CAPACIDADE_EM_LUGAR,
+            motor_insertion, NULL, "insertion", "interno,simples,quadratico"
         },
         {
-            "Bubble Sort", "O(n)", "O(n²)", "O(n²)", 1,
-            bubble_sort, NULL, 0
+            "Bubble Sort", "O(n)", "O(n²)", "O(n²)", CAPACIDADE_ESTAVEL | CAPACIDADE_EM_LUGAR,
+            motor_bubble, NULL, "bubble", "interno,simples,quadratico"
         },
         {
-            "Selection Sort", "O(n²)", "O(n²)", "O(n²)", 0,
-            selection_sort, NULL, 0
+            "Selection Sort", "O(n²)", "O(n²)", "O(n²)", CAPACIDADE_EM_LUGAR,
+            motor_selection, NULL, "selection", "interno,simples,quadratico"
         },
         {
-            "Shaker Sort", "O(n)", "O(n²)", "O(n²)", 1,
-            shaker_sort, NULL, 0
+            "Shaker Sort", "O(n)", "O(n²)", "O(n²)", CAPACIDADE_ESTAVEL | CAPACIDADE_EM_LUGAR,
+            motor_shaker, NULL, "shaker", "interno,simples,quadratico"
         },
         {
-            "Shell Sort", "O(n log n)", "O(n^1.25)", "O(n²)", 0,
-            shell_sort, NULL, 0
+            "Shell Sort", "O(n log n)", "O(n^1.25)", "O(n²)", CAPACIDADE_EM_LUGAR,
+            motor_shell, NULL, "shell", "interno,avancado,subquadratico"
         },
         {
-            "Quick Sort", "O(n log n)", "O(n log n)", "O(n²)", 0,
-            NULL, quick_sort, 1
+            "Quick Sort", "O(n log n)", "O(n log n)", "O(n²)", CAPACIDADE_EM_LUGAR,
+            motor_quick, NULL, "quick", "interno,avancado,n_log_n"
         },
         {
-            "Heap Sort", "O(n log n)", "O(n log n)", "O(n log n)", 0,
-            heap_sort, NULL, 0
+            "Heap Sort", "O(n log n)", "O(n log n)", "O(n log n)", CAPACIDADE_EM_LUGAR,
+            motor_heap, NULL, "heap", "interno,avancado,n_log_n"
         }
     };
     return algoritmos;
 }
 
+/* ================================================================
+ * AJUSTES ESTATÍSTICOS PARA VALIDAÇÃO DE COMPLEXIDADE
+ * ================================================================ */
+
+/**
+ * @brief Regressão linear simples por mínimos quadrados
+ *
+ * Retorna também o R² para indicar se o modelo descreve bem os pontos:
+ * valores próximos de 1 indicam crescimento bem comportado; valores baixos
+ * indicam ruído de medição ou mudança de regime (ex.: dados saindo do cache).
+ */
+AjusteLinear ajustar_reta(const double *x, const double *y, int n) {
+    AjusteLinear ajuste = {0.0, 0.0, 0.0, n};
+    if (n < 2) {
+        if (n == 1) ajuste.intercepto = y[0];
+        return ajuste;
+    }
+
+    double media_x = 0.0, media_y = 0.0;
+    for (int i = 0; i < n; i++) {
+        media_x += x[i];
+        media_y += y[i];
+    }
+    media_x /= n;
+    media_y /= n;
+
+    double sxx = 0.0, sxy = 0.0, syy = 0.0;
+    for (int i = 0; i < n; i++) {
+        double dx = x[i] - media_x;
+        double dy = y[i] - media_y;
+        sxx += dx * dx;
+        sxy += dx * dy;
+        syy += dy * dy;
+    }
+
+    if (sxx <= 0.0) {
+        ajuste.intercepto = media_y;
+        return ajuste;
+    }
+
+    ajuste.inclinacao = sxy / sxx;
+    ajuste.intercepto = media_y - ajuste.inclinacao * media_x;
+    ajuste.r2 = (syy > 0.0) ? (sxy * sxy) / (sxx * syy) : 1.0;
+    return ajuste;
+}
+
+/**
+ * @brief Ajuste y = c·n^k em escala log2-log2
+ */
+AjusteLinear ajustar_lei_potencia(const int *tamanhos, const double *valores, int num_pontos) {
+    double *log_n = malloc((size_t)(num_pontos > 0 ? num_pontos : 1) * sizeof(double));
+    double *log_v = malloc((size_t)(num_pontos > 0 ? num_pontos : 1) * sizeof(double));
+    AjusteLinear ajuste = {0.0, 0.0, 0.0, 0};
+
+    if (!log_n || !log_v) {
+        free(log_n);
+        free(log_v);
+        return ajuste;
+    }
+
+    // Descarta pontos sem logaritmo definido
+    int validos = 0;
+    for (int i = 0; i < num_pontos; i++) {
+        if (tamanhos[i] > 0 && valores[i] > 0.0) {
+            log_n[validos] = log2((double)tamanhos[i]);
+            log_v[validos] = log2(valores[i]);
+            validos++;
+        }
+    }
+
+    ajuste = ajustar_reta(log_n, log_v, validos);
+    free(log_n);
+    free(log_v);
+    return ajuste;
+}
+
 /* ================================================================
  * SISTEMA DE EXECUÇÃO E ANÁLISE AUTOMATIZADA
  * ================================================================ */
 
+/**
+ * @brief Aceleração de cada motor sobre o qsort da libc (console)
+ *
+ * Cada linha é associada ao seu motor pelo nome (buscar_motor), então
+ * motores pulados não desalinham a tabela. Algoritmos com a mesma
+ * complexidade média declarada do qsort (Quick e Heap) são marcados quando
+ * ficam mais lentos que ele: é a regressão que a linha de base revela.
+ */
+static void imprimir_aceleracoes_qsort(const ResultadoTempo *resultados, int num_resultados) {
+    double tempo_qsort = tempo_qsort_resultados(resultados, num_resultados);
+    if (tempo_qsort <= 0.0) return;
+
+    const AlgoritmoInfo *qsort_info = obter_info_motor(INDICE_QSORT);
+    printf("Aceleracao sobre %s (tempo do qsort / tempo; > 1 = mais rapido):\n", qsort_info->nome);
+    for (int i = 0; i < num_resultados; i++) {
+        const AlgoritmoInfo *info = buscar_motor(resultados[i].algoritmo);
+        if (!info || info == qsort_info) continue;
+        double aceleracao = aceleracao_sobre_qsort(tempo_qsort, resultados[i].tempo_execucao);
+        int comparavel = strcmp(info->complexidade_media, qsort_info->complexidade_media) == 0;
+        char texto[16];
+        formatar_aceleracao(aceleracao, texto, sizeof(texto));
+
+        printf("  %-18s %9s%s%s\n", info->nome, texto,
+               resultados[i].projetado ? " (projetado)" : "",
+               (comparavel && aceleracao < 1.0) ? "  <- mais lento que a libc" : "");
+    }
+}
+
 /**
  * Executa todos os algoritmos e gera análises com contagem de comparações e trocas
  */
 void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size, CompareFn cmp,
                               const char* tipo_dados, const char* arquivo_base) {
-    AlgoritmoInfo* algoritmos = obter_info_algoritmos();
-    ResultadoTempo resultados[NUM_ALGORITMOS];
+    ResultadoTempo resultados[MAX_MOTORES];
+    memset(resultados, 0, sizeof(resultados));
+    int total_motores = num_motores();
+    int num_resultados = 0;
 
     // Determina número de execuções baseado no tamanho do conjunto
     int num_execucoes = determinar_num_execucoes(tamanho);
 
-    printf("\nExecutando %d algoritmos com %d elementos...\n", NUM_ALGORITMOS, tamanho);
+    printf("\nExecutando %d algoritmos (+%d referencia(s) da libc, +%d especializado(s)",
+           NUM_ALGORITMOS, NUM_REFERENCIAS, NUM_ESPECIALIZADOS);
+    if (total_motores > NUM_MOTORES_INTERNOS) {
+        printf(", +%d plugin(s)", total_motores - NUM_MOTORES_INTERNOS);
+    }
+    printf(") com %d elementos...\n", tamanho);
     if (num_execucoes > 1) {
         printf("(Usando %d execucoes por algoritmo para maior precisao)\n", num_execucoes);
     }
@@ -511,14 +687,22 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
     printf("| Algoritmo          | Tempo (s)   | Comparacoes | Trocas      |Estabilidade|\n");
     printf("+--------------------+-------------+-------------+-------------+-------------+\n");
 
-    void *dados_copia = malloc(tamanho * elem_size);
+    // Cópia de trabalho do pool (conjuntos.h): a visão de entrada nunca é escrita
+    void *dados_copia = emprestar_buffer_trabalho((size_t)tamanho * elem_size);
     if (!dados_copia) {
         printf("ERRO: Falha na alocacao de memoria\n");
         return;
     }
 
-    for (int i = 0; i < NUM_ALGORITMOS; i++) {
+    for (int i = 0; i < total_motores; i++) {
+        AlgoritmoInfo *info = obter_info_motor(i);
         double tempo_total = 0.0;
+
+        if (i == NUM_ALGORITMOS || i == INDICE_APRENDIDA || i == NUM_MOTORES_INTERNOS) {
+            // Linhas de base da libc, especializados e plugins separados dos algoritmos
+            printf("+--------------------+-------------+-------------+-------------+-------------+\n");
+        }
+        if (!motor_aceita_dados(info, elem_size, cmp)) continue;  // Ex.: plugin só de inteiros
         long long comparacoes_total = 0;
         long long trocas_total = 0;
 
@@ -531,12 +715,7 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
             contador_comparacoes = 0;
             contador_trocas = 0;
 
-            double tempo_execucao;
-            if (algoritmos[i].eh_quick) {
-                tempo_execucao = medir_tempo_quick_sort(algoritmos[i].quick_sort_fn, dados_copia, tamanho, elem_size, cmp);
-            } else {
-                tempo_execucao = medir_tempo_ordenacao(algoritmos[i].sort_fn, dados_copia, tamanho, elem_size, cmp);
-            }
+            double tempo_execucao = medir_tempo_ordenacao(info, dados_copia, tamanho, elem_size, cmp);
 
             // Acumula métricas de todas as execuções
             tempo_total += tempo_execucao;
@@ -550,24 +729,27 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
         long long trocas_media = trocas_total / num_execucoes;
 
         // Armazena resultado com médias
-        strcpy(resultados[i].algoritmo, algoritmos[i].nome);
-        resultados[i].tempo_execucao = tempo_medio;
-        resultados[i].tamanho_dados = tamanho;
-        strcpy(resultados[i].tipo_dados, tipo_dados);
-        resultados[i].comparacoes = comparacoes_media;
-        resultados[i].trocas = trocas_media;
+        ResultadoTempo *resultado = &resultados[num_resultados++];
+        strcpy(resultado->algoritmo, info->nome);
+        resultado->tempo_execucao = tempo_medio;
+        resultado->tamanho_dados = tamanho;
+        strcpy(resultado->tipo_dados, tipo_dados);
+        resultado->comparacoes = comparacoes_media;
+        resultado->trocas = trocas_media;
 
         printf("| %-18s | %9.6f   | %11lld | %11lld | %-11s |\n",
-               algoritmos[i].nome,
+               info->nome,
                tempo_medio,
                comparacoes_media,
                trocas_media,
-               algoritmos[i].eh_estavel ? "Estavel" : "Nao Estavel");
+               (info->capacidades & CAPACIDADE_ESTAVEL) ? "Estavel" : "Nao Estavel");
+
+        if (i >= NUM_ALGORITMOS) continue;  // Referências e plugins: saída idêntica; não salva
 
         // Salva resultado ordenado (usando última execução)
         char nome_saida[MAX_PATH];
         snprintf(nome_saida, sizeof(nome_saida), "%s_%s_%s",
-                algoritmos[i].nome, tipo_dados, arquivo_base);
+                info->nome, tipo_dados, arquivo_base);
 
         // Remove espaços do nome do arquivo
         for (char *p = nome_saida; *p; ++p) {
@@ -590,14 +772,15 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
     // Gera relatório de tempos com métricas
     char nome_relatorio[MAX_PATH];
     snprintf(nome_relatorio, sizeof(nome_relatorio), "relatorio_%s_%s.txt", tipo_dados, arquivo_base);
-    gerar_relatorio_tempos(resultados, NUM_ALGORITMOS, nome_relatorio);
+    imprimir_aceleracoes_qsort(resultados, num_resultados);
+    gerar_relatorio_tempos(resultados, num_resultados, nome_relatorio);
 
     // Mostra ranking por tempo
     printf("\n=== RANKING POR TEMPO DE EXECUCAO ===\n");
 
     // Ordena resultados por tempo
-    for (int i = 0; i < NUM_ALGORITMOS - 1; i++) {
-        for (int j = i + 1; j < NUM_ALGORITMOS; j++) {
+    for (int i = 0; i < num_resultados - 1; i++) {
+        for (int j = i + 1; j < num_resultados; j++) {
             if (resultados[i].tempo_execucao > resultados[j].tempo_execucao) {
                 ResultadoTempo temp = resultados[i];
                 resultados[i] = resultados[j];
@@ -606,7 +789,7 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
         }
     }
 
-    for (int i = 0; i < NUM_ALGORITMOS; i++) {
+    for (int i = 0; i < num_resultados; i++) {
         printf("   %d. %s: %.6f segundos\n",
                i + 1, resultados[i].algoritmo, resultados[i].tempo_execucao);
     }
@@ -615,8 +798,8 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
     printf("\n=== RANKING POR NUMERO DE COMPARACOES ===\n");
 
     // Ordena por comparações
-    for (int i = 0; i < NUM_ALGORITMOS - 1; i++) {
-        for (int j = i + 1; j < NUM_ALGORITMOS; j++) {
+    for (int i = 0; i < num_resultados - 1; i++) {
+        for (int j = i + 1; j < num_resultados; j++) {
             if (resultados[i].comparacoes > resultados[j].comparacoes) {
                 ResultadoTempo temp = resultados[i];
                 resultados[i] = resultados[j];
@@ -625,7 +808,7 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
         }
     }
 
-    for (int i = 0; i < NUM_ALGORITMOS; i++) {
+    for (int i = 0; i < num_resultados; i++) {
         printf("   %d. %s: %lld comparacoes\n",
                i + 1, resultados[i].algoritmo, resultados[i].comparacoes);
     }
@@ -634,8 +817,8 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
     printf("\n=== RANKING POR NUMERO DE TROCAS ===\n");
 
     // Ordena por trocas
-    for (int i = 0; i < NUM_ALGORITMOS - 1; i++) {
-        for (int j = i + 1; j < NUM_ALGORITMOS; j++) {
+    for (int i = 0; i < num_resultados - 1; i++) {
+        for (int j = i + 1; j < num_resultados; j++) {
             if (resultados[i].trocas > resultados[j].trocas) {
                 ResultadoTempo temp = resultados[i];
                 resultados[i] = resultados[j];
@@ -644,7 +827,7 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
         }
     }
 
-    for (int i = 0; i < NUM_ALGORITMOS; i++) {
+    for (int i = 0; i < num_resultados; i++) {
         printf("   %d. %s: %lld trocas\n",
                i + 1, resultados[i].algoritmo, resultados[i].trocas);
     }
@@ -658,6 +841,44 @@ void executar_todos_algoritmos(const void *dados, int tamanho, size_t elem_size,
  */
 
 // Função callback para escrever relatórios - deve estar fora da função principal
+/**
+ * @brief Bytes movidos, banda atingida e fração do teto da sonda (banda.c)
+ */
+static void escrever_roofline_banda(FILE *arquivo, const ResultadoTempo *resultados, int tamanho) {
+    char descricao[128];
+    descrever_banda_memoria(descricao, sizeof(descricao));
+    fprintf(arquivo, "ROOFLINE DE BANDA (teto: %s):\n", descricao);
+    fprintf(arquivo, "+----------------+----------------+-----------------+-----------------+----------+----------+\n");
+    fprintf(arquivo, "| Algoritmo      | Tipo Dados     | Bytes lidos     | Bytes escritos  |   GB/s   | %% teto   |\n");
+    fprintf(arquivo, "+----------------+----------------+-----------------+-----------------+----------+----------+\n");
+
+    int acima_teto = 0;
+    for (int i = 0; i < tamanho; i++) {
+        double gb_s = banda_atingida(&resultados[i]);
+        double fracao = fracao_teto_banda(gb_s);
+        if (fracao > 1.0) acima_teto = 1;
+
+        char banda[16], percentual[16];
+        formatar_banda(gb_s, banda, sizeof(banda));
+        formatar_fracao_banda(fracao, percentual, sizeof(percentual));
+        if (resultados[i].projetado || gb_s <= 0.0) {
+            fprintf(arquivo, "| %-14s | %-14s | %15s | %15s | %8s | %8s |\n",
+                    resultados[i].algoritmo, resultados[i].tipo_dados, "-", "-", banda, percentual);
+            continue;
+        }
+        fprintf(arquivo, "| %-14s | %-14s | %15lld | %15lld | %8s | %8s |\n",
+                resultados[i].algoritmo, resultados[i].tipo_dados,
+                resultados[i].bytes_lidos, resultados[i].bytes_escritos, banda, percentual);
+    }
+    fprintf(arquivo, "+----------------+----------------+-----------------+-----------------+----------+----------+\n");
+    fprintf(arquivo, "- Bytes = movimentacoes x tamanho do elemento (cada movimentacao le e escreve)\n");
+    fprintf(arquivo, "- %% teto perto de 100%%: limitado pela memoria; baixo: comparacoes e desvios\n");
+    if (acima_teto) {
+        fprintf(arquivo, "- (*) Acima do teto: os dados cabem na cache e a DRAM nao e o limite\n");
+    }
+    fprintf(arquivo, "- Sem valor: tempo projetado ou referencia da libc (movimentacoes invisiveis)\n\n");
+}
+
 void escrever_relatorio_callback(FILE* arquivo, void* dados, int tamanho) {
     ResultadoTempo* resultados = (ResultadoTempo*)dados;
 
@@ -667,35 +888,102 @@ void escrever_relatorio_callback(FILE* arquivo, void* dados, int tamanho) {
     fprintf(arquivo, "================================================================\n\n");
     fprintf(arquivo, "Dados analisados: %d conjuntos de teste\n\n", tamanho);
 
+    // Linha de base (referencias.c): aceleração de cada linha sobre o qsort
+    double tempo_qsort = tempo_qsort_resultados(resultados, tamanho);
+
     // Tabela de resultados com nova coluna de movimentações
-    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+\n");
-    fprintf(arquivo, "| Algoritmo      | Tipo Dados     | Tempo (s)   | Compar.  | Trocas | Movimentac. |\n");
-    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+\n");
+    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+----------+\n");
+    fprintf(arquivo, "| Algoritmo      | Tipo Dados     | Tempo (s)   | Compar.  | Trocas | Movimentac. | x qsort  |\n");
+    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+----------+\n");
 
+    int num_projetados = 0;
     for (int i = 0; i < tamanho; i++) {
-        fprintf(arquivo, "| %-14s | %-14s | %9.6f | %8lld | %6lld | %11lld |\n",
+        char aceleracao[16];
+        formatar_aceleracao(aceleracao_sobre_qsort(tempo_qsort, resultados[i].tempo_execucao),
+                            aceleracao, sizeof(aceleracao));
+
+        if (resultados[i].projetado) {
+            // Execução pulada pelo orçamento: só o tempo extrapolado é conhecido
+            num_projetados++;
+            fprintf(arquivo, "| %-14s | %-14s | %9.6f*| %8s | %6s | %11s | %8s |\n",
+                   resultados[i].algoritmo,
+                   resultados[i].tipo_dados,
+                   resultados[i].tempo_execucao,
+                   "-", "-", "-", aceleracao);
+            continue;
+        }
+        fprintf(arquivo, "| %-14s | %-14s | %9.6f | %8lld | %6lld | %11lld | %8s |\n",
                resultados[i].algoritmo,
                resultados[i].tipo_dados,
                resultados[i].tempo_execucao,
                resultados[i].comparacoes,
                resultados[i].trocas,
-               resultados[i].movimentacoes);  // Nova coluna
+               resultados[i].movimentacoes,  // Nova coluna
+               aceleracao);
     }
 
-    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+\n\n");
+    fprintf(arquivo, "+----------------+----------------+-------------+----------+--------+-------------+----------+\n\n");
+
+    escrever_roofline_banda(arquivo, resultados, tamanho);
+
+    // Todas as linhas de um relatório vêm do mesmo conjunto de dados
+    if (tamanho > 0) {
+        escrever_metricas_desordem(arquivo, &resultados[0].desordem, resultados[0].tamanho_dados);
+    }
 
     // Análises adicionais atualizadas
     fprintf(arquivo, "OBSERVACOES:\n");
+    char cronometro[96];
+    descrever_cronometro(cronometro, sizeof(cronometro));
     fprintf(arquivo, "- Tempos em segundos (precisao: microssegundos - 6 casas decimais)\n");
+    fprintf(arquivo, "- Cronometro: %s (descontado de cada medicao)\n", cronometro);
+    char parametros[96];
+    descrever_parametros_motores(obter_parametros_motores(), parametros, sizeof(parametros));
+    fprintf(arquivo, "- Parametros dos motores otimizados: %s (perfil: menu de autoajuste)\n", parametros);
     fprintf(arquivo, "- Para algoritmos muito rapidos, foram executadas multiplas medicoes\n");
     fprintf(arquivo, "- Conjuntos < 100 elementos: 10 execucoes para maior precisao\n");
     fprintf(arquivo, "- Conjuntos < 1000 elementos: 5 execucoes para maior precisao\n");
     fprintf(arquivo, "- Conjuntos < 10000 elementos: 3 execucoes para maior precisao\n");
     fprintf(arquivo, "- Conjuntos >= 10000 elementos: 1 execucao (suficientemente lenta)\n");
-    fprintf(arquivo, "- Comparacoes, Trocas e Movimentacoes: valores absolutos\n");
+    fprintf(arquivo, "- Comparacoes, Trocas e Movimentacoes: valores de uma unica ordenacao\n");
+    if (num_projetados > 0) {
+        fprintf(arquivo, "- (*) Tempo PROJETADO: a execucao excederia o orcamento de %.2f s e foi\n",
+                obter_orcamento_tempo());
+        fprintf(arquivo, "  pulada; valor extrapolado por ajuste t ~ c*n^k nos tamanhos menores\n");
+    }
     fprintf(arquivo, "- Movimentacoes: operacoes de memoria (memcpy) realizadas\n");
     fprintf(arquivo, "- Uma troca equivale a 3 movimentacoes de memoria\n");
-    fprintf(arquivo, "- Dados ordenados por algoritmo\n\n");
+    if (tempo_qsort > 0.0) {
+        fprintf(arquivo, "- x qsort: tempo do %s / tempo da linha (> 1 = mais rapido que a libc)\n",
+                obter_info_motor(INDICE_QSORT)->nome);
+        fprintf(arquivo, "- Referencias da libc: trocas e movimentacoes internas nao sao visiveis (0)\n");
+    }
+    fprintf(arquivo, "- Dados ordenados por algoritmo\n");
+
+    // Modo de isolamento: uma linha se uniforme, senão um por medição
+    int primeiro_medido = -1, isolamento_uniforme = 1;
+    for (int i = 0; i < tamanho; i++) {
+        if (resultados[i].projetado) continue;
+        if (primeiro_medido < 0) {
+            primeiro_medido = i;
+        } else if (resultados[i].modo_isolamento != resultados[primeiro_medido].modo_isolamento) {
+            isolamento_uniforme = 0;
+        }
+    }
+    char modo[64];
+    if (primeiro_medido >= 0 && isolamento_uniforme) {
+        descrever_modo_isolamento(resultados[primeiro_medido].modo_isolamento, modo, sizeof(modo));
+        fprintf(arquivo, "- Isolamento das medicoes: %s\n", modo);
+    } else if (primeiro_medido >= 0) {
+        fprintf(arquivo, "- Isolamento das medicoes (variou entre execucoes):\n");
+        for (int i = 0; i < tamanho; i++) {
+            if (resultados[i].projetado) continue;
+            descrever_modo_isolamento(resultados[i].modo_isolamento, modo, sizeof(modo));
+            fprintf(arquivo, "    %-14s %-14s %s\n",
+                    resultados[i].algoritmo, resultados[i].tipo_dados, modo);
+        }
+    }
+    fprintf(arquivo, "\n");
 
     fprintf(arquivo, "METRICAS EXPLICADAS:\n");
     fprintf(arquivo, "- COMPARACOES: Numero de comparacoes entre elementos\n");
@@ -712,6 +1000,7 @@ void escrever_relatorio_callback(FILE* arquivo, void* dados, int tamanho) {
     fprintf(arquivo, "Heap Sort:      O(n log n) todos os casos\n");
     fprintf(arquivo, "Shell Sort:     O(n^1.25) medio (varia com incrementos)\n");
     fprintf(arquivo, "Shaker Sort:    O(n²) medio, O(n) melhor, O(n²) pior\n");
+    fprintf(arquivo, "qsort libc:     O(n log n) medio (algoritmo depende da libc)\n");
 }
 
 void gerar_relatorio_tempos(ResultadoTempo resultados[], int num_resultados, const char* arquivo_saida) {
@@ -753,10 +1042,11 @@ void escrever_estabilidade_callback(FILE* arquivo, void*  dados, int tamanho) {
 
     fprintf(arquivo, "RESUMO DOS ALGORITMOS:\n");
     for (int i = 0; i < NUM_ALGORITMOS; i++) {
+        int estavel = (algoritmos[i].capacidades & CAPACIDADE_ESTAVEL) != 0;
         fprintf(arquivo, "%s %s: %s\n",
-                algoritmos[i].eh_estavel ? "[ESTAVEL]" : "[NAO ESTAVEL]",
+                estavel ? "[ESTAVEL]" : "[NAO ESTAVEL]",
                 algoritmos[i].nome,
-                algoritmos[i].eh_estavel ? "ESTAVEL" : "NAO ESTAVEL");
+                estavel ? "ESTAVEL" : "NAO ESTAVEL");
     }
 }
 
@@ -792,16 +1082,13 @@ void analisar_estabilidade(void) {
         Aluno dados_copia[5];
         copiar_array(dados_teste, dados_copia, tamanho, sizeof(Aluno));
 
+        int estavel = (algoritmos[i].capacidades & CAPACIDADE_ESTAVEL) != 0;
         printf("\n%s %s (%s):\n",
-               algoritmos[i].eh_estavel ? "[ESTAVEL]" : "[NAO ESTAVEL]",
+               estavel ? "[ESTAVEL]" : "[NAO ESTAVEL]",
                algoritmos[i].nome,
-               algoritmos[i].eh_estavel ? "ESTAVEL" : "NAO ESTAVEL");
+               estavel ? "ESTAVEL" : "NAO ESTAVEL");
 
-        if (algoritmos[i].eh_quick) {
-            algoritmos[i].quick_sort_fn(dados_copia, 0, tamanho - 1, sizeof(Aluno), comparar_alunos);
-        } else {
-            algoritmos[i].sort_fn(dados_copia, tamanho, sizeof(Aluno), comparar_alunos);
-        }
+        executar_ordenacao(&algoritmos[i], dados_copia, tamanho, sizeof(Aluno), comparar_alunos);
 
         printf("%-15s %-12s %-15s %-15s\n", "Nome", "Data Nasc.", "Bairro", "Cidade");
         printf("-------------------------------------------------------------\n");
@@ -826,16 +1113,42 @@ void analisar_estabilidade(void) {
  */
 void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, size_t elem_size, CompareFn cmp,
                                             const char* tipo_dados, const char* arquivo_base, const char* versao) {
-    AlgoritmoInfo* algoritmos = obter_info_algoritmos();
-    ResultadoTempo resultados[NUM_ALGORITMOS];
+    ResultadoTempo resultados[MAX_MOTORES];
+    int total_motores = num_motores();
+    int num_resultados = 0;
 
     // Determina número de execuções baseado no tamanho do conjunto
     int num_execucoes = determinar_num_execucoes(tamanho);
 
-    printf("\nExecutando %d algoritmos com %d elementos (%s)...\n", NUM_ALGORITMOS, tamanho, versao);
+    printf("\nExecutando %d algoritmos (+%d referencia(s) da libc, +%d especializado(s)",
+           NUM_ALGORITMOS, NUM_REFERENCIAS, NUM_ESPECIALIZADOS);
+    if (total_motores > NUM_MOTORES_INTERNOS) {
+        printf(", +%d plugin(s)", total_motores - NUM_MOTORES_INTERNOS);
+    }
+    printf(") com %d elementos (%s)...\n", tamanho, versao);
     if (num_execucoes > 1) {
         printf("(Usando %d execucoes por algoritmo para maior precisao)\n", num_execucoes);
     }
+
+    // Pré-ordenação da entrada: uma vez por conjunto (já calculada se é visão do registro)
+    const ConjuntoDados *origem = conjunto_da_visao(dados);
+    MetricasDesordem desordem;
+    if (origem) {
+        desordem = origem->desordem;
+    } else {
+        calcular_metricas_desordem(dados, tamanho, elem_size, cmp, &desordem);
+    }
+    char perfil[160];
+    descrever_metricas_desordem(&desordem, tamanho, perfil, sizeof(perfil));
+    printf("Perfil da entrada: %s\n", perfil);
+    if (origem && origem->carga.calculadas) {
+        // Estatísticas do estágio fundido de leitura (io.h): nenhuma passada extra
+        int baldes = 0;
+        for (int b = 0; b < BALDES_DIGITO_SUPERIOR; b++) baldes += origem->carga.histograma[b] > 0;
+        printf("Carga: faixa [%d, %d], %d/%d baldes do digito superior ocupados\n",
+               origem->carga.minimo, origem->carga.maximo, baldes, BALDES_DIGITO_SUPERIOR);
+    }
+
     printf("+--------------------+-------------+-------------+-------------+---------------+-------------+\n");
     printf("| Algoritmo          | Tempo (s)   | Comparacoes | Trocas      | Movimentacoes |Estabilidade |\n");
     printf("+--------------------+-------------+-------------+-------------+---------------+-------------+\n");
@@ -846,70 +1159,114 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
         return;
     }
 
-    for (int i = 0; i < NUM_ALGORITMOS; i++) {
-        double tempo_total = 0.0;
-        long long comparacoes_total = 0;
-        long long trocas_total = 0;
-        long long movimentacoes_total = 0;  // Nova variável para acumular movimentações
-
-        // Executa múltiplas medições para maior precisão
-        for (int exec = 0; exec < num_execucoes; exec++) {
-            // Copia dados originais para cada execução
-            copiar_array(dados, dados_copia, tamanho, elem_size);
-
-            // Zera contadores para esta execução
-            contador_comparacoes = 0;
-            contador_trocas = 0;
-            contador_movimentacoes = 0;  // Zere o novo contador
-
-            double tempo_execucao;
-            if (algoritmos[i].eh_quick) {
-                tempo_execucao = medir_tempo_quick_sort(algoritmos[i].quick_sort_fn, dados_copia, tamanho, elem_size, cmp);
-            } else {
-                tempo_execucao = medir_tempo_ordenacao(algoritmos[i].sort_fn, dados_copia, tamanho, elem_size, cmp);
+    // Família dos dados (ex.: numeros_aleatorios) para projeções entre tamanhos
+    char categoria[40];
+    extrair_categoria_dados(arquivo_base, categoria, sizeof(categoria));
+    int num_projetados = 0;
+
+    // Cache da análise completa (cache_resultados.h): chave inclui o checksum do conjunto
+    uint64_t checksum = origem ? origem->checksum
+                      : cache_resultados_ativo() ? checksum_dados(dados, (size_t)tamanho * elem_size) : 0;
+    int num_reaproveitados = 0;
+    int interrompido = 0;
+
+    for (int i = 0; i < total_motores; i++) {
+        AlgoritmoInfo *info = obter_info_motor(i);
+        if (relatorio_interrompido()) {
+            interrompido = 1;  // Ctrl-C: as células já medidas estão no cache
+            break;
+        }
+        if (i == NUM_ALGORITMOS || i == INDICE_APRENDIDA || i == NUM_MOTORES_INTERNOS) {
+            // Linhas de base da libc, especializados e plugins separados dos algoritmos
+            printf("+--------------------+-------------+-------------+-------------+---------------+-------------+\n");
+        }
+        if (!motor_aceita_dados(info, elem_size, cmp)) continue;  // Ex.: plugin só de inteiros
+        ResultadoTempo *resultado = &resultados[num_resultados++];
+        int estavel = (info->capacidades & CAPACIDADE_ESTAVEL) != 0;
+
+        // Célula de uma execução anterior deste build: reaproveita sem medir (nem amostrar)
+        memset(resultado, 0, sizeof(*resultado));
+        if (buscar_resultado_cache(info, checksum, tamanho, elem_size, resultado)) {
+            snprintf(resultado->algoritmo, sizeof(resultado->algoritmo), "%s", info->nome);
+            snprintf(resultado->tipo_dados, sizeof(resultado->tipo_dados), "%s", tipo_dados);
+            resultado->tamanho_dados = tamanho;
+            resultado->desordem = desordem;
+            registrar_resultado_desordem(resultado, arquivo_base, versao);
+            num_reaproveitados++;
+
+            if (resultado->projetado) {
+                num_projetados++;
+                printf("| %-18s | %8.6f s | %11s | %11s | %13s | %-10s  |\n",
+                       info->nome, resultado->tempo_execucao, "PROJETADO", "-", "-",
+                       estavel ? "Estavel" : "Nao Estavel");
+                continue;
             }
+            registrar_medicao(info->nome, usar_versao_otimizada, categoria,
+                              tamanho, resultado->tempo_execucao);
+            // Não rodou: o relatório de fases a lista em vez de omiti-la em silêncio
+            fases_registrar_celula_cache(info->nome, usar_versao_otimizada, arquivo_base, tamanho);
+
+            printf("| %-18s | %8.6f s | %11lld | %11lld | %13lld | %-10s  |\n",
+                   info->nome,
+                   resultado->tempo_execucao,
+                   resultado->comparacoes,
+                   resultado->trocas,
+                   resultado->movimentacoes,
+                   estavel ? "Estavel" : "Nao Estavel");
+            continue;  // Array ordenado já salvo pela execução que mediu
+        }
 
-            // Acumula métricas de todas as execuções
-            tempo_total += tempo_execucao;
-            comparacoes_total += contador_comparacoes;
-            trocas_total += contador_trocas;
-            movimentacoes_total += contador_movimentacoes;  // Acumule as movimentações
+        // Corte por orçamento: pula execuções cuja projeção é longa demais
+        ProjecaoTempo projecao;
+        if (excede_orcamento(info, dados, tamanho, elem_size, cmp, categoria, &projecao)) {
+            *resultado = resultado_projetado(info, &projecao, tipo_dados);
+            gravar_resultado_cache(info, checksum, tamanho, elem_size, resultado);
+            resultado->desordem = desordem;
+            registrar_resultado_desordem(resultado, arquivo_base, versao);
+            num_projetados++;
+
+            printf("| %-18s | %8.6f s | %11s | %11s | %13s | %-10s  |\n",
+                   info->nome,
+                   projecao.tempo_projetado,
+                   "PROJETADO", "-", "-",
+                   estavel ? "Estavel" : "Nao Estavel");
+            if (projecao.tamanho_amostra > 0) {
+                printf("|   amostra n=%d: medido %.6f s, previsto %.6f s (erro %+.1f%%)\n",
+                       projecao.tamanho_amostra, projecao.tempo_amostra_medido,
+                       projecao.tempo_amostra_projetado, projecao.erro_relativo_amostra * 100.0);
+            }
+            continue;
         }
 
-        // Calcula médias
-        double tempo_medio = tempo_total / num_execucoes;
-        long long comparacoes_media = comparacoes_total / num_execucoes;
-        long long trocas_media = trocas_total / num_execucoes;
-        long long movimentacoes_media = movimentacoes_total / num_execucoes;  // Calcule a média
+        // Contadores refletem uma única ordenação; tempo é a média das execuções
+        copiar_array(dados, dados_copia, tamanho, elem_size);
+        *resultado = medir_algoritmo(info, dados_copia, tamanho, elem_size, cmp, tipo_dados);
+        registrar_medicao(info->nome, usar_versao_otimizada, categoria,
+                          tamanho, resultado->tempo_execucao);
+        gravar_resultado_cache(info, checksum, tamanho, elem_size, resultado);
+        resultado->desordem = desordem;
+        registrar_resultado_desordem(resultado, arquivo_base, versao);
 
-        // Armazena resultado com médias
-        strcpy(resultados[i].algoritmo, algoritmos[i].nome);
-        resultados[i].tempo_execucao = tempo_medio;
-        resultados[i].tamanho_dados = tamanho;
-        strcpy(resultados[i].tipo_dados, tipo_dados);
-        resultados[i].comparacoes = comparacoes_media;
-        resultados[i].trocas = trocas_media;
-        resultados[i].movimentacoes = movimentacoes_media;  // Armazene no struct de resultados
-
-        // Exibe resultado na tabela com nova coluna
         printf("| %-18s | %8.6f s | %11lld | %11lld | %13lld | %-10s  |\n",
-               algoritmos[i].nome,
-               tempo_medio,
-               comparacoes_media,
-               trocas_media,
-               movimentacoes_media,  // Nova coluna
-               algoritmos[i].eh_estavel ? "Estavel" : "Nao Estavel");
+               info->nome,
+               resultado->tempo_execucao,
+               resultado->comparacoes,
+               resultado->trocas,
+               resultado->movimentacoes,
+               estavel ? "Estavel" : "Nao Estavel");
+
+        // Conferência em uma passada contra a assinatura calculada na leitura
+        if (origem && origem->carga.calculadas) {
+            int erro = conferir_saida_ordenada(dados_copia, tamanho, &origem->carga);
+            if (erro) {
+                printf("|   ERRO: saida de %s %s\n", info->nome,
+                       erro == 1 ? "fora de ordem" : "nao e permutacao da entrada");
+            }
+        }
 
-        // Salva o array ordenado final (usando a última execução)
-        copiar_array(dados, dados_copia, tamanho, elem_size);
-        contador_comparacoes = 0;
-        contador_trocas = 0;
+        if (i >= NUM_ALGORITMOS) continue;  // Referências e plugins: saída idêntica; não salva
 
-        if (algoritmos[i].eh_quick) {
-            algoritmos[i].quick_sort_fn(dados_copia, 0, tamanho - 1, elem_size, cmp);
-        } else {
-            algoritmos[i].sort_fn(dados_copia, tamanho, elem_size, cmp);
-        }
+        // dados_copia já contém o array ordenado pela última execução medida
 
         // Gera nome do arquivo para array ordenado
         char nome_arquivo_ordenado[MAX_PATH];
@@ -922,7 +1279,7 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
         if (ponto) *ponto = '\0';
 
         snprintf(nome_arquivo_ordenado, sizeof(nome_arquivo_ordenado),
-                "%s_%s_%s.txt", algoritmos[i].nome, versao, arquivo_limpo);
+                "%s_%s_%s.txt", info->nome, versao, arquivo_limpo);
 
         // Substitui espaços por underscores no nome do arquivo
         for (char* p = nome_arquivo_ordenado; *p; p++) {
@@ -941,6 +1298,25 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
 
     printf("+--------------------+-------------+-------------+-------------+---------------+-------------+\n");
 
+    if (interrompido) {
+        // Tabela incompleta: o relatório deste conjunto sai na retomada
+        printf("Interrompido: %d celula(s) deste conjunto concluida(s)\n", num_resultados);
+        devolver_buffer_trabalho(dados_copia);
+        return;
+    }
+    if (num_reaproveitados > 0) {
+        printf("Nota: %d celula(s) reaproveitada(s) do cache de resultados\n"
+               "      (arrays ordenados e fases vem da execucao que as mediu)\n",
+               num_reaproveitados);
+    }
+    if (num_projetados > 0) {
+        printf("Nota: %d algoritmo(s) excederiam o orcamento de %.2f s; tempos PROJETADOS\n"
+               "      por ajuste t ~ c*n^k nos tamanhos menores (arrays ordenados nao salvos)\n",
+               num_projetados, obter_orcamento_tempo());
+    }
+
+    imprimir_aceleracoes_qsort(resultados, num_resultados);
+
     // Gera relatório de performance
     char nome_relatorio[MAX_PATH];
     char arquivo_limpo[MAX_PATH];
@@ -954,9 +1330,9 @@ void executar_todos_algoritmos_com_salvamento(const void *dados, int tamanho, si
     snprintf(nome_relatorio, sizeof(nome_relatorio),
             "relatorio_%s_%s_%s.txt", tipo_dados, versao, arquivo_limpo);
 
-    gerar_relatorio_detalhado(resultados, NUM_ALGORITMOS, nome_relatorio);
+    gerar_relatorio_detalhado(resultados, num_resultados, nome_relatorio);
 
-    free(dados_copia);
+    devolver_buffer_trabalho(dados_copia);
     printf("\nTestes concluidos para versao %s!\n", versao);
 }
 
@@ -0,0 +1,276 @@
+/**
+ * ================================================================
+ * ORDENAÇÃO APRENDIDA (MODELO DE CDF) PARA INTEIROS
+ * ================================================================
+ *
+ * @file aprendida.c
+ * @brief Amostra, modelo linear por partes, espalhamento e recuperação
+ *
+ *  MODELO:
+ * A amostra ordenada dá SEGMENTOS_CDF_APRENDIDA + 1 nós (x = chave no
+ * quantil k/S, y = k/S). Nós com a mesma chave colapsam no último
+ * quantil, então a previsão é não-decrescente na chave:
+ *
+ *   y
+ *   1 ┤                       ●──●
+ *     │                  ●───╯
+ *     │            ●────╯            CDF(chave) = y_j + (chave − x_j) · inclinação_j
+ *     │       ●───╯                  balde = ⌊CDF(chave) · baldes⌋
+ *   0 ┼──●───╯
+ *     └──┴────┴─────┴─────┴──────┴──┴──→ chave
+ *
+ * Memória: baldes com capacidade fixa (2 × a ocupação esperada, ~2n
+ * inteiros) e transbordo limitado a LIMITE_TRANSBORDO_APRENDIDA × n.
+ * Encher o transbordo interrompe o espalhamento antes de o array ser
+ * tocado: o Radix LSD recebe a entrada original.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy, memset
+
+/* ================================================================
+ * ESTRUTURAS
+ * ================================================================ */
+
+/**
+ * @brief CDF linear por partes ajustada na amostra
+ */
+typedef struct {
+    int nos;                                      ///< Nós distintos (<= SEGMENTOS + 1)
+    int x[SEGMENTOS_CDF_APRENDIDA + 1];           ///< Chaves nos nós (crescentes)
+    double y[SEGMENTOS_CDF_APRENDIDA + 1];        ///< CDF nos nós
+    double inclinacao[SEGMENTOS_CDF_APRENDIDA + 1];
+} ModeloCdf;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void insercao_inteiros(int *arr, int n, long long *comparacoes, long long *movimentacoes);
+static void radix_inteiros(int *arr, int n, int *aux, long long *movimentacoes);
+static void ajustar_modelo(const int *amostra, int tamanho_amostra, ModeloCdf *modelo);
+static double prever_cdf(const ModeloCdf *modelo, int chave);
+static int comparar_int_simples(const void *a, const void *b);
+
+/* ================================================================
+ * PEÇAS AUXILIARES
+ * ================================================================ */
+
+static void insercao_inteiros(int *arr, int n, long long *comparacoes, long long *movimentacoes) {
+    for (int i = 1; i < n; i++) {
+        int chave = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > chave) {
+            arr[j + 1] = arr[j];
+            j--;
+            (*comparacoes)++;
+            (*movimentacoes)++;
+        }
+        if (j >= 0) (*comparacoes)++;  // Comparação que parou o laço
+        arr[j + 1] = chave;
+    }
+}
+
+/**
+ * @brief Radix LSD de 8 bits; dígitos iguais em todas as chaves não geram passada
+ *
+ * Chaves em [0, 10^6) têm o byte superior constante: 3 passadas em vez de 4.
+ */
+static void radix_inteiros(int *arr, int n, int *aux, long long *movimentacoes) {
+    unsigned *origem = (unsigned*)arr;
+    unsigned *destino = (unsigned*)aux;
+    size_t contagem[256];
+
+    for (int deslocamento = 0; deslocamento < 32; deslocamento += 8) {
+        memset(contagem, 0, sizeof(contagem));
+        // Inverter o bit de sinal põe os negativos antes dos positivos
+        unsigned sinal = deslocamento == 24 ? 0x80u : 0u;
+        for (int i = 0; i < n; i++) contagem[((origem[i] >> deslocamento) & 0xFFu) ^ sinal]++;
+
+        int trivial = 0;
+        for (int b = 0; b < 256; b++) {
+            if (contagem[b] == (size_t)n) trivial = 1;
+        }
+        if (trivial) continue;
+
+        size_t soma = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t c = contagem[b];
+            contagem[b] = soma;
+            soma += c;
+        }
+        for (int i = 0; i < n; i++) {
+            destino[contagem[((origem[i] >> deslocamento) & 0xFFu) ^ sinal]++] = origem[i];
+        }
+        *movimentacoes += n;
+
+        unsigned *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    if (origem != (unsigned*)arr) memcpy(arr, origem, (size_t)n * sizeof(int));
+}
+
+static int comparar_int_simples(const void *a, const void *b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/* ================================================================
+ * MODELO DE CDF
+ * ================================================================ */
+
+static void ajustar_modelo(const int *amostra, int tamanho_amostra, ModeloCdf *modelo) {
+    modelo->nos = 0;
+    for (int k = 0; k <= SEGMENTOS_CDF_APRENDIDA; k++) {
+        int indice = (int)((long long)k * (tamanho_amostra - 1) / SEGMENTOS_CDF_APRENDIDA);
+        int x = amostra[indice];
+        double y = (double)k / SEGMENTOS_CDF_APRENDIDA;
+        if (modelo->nos > 0 && modelo->x[modelo->nos - 1] == x) {
+            modelo->y[modelo->nos - 1] = y;  // Repetição: o nó fica com o maior quantil
+            continue;
+        }
+        modelo->x[modelo->nos] = x;
+        modelo->y[modelo->nos] = y;
+        modelo->nos++;
+    }
+    for (int j = 0; j + 1 < modelo->nos; j++) {
+        modelo->inclinacao[j] = (modelo->y[j + 1] - modelo->y[j]) /
+                                ((double)modelo->x[j + 1] - (double)modelo->x[j]);
+    }
+    modelo->inclinacao[modelo->nos - 1] = 0.0;
+}
+
+/**
+ * @brief CDF prevista em [0, 1] (busca binária nos nós + interpolação)
+ */
+static double prever_cdf(const ModeloCdf *modelo, int chave) {
+    if (chave <= modelo->x[0]) return modelo->y[0];
+    if (chave >= modelo->x[modelo->nos - 1]) return 1.0;
+
+    int baixo = 0, alto = modelo->nos - 1;  // x[baixo] < chave < x[alto]
+    while (alto - baixo > 1) {
+        int meio = (baixo + alto) / 2;
+        if (modelo->x[meio] <= chave) baixo = meio;
+        else alto = meio;
+    }
+    return modelo->y[baixo] + ((double)chave - (double)modelo->x[baixo]) * modelo->inclinacao[baixo];
+}
+
+/* ================================================================
+ * MOTOR
+ * ================================================================ */
+
+void ordenacao_aprendida(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)elem_size;
+    (void)cmp;
+    (void)contexto;
+    if (n < 2) return;
+
+    int *chaves = arr;
+    long long comparacoes = 0, movimentacoes = 0;
+
+    if (n < LIMIAR_INSERCAO_APRENDIDA) {
+        insercao_inteiros(chaves, n, &comparacoes, &movimentacoes);
+        contador_comparacoes += comparacoes;
+        contador_movimentacoes += movimentacoes;
+        return;
+    }
+
+    int *aux = malloc((size_t)n * sizeof(int));
+    if (!aux) {
+        qsort(chaves, (size_t)n, sizeof(int), comparar_int_simples);  // Sem memória
+        return;
+    }
+
+    // Amostra em passos fixos (determinística); ordenada pelo próprio radix
+    int tamanho_amostra = n / 100;
+    if (tamanho_amostra < AMOSTRA_MINIMA_APRENDIDA) tamanho_amostra = AMOSTRA_MINIMA_APRENDIDA;
+    if (tamanho_amostra > AMOSTRA_MAXIMA_APRENDIDA) tamanho_amostra = AMOSTRA_MAXIMA_APRENDIDA;
+    if (tamanho_amostra > n / 2) tamanho_amostra = n / 2;  // A outra metade de aux é o buffer do radix
+    for (int i = 0; i < tamanho_amostra; i++) {
+        aux[i] = chaves[(long long)i * n / tamanho_amostra];
+    }
+    long long movimentacoes_amostra = 0;  // Custo do modelo, fora das movimentações do array
+    radix_inteiros(aux, tamanho_amostra, aux + tamanho_amostra, &movimentacoes_amostra);
+
+    ModeloCdf modelo;
+    ajustar_modelo(aux, tamanho_amostra, &modelo);
+
+    // Poucas chaves distintas: a CDF tem degraus que nenhum balde separa
+    int usar_modelo = modelo.nos > SEGMENTOS_CDF_APRENDIDA / 2;
+
+    int num_baldes = n / OCUPACAO_BALDE_APRENDIDA;
+    int limite_transbordo = (int)(n * LIMITE_TRANSBORDO_APRENDIDA);
+    int *baldes = NULL;
+    int *ocupacao = NULL;
+    int *transbordo = NULL;
+    if (usar_modelo) {
+        baldes = malloc((size_t)num_baldes * CAPACIDADE_BALDE_APRENDIDA * sizeof(int));
+        ocupacao = calloc((size_t)num_baldes, sizeof(int));
+        transbordo = malloc((size_t)(limite_transbordo + 1) * sizeof(int));
+        usar_modelo = baldes && ocupacao && transbordo;
+    }
+
+    int num_transbordo = 0;
+    for (int i = 0; usar_modelo && i < n; i++) {
+        int chave = chaves[i];
+        int b = (int)(prever_cdf(&modelo, chave) * num_baldes);
+        if (b >= num_baldes) b = num_baldes - 1;
+        if (ocupacao[b] < CAPACIDADE_BALDE_APRENDIDA) {
+            baldes[(size_t)b * CAPACIDADE_BALDE_APRENDIDA + ocupacao[b]++] = chave;
+        } else if (num_transbordo < limite_transbordo) {
+            transbordo[num_transbordo++] = chave;
+        } else {
+            usar_modelo = 0;  // Erro do modelo alto demais: array ainda intacto
+        }
+    }
+
+    if (!usar_modelo) {
+        radix_inteiros(chaves, n, aux, &movimentacoes);
+    } else {
+        // Baldes em ordem; a inserção só corrige a ordem dentro de cada um
+        int m = 0;
+        for (int b = 0; b < num_baldes; b++) {
+            memcpy(chaves + m, baldes + (size_t)b * CAPACIDADE_BALDE_APRENDIDA,
+                   (size_t)ocupacao[b] * sizeof(int));
+            m += ocupacao[b];
+        }
+        movimentacoes += 2LL * m;  // Espalhamento + compactação
+        insercao_inteiros(chaves, m, &comparacoes, &movimentacoes);
+
+        // Transbordo: radix e intercalação de trás para frente, no próprio array
+        if (num_transbordo > 0) {
+            radix_inteiros(transbordo, num_transbordo, aux, &movimentacoes);
+            int i = m - 1, j = num_transbordo - 1, destino = n - 1;
+            while (j >= 0) {
+                if (i >= 0) comparacoes++;
+                chaves[destino--] = (i >= 0 && chaves[i] > transbordo[j]) ? chaves[i--] : transbordo[j--];
+                movimentacoes++;
+            }
+        }
+    }
+
+    free(baldes);
+    free(ocupacao);
+    free(transbordo);
+    free(aux);
+    contador_comparacoes += comparacoes;
+    contador_movimentacoes += movimentacoes;
+}
+
+/* ================================================================
+ * REGISTRO
+ * ================================================================ */
+
+AlgoritmoInfo* obter_info_especializados(void) {
+    static AlgoritmoInfo especializados[NUM_ESPECIALIZADOS] = {
+        {
+            "Learned Sort", "O(n)", "O(n)", "O(n)", CAPACIDADE_SO_INTEIROS,
+            ordenacao_aprendida, NULL, "aprendida", "especializado,aprendida,linear"
+        }
+    };
+    return especializados;
+}
@@ -0,0 +1,178 @@
+/**
+ * ================================================================
+ * BANDA DE MEMÓRIA E ROOFLINE
+ * ================================================================
+ *
+ * @file banda.c
+ * @brief Sonda de cópia/escala e banda atingida pelas ordenações
+ *
+ *  SONDA:
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ Aloca a, b (32 MB)   │ → │ 5× cópia e 5× escala │ → │ GB/s do MELHOR tempo │
+ * │ e toca cada página   │   │ cronometradas        │   │ de cada núcleo       │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * O melhor tempo (não a média) é o que o STREAM reporta: a banda
+ * sustentável é um limite superior, e interrupções só a reduzem.
+ *
+ * Sem memória para 2 × 32 MB, a sonda tenta metades até 2 × 4 MB; com
+ * arrays menores que a LLC ela mediria a cache, então desiste e as
+ * frações do teto ficam indisponíveis ("-").
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <stdatomic.h>  // Para a inicialização única
+
+/* ================================================================
+ * ESTADO DA SONDA
+ * ================================================================ */
+
+/// 0 = não medida, 1 = medindo, 2 = pronta
+static atomic_int estado_banda = 0;
+static BandaMemoria banda_memoria;
+
+/// Impede que o compilador descarte os núcleos
+static volatile double sumidouro_banda;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+typedef void (*NucleoBanda)(double *destino, const double *origem, size_t n);
+
+static void nucleo_copia(double *destino, const double *origem, size_t n);
+static void nucleo_escala(double *destino, const double *origem, size_t n);
+static double medir_nucleo(NucleoBanda nucleo, double *destino, const double *origem, size_t n);
+
+/* ================================================================
+ * NÚCLEOS
+ * ================================================================ */
+
+static void nucleo_copia(double *destino, const double *origem, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        destino[i] = origem[i];
+    }
+}
+
+static void nucleo_escala(double *destino, const double *origem, size_t n) {
+    const double fator = 3.0;  // Mesmo escalar do STREAM
+    for (size_t i = 0; i < n; i++) {
+        destino[i] = fator * origem[i];
+    }
+}
+
+/**
+ * @brief GB/s do melhor de REPETICOES_SONDA_BANDA execuções (16 bytes por elemento)
+ */
+static double medir_nucleo(NucleoBanda nucleo, double *destino, const double *origem, size_t n) {
+    uint64_t melhor = UINT64_MAX;
+    for (int r = 0; r < REPETICOES_SONDA_BANDA; r++) {
+        uint64_t inicio = cronometro_iniciar();
+        nucleo(destino, origem, n);
+        uint64_t fim = cronometro_parar();
+        uint64_t decorrido = cronometro_decorrido(inicio, fim);
+        if (decorrido < melhor) melhor = decorrido;
+        sumidouro_banda += destino[(size_t)r * (n / REPETICOES_SONDA_BANDA)];
+    }
+
+    double segundos = ticks_para_segundos(melhor);
+    return segundos > 0.0 ? 2.0 * sizeof(double) * (double)n / segundos / 1e9 : 0.0;
+}
+
+/* ================================================================
+ * INICIALIZAÇÃO
+ * ================================================================ */
+
+void medir_banda_memoria(void) {
+    int esperado = 0;
+    if (!atomic_compare_exchange_strong(&estado_banda, &esperado, 1)) {
+        // Outra thread medindo (ou já pronta): espera o término
+        while (atomic_load(&estado_banda) != 2) { }
+        return;
+    }
+
+    BandaMemoria banda = {0, 0.0, 0.0, 0.0, 0};
+    double *a = NULL;
+    double *b = NULL;
+    size_t n = ELEMENTOS_SONDA_BANDA;
+
+    for (; n >= ELEMENTOS_MINIMOS_SONDA; n /= 2) {
+        a = malloc(n * sizeof(double));
+        b = malloc(n * sizeof(double));
+        if (a && b) break;
+        free(a);
+        free(b);
+        a = b = NULL;
+    }
+
+    if (a && b) {
+        // Toca cada página: falhas de página não entram na medição
+        for (size_t i = 0; i < n; i++) {
+            a[i] = 1.0;
+            b[i] = 2.0;
+        }
+
+        banda.copia = medir_nucleo(nucleo_copia, b, a, n);
+        banda.escala = medir_nucleo(nucleo_escala, a, b, n);
+        banda.teto = banda.copia > banda.escala ? banda.copia : banda.escala;
+        banda.bytes_array = n * sizeof(double);
+        banda.medida = banda.teto > 0.0;
+    }
+    free(a);
+    free(b);
+
+    banda_memoria = banda;
+    atomic_store_explicit(&estado_banda, 2, memory_order_release);
+}
+
+const BandaMemoria* obter_banda_memoria(void) {
+    if (atomic_load_explicit(&estado_banda, memory_order_acquire) != 2) {
+        medir_banda_memoria();
+    }
+    return &banda_memoria;
+}
+
+/* ================================================================
+ * ROOFLINE
+ * ================================================================ */
+
+double banda_atingida(const ResultadoTempo *resultado) {
+    if (resultado->projetado || resultado->tempo_execucao <= 0.0) return 0.0;
+    long long bytes = resultado->bytes_lidos + resultado->bytes_escritos;
+    if (bytes <= 0) return 0.0;
+    return (double)bytes / resultado->tempo_execucao / 1e9;
+}
+
+double fracao_teto_banda(double gb_por_segundo) {
+    const BandaMemoria *banda = obter_banda_memoria();
+    if (!banda->medida || gb_por_segundo <= 0.0) return 0.0;
+    return gb_por_segundo / banda->teto;
+}
+
+void formatar_banda(double gb_por_segundo, char *buffer, size_t tamanho_buffer) {
+    if (gb_por_segundo <= 0.0) {
+        snprintf(buffer, tamanho_buffer, "-");
+    } else {
+        snprintf(buffer, tamanho_buffer, "%.2f", gb_por_segundo);
+    }
+}
+
+void formatar_fracao_banda(double fracao, char *buffer, size_t tamanho_buffer) {
+    if (fracao <= 0.0) {
+        snprintf(buffer, tamanho_buffer, "-");
+    } else {
+        snprintf(buffer, tamanho_buffer, "%.1f%%%s", fracao * 100.0, fracao > 1.0 ? "*" : "");
+    }
+}
+
+void descrever_banda_memoria(char *buffer, size_t tamanho_buffer) {
+    const BandaMemoria *banda = obter_banda_memoria();
+    if (!banda->medida) {
+        snprintf(buffer, tamanho_buffer, "indisponivel (sem memoria para a sonda)");
+        return;
+    }
+    snprintf(buffer, tamanho_buffer, "copia %.2f GB/s, escala %.2f GB/s, 2 x %zu MB, 1 thread",
+             banda->copia, banda->escala, banda->bytes_array / (1024 * 1024));
+}
@@ -0,0 +1,355 @@
+/**
+ * ================================================================
+ * PESQUISA EM VETORES ORDENADOS - LAYOUTS AMIGÁVEIS À CACHE
+ * ================================================================
+ *
+ * @file busca.c
+ * @brief Construção dos layouts e buscas unitárias e em lote
+ *
+ *  EYTZINGER (n = 10, percurso em ordem preenche a árvore):
+ *
+ *   ordenado:  0  1  2  3  4  5  6  7  8  9
+ *   nos[k]:    k=1 → 6, k=2 → 3, k=3 → 8, k=4 → 1, ...
+ *
+ *                     [1]
+ *               [2]         [3]
+ *            [4]   [5]   [6]   [7]
+ *          [8][9] [10]
+ *
+ * A descida faz k = 2k + (nos[k] < chave); ao sair, os bits 1 finais de
+ * k são as descidas à direita depois do último "maior ou igual", e
+ * removê-los (k >> (ctz(~k) + 1)) devolve esse nó: o limite inferior.
+ *
+ *  ÁRVORE B+ (camadas em um bloco, raiz primeiro):
+ *
+ *   ┌──────────┬───────────────────┬───────────────────────────────────┐
+ *   │ raiz (1) │ camada 1 (m1 nós) │ folhas: vetor ordenado + INT_MAX  │
+ *   └──────────┴───────────────────┴───────────────────────────────────┘
+ *
+ * Em cada nó, "quantas chaves são menores" é o filho seguinte: 4
+ * comparações SSE2 de 4 chaves, empacotadas em uma máscara de 16 bits.
+ * Sem SSE2 o laço escalar equivalente é vetorizado pelo compilador.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <limits.h>  // Para INT_MAX, INT_MIN
+#include <string.h>  // Para memcpy
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define BUSCA_SSE2 1
+#endif
+
+#if defined(_WIN32)
+    #include <malloc.h>  // Para _aligned_malloc
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define PREFETCH_BUSCA(endereco) __builtin_prefetch(endereco)
+#else
+    #define PREFETCH_BUSCA(endereco) ((void)0)
+#endif
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void* alocar_alinhado(size_t bytes);
+static void liberar_alinhado(void *ponteiro);
+static int contar_bits(unsigned mascara);
+static size_t subir_ate_limite(size_t k);
+static int preencher_eytzinger(const int *ordenado, IndiceEytzinger *indice, int i, size_t k);
+static int contar_menores(const int *no, int chave);
+
+/* ================================================================
+ * AUXILIARES
+ * ================================================================ */
+
+static void* alocar_alinhado(size_t bytes) {
+    // aligned_alloc exige tamanho múltiplo do alinhamento
+    bytes = (bytes + ALINHAMENTO_BUSCA - 1) / ALINHAMENTO_BUSCA * ALINHAMENTO_BUSCA;
+#if defined(_WIN32)
+    return _aligned_malloc(bytes, ALINHAMENTO_BUSCA);
+#else
+    return aligned_alloc(ALINHAMENTO_BUSCA, bytes);
+#endif
+}
+
+static void liberar_alinhado(void *ponteiro) {
+#if defined(_WIN32)
+    _aligned_free(ponteiro);
+#else
+    free(ponteiro);
+#endif
+}
+
+static int contar_bits(unsigned mascara) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(mascara);
+#else
+    int bits = 0;
+    for (; mascara; mascara &= mascara - 1) bits++;
+    return bits;
+#endif
+}
+
+/**
+ * @brief Desfaz as descidas à direita finais de uma busca de Eytzinger
+ *
+ * @return Índice do limite inferior em nos[], ou 0 se todas as chaves são menores
+ */
+static size_t subir_ate_limite(size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+    return k >> (__builtin_ctzll(~(unsigned long long)k) + 1);
+#else
+    while (k & 1) k >>= 1;
+    return k >> 1;
+#endif
+}
+
+/* ================================================================
+ * BUSCA BINÁRIA SEM DESVIOS
+ * ================================================================ */
+
+int busca_binaria(const int *ordenado, int n, int chave) {
+    if (n <= 0) return 0;
+
+    const int *base = ordenado;
+    int restante = n;
+    while (restante > 1) {
+        int metade = restante / 2;
+        int proxima = (restante - metade) / 2;  // Metade do passo seguinte
+        PREFETCH_BUSCA(base + proxima - 1);
+        PREFETCH_BUSCA(base + metade + proxima - 1);
+        // Aritmética em vez de ?: (que o GCC compila como desvio): setl + imul
+        base += (size_t)(base[metade - 1] < chave) * (size_t)metade;
+        restante -= metade;
+    }
+    return (int)(base - ordenado) + (*base < chave);
+}
+
+void busca_binaria_lote(const int *ordenado, int n, const int *consultas, int num_consultas,
+                        int *resultados) {
+    if (n <= 0) {
+        for (int i = 0; i < num_consultas; i++) resultados[i] = 0;
+        return;
+    }
+
+    for (int inicio = 0; inicio < num_consultas; inicio += LOTE_BUSCA) {
+        int tamanho_lote = num_consultas - inicio < LOTE_BUSCA ? num_consultas - inicio : LOTE_BUSCA;
+        const int *chaves = consultas + inicio;
+        const int *base[LOTE_BUSCA];
+        for (int q = 0; q < tamanho_lote; q++) base[q] = ordenado;
+
+        // Todas as consultas percorrem a mesma sequência de metades
+        int restante = n;
+        while (restante > 1) {
+            int metade = restante / 2;
+            for (int q = 0; q < tamanho_lote; q++) PREFETCH_BUSCA(base[q] + metade - 1);
+            for (int q = 0; q < tamanho_lote; q++) {
+                base[q] += (size_t)(base[q][metade - 1] < chaves[q]) * (size_t)metade;
+            }
+            restante -= metade;
+        }
+        for (int q = 0; q < tamanho_lote; q++) {
+            resultados[inicio + q] = (int)(base[q] - ordenado) + (*base[q] < chaves[q]);
+        }
+    }
+}
+
+/* ================================================================
+ * LAYOUT DE EYTZINGER
+ * ================================================================ */
+
+/**
+ * @brief Percurso em ordem da árvore implícita: o i-ésimo nó visitado recebe ordenado[i]
+ */
+static int preencher_eytzinger(const int *ordenado, IndiceEytzinger *indice, int i, size_t k) {
+    if (k > (size_t)indice->n) return i;
+    i = preencher_eytzinger(ordenado, indice, i, 2 * k);
+    indice->nos[k] = ordenado[i];
+    indice->posicoes[k] = i;
+    i++;
+    return preencher_eytzinger(ordenado, indice, i, 2 * k + 1);
+}
+
+int construir_eytzinger(IndiceEytzinger *indice, const int *ordenado, int n) {
+    indice->n = 0;
+    indice->nos = NULL;
+    indice->posicoes = NULL;
+    if (n < 0) return -1;
+
+    indice->nos = alocar_alinhado(((size_t)n + 1) * sizeof(int));
+    indice->posicoes = malloc(((size_t)n + 1) * sizeof(int));
+    if (!indice->nos || !indice->posicoes) {
+        liberar_eytzinger(indice);
+        return -1;
+    }
+    indice->n = n;
+    indice->nos[0] = INT_MAX;  // Não usado: a raiz é nos[1]
+    indice->posicoes[0] = n;   // subir_ate_limite devolve 0 quando não há limite inferior
+    preencher_eytzinger(ordenado, indice, 0, 1);
+    return 0;
+}
+
+int buscar_eytzinger(const IndiceEytzinger *indice, int chave) {
+    const int *nos = indice->nos;
+    size_t n = (size_t)indice->n;
+    size_t k = 1;
+    while (k <= n) {
+        // nos[16k .. 16k+15] (4 níveis abaixo) ocupam uma linha de cache
+        PREFETCH_BUSCA(nos + 16 * k);
+        k = 2 * k + (nos[k] < chave);
+    }
+    return indice->posicoes[subir_ate_limite(k)];
+}
+
+void buscar_eytzinger_lote(const IndiceEytzinger *indice, const int *consultas, int num_consultas,
+                           int *resultados) {
+    const int *nos = indice->nos;
+    size_t n = (size_t)indice->n;
+
+    // Níveis completos: todas as consultas descem por eles
+    int niveis_completos = 0;
+    while (((size_t)2 << niveis_completos) - 1 <= n) niveis_completos++;
+
+    for (int inicio = 0; inicio < num_consultas; inicio += LOTE_BUSCA) {
+        int tamanho_lote = num_consultas - inicio < LOTE_BUSCA ? num_consultas - inicio : LOTE_BUSCA;
+        const int *chaves = consultas + inicio;
+        size_t k[LOTE_BUSCA];
+        for (int q = 0; q < tamanho_lote; q++) k[q] = 1;
+
+        for (int nivel = 0; nivel < niveis_completos; nivel++) {
+            for (int q = 0; q < tamanho_lote; q++) PREFETCH_BUSCA(nos + 16 * k[q]);
+            for (int q = 0; q < tamanho_lote; q++) k[q] = 2 * k[q] + (nos[k[q]] < chaves[q]);
+        }
+        for (int q = 0; q < tamanho_lote; q++) {
+            if (k[q] <= n) k[q] = 2 * k[q] + (nos[k[q]] < chaves[q]);  // Último nível, incompleto
+            resultados[inicio + q] = indice->posicoes[subir_ate_limite(k[q])];
+        }
+    }
+}
+
+void liberar_eytzinger(IndiceEytzinger *indice) {
+    if (!indice) return;
+    liberar_alinhado(indice->nos);
+    free(indice->posicoes);
+    indice->nos = NULL;
+    indice->posicoes = NULL;
+    indice->n = 0;
+}
+
+/* ================================================================
+ * ÁRVORE B+ ESTÁTICA
+ * ================================================================ */
+
+/**
+ * @brief Quantas das 16 chaves (crescentes) do nó são menores que `chave`
+ */
+static int contar_menores(const int *no, int chave) {
+#ifdef BUSCA_SSE2
+    __m128i x = _mm_set1_epi32(chave);
+    __m128i a = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)no));
+    __m128i b = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(no + 4)));
+    __m128i c = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(no + 8)));
+    __m128i d = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(no + 12)));
+    // 4 × 4 máscaras de 32 bits → 16 bytes → 16 bits
+    __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+    return contar_bits((unsigned)_mm_movemask_epi8(bytes));
+#else
+    int menores = 0;
+    for (int j = 0; j < CHAVES_NO_ARVORE_B; j++) menores += no[j] < chave;
+    return menores;
+#endif
+}
+
+int construir_arvore_b(IndiceArvoreB *indice, const int *ordenado, int n) {
+    memset(indice, 0, sizeof(*indice));
+    if (n < 0) return -1;
+
+    // Nós por camada, das folhas para a raiz
+    size_t nos_camada[8];
+    int camadas = 0;
+    nos_camada[camadas++] = n > 0 ? ((size_t)n + CHAVES_NO_ARVORE_B - 1) / CHAVES_NO_ARVORE_B : 1;
+    while (nos_camada[camadas - 1] > 1) {
+        nos_camada[camadas] = (nos_camada[camadas - 1] + CHAVES_NO_ARVORE_B - 1) / CHAVES_NO_ARVORE_B;
+        camadas++;
+    }
+
+    size_t total = 0;
+    for (int h = camadas - 1; h >= 0; h--) {
+        indice->inicio[h] = (int)total;
+        total += nos_camada[h] * CHAVES_NO_ARVORE_B;
+    }
+    indice->chaves = alocar_alinhado(total * sizeof(int));
+    if (!indice->chaves) return -1;
+    indice->camadas = camadas;
+    indice->maior = n > 0 ? ordenado[n - 1] : INT_MIN;
+    indice->n = n;
+
+    int *folhas = indice->chaves + indice->inicio[0];
+    if (n > 0) memcpy(folhas, ordenado, (size_t)n * sizeof(int));
+    for (size_t i = (size_t)n; i < nos_camada[0] * CHAVES_NO_ARVORE_B; i++) folhas[i] = INT_MAX;
+
+    // Chave j do nó i = maior chave do filho 16i + j = última chave desse filho
+    for (int h = 1; h < camadas; h++) {
+        const int *abaixo = indice->chaves + indice->inicio[h - 1];
+        int *camada = indice->chaves + indice->inicio[h];
+        for (size_t filho = 0; filho < nos_camada[h] * CHAVES_NO_ARVORE_B; filho++) {
+            camada[filho] = filho < nos_camada[h - 1]
+                          ? abaixo[filho * CHAVES_NO_ARVORE_B + CHAVES_NO_ARVORE_B - 1]
+                          : INT_MAX;
+        }
+    }
+    return 0;
+}
+
+int buscar_arvore_b(const IndiceArvoreB *indice, int chave) {
+    if (chave > indice->maior) return indice->n;  // Nenhuma chave >= a procurada
+
+    // Cada filho escolhido é real e tem uma chave >= a procurada
+    const int *chaves = indice->chaves;
+    size_t i = 0;
+    for (int h = indice->camadas - 1; h >= 0; h--) {
+        i = i * CHAVES_NO_ARVORE_B + (size_t)contar_menores(chaves + indice->inicio[h] + i * CHAVES_NO_ARVORE_B, chave);
+    }
+    return (int)i;
+}
+
+void buscar_arvore_b_lote(const IndiceArvoreB *indice, const int *consultas, int num_consultas,
+                          int *resultados) {
+    const int *chaves = indice->chaves;
+
+    for (int inicio = 0; inicio < num_consultas; inicio += LOTE_BUSCA) {
+        int tamanho_lote = num_consultas - inicio < LOTE_BUSCA ? num_consultas - inicio : LOTE_BUSCA;
+        size_t i[LOTE_BUSCA];
+        int chave[LOTE_BUSCA];
+        int alem_do_fim[LOTE_BUSCA];
+
+        for (int q = 0; q < tamanho_lote; q++) {
+            alem_do_fim[q] = consultas[inicio + q] > indice->maior;
+            // Além do fim: desce pela borda esquerda (sempre existe) e o resultado é n
+            chave[q] = alem_do_fim[q] ? INT_MIN : consultas[inicio + q];
+            i[q] = 0;
+        }
+        for (int h = indice->camadas - 1; h >= 0; h--) {
+            const int *camada = chaves + indice->inicio[h];
+            for (int q = 0; q < tamanho_lote; q++) PREFETCH_BUSCA(camada + i[q] * CHAVES_NO_ARVORE_B);
+            for (int q = 0; q < tamanho_lote; q++) {
+                i[q] = i[q] * CHAVES_NO_ARVORE_B +
+                       (size_t)contar_menores(camada + i[q] * CHAVES_NO_ARVORE_B, chave[q]);
+            }
+        }
+        for (int q = 0; q < tamanho_lote; q++) {
+            resultados[inicio + q] = alem_do_fim[q] ? indice->n : (int)i[q];
+        }
+    }
+}
+
+void liberar_arvore_b(IndiceArvoreB *indice) {
+    if (!indice) return;
+    liberar_alinhado(indice->chaves);
+    memset(indice, 0, sizeof(*indice));
+}
@@ -0,0 +1,459 @@
+/**
+ * ================================================================
+ * CACHE DE RESULTADOS E RETOMADA DO RELATÓRIO COMPLETO
+ * ================================================================
+ *
+ * @file cache_resultados.c
+ * @brief Arquivo de células medidas, compactação por build/máquina e Ctrl-C
+ *
+ *  ABERTURA:
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ Procura o arquivo em │ → │ Mantém só as linhas  │ → │ Reescreve (.tmp +    │
+ * │ output/, ../output,  │   │ deste build e desta  │   │ rename) e reabre em  │
+ * │ ../../output         │   │ máquina              │   │ modo append          │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ *  LINHA (separada por tabulações, uma por célula):
+ * ┌──────────────────────────────────────────────────────────────┐
+ * │ build host checksum n elem_size motor variante parametros    │
+ * │ tempo ticks comparacoes trocas movimentacoes bytes_lidos     │
+ * │ bytes_escritos modo_isolamento projetado                     │
+ * └──────────────────────────────────────────────────────────────┘
+ *
+ * Cada linha é descarregada (fflush) ao ser gravada: uma queda perde
+ * no máximo a célula em andamento. Uma célula projetada só é
+ * reaproveitada enquanto seu tempo ainda estoura o orçamento em vigor;
+ * com um orçamento maior ela volta a ser medida. Linhas truncadas não casam com o
+ * formato e são descartadas na próxima abertura.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>    // Para strlen, strcmp, snprintf
+#include <signal.h>    // Para signal, raise, sig_atomic_t
+#include <inttypes.h>  // Para PRIx64, SCNx64
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>  // Para gethostname
+    #define SORTS_TEM_GETHOSTNAME 1
+#endif
+
+/* ================================================================
+ * CONSTANTES INTERNAS
+ * ================================================================ */
+
+#define TAMANHO_LINHA_CACHE 512
+#define TAMANHO_HOST_CACHE 64
+#define TAMANHO_VARIANTE_CACHE 12
+
+
+/* ================================================================
+ * ESTRUTURAS E ESTADO
+ * ================================================================ */
+
+/**
+ * @brief Uma célula medida: chave e valores reaproveitáveis
+ */
+typedef struct {
+    uint64_t checksum;
+    int tamanho;
+    unsigned long elem_size;
+    char motor[16];
+    char variante[TAMANHO_VARIANTE_CACHE];
+    uint64_t parametros;
+    double tempo;
+    unsigned long long ticks;
+    long long comparacoes;
+    long long trocas;
+    long long movimentacoes;
+    long long bytes_lidos;
+    long long bytes_escritos;
+    unsigned modo_isolamento;
+    int projetado;
+} EntradaCache;
+
+static EntradaCache *entradas = NULL;
+static int num_entradas = 0;
+static int capacidade_entradas = 0;
+
+static FILE *arquivo_cache = NULL;
+static char caminho_cache[MAX_PATH];
+static uint64_t build_atual = 0;
+static char host_atual[TAMANHO_HOST_CACHE];
+
+static int celulas_reaproveitadas = 0;
+static int celulas_gravadas = 0;
+
+static volatile sig_atomic_t pedido_parada = 0;
+static void (*tratador_anterior)(int) = SIG_DFL;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static uint64_t identificar_build(void);
+static void identificar_host(char *buffer, size_t tamanho_buffer);
+static uint64_t identificar_isolamento(void);
+static int variante_motor(const AlgoritmoInfo *info, char *variante, uint64_t *parametros);
+static EntradaCache* procurar_entrada(uint64_t checksum, int tamanho, size_t elem_size,
+                                      const char *motor, const char *variante, uint64_t parametros);
+static int acrescentar_entrada(const EntradaCache *entrada);
+static void escrever_entrada(FILE *arquivo, const EntradaCache *entrada);
+static int ler_entradas(FILE *arquivo, int *descartadas);
+static void tratar_sigint(int sinal);
+
+/* ================================================================
+ * IDENTIDADE: DADOS, BUILD E MÁQUINA
+ * ================================================================ */
+
+/**
+ * @brief Hash do próprio executável; sem /proc, a data de compilação
+ *
+ * Qualquer recompilação que mude o código gerado muda o hash e
+ * invalida o cache inteiro: tempos de outro binário não são comparáveis.
+ */
+static uint64_t identificar_build(void) {
+    uint64_t hash = CHECKSUM_DADOS_INICIAL;
+    FILE *executavel = fopen("/proc/self/exe", "rb");
+    if (executavel) {
+        unsigned char bloco[65536];
+        size_t lidos;
+        while ((lidos = fread(bloco, 1, sizeof(bloco), executavel)) > 0) {
+            hash = continuar_checksum_dados(hash, bloco, lidos);
+        }
+        fclose(executavel);
+        return hash;
+    }
+
+    static const char carimbo[] = __DATE__ " " __TIME__;
+    return continuar_checksum_dados(hash, carimbo, sizeof(carimbo) - 1);
+}
+
+static void identificar_host(char *buffer, size_t tamanho_buffer) {
+    buffer[0] = '\0';
+#ifdef SORTS_TEM_GETHOSTNAME
+    if (gethostname(buffer, tamanho_buffer) != 0) buffer[0] = '\0';
+    buffer[tamanho_buffer - 1] = '\0';
+#else
+    const char *nome = getenv("COMPUTERNAME");
+    if (nome) snprintf(buffer, tamanho_buffer, "%s", nome);
+#endif
+    if (buffer[0] == '\0') snprintf(buffer, tamanho_buffer, "desconhecido");
+
+    // O arquivo é separado por espaços em branco
+    for (char *p = buffer; *p; p++) {
+        if (*p == ' ' || *p == '\t') *p = '_';
+    }
+}
+
+/**
+ * @brief Hash da configuração de isolamento (fixação, pré-falha, mlock, cache)
+ *
+ * Campo a campo, sem o preenchimento da struct; a CPU alvo só conta com
+ * a fixação ligada.
+ */
+static uint64_t identificar_isolamento(void) {
+    const ConfiguracaoIsolamento *isolamento = obter_isolamento();
+    int campos[5] = {
+        isolamento->fixar_cpu, isolamento->fixar_cpu ? isolamento->cpu : -1,
+        isolamento->pre_falhar, isolamento->travar_memoria, (int)isolamento->modo_cache
+    };
+    return checksum_dados(campos, sizeof(campos));
+}
+
+/**
+ * @brief Variante da célula e hash dos parâmetros que a afetam
+ *
+ * O isolamento muda o tempo de todo motor e entra em todas as variantes;
+ * os parâmetros do autoajuste, só na otimizada.
+ *
+ * @return 0 se o motor não é cacheado (plugin)
+ */
+static int variante_motor(const AlgoritmoInfo *info, char *variante, uint64_t *parametros) {
+    if (eh_plugin(info)) return 0;  // Código fora do executável: o build não o identifica
+
+    *parametros = identificar_isolamento();
+    if (eh_referencia(info)) {
+        snprintf(variante, TAMANHO_VARIANTE_CACHE, "libc");  // Ignora a versão em vigor
+    } else if (indice_motor(info) >= NUM_ALGORITMOS) {
+        snprintf(variante, TAMANHO_VARIANTE_CACHE, "unica");  // Especializado: sem versões nem parâmetros
+    } else if (usar_versao_otimizada) {
+        char descricao[128];
+        descrever_parametros_motores(obter_parametros_motores(), descricao, sizeof(descricao));
+        *parametros = continuar_checksum_dados(*parametros, descricao, strlen(descricao));
+        snprintf(variante, TAMANHO_VARIANTE_CACHE, "otimizada");
+    } else {
+        snprintf(variante, TAMANHO_VARIANTE_CACHE, "didatica");
+    }
+    return 1;
+}
+
+/* ================================================================
+ * TABELA EM MEMÓRIA
+ * ================================================================ */
+
+static EntradaCache* procurar_entrada(uint64_t checksum, int tamanho, size_t elem_size,
+                                      const char *motor, const char *variante, uint64_t parametros) {
+    // Da mais recente para a mais antiga: uma remedição prevalece
+    for (int i = num_entradas - 1; i >= 0; i--) {
+        EntradaCache *e = &entradas[i];
+        if (e->checksum == checksum && e->tamanho == tamanho &&
+            e->elem_size == (unsigned long)elem_size && e->parametros == parametros &&
+            strcmp(e->motor, motor) == 0 && strcmp(e->variante, variante) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static int acrescentar_entrada(const EntradaCache *entrada) {
+    EntradaCache *existente = procurar_entrada(entrada->checksum, entrada->tamanho,
+                                               entrada->elem_size, entrada->motor,
+                                               entrada->variante, entrada->parametros);
+    if (existente) {
+        *existente = *entrada;
+        return 0;
+    }
+
+    if (num_entradas == capacidade_entradas) {
+        int nova = capacidade_entradas ? capacidade_entradas * 2 : 64;
+        EntradaCache *maior = realloc(entradas, (size_t)nova * sizeof(EntradaCache));
+        if (!maior) return -1;
+        entradas = maior;
+        capacidade_entradas = nova;
+    }
+    entradas[num_entradas++] = *entrada;
+    return 0;
+}
+
+/* ================================================================
+ * ARQUIVO
+ * ================================================================ */
+
+static void escrever_entrada(FILE *arquivo, const EntradaCache *e) {
+    fprintf(arquivo, "%016" PRIx64 "\t%s\t%016" PRIx64 "\t%d\t%lu\t%s\t%s\t%016" PRIx64
+                     "\t%.17g\t%llu\t%lld\t%lld\t%lld\t%lld\t%lld\t%u\t%d\n",
+            build_atual, host_atual, e->checksum, e->tamanho, e->elem_size,
+            e->motor, e->variante, e->parametros,
+            e->tempo, e->ticks, e->comparacoes, e->trocas, e->movimentacoes,
+            e->bytes_lidos, e->bytes_escritos, e->modo_isolamento, e->projetado);
+}
+
+/**
+ * @brief Carrega as linhas deste build e desta máquina
+ *
+ * @return Entradas mantidas (ou -1 se faltar memória)
+ */
+static int ler_entradas(FILE *arquivo, int *descartadas) {
+    char linha[TAMANHO_LINHA_CACHE];
+    int versao_ok = 0;
+    *descartadas = 0;
+
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (linha[0] == '#') {
+            int versao;
+            if (sscanf(linha, "# cache_resultados versao %d", &versao) == 1) {
+                versao_ok = versao == VERSAO_CACHE_RESULTADOS;
+            }
+            continue;
+        }
+        if (linha[0] == '\n' || linha[0] == '\0') continue;
+
+        EntradaCache e;
+        uint64_t build;
+        char host[TAMANHO_HOST_CACHE];
+        int campos = sscanf(linha, "%" SCNx64 " %63s %" SCNx64 " %d %lu %15s %11s %" SCNx64
+                                   " %lf %llu %lld %lld %lld %lld %lld %u %d",
+                            &build, host, &e.checksum, &e.tamanho, &e.elem_size,
+                            e.motor, e.variante, &e.parametros,
+                            &e.tempo, &e.ticks, &e.comparacoes, &e.trocas, &e.movimentacoes,
+                            &e.bytes_lidos, &e.bytes_escritos, &e.modo_isolamento, &e.projetado);
+
+        // Linha truncada por uma queda, outra versão do formato, outro build ou máquina
+        if (!versao_ok || campos != 17 || linha[strlen(linha) - 1] != '\n' ||
+            build != build_atual || strcmp(host, host_atual) != 0) {
+            (*descartadas)++;
+            continue;
+        }
+        if (acrescentar_entrada(&e) < 0) return -1;
+    }
+    return num_entradas;
+}
+
+int abrir_cache_resultados(void) {
+    if (arquivo_cache) return num_entradas;
+
+    const char *desligado = getenv(VARIAVEL_AMBIENTE_SEM_CACHE);
+    if (desligado && desligado[0] != '\0' && strcmp(desligado, "0") != 0) {
+        printf("Cache de resultados desligado (%s)\n", VARIAVEL_AMBIENTE_SEM_CACHE);
+        return -1;
+    }
+
+    build_atual = identificar_build();
+    identificar_host(host_atual, sizeof(host_atual));
+    num_entradas = 0;
+    celulas_reaproveitadas = 0;
+    celulas_gravadas = 0;
+
+    // Arquivo existente: o primeiro encontrado; senão, o primeiro local gravável
+    const char *caminhos_base[] = {"output", "../output", "../../output"};
+    int descartadas = 0;
+    caminho_cache[0] = '\0';
+    for (int i = 0; i < 3; i++) {
+        char caminho[MAX_PATH];
+        snprintf(caminho, sizeof(caminho), "%s/%s", caminhos_base[i], ARQUIVO_CACHE_RESULTADOS);
+        FILE *existente = fopen(caminho, "r");
+        if (!existente) continue;
+
+        int lidas = ler_entradas(existente, &descartadas);
+        fclose(existente);
+        if (lidas < 0) {
+            printf("AVISO: Memoria insuficiente para o cache de resultados\n");
+            num_entradas = 0;
+            return -1;
+        }
+        snprintf(caminho_cache, sizeof(caminho_cache), "%s", caminho);
+        break;
+    }
+
+    // Compacta: reescreve só o que vale e troca o arquivo de uma vez
+    for (int i = 0; i < 3 && !arquivo_cache; i++) {
+        char caminho[MAX_PATH];
+        char temporario[MAX_PATH + 4];
+        if (caminho_cache[0] != '\0') {
+            snprintf(caminho, sizeof(caminho), "%s", caminho_cache);
+            i = 3;  // Não muda de lugar um arquivo existente
+        } else {
+            snprintf(caminho, sizeof(caminho), "%s/%s", caminhos_base[i], ARQUIVO_CACHE_RESULTADOS);
+        }
+        snprintf(temporario, sizeof(temporario), "%s.tmp", caminho);
+
+        FILE *novo = fopen(temporario, "w");
+        if (!novo) continue;
+        fprintf(novo, "# cache_resultados versao %d\n", VERSAO_CACHE_RESULTADOS);
+        for (int j = 0; j < num_entradas; j++) escrever_entrada(novo, &entradas[j]);
+        int falhou = fclose(novo) != 0;
+
+        remove(caminho);  // rename() no Windows não sobrescreve
+        if (falhou || rename(temporario, caminho) != 0) {
+            remove(temporario);
+            continue;
+        }
+        arquivo_cache = fopen(caminho, "a");
+        if (arquivo_cache) snprintf(caminho_cache, sizeof(caminho_cache), "%s", caminho);
+    }
+
+    if (!arquivo_cache) {
+        printf("AVISO: Nao foi possivel abrir %s; medindo sem cache\n", ARQUIVO_CACHE_RESULTADOS);
+        num_entradas = 0;
+        return -1;
+    }
+
+    printf("Cache de resultados: %s (%d celula(s) validas", caminho_cache, num_entradas);
+    if (descartadas > 0) printf(", %d de outro build/maquina descartada(s)", descartadas);
+    printf(")\n");
+    return num_entradas;
+}
+
+void fechar_cache_resultados(void) {
+    if (!arquivo_cache) return;
+    fclose(arquivo_cache);
+    arquivo_cache = NULL;
+
+    printf("Cache de resultados: %d celula(s) reaproveitada(s), %d medida(s) e gravada(s)\n",
+           celulas_reaproveitadas, celulas_gravadas);
+
+    free(entradas);
+    entradas = NULL;
+    num_entradas = 0;
+    capacidade_entradas = 0;
+}
+
+int cache_resultados_ativo(void) {
+    return arquivo_cache != NULL;
+}
+
+/* ================================================================
+ * BUSCA E GRAVAÇÃO
+ * ================================================================ */
+
+int buscar_resultado_cache(const AlgoritmoInfo *info, uint64_t checksum, int tamanho,
+                           size_t elem_size, ResultadoTempo *destino) {
+    char variante[TAMANHO_VARIANTE_CACHE];
+    uint64_t parametros;
+    if (!arquivo_cache || !variante_motor(info, variante, &parametros)) return 0;
+
+    const EntradaCache *e = procurar_entrada(checksum, tamanho, elem_size, info->id,
+                                             variante, parametros);
+    if (!e) return 0;
+    if (e->projetado && e->tempo <= obter_orcamento_tempo()) return 0;  // Orçamento cresceu: medir
+
+    destino->tempo_execucao = e->tempo;
+    destino->ticks = e->ticks;
+    destino->comparacoes = e->comparacoes;
+    destino->trocas = e->trocas;
+    destino->movimentacoes = e->movimentacoes;
+    destino->bytes_lidos = e->bytes_lidos;
+    destino->bytes_escritos = e->bytes_escritos;
+    destino->modo_isolamento = e->modo_isolamento;
+    destino->projetado = e->projetado;
+    celulas_reaproveitadas++;
+    return 1;
+}
+
+void gravar_resultado_cache(const AlgoritmoInfo *info, uint64_t checksum, int tamanho,
+                            size_t elem_size, const ResultadoTempo *resultado) {
+    EntradaCache e;
+    if (!arquivo_cache) return;
+    if (!variante_motor(info, e.variante, &e.parametros)) return;
+
+    e.checksum = checksum;
+    e.tamanho = tamanho;
+    e.elem_size = (unsigned long)elem_size;
+    snprintf(e.motor, sizeof(e.motor), "%s", info->id);
+    e.tempo = resultado->tempo_execucao;
+    e.ticks = resultado->ticks;
+    e.comparacoes = resultado->comparacoes;
+    e.trocas = resultado->trocas;
+    e.movimentacoes = resultado->movimentacoes;
+    e.bytes_lidos = resultado->bytes_lidos;
+    e.bytes_escritos = resultado->bytes_escritos;
+    e.modo_isolamento = resultado->modo_isolamento;
+    e.projetado = resultado->projetado;
+
+    acrescentar_entrada(&e);
+    escrever_entrada(arquivo_cache, &e);
+    fflush(arquivo_cache);  // Ponto de retomada: a célula sobrevive a uma queda
+    celulas_gravadas++;
+}
+
+/* ================================================================
+ * INTERRUPÇÃO (CTRL-C)
+ * ================================================================ */
+
+static void tratar_sigint(int sinal) {
+    if (pedido_parada) {
+        // Segundo Ctrl-C: encerra já (o cache tem tudo até a última célula)
+        signal(sinal, SIG_DFL);
+        raise(sinal);
+        return;
+    }
+    pedido_parada = 1;
+    signal(sinal, tratar_sigint);  // Semântica System V desarma o tratador
+}
+
+void instalar_interrupcao_relatorio(void) {
+    pedido_parada = 0;
+    tratador_anterior = signal(SIGINT, tratar_sigint);
+    if (tratador_anterior == SIG_ERR) tratador_anterior = SIG_DFL;
+}
+
+void restaurar_interrupcao_relatorio(void) {
+    signal(SIGINT, tratador_anterior);
+    pedido_parada = 0;
+}
+
+int relatorio_interrompido(void) {
+    return pedido_parada != 0;
+}
@@ -0,0 +1,211 @@
+/**
+ * ================================================================
+ * REGISTRO DE CONJUNTOS DE DADOS E POOL DE BUFFERS
+ * ================================================================
+ *
+ * @file conjuntos.c
+ * @brief Carga única dos arquivos de entrada e reaproveitamento de cópias
+ *
+ *  POOL (NUM_BUFFERS_POOL vagas):
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ emprestar(bytes):    │ → │ Senão, a maior vaga  │ → │ Todas ocupadas:      │
+ * │ menor vaga livre que │   │ livre cresce até     │   │ malloc avulso (free  │
+ * │ já comporta `bytes`  │   │ `bytes`              │   │ na devolução)        │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * As vagas só crescem: depois da primeira passada pelos conjuntos, o
+ * maior tamanho já está reservado e as medições seguintes não alocam.
+ * Uma trava de espera ocupada protege a tabela; a seção crítica é uma
+ * varredura de NUM_BUFFERS_POOL vagas.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>     // Para snprintf, memset
+#include <stdatomic.h>  // Para a inicialização única e a trava do pool
+
+/* ================================================================
+ * ESTADO
+ * ================================================================ */
+
+/// 0 = vazio, 1 = carregando, 2 = carregado
+static atomic_int estado_conjuntos = 0;
+
+static ConjuntoDados conjuntos[MAX_CONJUNTOS_DADOS];
+static int total_conjuntos = 0;
+
+/**
+ * @brief Uma vaga do pool de buffers de trabalho
+ */
+typedef struct {
+    void *buffer;
+    size_t capacidade;
+    int emprestado;
+} VagaPool;
+
+static VagaPool pool[NUM_BUFFERS_POOL];
+static atomic_flag trava_pool = ATOMIC_FLAG_INIT;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void adicionar_conjunto(const char *nome, const char *tipo_dados, void *dados,
+                               int tamanho, size_t elem_size, CompareFn cmp,
+                               const EstatisticasCarga *carga);
+static void travar_pool(void);
+static void destravar_pool(void);
+
+/* ================================================================
+ * CARGA DOS CONJUNTOS
+ * ================================================================ */
+
+static void adicionar_conjunto(const char *nome, const char *tipo_dados, void *dados,
+                               int tamanho, size_t elem_size, CompareFn cmp,
+                               const EstatisticasCarga *carga) {
+    if (total_conjuntos >= MAX_CONJUNTOS_DADOS) {
+        printf("AVISO: Registro de conjuntos cheio; %s ignorado\n", nome);
+        free(dados);
+        return;
+    }
+
+    ConjuntoDados *c = &conjuntos[total_conjuntos++];
+    snprintf(c->nome, sizeof(c->nome), "%s", nome);
+    snprintf(c->tipo_dados, sizeof(c->tipo_dados), "%s", tipo_dados);
+    extrair_categoria_dados(nome, c->categoria, sizeof(c->categoria));
+    c->dados = dados;
+    c->tamanho = tamanho;
+    c->elem_size = elem_size;
+    c->cmp = cmp;
+
+    // Só dependem dos bytes: calculados aqui, uma vez, para todas as fases
+    if (carga) {
+        c->carga = *carga;
+        c->checksum = carga->checksum;  // Já calculado na leitura
+    } else {
+        memset(&c->carga, 0, sizeof(c->carga));
+        c->checksum = checksum_dados(dados, (size_t)tamanho * elem_size);
+    }
+    if (carga && carga->calculadas && elem_size == sizeof(int) && cmp == comparar_inteiros) {
+        // Corridas e faixa já vieram da leitura (ler_numeros_com_estatisticas)
+        calcular_metricas_desordem_carga(dados, tamanho, carga, &c->desordem);
+    } else {
+        calcular_metricas_desordem(dados, tamanho, elem_size, cmp, &c->desordem);
+    }
+}
+
+int carregar_conjuntos_dados(void) {
+    if (atomic_load_explicit(&estado_conjuntos, memory_order_acquire) == 2) return total_conjuntos;
+
+    int esperado = 0;
+    if (!atomic_compare_exchange_strong(&estado_conjuntos, &esperado, 1)) {
+        // Outra thread carregando: espera o término
+        while (atomic_load(&estado_conjuntos) != 2) { }
+        return total_conjuntos;
+    }
+
+    int num_arquivos;
+    const char* const* arquivos = obter_arquivos_numeros(&num_arquivos);
+    for (int i = 0; i < num_arquivos; i++) {
+        int tamanho;
+        EstatisticasCarga carga;
+        int *dados = ler_numeros_com_estatisticas(arquivos[i], &tamanho, &carga);
+        if (!dados) {
+            printf("AVISO: Nao foi possivel carregar %s\n", arquivos[i]);
+            continue;
+        }
+        adicionar_conjunto(arquivos[i], "numeros", dados, tamanho, sizeof(int),
+                           comparar_inteiros, &carga);
+    }
+
+    int tamanho_alunos;
+    Aluno *alunos = ler_alunos(ARQUIVO_ALUNOS, &tamanho_alunos);
+    if (alunos) {
+        adicionar_conjunto(ARQUIVO_ALUNOS, "alunos", alunos, tamanho_alunos,
+                           sizeof(Aluno), comparar_alunos, NULL);
+    } else {
+        printf("AVISO: Nao foi possivel carregar %s\n", ARQUIVO_ALUNOS);
+    }
+
+    printf("Conjuntos carregados: %d (uma leitura por arquivo)\n", total_conjuntos);
+    atomic_store_explicit(&estado_conjuntos, 2, memory_order_release);
+    return total_conjuntos;
+}
+
+const ConjuntoDados* obter_conjunto_dados(int indice) {
+    if (indice < 0 || indice >= total_conjuntos) return NULL;
+    return &conjuntos[indice];
+}
+
+const ConjuntoDados* conjunto_da_visao(const void *dados) {
+    if (atomic_load_explicit(&estado_conjuntos, memory_order_acquire) != 2) return NULL;
+    for (int i = 0; i < total_conjuntos; i++) {
+        if (conjuntos[i].dados == dados) return &conjuntos[i];
+    }
+    return NULL;
+}
+
+/* ================================================================
+ * POOL DE BUFFERS DE TRABALHO
+ * ================================================================ */
+
+static void travar_pool(void) {
+    while (atomic_flag_test_and_set_explicit(&trava_pool, memory_order_acquire)) { }
+}
+
+static void destravar_pool(void) {
+    atomic_flag_clear_explicit(&trava_pool, memory_order_release);
+}
+
+void* emprestar_buffer_trabalho(size_t bytes) {
+    if (bytes == 0) bytes = 1;
+
+    travar_pool();
+    int melhor = -1;   // Menor vaga livre que já comporta
+    int maior = -1;    // Maior vaga livre (cresce se nenhuma comporta)
+    for (int i = 0; i < NUM_BUFFERS_POOL; i++) {
+        if (pool[i].emprestado) continue;
+        if (pool[i].capacidade >= bytes &&
+            (melhor < 0 || pool[i].capacidade < pool[melhor].capacidade)) {
+            melhor = i;
+        }
+        if (maior < 0 || pool[i].capacidade > pool[maior].capacidade) maior = i;
+    }
+    int escolhida = melhor >= 0 ? melhor : maior;
+    if (escolhida >= 0) pool[escolhida].emprestado = 1;
+    destravar_pool();
+
+    if (METRICAS_HABILITADAS()) metricas_registrar_emprestimo(melhor < 0);
+    if (escolhida < 0) return malloc(bytes);  // Pool esgotado: avulso
+    if (melhor >= 0) return pool[escolhida].buffer;
+
+    // Crescimento: aloca fora da trava (a vaga já está reservada) e troca dentro dela
+    void *novo = malloc(bytes);
+    travar_pool();
+    void *antigo = novo ? pool[escolhida].buffer : NULL;
+    if (novo) {
+        pool[escolhida].buffer = novo;
+        pool[escolhida].capacidade = bytes;
+    } else {
+        pool[escolhida].emprestado = 0;
+    }
+    destravar_pool();
+    free(antigo);
+    return novo;
+}
+
+void devolver_buffer_trabalho(void *buffer) {
+    if (!buffer) return;
+
+    travar_pool();
+    for (int i = 0; i < NUM_BUFFERS_POOL; i++) {
+        if (pool[i].emprestado && pool[i].buffer == buffer) {
+            pool[i].emprestado = 0;
+            destravar_pool();
+            return;
+        }
+    }
+    destravar_pool();
+    free(buffer);  // Emprestado avulso
+}
@@ -0,0 +1,509 @@
+/**
+ * ================================================================
+ * VAZÃO SOB CONTENÇÃO
+ * ================================================================
+ *
+ * @file contencao.c
+ * @brief Threads fixadas ordenando arrays próprios durante uma janela fixa
+ *
+ *  UM PONTO (motor, T):
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ Cria T threads; cada │ → │ Largada: a principal │ → │ Cada thread repete   │
+ * │ uma fixa, gera o seu │   │ espera as T prontas  │   │ copia → ordena até a │
+ * │ array e aquece       │   │ e libera todas       │   │ janela se esgotar    │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *                                                                 ↓
+ *            ┌─────────────────────────────────────────────────────────┐
+ *            │ Junta as latências, calcula vazão, eficiência e         │
+ *            │ lentidão contra o ponto T = 1 do mesmo motor            │
+ *            └─────────────────────────────────────────────────────────┘
+ *
+ *  LARGADA:
+ * Uma barreira pthread travaria para sempre se a criação de uma thread
+ * falhasse. A largada usa dois atômicos: as threads contam-se prontas e
+ * esperam o sinal; a principal só dá o sinal quando todas as criadas
+ * estão prontas, ou sinaliza cancelamento se alguma criação falhou.
+ *
+ *  O QUE É MEDIDO:
+ * A latência é só a ordenação (cronômetro com overhead descontado); a
+ * vazão inclui a cópia de reposição, como um serviço que recebe dados
+ * novos a cada requisição.
+ *
+ * ================================================================
+ */
+
+#if defined(__linux__)
+    #define _GNU_SOURCE      // Para sched_yield
+    #include <sched.h>
+    #include <pthread.h>
+#endif
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>     // Para memcpy e memset
+#include <stdatomic.h>  // Para a largada sem barreira
+
+/* ================================================================
+ * CONSTANTES INTERNAS
+ * ================================================================ */
+
+/// Sinais da largada
+#define LARGADA_ESPERANDO 0
+#define LARGADA_LIBERADA 1
+#define LARGADA_CANCELADA 2
+
+/// Motores com expoente médio a partir daqui ficam fora (O(n²))
+#define EXPOENTE_MAXIMO_CONTENCAO 1.5
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+/// Sincronização de um ponto
+typedef struct {
+    atomic_int prontas;
+    atomic_int sinal;
+} Largada;
+
+/// Argumento e saída de cada thread
+typedef struct {
+    const AlgoritmoInfo *info;
+    const ConfiguracaoContencao *config;
+    Largada *largada;
+    int indice;
+    int cpu;
+    uint64_t *amostras;       ///< MAX_AMOSTRAS_THREAD_CONTENCAO posições
+    int num_amostras;
+    long long ordenacoes;
+    uint64_t soma_ticks;
+    uint64_t janela_ticks;
+    int falhou;
+} ContextoContencao;
+
+static int montar_contagens(int max_threads, int *contagens);
+static void* trabalhador_contencao(void *arg);
+static int executar_threads(ContextoContencao *contextos, int threads);
+static int medir_ponto(const AlgoritmoInfo *info, int threads, const ResultadoContencao *resultado,
+                       uint64_t *amostras, PontoContencao *ponto, const PontoContencao *isolado);
+static void imprimir_resumo_contencao(const ResultadoContencao *resultado);
+static void escrever_contencao_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_contencao_csv_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+ConfiguracaoContencao configuracao_contencao_padrao(void) {
+    ConfiguracaoContencao config;
+    config.tamanho_array = TAMANHO_CONTENCAO_PADRAO;
+    config.duracao_ponto = DURACAO_PONTO_CONTENCAO;
+    config.max_threads = 0;
+    config.semente = SEMENTE_PADRAO_GERADOR;
+    return config;
+}
+
+/**
+ * @brief 1, 2, 4, ... abaixo de max_threads, e o próprio max_threads
+ *
+ * @return Quantidade de contagens (<= MAX_PONTOS_CONTENCAO)
+ */
+static int montar_contagens(int max_threads, int *contagens) {
+    int total = 0;
+    for (int t = 1; t < max_threads && total < MAX_PONTOS_CONTENCAO - 1; t *= 2) {
+        contagens[total++] = t;
+    }
+    contagens[total++] = max_threads;
+    return total;
+}
+
+/* ================================================================
+ * THREADS DE TRABALHO
+ * ================================================================ */
+
+static void* trabalhador_contencao(void *arg) {
+    ContextoContencao *ctx = (ContextoContencao*)arg;
+    const ConfiguracaoContencao *config = ctx->config;
+    int n = config->tamanho_array;
+    size_t bytes = (size_t)n * sizeof(int);
+
+    if (ctx->cpu >= 0) fixar_thread_cpu(ctx->cpu);
+    configurar_otimizacao(1);  // THREAD_LOCAL: vale só para esta thread
+
+    int *original = malloc(bytes);
+    int *trabalho = malloc(bytes);
+    if (!original || !trabalho) {
+        ctx->falhou = 1;
+    } else {
+        gerar_numeros(original, n, DIST_ALEATORIA, config->semente + (uint64_t)ctx->indice);
+        // Aquecimento: páginas dos dois buffers e o buffer de troca da thread
+        memcpy(trabalho, original, bytes);
+        executar_ordenacao(ctx->info, trabalho, n, sizeof(int), comparar_inteiros);
+    }
+
+    // Sempre se declara pronta: a principal espera todas antes do sinal
+    atomic_fetch_add(&ctx->largada->prontas, 1);
+    while (atomic_load(&ctx->largada->sinal) == LARGADA_ESPERANDO) {
+#if defined(__linux__)
+        sched_yield();
+#endif
+    }
+
+    if (!ctx->falhou && atomic_load(&ctx->largada->sinal) == LARGADA_LIBERADA) {
+        uint64_t janela = (uint64_t)(config->duracao_ponto *
+                                     obter_info_cronometro()->ticks_por_segundo);
+        uint64_t inicio = cronometro_iniciar();
+        uint64_t agora = inicio;
+        do {
+            memcpy(trabalho, original, bytes);
+            uint64_t t0 = cronometro_iniciar();
+            executar_ordenacao(ctx->info, trabalho, n, sizeof(int), comparar_inteiros);
+            uint64_t t1 = cronometro_parar();
+
+            uint64_t decorrido = cronometro_decorrido(t0, t1);
+            if (ctx->num_amostras < MAX_AMOSTRAS_THREAD_CONTENCAO) {
+                ctx->amostras[ctx->num_amostras++] = decorrido;
+            }
+            ctx->soma_ticks += decorrido;
+            ctx->ordenacoes++;
+            agora = t1;
+        } while (agora - inicio < janela);
+        ctx->janela_ticks = agora - inicio;
+    }
+
+    free(original);
+    free(trabalho);
+    liberar_buffer_troca();
+    return NULL;
+}
+
+/**
+ * @brief Cria as threads, dá a largada e espera todas terminarem
+ *
+ * @return 0 se todas as threads rodaram, -1 caso contrário
+ */
+static int executar_threads(ContextoContencao *contextos, int threads) {
+    Largada largada;
+    atomic_init(&largada.prontas, 0);
+    atomic_init(&largada.sinal, LARGADA_ESPERANDO);
+    for (int t = 0; t < threads; t++) {
+        contextos[t].largada = &largada;
+    }
+
+#if defined(__linux__)
+    pthread_t ids[MAX_TRABALHADORES];
+    int criadas = 0;
+    for (int t = 0; t < threads; t++) {
+        if (pthread_create(&ids[t], NULL, trabalhador_contencao, &contextos[t]) != 0) {
+            printf("AVISO: Falha ao criar a thread %d de %d\n", t, threads);
+            break;
+        }
+        criadas++;
+    }
+
+    while (atomic_load(&largada.prontas) < criadas) {
+        sched_yield();
+    }
+    atomic_store(&largada.sinal, criadas == threads ? LARGADA_LIBERADA : LARGADA_CANCELADA);
+
+    for (int t = 0; t < criadas; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    if (criadas < threads) return -1;
+#else
+    if (threads != 1) return -1;
+    atomic_store(&largada.sinal, LARGADA_LIBERADA);
+    trabalhador_contencao(&contextos[0]);
+#endif
+
+    for (int t = 0; t < threads; t++) {
+        if (contextos[t].falhou) return -1;
+    }
+    return 0;
+}
+
+/* ================================================================
+ * MEDIÇÃO
+ * ================================================================ */
+
+/**
+ * @brief Mede um motor com `threads` threads simultâneas
+ *
+ * @param amostras threads × MAX_AMOSTRAS_THREAD_CONTENCAO posições
+ * @param isolado  Ponto T = 1 do mesmo motor, ou NULL se este é o ponto T = 1
+ * @return 0 em caso de sucesso, -1 se alguma thread falhou
+ */
+static int medir_ponto(const AlgoritmoInfo *info, int threads, const ResultadoContencao *resultado,
+                       uint64_t *amostras, PontoContencao *ponto, const PontoContencao *isolado) {
+    ContextoContencao contextos[MAX_TRABALHADORES];
+    memset(contextos, 0, sizeof(ContextoContencao) * (size_t)threads);
+    for (int t = 0; t < threads; t++) {
+        contextos[t].info = info;
+        contextos[t].config = &resultado->config;
+        contextos[t].indice = t;
+        contextos[t].cpu = resultado->cpus[t % resultado->nucleos_fisicos];
+        contextos[t].amostras = amostras + (size_t)t * MAX_AMOSTRAS_THREAD_CONTENCAO;
+    }
+
+    memset(ponto, 0, sizeof(*ponto));
+    ponto->threads = threads;
+    if (executar_threads(contextos, threads) != 0) return -1;
+
+    // Junta as latências de todas as threads no início do buffer
+    uint64_t soma_ticks = 0;
+    uint64_t maior_janela = 0;
+    for (int t = 0; t < threads; t++) {
+        memmove(amostras + ponto->amostras, contextos[t].amostras,
+                (size_t)contextos[t].num_amostras * sizeof(uint64_t));
+        ponto->amostras += contextos[t].num_amostras;
+        ponto->ordenacoes += contextos[t].ordenacoes;
+        soma_ticks += contextos[t].soma_ticks;
+        if (contextos[t].janela_ticks > maior_janela) maior_janela = contextos[t].janela_ticks;
+    }
+
+    ponto->janela = ticks_para_segundos(maior_janela);
+    ponto->vazao = ponto->janela > 0.0
+                   ? (double)ponto->ordenacoes * resultado->config.tamanho_array / ponto->janela
+                   : 0.0;
+    ponto->media = ponto->ordenacoes > 0
+                   ? ticks_para_segundos(soma_ticks) * 1e9 / (double)ponto->ordenacoes : 0.0;
+
+    ordenar_ticks(amostras, ponto->amostras);
+    ponto->p50 = percentil_ticks_ns(amostras, ponto->amostras, 0.50);
+    ponto->p99 = percentil_ticks_ns(amostras, ponto->amostras, 0.99);
+    ponto->p999 = ponto->amostras >= AMOSTRAS_MINIMAS_P999
+                  ? percentil_ticks_ns(amostras, ponto->amostras, 0.999) : 0.0;
+    ponto->maximo = ponto->amostras > 0
+                    ? ticks_para_segundos(amostras[ponto->amostras - 1]) * 1e9 : 0.0;
+
+    // Lentidão de cada thread contra o mesmo motor rodando sozinho
+    double media_isolada = isolado ? isolado->media : ponto->media;
+    double vazao_isolada = isolado ? isolado->vazao : ponto->vazao;
+    double soma_lentidao = 0.0;
+    for (int t = 0; t < threads; t++) {
+        if (contextos[t].ordenacoes == 0 || media_isolada <= 0.0) continue;
+        double media_thread = ticks_para_segundos(contextos[t].soma_ticks) * 1e9 /
+                              (double)contextos[t].ordenacoes;
+        double lentidao = media_thread / media_isolada;
+        soma_lentidao += lentidao;
+        if (lentidao > ponto->lentidao_pior) ponto->lentidao_pior = lentidao;
+    }
+    ponto->lentidao_media = soma_lentidao / threads;
+    ponto->eficiencia = vazao_isolada > 0.0 ? ponto->vazao / (threads * vazao_isolada) : 0.0;
+    return 0;
+}
+
+ResultadoContencao* executar_contencao(const ConfiguracaoContencao *config) {
+    ResultadoContencao *resultado = calloc(1, sizeof(ResultadoContencao));
+    if (!resultado) {
+        printf("ERRO: Sem memoria para a medicao de contencao\n");
+        return NULL;
+    }
+    resultado->config = *config;
+    inicializar_cronometro();
+
+    resultado->nucleos_fisicos = detectar_nucleos_fisicos(resultado->cpus, MAX_TRABALHADORES);
+    int max_threads = config->max_threads > 0 ? config->max_threads : resultado->nucleos_fisicos;
+    if (max_threads > MAX_TRABALHADORES) max_threads = MAX_TRABALHADORES;
+#if !defined(__linux__)
+    max_threads = 1;
+#endif
+    resultado->config.max_threads = max_threads;
+    if (max_threads > resultado->nucleos_fisicos) {
+        printf("AVISO: %d threads em %d nucleos fisicos (sobreinscricao)\n",
+               max_threads, resultado->nucleos_fisicos);
+    }
+
+    int contagens[MAX_PONTOS_CONTENCAO];
+    int num_contagens = montar_contagens(max_threads, contagens);
+
+    uint64_t *amostras = malloc((size_t)max_threads * MAX_AMOSTRAS_THREAD_CONTENCAO *
+                                sizeof(uint64_t));
+    if (!amostras) {
+        printf("ERRO: Sem memoria para a medicao de contencao\n");
+        free(resultado);
+        return NULL;
+    }
+
+    printf("\nNucleos fisicos: %d | threads: ate %d | %d elementos por thread | %.2f s por ponto\n",
+           resultado->nucleos_fisicos, max_threads, config->tamanho_array, config->duracao_ponto);
+
+    int total_motores = num_motores();
+    for (int m = 0; m < total_motores; m++) {
+        AlgoritmoInfo *info = obter_info_motor(m);
+        if (expoente_declarado(info->complexidade_media, NULL) > EXPOENTE_MAXIMO_CONTENCAO) {
+            continue;
+        }
+        // Motor que já usa várias threads disputaria núcleos com os trabalhadores
+        if (info->capacidades & CAPACIDADE_PARALELO) continue;
+
+        CurvaContencao *curva = &resultado->curvas[resultado->num_curvas++];
+        curva->indice_motor = m;
+        printf("\n%s:\n", info->nome);
+
+        for (int c = 0; c < num_contagens; c++) {
+            PontoContencao *ponto = &curva->pontos[curva->num_pontos];
+            const PontoContencao *isolado = curva->num_pontos > 0 ? &curva->pontos[0] : NULL;
+            if (medir_ponto(info, contagens[c], resultado, amostras, ponto, isolado) != 0) {
+                printf("  AVISO: T = %d falhou (threads ou memoria); curva interrompida\n",
+                       contagens[c]);
+                break;
+            }
+            curva->num_pontos++;
+            printf("  T=%2d  %8.2f Melem/s  efic. %4.2f  lentidao %5.2fx (pior %5.2fx)"
+                   "  p50 %9.1f us  p99 %9.1f us\n",
+                   ponto->threads, ponto->vazao / 1e6, ponto->eficiencia,
+                   ponto->lentidao_media, ponto->lentidao_pior,
+                   ponto->p50 / 1e3, ponto->p99 / 1e3);
+        }
+    }
+
+    free(amostras);
+    return resultado;
+}
+
+/* ================================================================
+ * RESUMO NO TERMINAL
+ * ================================================================ */
+
+/**
+ * @brief Lentidão e eficiência no maior T medido, do motor que melhor resiste ao pior
+ */
+static void imprimir_resumo_contencao(const ResultadoContencao *resultado) {
+    int ordem[MAX_MOTORES];
+    int num = 0;
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        if (resultado->curvas[c].num_pontos == 0) continue;
+        // Inserção por lentidão média no último ponto
+        const CurvaContencao *curva = &resultado->curvas[c];
+        double chave = curva->pontos[curva->num_pontos - 1].lentidao_media;
+        int j = num++;
+        while (j > 0) {
+            const CurvaContencao *anterior = &resultado->curvas[ordem[j - 1]];
+            if (anterior->pontos[anterior->num_pontos - 1].lentidao_media <= chave) break;
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = c;
+    }
+
+    printf("\nDEGRADACAO NO MAIOR T (da mais suave para a mais forte):\n");
+    printf("+-----------------+----+---------------+------------+------------------+\n");
+    printf("| Motor           |  T | Melem/s agreg.| Eficiencia | Lentidao (pior)  |\n");
+    printf("+-----------------+----+---------------+------------+------------------+\n");
+    for (int i = 0; i < num; i++) {
+        const CurvaContencao *curva = &resultado->curvas[ordem[i]];
+        const PontoContencao *p = &curva->pontos[curva->num_pontos - 1];
+        printf("| %-15s | %2d | %13.2f | %10.2f | %5.2fx (%5.2fx)  |\n",
+               obter_info_motor(curva->indice_motor)->nome, p->threads, p->vazao / 1e6,
+               p->eficiencia, p->lentidao_media, p->lentidao_pior);
+    }
+    printf("+-----------------+----+---------------+------------+------------------+\n");
+}
+
+/* ================================================================
+ * RELATÓRIOS
+ * ================================================================ */
+
+static void escrever_contencao_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ResultadoContencao *resultado = (const ResultadoContencao*)dados;
+    char cronometro[128];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "           VAZAO SOB CONTENCAO (THREADS SIMULTANEAS)            \n");
+    fprintf(arquivo, "================================================================\n\n");
+    fprintf(arquivo, "Cronometro: %s\n", cronometro);
+    fprintf(arquivo, "Nucleos fisicos: %d | threads: ate %d\n",
+            resultado->nucleos_fisicos, resultado->config.max_threads);
+    fprintf(arquivo, "Array por thread: %d ints (%.0f KB) | janela por ponto: %.2f s\n",
+            resultado->config.tamanho_array,
+            resultado->config.tamanho_array * sizeof(int) / 1024.0,
+            resultado->config.duracao_ponto);
+    fprintf(arquivo, "Semente base: 0x%llX (thread i usa semente + i)\n",
+            (unsigned long long)resultado->config.semente);
+    fprintf(arquivo, "Versao: otimizada; comparador comparar_inteiros\n");
+
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaContencao *curva = &resultado->curvas[c];
+        fprintf(arquivo, "\n%s\n", obter_info_motor(curva->indice_motor)->nome);
+        fprintf(arquivo, "+----+------------+---------------+-------+--------------+-------------+------------+------------+------------+------------+\n");
+        fprintf(arquivo, "|  T | Ordenacoes | Melem/s agreg.| Efic. | Lentidao med.| Lentidao max| media (us) | p50 (us)   | p99 (us)   | p99.9 (us) |\n");
+        fprintf(arquivo, "+----+------------+---------------+-------+--------------+-------------+------------+------------+------------+------------+\n");
+        for (int i = 0; i < curva->num_pontos; i++) {
+            const PontoContencao *p = &curva->pontos[i];
+            char p999[16];
+            if (p->p999 > 0.0) {
+                snprintf(p999, sizeof(p999), "%.1f", p->p999 / 1e3);
+            } else {
+                snprintf(p999, sizeof(p999), "-");
+            }
+            fprintf(arquivo, "| %2d | %10lld | %13.2f | %5.2f | %11.2fx | %10.2fx | %10.1f | %10.1f | %10.1f | %10s |\n",
+                    p->threads, p->ordenacoes, p->vazao / 1e6, p->eficiencia,
+                    p->lentidao_media, p->lentidao_pior, p->media / 1e3,
+                    p->p50 / 1e3, p->p99 / 1e3, p999);
+        }
+        fprintf(arquivo, "+----+------------+---------------+-------+--------------+-------------+------------+------------+------------+------------+\n");
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Cada thread fica fixada em um nucleo fisico e repete copia + ordenacao\n");
+    fprintf(arquivo, "  do seu proprio array durante a janela\n");
+    fprintf(arquivo, "- Efic.: vazao(T) / (T x vazao(1)); abaixo de 1 as threads disputam\n");
+    fprintf(arquivo, "  banda de memoria e LLC (ou, com sobreinscricao, o proprio nucleo)\n");
+    fprintf(arquivo, "- Lentidao: latencia media da thread / latencia media com T = 1\n");
+    fprintf(arquivo, "- Percentis juntam as ordenacoes de todas as threads (ate %d por thread);\n",
+            MAX_AMOSTRAS_THREAD_CONTENCAO);
+    fprintf(arquivo, "  p99.9 exige ao menos %d amostras\n", AMOSTRAS_MINIMAS_P999);
+    fprintf(arquivo, "- Algoritmos O(n^2) ficam fora: segundos por ordenacao neste tamanho\n");
+}
+
+static void escrever_contencao_csv_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ResultadoContencao *resultado = (const ResultadoContencao*)dados;
+
+    fprintf(arquivo, "algoritmo,threads,n,ordenacoes,amostras,janela_s,vazao_elem_s,eficiencia,"
+                     "lentidao_media,lentidao_pior,media_ns,p50_ns,p99_ns,p999_ns,max_ns\n");
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaContencao *curva = &resultado->curvas[c];
+        for (int i = 0; i < curva->num_pontos; i++) {
+            const PontoContencao *p = &curva->pontos[i];
+            fprintf(arquivo, "%s,%d,%d,%lld,%d,%.6f,%.1f,%.4f,%.4f,%.4f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                    obter_info_motor(curva->indice_motor)->nome, p->threads,
+                    resultado->config.tamanho_array, p->ordenacoes, p->amostras, p->janela,
+                    p->vazao, p->eficiencia, p->lentidao_media, p->lentidao_pior,
+                    p->media, p->p50, p->p99, p->p999, p->maximo);
+        }
+    }
+}
+
+void gerar_relatorio_contencao(const ResultadoContencao *resultado) {
+    if (!resultado) return;
+
+    salvar_arquivo_multiplos_locais("relatorios", "contencao_threads.txt",
+                                    escrever_contencao_callback, (void*)resultado,
+                                    resultado->num_curvas);
+    salvar_arquivo_multiplos_locais("relatorios", "contencao_threads.csv",
+                                    escrever_contencao_csv_callback, (void*)resultado,
+                                    resultado->num_curvas);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_contencao_completa(void) {
+    ConfiguracaoContencao config = configuracao_contencao_padrao();
+
+    printf("\n=== VAZAO SOB CONTENCAO (T threads simultaneas) ===\n");
+    printf("Cada thread ordena repetidamente o proprio array de %d elementos.\n",
+           config.tamanho_array);
+
+    criar_diretorios_output();
+
+    ResultadoContencao *resultado = executar_contencao(&config);
+    if (!resultado) return;
+
+    imprimir_resumo_contencao(resultado);
+    gerar_relatorio_contencao(resultado);
+    free(resultado);
+}
@@ -0,0 +1,280 @@
+/**
+ * ================================================================
+ * CRONÔMETRO DE CICLOS COM CALIBRAÇÃO DE OVERHEAD
+ * ================================================================
+ *
+ * @file cronometro.c
+ * @brief TSC invariante com cercas, calibração e desconto de overhead
+ *
+ *  POSICIONAMENTO DAS CERCAS:
+ * ┌──────────────────────────┐   ┌──────────┐   ┌──────────────────────────┐
+ * │ lfence; rdtsc; lfence    │ → │ região   │ → │ rdtscp; lfence           │
+ * │ (nada anterior vaza para │   │ medida   │   │ (rdtscp espera a região; │
+ * │  dentro, nada posterior  │   │          │   │  lfence impede que o     │
+ * │  começa antes da leitura)│   │          │   │  código seguinte suba)   │
+ * └──────────────────────────┘   └──────────┘   └──────────────────────────┘
+ *
+ *  POR QUE INVARIANTE:
+ * Sem o bit "invariant TSC" (CPUID 0x80000007, EDX bit 8) a frequência do
+ * contador acompanha o clock do núcleo e para em estados de economia de
+ * energia; nesse caso os ticks não são convertíveis em tempo e o módulo
+ * usa o relógio monotônico do sistema.
+ *
+ *  CONCORRÊNCIA:
+ * A inicialização usa um estado atômico (0 = pendente, 1 = calibrando,
+ * 2 = pronto); threads que chegam durante a calibração esperam o término.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>     // Para snprintf
+#include <stdatomic.h>  // Para o estado de inicialização
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>   // Para clock_gettime
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <x86intrin.h>  // Para __rdtsc, __rdtscp e _mm_lfence
+    #include <cpuid.h>      // Para __get_cpuid
+    #define CRONOMETRO_TEM_TSC 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>     // Para __rdtsc, __rdtscp, _mm_lfence e __cpuid
+    #define CRONOMETRO_TEM_TSC 1
+#else
+    #define CRONOMETRO_TEM_TSC 0
+#endif
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+static InfoCronometro info_cronometro = { FONTE_RELOGIO_SO, 1e9, 0 };
+static atomic_int estado_cronometro = 0;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static uint64_t relogio_so_ticks(void);
+static double relogio_so_frequencia(void);
+static int tsc_invariante_disponivel(void);
+static double calibrar_tsc(void);
+static uint64_t ler_inicio(FonteCronometro fonte);
+static uint64_t ler_fim(FonteCronometro fonte);
+static uint64_t medir_overhead(FonteCronometro fonte);
+static void garantir_inicializacao(void);
+
+/* ================================================================
+ * RELÓGIO DO SISTEMA
+ * ================================================================ */
+
+/**
+ * @brief Ticks do relógio monotônico do SO (ns no POSIX, contagens de QPC no Windows)
+ */
+static uint64_t relogio_so_ticks(void) {
+#ifdef _WIN32
+    LARGE_INTEGER agora;
+    QueryPerformanceCounter(&agora);
+    return (uint64_t)agora.QuadPart;
+#else
+    struct timespec tempo;
+    #ifdef CLOCK_MONOTONIC_RAW
+        clock_gettime(CLOCK_MONOTONIC_RAW, &tempo);  // Imune a ajustes do NTP
+    #else
+        clock_gettime(CLOCK_MONOTONIC, &tempo);
+    #endif
+    return (uint64_t)tempo.tv_sec * 1000000000ULL + (uint64_t)tempo.tv_nsec;
+#endif
+}
+
+static double relogio_so_frequencia(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequencia;
+    if (QueryPerformanceFrequency(&frequencia) && frequencia.QuadPart > 0) {
+        return (double)frequencia.QuadPart;
+    }
+#endif
+    return 1e9;
+}
+
+/* ================================================================
+ * TSC
+ * ================================================================ */
+
+/**
+ * @brief Verifica suporte a RDTSCP e ao bit de TSC invariante
+ */
+static int tsc_invariante_disponivel(void) {
+#if CRONOMETRO_TEM_TSC && defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, (int)0x80000000);
+    if ((unsigned)regs[0] < 0x80000007u) return 0;
+    __cpuid(regs, (int)0x80000001);
+    if (!(regs[3] & (1 << 27))) return 0;  // RDTSCP
+    __cpuid(regs, (int)0x80000007);
+    return (regs[3] & (1 << 8)) != 0;      // TSC invariante
+#elif CRONOMETRO_TEM_TSC
+    unsigned a, b, c, d;
+    if (!__get_cpuid(0x80000000u, &a, &b, &c, &d) || a < 0x80000007u) return 0;
+    if (!__get_cpuid(0x80000001u, &a, &b, &c, &d) || !(d & (1u << 27))) return 0;
+    if (!__get_cpuid(0x80000007u, &a, &b, &c, &d)) return 0;
+    return (d & (1u << 8)) != 0;
+#else
+    return 0;
+#endif
+}
+
+#if CRONOMETRO_TEM_TSC
+static inline uint64_t tsc_inicio(void) {
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+
+static inline uint64_t tsc_fim(void) {
+    unsigned int aux;
+    uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+}
+#endif
+
+/**
+ * @brief Ticks de TSC por segundo, medidos contra o relógio do SO
+ *
+ * Cada leitura do relógio é cercada por duas leituras do TSC e a média
+ * das duas é usada, o que reduz o erro da própria chamada ao SO.
+ */
+static double calibrar_tsc(void) {
+#if CRONOMETRO_TEM_TSC
+    double freq_so = relogio_so_frequencia();
+    uint64_t janela = (uint64_t)(freq_so * (double)CALIBRACAO_TSC_NS / 1e9);
+
+    uint64_t c0a = tsc_inicio();
+    uint64_t s0 = relogio_so_ticks();
+    uint64_t c0b = tsc_fim();
+
+    uint64_t s1, c1a, c1b;
+    do {
+        c1a = tsc_inicio();
+        s1 = relogio_so_ticks();
+        c1b = tsc_fim();
+    } while (s1 - s0 < janela);
+
+    double ciclos = (double)((c1a + c1b) / 2 - (c0a + c0b) / 2);
+    double segundos = (double)(s1 - s0) / freq_so;
+    return ciclos / segundos;
+#else
+    return 0.0;
+#endif
+}
+
+static uint64_t ler_inicio(FonteCronometro fonte) {
+#if CRONOMETRO_TEM_TSC
+    if (fonte == FONTE_TSC) return tsc_inicio();
+#else
+    (void)fonte;
+#endif
+    return relogio_so_ticks();
+}
+
+static uint64_t ler_fim(FonteCronometro fonte) {
+#if CRONOMETRO_TEM_TSC
+    if (fonte == FONTE_TSC) return tsc_fim();
+#else
+    (void)fonte;
+#endif
+    return relogio_so_ticks();
+}
+
+/**
+ * @brief Menor custo observado de uma região vazia com a fonte escolhida
+ */
+static uint64_t medir_overhead(FonteCronometro fonte) {
+    uint64_t menor = UINT64_MAX;
+    for (int i = 0; i < AMOSTRAS_OVERHEAD; i++) {
+        uint64_t inicio = ler_inicio(fonte);
+        uint64_t fim = ler_fim(fonte);
+        if (fim - inicio < menor) menor = fim - inicio;
+    }
+    return menor == UINT64_MAX ? 0 : menor;
+}
+
+/* ================================================================
+ * INICIALIZAÇÃO
+ * ================================================================ */
+
+void inicializar_cronometro(void) {
+    int esperado = 0;
+    if (!atomic_compare_exchange_strong(&estado_cronometro, &esperado, 1)) {
+        // Outra thread calibrando (ou já pronto): espera o término
+        while (atomic_load(&estado_cronometro) != 2) { }
+        return;
+    }
+
+    InfoCronometro info = { FONTE_RELOGIO_SO, relogio_so_frequencia(), 0 };
+    if (tsc_invariante_disponivel()) {
+        double frequencia = calibrar_tsc();
+        if (frequencia > 0.0) {
+            info.fonte = FONTE_TSC;
+            info.ticks_por_segundo = frequencia;
+        }
+    }
+    info.overhead_ticks = medir_overhead(info.fonte);
+
+    info_cronometro = info;
+    atomic_store_explicit(&estado_cronometro, 2, memory_order_release);
+}
+
+static void garantir_inicializacao(void) {
+    if (atomic_load_explicit(&estado_cronometro, memory_order_acquire) != 2) {
+        inicializar_cronometro();
+    }
+}
+
+const InfoCronometro* obter_info_cronometro(void) {
+    garantir_inicializacao();
+    return &info_cronometro;
+}
+
+/* ================================================================
+ * LEITURAS
+ * ================================================================ */
+
+uint64_t cronometro_iniciar(void) {
+    garantir_inicializacao();
+    return ler_inicio(info_cronometro.fonte);
+}
+
+uint64_t cronometro_parar(void) {
+    return ler_fim(info_cronometro.fonte);
+}
+
+uint64_t cronometro_decorrido(uint64_t inicio, uint64_t fim) {
+    uint64_t bruto = (fim > inicio) ? fim - inicio : 0;
+    uint64_t overhead = info_cronometro.overhead_ticks;
+    return (bruto > overhead) ? bruto - overhead : 0;
+}
+
+double ticks_para_segundos(uint64_t ticks) {
+    garantir_inicializacao();
+    return (double)ticks / info_cronometro.ticks_por_segundo;
+}
+
+void descrever_cronometro(char *buffer, size_t tamanho_buffer) {
+    if (!buffer || tamanho_buffer == 0) return;
+    const InfoCronometro *info = obter_info_cronometro();
+
+    if (info->fonte == FONTE_TSC) {
+        snprintf(buffer, tamanho_buffer, "TSC invariante %.3f GHz, overhead %llu ticks",
+                 info->ticks_por_segundo / 1e9, (unsigned long long)info->overhead_ticks);
+    } else {
+        snprintf(buffer, tamanho_buffer, "relogio monotonico do SO (%.0f ticks/s), overhead %llu ticks",
+                 info->ticks_por_segundo, (unsigned long long)info->overhead_ticks);
+    }
+}
@@ -0,0 +1,534 @@
+/**
+ * ================================================================
+ * MODELO DE CUSTO: COMPARAÇÕES × BYTES MOVIDOS
+ * ================================================================
+ *
+ * @file custo.c
+ * @brief Grade (custo da comparação × elem_size), ajuste e escolha
+ *
+ *  FLUXO POR ALGORITMO:
+ * ┌────────────────┐   ┌──────────────────┐   ┌──────────────────────┐
+ * │ n chaves em    │ → │ medir_algoritmo  │ → │ para cada custo:     │
+ * │ registros de S │   │ com comparador + │   │ t ≈ k + a·C + b·M·S  │
+ * │ bytes (chave   │   │ custo sintético  │   │ (mínimos quadrados   │
+ * │ int no início) │   │                  │   │ não negativos)       │
+ * └────────────────┘   └──────────────────┘   └──────────────────────┘
+ *
+ * Com n fixo, C e M são os mesmos em todos os elem_size: a varredura de
+ * elem_size separa b, mas a·C não se distingue do custo fixo k. Os três
+ * n da grade fazem C variar dentro de cada ajuste.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy, memset e snprintf
+#include <math.h>    // Para fabs
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+static const int tamanhos_n_custo[NUM_TAMANHOS_N_CUSTO] = {
+    TAMANHO_MODELO_CUSTO / 4, TAMANHO_MODELO_CUSTO / 2, TAMANHO_MODELO_CUSTO
+};
+
+static const size_t tamanhos_elemento_custo[NUM_TAMANHOS_ELEMENTO_CUSTO] = {
+    4, 8, 16, 32, 64, 128, 256, 512, 1024
+};
+
+static const uint64_t custos_comparacao[NUM_CUSTOS_COMPARACAO] = { 0, 32, 256 };
+
+static THREAD_LOCAL CompareFn comparador_base = comparar_inteiros;
+static THREAD_LOCAL uint64_t iteracoes_por_comparacao = 0;
+
+/// Iterações do laço de espera por tick do cronômetro (calibrado uma vez)
+static double iteracoes_por_tick = 0.0;
+
+#define ITERACOES_CALIBRACAO_ESPERA 4000000ULL
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void calibrar_espera(void);
+static void girar(uint64_t iteracoes);
+static double valor_termo(const PontoCusto *ponto, int termo);
+static double ajustar_termos(const PontoCusto *pontos, int num_pontos, unsigned termos, double coef[3]);
+static void montar_registros_custo(char *destino, const int *chaves, int n, size_t elem_size);
+static double prever_tempo(const ModeloCusto *modelo, const PontoCusto *ponto, size_t elem_size);
+static double equilibrio_bytes(const ModeloCusto *modelo, const PontoCusto *ponto);
+static int melhor_algoritmo(const RelatorioCusto *relatorio, int custo, size_t elem_size);
+static void escrever_custo_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_custo_csv_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * COMPARADOR COM CUSTO SINTÉTICO
+ * ================================================================ */
+
+/**
+ * @brief Laço de espera com uma dependência por iteração (não é eliminado)
+ */
+static void girar(uint64_t iteracoes) {
+    volatile uint64_t contador = 0;
+    for (uint64_t i = 0; i < iteracoes; i++) contador++;
+}
+
+/**
+ * @brief Iterações por tick, medidas uma vez
+ *
+ * Ler o cronômetro a cada volta custaria dezenas de ticks (lfence), mais
+ * que os custos pequenos da grade; o laço calibrado tem resolução de
+ * poucos ciclos.
+ */
+static void calibrar_espera(void) {
+    uint64_t inicio = cronometro_iniciar();
+    girar(ITERACOES_CALIBRACAO_ESPERA);
+    uint64_t decorrido = cronometro_decorrido(inicio, cronometro_parar());
+    iteracoes_por_tick = (double)ITERACOES_CALIBRACAO_ESPERA / (double)(decorrido > 0 ? decorrido : 1);
+}
+
+void configurar_custo_comparacao(CompareFn base, uint64_t ticks) {
+    if (ticks > 0 && iteracoes_por_tick <= 0.0) calibrar_espera();
+    comparador_base = base ? base : comparar_inteiros;
+    iteracoes_por_comparacao = (uint64_t)((double)ticks * iteracoes_por_tick + 0.5);
+}
+
+int comparar_com_custo(const void *a, const void *b) {
+    if (iteracoes_por_comparacao > 0) girar(iteracoes_por_comparacao);
+    return comparador_base(a, b);
+}
+
+/* ================================================================
+ * AJUSTE DO MODELO
+ * ================================================================ */
+
+/**
+ * @brief Valor do termo no ponto (0 = intercepto, 1 = comparações, 2 = bytes movidos)
+ */
+static double valor_termo(const PontoCusto *ponto, int termo) {
+    if (termo == 0) return 1.0;
+    return termo == 1 ? (double)ponto->comparacoes : ponto->bytes_movidos;
+}
+
+/**
+ * @brief Mínimos quadrados ponderados só com os termos do bitmask `termos`
+ *
+ * Equações normais resolvidas por eliminação de Gauss com pivô parcial.
+ * Um pivô que cai abaixo de 1e-9 da diagonal original indica termos
+ * colineares (ex.: C constante junto do intercepto).
+ *
+ * @param coef Saída [k, a, b]; termos fora do bitmask ficam em 0
+ * @return Soma ponderada dos quadrados dos resíduos, ou -1 se singular
+ */
+static double ajustar_termos(const PontoCusto *pontos, int num_pontos, unsigned termos, double coef[3]) {
+    int indices[3];
+    int t = 0;
+    for (int j = 0; j < 3; j++) {
+        coef[j] = 0.0;
+        if (termos & (1u << j)) indices[t++] = j;
+    }
+
+    double m[3][4] = {{0.0}};
+    for (int i = 0; i < num_pontos; i++) {
+        const PontoCusto *p = &pontos[i];
+        if (p->tempo <= 0.0) continue;
+        double w = 1.0 / (p->tempo * p->tempo);
+        for (int r = 0; r < t; r++) {
+            double xr = valor_termo(p, indices[r]);
+            for (int c = 0; c < t; c++) m[r][c] += w * xr * valor_termo(p, indices[c]);
+            m[r][t] += w * xr * p->tempo;
+        }
+    }
+
+    double diagonal[3];
+    for (int r = 0; r < t; r++) diagonal[r] = m[r][r];
+    for (int col = 0; col < t; col++) {
+        int pivo = col;
+        for (int r = col + 1; r < t; r++) {
+            if (fabs(m[r][col]) > fabs(m[pivo][col])) pivo = r;
+        }
+        if (!(fabs(m[pivo][col]) > 1e-9 * diagonal[col])) return -1.0;
+        for (int c = 0; c <= t; c++) {
+            double troca = m[col][c];
+            m[col][c] = m[pivo][c];
+            m[pivo][c] = troca;
+        }
+        double troca_diagonal = diagonal[col];
+        diagonal[col] = diagonal[pivo];
+        diagonal[pivo] = troca_diagonal;
+        for (int r = col + 1; r < t; r++) {
+            double fator = m[r][col] / m[col][col];
+            for (int c = col; c <= t; c++) m[r][c] -= fator * m[col][c];
+        }
+    }
+    for (int r = t - 1; r >= 0; r--) {
+        double soma = m[r][t];
+        for (int c = r + 1; c < t; c++) soma -= m[r][c] * coef[indices[c]];
+        coef[indices[r]] = soma / m[r][r];
+    }
+
+    double residuo = 0.0;
+    for (int i = 0; i < num_pontos; i++) {
+        const PontoCusto *p = &pontos[i];
+        if (p->tempo <= 0.0) continue;
+        double previsto = coef[0] + coef[1] * (double)p->comparacoes + coef[2] * p->bytes_movidos;
+        residuo += (p->tempo - previsto) * (p->tempo - previsto) / (p->tempo * p->tempo);
+    }
+    return residuo;
+}
+
+ModeloCusto ajustar_modelo_custo(const PontoCusto *pontos, int num_pontos) {
+    ModeloCusto modelo;
+    memset(&modelo, 0, sizeof(modelo));
+
+    double menor_c = 0.0, maior_c = 0.0;
+    double soma_w = 0.0, soma_wt = 0.0;
+    for (int i = 0; i < num_pontos; i++) {
+        const PontoCusto *p = &pontos[i];
+        if (p->tempo <= 0.0) continue;
+        double w = 1.0 / (p->tempo * p->tempo);
+        double c = (double)p->comparacoes;
+        if (modelo.pontos == 0 || c < menor_c) menor_c = c;
+        if (modelo.pontos == 0 || c > maior_c) maior_c = c;
+        soma_w += w;
+        soma_wt += w * p->tempo;
+        modelo.pontos++;
+    }
+    if (modelo.pontos == 0) return modelo;
+
+    // Com C constante, a·C é indistinguível do intercepto: o termo a fica de fora
+    modelo.a_identificado = maior_c > 0.0 && maior_c >= menor_c * (1.0 + VARIACAO_MINIMA_COMPARACOES_CUSTO);
+
+    // Mínimos quadrados não negativos por enumeração: com 3 termos, a
+    // solução é o ajuste viável (coeficientes >= 0) de menor resíduo
+    double menor_residuo = -1.0;
+    for (unsigned termos = 1; termos < 8; termos++) {
+        if ((termos & 2u) && !modelo.a_identificado) continue;
+        double coef[3];
+        double residuo = ajustar_termos(pontos, num_pontos, termos, coef);
+        if (residuo < 0.0 || coef[0] < 0.0 || coef[1] < 0.0 || coef[2] < 0.0) continue;
+        if (menor_residuo < 0.0 || residuo < menor_residuo) {
+            menor_residuo = residuo;
+            modelo.k = coef[0];
+            modelo.a = coef[1];
+            modelo.b = coef[2];
+        }
+    }
+
+    // R² ponderado, com os mesmos pesos do ajuste
+    double media = soma_wt / soma_w;
+    double residuo = 0.0, total = 0.0;
+    for (int i = 0; i < num_pontos; i++) {
+        const PontoCusto *p = &pontos[i];
+        if (p->tempo <= 0.0) continue;
+        double w = 1.0 / (p->tempo * p->tempo);
+        double previsto = modelo.k + modelo.a * (double)p->comparacoes + modelo.b * p->bytes_movidos;
+        residuo += w * (p->tempo - previsto) * (p->tempo - previsto);
+        total += w * (p->tempo - media) * (p->tempo - media);
+    }
+    modelo.r2 = total > 0.0 ? 1.0 - residuo / total : 1.0;
+    return modelo;
+}
+
+/**
+ * @brief Tempo previsto para os contadores do ponto com outro elem_size
+ */
+static double prever_tempo(const ModeloCusto *modelo, const PontoCusto *ponto, size_t elem_size) {
+    return modelo->k + modelo->a * (double)ponto->comparacoes +
+           modelo->b * (double)ponto->movimentacoes * (double)elem_size;
+}
+
+/**
+ * @brief elem_size em que a·C = b·M·S (acima dele as cópias dominam)
+ *
+ * @return Bytes, ou -1 se o modelo não tem custo de cópia positivo ou `a`
+ *         não foi identificado
+ */
+static double equilibrio_bytes(const ModeloCusto *modelo, const PontoCusto *ponto) {
+    if (!modelo->a_identificado || modelo->b <= 0.0 || ponto->movimentacoes <= 0) return -1.0;
+    return modelo->a * (double)ponto->comparacoes / (modelo->b * (double)ponto->movimentacoes);
+}
+
+/* ================================================================
+ * MEDIÇÃO DA GRADE
+ * ================================================================ */
+
+/**
+ * @brief Registro i = [chave i][bytes derivados de i ...]
+ */
+static void montar_registros_custo(char *destino, const int *chaves, int n, size_t elem_size) {
+    for (int i = 0; i < n; i++) {
+        char *registro = destino + (size_t)i * elem_size;
+        memcpy(registro, &chaves[i], sizeof(int));
+        for (size_t b = sizeof(int); b < elem_size; b++) {
+            registro[b] = (char)(unsigned char)((unsigned)i + (unsigned)b);
+        }
+    }
+}
+
+int medir_modelo_custo(RelatorioCusto *relatorio) {
+    if (!relatorio) return -1;
+    memset(relatorio, 0, sizeof(*relatorio));
+    relatorio->tamanho = TAMANHO_MODELO_CUSTO;
+    memcpy(relatorio->tamanhos_n, tamanhos_n_custo, sizeof(tamanhos_n_custo));
+    memcpy(relatorio->tamanhos_elemento, tamanhos_elemento_custo, sizeof(tamanhos_elemento_custo));
+    memcpy(relatorio->custos_ticks, custos_comparacao, sizeof(custos_comparacao));
+
+    int n_maximo = TAMANHO_MODELO_CUSTO;
+    size_t maior = tamanhos_elemento_custo[NUM_TAMANHOS_ELEMENTO_CUSTO - 1];
+    int *chaves = malloc((size_t)n_maximo * sizeof(int));
+    char *entrada = malloc((size_t)n_maximo * maior);
+    char *trabalho = malloc((size_t)n_maximo * maior);
+    if (!chaves || !entrada || !trabalho) {
+        printf("ERRO: Sem memoria para o modelo de custo\n");
+        free(chaves);
+        free(entrada);
+        free(trabalho);
+        return -1;
+    }
+    int versao_original = usar_versao_otimizada;
+    configurar_otimizacao(1);
+
+    // Algoritmos (versão otimizada) e plugins; as referências da libc não
+    // contam movimentações, e motores só de int não varrem elem_size
+    int total_motores = num_motores();
+    for (int m = 0; m < total_motores; m++) {
+        AlgoritmoInfo *info = obter_info_motor(m);
+        if (eh_referencia(info)) continue;
+        if (!motor_aceita_dados(info, maior, comparar_com_custo)) continue;
+
+        CustoAlgoritmo *custo = &relatorio->algoritmos[relatorio->num_algoritmos++];
+        snprintf(custo->algoritmo, sizeof(custo->algoritmo), "%s", info->nome);
+        printf("Medindo %s (%d custos x %d n x %d tamanhos de elemento)...\n", info->nome,
+               NUM_CUSTOS_COMPARACAO, NUM_TAMANHOS_N_CUSTO, NUM_TAMANHOS_ELEMENTO_CUSTO);
+
+        for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+            configurar_custo_comparacao(comparar_inteiros, custos_comparacao[c]);
+            // Sem custo extra, o comparador é chamado diretamente (sem a camada do envoltório)
+            CompareFn cmp = custos_comparacao[c] > 0 ? comparar_com_custo : comparar_inteiros;
+
+            for (int t = 0; t < NUM_TAMANHOS_N_CUSTO; t++) {
+                // Cada n tem a sua entrada: mesmas chaves em todos os elem_size
+                int n = tamanhos_n_custo[t];
+                gerar_numeros(chaves, n, DIST_ALEATORIA, SEMENTE_PADRAO_GERADOR + (uint64_t)t);
+
+                for (int s = 0; s < NUM_TAMANHOS_ELEMENTO_CUSTO; s++) {
+                    size_t elem_size = tamanhos_elemento_custo[s];
+                    montar_registros_custo(entrada, chaves, n, elem_size);
+                    copiar_array(entrada, trabalho, n, elem_size);
+
+                    ResultadoTempo medicao = medir_algoritmo(info, trabalho, n, elem_size,
+                                                             cmp, "registros");
+                    PontoCusto *ponto = &custo->pontos[c][t][s];
+                    ponto->n = n;
+                    ponto->elem_size = elem_size;
+                    ponto->custo_ticks = custos_comparacao[c];
+                    ponto->comparacoes = medicao.comparacoes;
+                    ponto->movimentacoes = medicao.movimentacoes;
+                    ponto->bytes_movidos = (double)medicao.movimentacoes * (double)elem_size;
+                    ponto->tempo = medicao.tempo_execucao;
+                }
+            }
+            custo->modelos[c] = ajustar_modelo_custo(&custo->pontos[c][0][0], NUM_PONTOS_AJUSTE_CUSTO);
+        }
+    }
+
+    configurar_custo_comparacao(comparar_inteiros, 0);
+    configurar_otimizacao(versao_original);
+    free(chaves);
+    free(entrada);
+    free(trabalho);
+    return 0;
+}
+
+/* ================================================================
+ * RELATÓRIOS
+ * ================================================================ */
+
+/**
+ * @brief Índice do algoritmo com menor tempo previsto pelo modelo
+ */
+static int melhor_algoritmo(const RelatorioCusto *relatorio, int custo, size_t elem_size) {
+    int melhor = -1;
+    double menor = 0.0;
+    for (int a = 0; a < relatorio->num_algoritmos; a++) {
+        const CustoAlgoritmo *alg = &relatorio->algoritmos[a];
+        if (alg->modelos[custo].pontos == 0) continue;
+        // Contadores do maior n: a tabela de escolha é para n = TAMANHO_MODELO_CUSTO
+        const PontoCusto *ponto = &alg->pontos[custo][NUM_TAMANHOS_N_CUSTO - 1][0];
+        double previsto = prever_tempo(&alg->modelos[custo], ponto, elem_size);
+        if (melhor < 0 || previsto < menor) {
+            melhor = a;
+            menor = previsto;
+        }
+    }
+    return melhor;
+}
+
+static void escrever_custo_callback(FILE* arquivo, void* dados, int tamanho) {
+    const RelatorioCusto *relatorio = (const RelatorioCusto*)dados;
+    (void)tamanho;
+
+    char cronometro[128];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+
+    fprintf(arquivo, "=== MODELO DE CUSTO: COMPARACOES x BYTES MOVIDOS ===\n\n");
+    fprintf(arquivo, "Versao: otimizada | n =");
+    for (int t = 0; t < NUM_TAMANHOS_N_CUSTO; t++) fprintf(arquivo, " %d", relatorio->tamanhos_n[t]);
+    fprintf(arquivo, " chaves int aleatorias no inicio de registros de %zu a %zu bytes\n",
+            relatorio->tamanhos_elemento[0], relatorio->tamanhos_elemento[NUM_TAMANHOS_ELEMENTO_CUSTO - 1]);
+    fprintf(arquivo, "Cronometro: %s\n", cronometro);
+    fprintf(arquivo, "Custo sintetico por comparacao (ticks):");
+    for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+        fprintf(arquivo, " %llu", (unsigned long long)relatorio->custos_ticks[c]);
+    }
+    fprintf(arquivo, "\nModelo: tempo = k + a * comparacoes + b * bytes_movidos (por custo de comparacao,"
+                     " %d pontos: n x elem_size)\n\n", NUM_PONTOS_AJUSTE_CUSTO);
+
+    fprintf(arquivo, "%-16s %6s %12s %10s %12s %12s %8s %12s\n",
+            "Algoritmo", "Custo", "Comparacoes", "k (us)", "a (ns/comp)", "b (ns/byte)", "R2", "Equilibrio");
+    fprintf(arquivo, "----------------------------------------------------------------------------------------------\n");
+    for (int a = 0; a < relatorio->num_algoritmos; a++) {
+        const CustoAlgoritmo *alg = &relatorio->algoritmos[a];
+        for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+            const ModeloCusto *m = &alg->modelos[c];
+            const PontoCusto *maior_n = &alg->pontos[c][NUM_TAMANHOS_N_CUSTO - 1][0];
+            double equilibrio = equilibrio_bytes(m, maior_n);
+            fprintf(arquivo, "%-16s %6llu %12lld %10.3f ",
+                    c == 0 ? alg->algoritmo : "", (unsigned long long)relatorio->custos_ticks[c],
+                    maior_n->comparacoes, m->k * 1e6);
+            if (m->a_identificado) fprintf(arquivo, "%12.3f ", m->a * 1e9);
+            else                   fprintf(arquivo, "%12s ", "-");
+            fprintf(arquivo, "%12.4f %8.4f ", m->b * 1e9, m->r2);
+            if (equilibrio >= 0.0) {
+                fprintf(arquivo, "%8.0f B\n", equilibrio);
+            } else {
+                fprintf(arquivo, "%12s\n", "-");
+            }
+        }
+    }
+
+    fprintf(arquivo, "\nComparacoes e equilibrio no maior n (%d)\n", relatorio->tamanho);
+    fprintf(arquivo, "Equilibrio: elem_size em que a*C = b*M*S; acima dele as copias custam mais que as comparacoes\n");
+    fprintf(arquivo, "a = '-': as comparacoes nao variaram %.0f%% entre os pontos e a*C nao se separa de k\n",
+            VARIACAO_MINIMA_COMPARACOES_CUSTO * 100.0);
+
+    fprintf(arquivo, "\n=== ESCOLHA PELO MODELO (n = %d, menor tempo previsto) ===\n\n", relatorio->tamanho);
+    fprintf(arquivo, "%-10s", "elem_size");
+    for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+        char titulo[32];
+        snprintf(titulo, sizeof(titulo), "custo %llu", (unsigned long long)relatorio->custos_ticks[c]);
+        fprintf(arquivo, " %-16s", titulo);
+    }
+    fprintf(arquivo, "\n");
+
+    // A grade medida e o registro Aluno do programa (previsto, não medido)
+    for (int s = 0; s <= NUM_TAMANHOS_ELEMENTO_CUSTO; s++) {
+        size_t elem_size = s < NUM_TAMANHOS_ELEMENTO_CUSTO ? relatorio->tamanhos_elemento[s] : sizeof(Aluno);
+        char rotulo[32];
+        snprintf(rotulo, sizeof(rotulo), s < NUM_TAMANHOS_ELEMENTO_CUSTO ? "%zu" : "%zu*", elem_size);
+        fprintf(arquivo, "%-10s", rotulo);
+        for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+            int melhor = melhor_algoritmo(relatorio, c, elem_size);
+            fprintf(arquivo, " %-16s", melhor >= 0 ? relatorio->algoritmos[melhor].algoritmo : "-");
+        }
+        fprintf(arquivo, "\n");
+    }
+    fprintf(arquivo, "* sizeof(Aluno): tamanho fora da grade, apenas previsto pelo modelo\n");
+
+    fprintf(arquivo, "\n=== MEDIDO x PREVISTO ===\n");
+    for (int a = 0; a < relatorio->num_algoritmos; a++) {
+        const CustoAlgoritmo *alg = &relatorio->algoritmos[a];
+        fprintf(arquivo, "\n%s:\n", alg->algoritmo);
+        fprintf(arquivo, "  %6s %6s %9s %12s %14s %14s %14s %8s\n",
+                "Custo", "n", "elem_size", "Comparacoes", "Movimentacoes", "Medido (s)", "Previsto (s)", "Erro");
+        for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+            for (int t = 0; t < NUM_TAMANHOS_N_CUSTO; t++) {
+                for (int s = 0; s < NUM_TAMANHOS_ELEMENTO_CUSTO; s++) {
+                    const PontoCusto *p = &alg->pontos[c][t][s];
+                    double previsto = prever_tempo(&alg->modelos[c], p, p->elem_size);
+                    double erro = p->tempo > 0.0 ? (previsto - p->tempo) / p->tempo * 100.0 : 0.0;
+                    fprintf(arquivo, "  %6llu %6d %9zu %12lld %14lld %14.6f %14.6f %7.1f%%\n",
+                            (unsigned long long)p->custo_ticks, p->n, p->elem_size, p->comparacoes,
+                            p->movimentacoes, p->tempo, previsto, erro);
+                }
+            }
+        }
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Custo sintetico: laco de espera calibrado em ticks do cronometro, dentro de cada comparacao\n");
+    fprintf(arquivo, "- bytes_movidos = movimentacoes x elem_size (uma troca conta 3 movimentacoes)\n");
+    fprintf(arquivo, "- Ajuste ponderado por 1/tempo^2: erro relativo pesa igual em 4 B e 1 KB\n");
+    fprintf(arquivo, "- k absorve o custo fixo da chamada; os tres n fazem C variar e separam a de k\n");
+    fprintf(arquivo, "- Para um tipo novo: meca o custo do comparador e use a linha de custo mais proxima\n");
+}
+
+static void escrever_custo_csv_callback(FILE* arquivo, void* dados, int tamanho) {
+    const RelatorioCusto *relatorio = (const RelatorioCusto*)dados;
+    (void)tamanho;
+
+    // a_s_por_comparacao vazio quando a não foi identificado
+    fprintf(arquivo, "algoritmo,custo_ticks,elem_size,n,comparacoes,movimentacoes,bytes_movidos,"
+                     "tempo_s,previsto_s,k_s,a_s_por_comparacao,b_s_por_byte,r2\n");
+    for (int a = 0; a < relatorio->num_algoritmos; a++) {
+        const CustoAlgoritmo *alg = &relatorio->algoritmos[a];
+        for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+            const ModeloCusto *m = &alg->modelos[c];
+            char coef_a[32] = "";
+            if (m->a_identificado) snprintf(coef_a, sizeof(coef_a), "%.6e", m->a);
+            for (int t = 0; t < NUM_TAMANHOS_N_CUSTO; t++) {
+                for (int s = 0; s < NUM_TAMANHOS_ELEMENTO_CUSTO; s++) {
+                    const PontoCusto *p = &alg->pontos[c][t][s];
+                    fprintf(arquivo, "%s,%llu,%zu,%d,%lld,%lld,%.0f,%.9f,%.9f,%.6e,%s,%.6e,%.6f\n",
+                            alg->algoritmo, (unsigned long long)p->custo_ticks, p->elem_size,
+                            p->n, p->comparacoes, p->movimentacoes, p->bytes_movidos,
+                            p->tempo, prever_tempo(m, p, p->elem_size), m->k, coef_a, m->b, m->r2);
+                }
+            }
+        }
+    }
+}
+
+void gerar_relatorio_custo(const RelatorioCusto *relatorio) {
+    if (!relatorio) return;
+    salvar_arquivo_multiplos_locais("relatorios", "modelo_custo.txt",
+                                    escrever_custo_callback, (void*)relatorio,
+                                    relatorio->num_algoritmos);
+    salvar_arquivo_multiplos_locais("relatorios", "modelo_custo.csv",
+                                    escrever_custo_csv_callback, (void*)relatorio,
+                                    relatorio->num_algoritmos);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_analise_custo(void) {
+    printf("\n=== MODELO DE CUSTO: COMPARACOES x BYTES MOVIDOS ===\n");
+    printf("n = 250, 500 e 1000; registros de 4 a 1024 bytes; comparador com 0, 32 e 256 ticks extras.\n\n");
+
+    criar_diretorios_output();
+
+    RelatorioCusto *relatorio = malloc(sizeof(RelatorioCusto));
+    if (!relatorio) return;
+
+    if (medir_modelo_custo(relatorio) == 0) {
+        printf("\n%-16s %6s %10s %12s %12s %8s\n", "Algoritmo", "Custo", "k (us)", "a (ns/comp)",
+               "b (ns/byte)", "R2");
+        for (int a = 0; a < relatorio->num_algoritmos; a++) {
+            const CustoAlgoritmo *alg = &relatorio->algoritmos[a];
+            for (int c = 0; c < NUM_CUSTOS_COMPARACAO; c++) {
+                const ModeloCusto *m = &alg->modelos[c];
+                char coef_a[32] = "-";
+                if (m->a_identificado) snprintf(coef_a, sizeof(coef_a), "%.3f", m->a * 1e9);
+                printf("%-16s %6llu %10.3f %12s %12.4f %8.4f\n", c == 0 ? alg->algoritmo : "",
+                       (unsigned long long)relatorio->custos_ticks[c], m->k * 1e6, coef_a, m->b * 1e9, m->r2);
+            }
+        }
+        printf("\n");
+        gerar_relatorio_custo(relatorio);
+    }
+    free(relatorio);
+}
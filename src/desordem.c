@@ -0,0 +1,302 @@
+/**
+ * ================================================================
+ * MÉTRICAS DE PRÉ-ORDENAÇÃO DAS ENTRADAS
+ * ================================================================
+ *
+ * @file desordem.c
+ * @brief Contagem de inversões por intercalação, LNDS por paciência, entropia
+ *
+ *  UMA PASSADA DE ORDENAÇÃO, TRÊS MÉTRICAS:
+ * ┌──────────────┐   ┌─────────────────────────┐   ┌────────────────────┐
+ * │ cópia dos    │ → │ intercalação de baixo   │ → │ cópia ordenada:    │
+ * │ dados        │   │ para cima; ao tirar da  │   │ grupos de chaves   │
+ * │              │   │ direita, soma o que     │   │ iguais → distintos │
+ * │              │   │ resta à esquerda        │   │ e entropia         │
+ * └──────────────┘   └─────────────────────────┘   └────────────────────┘
+ *
+ * Empates saem da metade esquerda primeiro, então chaves iguais não contam
+ * como inversão (mesmo critério de "a[i] > a[j]").
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy e snprintf
+#include <math.h>    // Para log2
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+/**
+ * @brief Linha acumulada para o CSV
+ */
+typedef struct {
+    char arquivo[64];
+    char versao[20];
+    ResultadoTempo resultado;
+} LinhaDesordem;
+
+static LinhaDesordem linhas_desordem[MAX_LINHAS_DESORDEM];
+static int num_linhas_desordem = 0;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static long long contar_inversoes(char *dados, char *auxiliar, int n, size_t elem_size, CompareFn cmp);
+static int maior_subsequencia_nao_decrescente(const char *dados, int n, size_t elem_size, CompareFn cmp);
+static void agrupar_chaves(const char *ordenados, int n, size_t elem_size, CompareFn cmp,
+                           MetricasDesordem *metricas);
+static int calcular_metricas(const void *dados, int n, size_t elem_size, CompareFn cmp,
+                             int corridas, MetricasDesordem *metricas);
+static void escrever_desordem_csv_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * CÁLCULO DAS MÉTRICAS
+ * ================================================================ */
+
+/**
+ * @brief Ordena `dados` por intercalação (de baixo para cima) contando inversões
+ *
+ * Ao final `dados` está ordenado; `auxiliar` tem o mesmo tamanho.
+ */
+static long long contar_inversoes(char *dados, char *auxiliar, int n, size_t elem_size, CompareFn cmp) {
+    long long inversoes = 0;
+    char *origem = dados;
+    char *destino = auxiliar;
+
+    for (int largura = 1; largura < n; largura *= 2) {
+        for (int inicio = 0; inicio < n; inicio += 2 * largura) {
+            int meio = inicio + largura < n ? inicio + largura : n;
+            int fim = inicio + 2 * largura < n ? inicio + 2 * largura : n;
+            int i = inicio, j = meio, k = inicio;
+
+            while (i < meio && j < fim) {
+                if (cmp(origem + (size_t)i * elem_size, origem + (size_t)j * elem_size) <= 0) {
+                    memcpy(destino + (size_t)k++ * elem_size, origem + (size_t)i++ * elem_size, elem_size);
+                } else {
+                    // Todos os que restam à esquerda são maiores que o elemento da direita
+                    inversoes += meio - i;
+                    memcpy(destino + (size_t)k++ * elem_size, origem + (size_t)j++ * elem_size, elem_size);
+                }
+            }
+            if (i < meio) memcpy(destino + (size_t)k * elem_size, origem + (size_t)i * elem_size, (size_t)(meio - i) * elem_size);
+            if (j < fim) memcpy(destino + (size_t)(k + meio - i) * elem_size, origem + (size_t)j * elem_size, (size_t)(fim - j) * elem_size);
+        }
+        char *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+
+    if (origem != dados) memcpy(dados, origem, (size_t)n * elem_size);
+    return inversoes;
+}
+
+/**
+ * @brief Comprimento da maior subsequência não decrescente em O(n log n)
+ *
+ * caudas[k] é o índice do menor último elemento entre as subsequências de
+ * comprimento k + 1; cada elemento substitui a primeira cauda maior que ele.
+ * Não decrescente (e não estritamente crescente) de propósito: os arquivos
+ * crescentes repetem chaves, e n - LNDS deve ser 0 para eles.
+ */
+static int maior_subsequencia_nao_decrescente(const char *dados, int n, size_t elem_size, CompareFn cmp) {
+    int *caudas = malloc((size_t)n * sizeof(int));
+    if (!caudas) return -1;
+
+    int comprimento = 0;
+    for (int i = 0; i < n; i++) {
+        const char *elemento = dados + (size_t)i * elem_size;
+        int baixo = 0, alto = comprimento;
+        while (baixo < alto) {
+            int meio = baixo + (alto - baixo) / 2;
+            if (cmp(dados + (size_t)caudas[meio] * elem_size, elemento) <= 0) {
+                baixo = meio + 1;
+            } else {
+                alto = meio;
+            }
+        }
+        caudas[baixo] = i;
+        if (baixo == comprimento) comprimento++;
+    }
+
+    free(caudas);
+    return comprimento;
+}
+
+/**
+ * @brief Chaves distintas e entropia a partir de uma sequência já ordenada
+ */
+static void agrupar_chaves(const char *ordenados, int n, size_t elem_size, CompareFn cmp,
+                           MetricasDesordem *metricas) {
+    int distintos = 0;
+    double entropia = 0.0;
+    for (int inicio = 0; inicio < n; ) {
+        int fim = inicio + 1;
+        while (fim < n && cmp(ordenados + (size_t)inicio * elem_size, ordenados + (size_t)fim * elem_size) == 0) fim++;
+        double p = (double)(fim - inicio) / (double)n;
+        entropia -= p * log2(p);
+        distintos++;
+        inicio = fim;
+    }
+    metricas->razao_distintos = (double)distintos / (double)n;
+    metricas->entropia = entropia;
+}
+
+/**
+ * @brief Núcleo comum; `corridas` > 0 dispensa a passada que as conta
+ */
+static int calcular_metricas(const void *dados, int n, size_t elem_size, CompareFn cmp,
+                             int corridas, MetricasDesordem *metricas) {
+    if (!metricas) return -1;
+    memset(metricas, 0, sizeof(*metricas));
+    if (!dados || !cmp || n <= 0 || elem_size == 0) return -1;
+
+    const char *base = (const char*)dados;
+    size_t bytes = (size_t)n * elem_size;
+    char *copia = malloc(bytes);
+    char *auxiliar = malloc(bytes);
+    if (!copia || !auxiliar) {
+        free(copia);
+        free(auxiliar);
+        return -1;
+    }
+
+    // Corridas: uma a mais que o número de descidas
+    if (corridas <= 0) {
+        int descidas = 0;
+        for (int i = 0; i + 1 < n; i++) {
+            if (cmp(base + (size_t)i * elem_size, base + (size_t)(i + 1) * elem_size) > 0) descidas++;
+        }
+        corridas = descidas + 1;
+    }
+    metricas->corridas = corridas;
+
+    int lnds = maior_subsequencia_nao_decrescente(base, n, elem_size, cmp);
+    if (lnds < 0) {
+        free(copia);
+        free(auxiliar);
+        return -1;
+    }
+    metricas->maior_subsequencia = lnds;
+
+    memcpy(copia, base, bytes);
+    metricas->inversoes = contar_inversoes(copia, auxiliar, n, elem_size, cmp);
+    double pares = (double)n * (double)(n - 1) / 2.0;
+    metricas->inversoes_relativas = pares > 0.0 ? (double)metricas->inversoes / pares : 0.0;
+
+    // Grupos de chaves iguais na cópia ordenada
+    agrupar_chaves(copia, n, elem_size, cmp, metricas);
+
+    free(copia);
+    free(auxiliar);
+    metricas->calculadas = 1;
+    return 0;
+}
+
+int calcular_metricas_desordem(const void *dados, int n, size_t elem_size, CompareFn cmp,
+                               MetricasDesordem *metricas) {
+    return calcular_metricas(dados, n, elem_size, cmp, 0, metricas);
+}
+
+int calcular_metricas_desordem_carga(const int *dados, int n, const EstatisticasCarga *carga,
+                                     MetricasDesordem *metricas) {
+    if (!carga || !carga->calculadas || carga->corridas <= 0) {
+        return calcular_metricas_desordem(dados, n, sizeof(int), comparar_inteiros, metricas);
+    }
+    if (carga->corridas > 1) {
+        return calcular_metricas(dados, n, sizeof(int), comparar_inteiros, carga->corridas, metricas);
+    }
+
+    // Uma só corrida: já ordenado, sem inversões e com LNDS = n
+    if (!metricas) return -1;
+    memset(metricas, 0, sizeof(*metricas));
+    if (!dados || n <= 0) return -1;
+    metricas->corridas = 1;
+    metricas->maior_subsequencia = n;
+    if (carga->minimo == carga->maximo) {
+        metricas->razao_distintos = 1.0 / (double)n;  // Constante: um grupo só
+    } else {
+        agrupar_chaves((const char*)dados, n, sizeof(int), comparar_inteiros, metricas);
+    }
+    metricas->calculadas = 1;
+    return 0;
+}
+
+/* ================================================================
+ * APRESENTAÇÃO
+ * ================================================================ */
+
+void descrever_metricas_desordem(const MetricasDesordem *metricas, int n,
+                                 char *buffer, size_t tamanho_buffer) {
+    if (!buffer || tamanho_buffer == 0) return;
+    if (!metricas || !metricas->calculadas) {
+        snprintf(buffer, tamanho_buffer, "nao calculado");
+        return;
+    }
+    snprintf(buffer, tamanho_buffer,
+             "inversoes %.1f%%, %d corridas, LNDS %d de %d, distintos %.1f%%, entropia %.2f bits",
+             metricas->inversoes_relativas * 100.0, metricas->corridas,
+             metricas->maior_subsequencia, n, metricas->razao_distintos * 100.0,
+             metricas->entropia);
+}
+
+void escrever_metricas_desordem(FILE *arquivo, const MetricasDesordem *metricas, int n) {
+    if (!metricas || !metricas->calculadas) return;
+
+    fprintf(arquivo, "PERFIL DA ENTRADA (pre-ordenacao):\n");
+    fprintf(arquivo, "- Inversoes: %lld (%.2f%% do maximo n(n-1)/2)\n",
+            metricas->inversoes, metricas->inversoes_relativas * 100.0);
+    fprintf(arquivo, "- Corridas ascendentes: %d (1 = ja ordenada, n = estritamente decrescente)\n",
+            metricas->corridas);
+    fprintf(arquivo, "- Maior subsequencia nao decrescente: %d de %d (%d fora do lugar)\n",
+            metricas->maior_subsequencia, n, n - metricas->maior_subsequencia);
+    fprintf(arquivo, "- Chaves distintas: %.2f%% | Entropia: %.3f bits (maximo log2 n = %.3f)\n\n",
+            metricas->razao_distintos * 100.0, metricas->entropia, n > 0 ? log2((double)n) : 0.0);
+}
+
+/* ================================================================
+ * CSV ACUMULADO
+ * ================================================================ */
+
+void desordem_limpar(void) {
+    num_linhas_desordem = 0;
+}
+
+void registrar_resultado_desordem(const ResultadoTempo *resultado, const char *arquivo,
+                                  const char *versao) {
+    if (!resultado || num_linhas_desordem >= MAX_LINHAS_DESORDEM) return;
+
+    LinhaDesordem *linha = &linhas_desordem[num_linhas_desordem++];
+    snprintf(linha->arquivo, sizeof(linha->arquivo), "%s", arquivo ? arquivo : "");
+    snprintf(linha->versao, sizeof(linha->versao), "%s", versao ? versao : "");
+    linha->resultado = *resultado;
+}
+
+static void escrever_desordem_csv_callback(FILE* arquivo, void* dados, int tamanho) {
+    const LinhaDesordem *linhas = (const LinhaDesordem*)dados;
+
+    fprintf(arquivo, "versao,arquivo,algoritmo,n,projetado,tempo_s,comparacoes,trocas,movimentacoes,"
+                     "inversoes,inversoes_relativas,corridas,maior_subsequencia_nao_decrescente,razao_distintos,entropia_bits\n");
+    for (int i = 0; i < tamanho; i++) {
+        const ResultadoTempo *r = &linhas[i].resultado;
+        const MetricasDesordem *m = &r->desordem;
+        fprintf(arquivo, "%s,%s,%s,%d,%d,%.9f,%lld,%lld,%lld,",
+                linhas[i].versao, linhas[i].arquivo, r->algoritmo, r->tamanho_dados,
+                r->projetado, r->tempo_execucao, r->comparacoes, r->trocas, r->movimentacoes);
+        if (m->calculadas) {
+            fprintf(arquivo, "%lld,%.6f,%d,%d,%.6f,%.6f\n", m->inversoes, m->inversoes_relativas,
+                    m->corridas, m->maior_subsequencia, m->razao_distintos, m->entropia);
+        } else {
+            fprintf(arquivo, ",,,,,\n");
+        }
+    }
+}
+
+void gerar_relatorio_desordem(void) {
+    if (num_linhas_desordem == 0) return;
+    salvar_arquivo_multiplos_locais("relatorios", "desordem_entradas.csv",
+                                    escrever_desordem_csv_callback, linhas_desordem,
+                                    num_linhas_desordem);
+}
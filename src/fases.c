@@ -0,0 +1,371 @@
+/**
+ * ================================================================
+ * INSTRUMENTAÇÃO POR FASES DOS ALGORITMOS
+ * ================================================================
+ *
+ * @file fases.c
+ * @brief Buffers de eventos por thread, totais por fase e exportação
+ *
+ *  ESTRUTURA POR THREAD:
+ * ┌────────────────────┐   ┌────────────────────┐   ┌─────────────────────┐
+ * │ Pilha de fases     │ → │ Eventos do trace   │   │ Totais por          │
+ * │ abertas (início,   │   │ (até PROFUNDIDADE_ │   │ (fase, versão):     │
+ * │ ticks dos filhos)  │ → │ MAXIMA_TRACE)      │   │ chamadas, incl/excl │
+ * └────────────────────┘   └────────────────────┘   └─────────────────────┘
+ *
+ * Cada thread grava apenas no próprio buffer (THREAD_LOCAL), sem travas.
+ * Os buffers são encadeados numa lista global por inserção atômica e só
+ * são lidos por fases_resumir() e gerar_relatorio_fases(), depois que as
+ * threads de medição terminaram.
+ *
+ *  LIMITES:
+ * Quick Sort em 10^6 elementos abre ~10^6 fases de partição. Apenas os
+ * níveis rasos vão para o trace (o arquivo continua abrível no Perfetto);
+ * os totais do resumo incluem todos os níveis. Eventos além da capacidade
+ * são contados como descartados.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>     // Para strcmp e memset
+#include <stdatomic.h>  // Para a lista global de buffers
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+/// Fase fechada, pronta para o trace
+typedef struct {
+    const char *nome;
+    long long valor;
+    int otimizada;
+    uint64_t inicio;
+    uint64_t duracao;
+} EventoFase;
+
+/// Fase ainda aberta na pilha
+typedef struct {
+    const char *nome;
+    long long valor;
+    int otimizada;
+    uint64_t inicio;
+    uint64_t ticks_filhos;
+} FaseAberta;
+
+/// Buffer de uma thread
+typedef struct BufferFases {
+    int id_thread;
+    EventoFase *eventos;
+    int num_eventos;
+    long long descartados;
+    FaseAberta pilha[MAX_PROFUNDIDADE_FASES];
+    int profundidade;   ///< Pode passar de MAX_PROFUNDIDADE_FASES (níveis ignorados)
+    ResumoFase totais[MAX_FASES_DISTINTAS];
+    int num_totais;
+    struct BufferFases *proximo;
+} BufferFases;
+
+static THREAD_LOCAL BufferFases *buffer_thread = NULL;
+static _Atomic(BufferFases *) lista_buffers = NULL;
+static atomic_int proximo_id_thread = 0;
+
+/// Célula reaproveitada do cache de resultados: não rodou, não tem fases
+typedef struct {
+    char algoritmo[30];
+    int otimizada;
+    char arquivo[64];
+    int tamanho;
+} CelulaCacheFases;
+
+static CelulaCacheFases celulas_cache[MAX_CELULAS_CACHE_FASES];
+static int num_celulas_cache = 0;  ///< Pode passar de MAX_CELULAS_CACHE_FASES (só conta)
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static BufferFases* obter_buffer_thread(void);
+static void acumular_total(ResumoFase *totais, int *num_totais, int max_totais,
+                           const char *nome, int otimizada, long long chamadas,
+                           uint64_t inclusivo, uint64_t exclusivo);
+static void escrever_trace_fases_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_resumo_fases_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * BUFFERS POR THREAD
+ * ================================================================ */
+
+/**
+ * @brief Cria (na primeira fase) e registra o buffer da thread corrente
+ */
+static BufferFases* obter_buffer_thread(void) {
+    if (buffer_thread) return buffer_thread;
+
+    BufferFases *buffer = calloc(1, sizeof(BufferFases));
+    if (!buffer) return NULL;
+    buffer->eventos = malloc(MAX_EVENTOS_FASE * sizeof(EventoFase));
+    if (!buffer->eventos) {
+        free(buffer);
+        return NULL;
+    }
+    buffer->id_thread = atomic_fetch_add(&proximo_id_thread, 1);
+
+    // Inserção sem trava no início da lista global
+    BufferFases *cabeca = atomic_load(&lista_buffers);
+    do {
+        buffer->proximo = cabeca;
+    } while (!atomic_compare_exchange_weak(&lista_buffers, &cabeca, buffer));
+
+    buffer_thread = buffer;
+    return buffer;
+}
+
+/**
+ * @brief Soma uma contribuição ao total de (nome, versão)
+ */
+static void acumular_total(ResumoFase *totais, int *num_totais, int max_totais,
+                           const char *nome, int otimizada, long long chamadas,
+                           uint64_t inclusivo, uint64_t exclusivo) {
+    for (int i = 0; i < *num_totais; i++) {
+        if (totais[i].otimizada == otimizada &&
+            (totais[i].nome == nome || strcmp(totais[i].nome, nome) == 0)) {
+            totais[i].chamadas += chamadas;
+            totais[i].ticks_inclusivo += inclusivo;
+            totais[i].ticks_exclusivo += exclusivo;
+            return;
+        }
+    }
+    if (*num_totais >= max_totais) return;
+
+    ResumoFase *novo = &totais[(*num_totais)++];
+    novo->nome = nome;
+    novo->otimizada = otimizada;
+    novo->chamadas = chamadas;
+    novo->ticks_inclusivo = inclusivo;
+    novo->ticks_exclusivo = exclusivo;
+}
+
+/* ================================================================
+ * ABERTURA E FECHAMENTO DE FASES
+ * ================================================================ */
+
+void fase_iniciar(const char *nome, long long valor) {
+    BufferFases *buffer = obter_buffer_thread();
+    if (!buffer) return;
+
+    int nivel = buffer->profundidade++;
+    if (nivel >= MAX_PROFUNDIDADE_FASES) return;
+
+    FaseAberta *fase = &buffer->pilha[nivel];
+    fase->nome = nome;
+    fase->valor = valor;
+    fase->otimizada = usar_versao_otimizada;
+    fase->ticks_filhos = 0;
+    fase->inicio = cronometro_iniciar();  // Por último: não mede a própria contabilidade
+}
+
+void fase_encerrar(void) {
+    uint64_t fim = cronometro_parar();
+    BufferFases *buffer = buffer_thread;
+    if (!buffer || buffer->profundidade == 0) return;
+
+    int nivel = --buffer->profundidade;
+    if (nivel >= MAX_PROFUNDIDADE_FASES) return;
+
+    FaseAberta *fase = &buffer->pilha[nivel];
+    uint64_t duracao = cronometro_decorrido(fase->inicio, fim);
+    uint64_t exclusivo = (duracao > fase->ticks_filhos) ? duracao - fase->ticks_filhos : 0;
+    if (nivel > 0) {
+        buffer->pilha[nivel - 1].ticks_filhos += duracao;
+    }
+
+    acumular_total(buffer->totais, &buffer->num_totais, MAX_FASES_DISTINTAS,
+                   fase->nome, fase->otimizada, 1, duracao, exclusivo);
+
+    if (nivel < PROFUNDIDADE_MAXIMA_TRACE) {
+        if (buffer->num_eventos < MAX_EVENTOS_FASE) {
+            EventoFase *evento = &buffer->eventos[buffer->num_eventos++];
+            evento->nome = fase->nome;
+            evento->valor = fase->valor;
+            evento->otimizada = fase->otimizada;
+            evento->inicio = fase->inicio;
+            evento->duracao = duracao;
+        } else {
+            buffer->descartados++;
+        }
+    }
+}
+
+/* ================================================================
+ * CONSULTA
+ * ================================================================ */
+
+int fases_instrumentacao_ativa(void) {
+#ifdef SORTS_INSTRUMENTAR_FASES
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void fases_limpar(void) {
+    for (BufferFases *b = atomic_load(&lista_buffers); b; b = b->proximo) {
+        b->num_eventos = 0;
+        b->descartados = 0;
+        b->num_totais = 0;
+        b->profundidade = 0;
+    }
+    num_celulas_cache = 0;
+}
+
+void fases_registrar_celula_cache(const char *algoritmo, int otimizada,
+                                  const char *arquivo, int tamanho) {
+    if (num_celulas_cache < MAX_CELULAS_CACHE_FASES) {
+        CelulaCacheFases *c = &celulas_cache[num_celulas_cache];
+        snprintf(c->algoritmo, sizeof(c->algoritmo), "%s", algoritmo ? algoritmo : "?");
+        snprintf(c->arquivo, sizeof(c->arquivo), "%s", arquivo ? arquivo : "?");
+        c->otimizada = otimizada;
+        c->tamanho = tamanho;
+    }
+    num_celulas_cache++;
+}
+
+int fases_resumir(ResumoFase *resumo, int max_fases) {
+    int num = 0;
+    for (BufferFases *b = atomic_load(&lista_buffers); b; b = b->proximo) {
+        for (int i = 0; i < b->num_totais; i++) {
+            const ResumoFase *t = &b->totais[i];
+            acumular_total(resumo, &num, max_fases, t->nome, t->otimizada,
+                           t->chamadas, t->ticks_inclusivo, t->ticks_exclusivo);
+        }
+    }
+    return num;
+}
+
+/* ================================================================
+ * EXPORTAÇÃO
+ * ================================================================ */
+
+/**
+ * @brief Escreve o trace no formato Chrome trace-event (JSON)
+ *
+ * Tempos em microssegundos a partir do primeiro evento; cada buffer vira
+ * uma "thread" no Perfetto, nomeada por um evento de metadados "M".
+ */
+static void escrever_trace_fases_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)dados;
+    (void)tamanho;
+
+    uint64_t origem = UINT64_MAX;
+    for (BufferFases *b = atomic_load(&lista_buffers); b; b = b->proximo) {
+        for (int i = 0; i < b->num_eventos; i++) {
+            if (b->eventos[i].inicio < origem) origem = b->eventos[i].inicio;
+        }
+    }
+
+    fprintf(arquivo, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    int primeiro = 1;
+    for (BufferFases *b = atomic_load(&lista_buffers); b; b = b->proximo) {
+        fprintf(arquivo, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                         "\"args\":{\"name\":\"medicao %d\"}}",
+                primeiro ? "" : ",\n", b->id_thread, b->id_thread);
+        primeiro = 0;
+
+        for (int i = 0; i < b->num_eventos; i++) {
+            const EventoFase *e = &b->eventos[i];
+            fprintf(arquivo, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                             "\"ts\":%.3f,\"dur\":%.3f",
+                    e->nome, e->otimizada ? "otimizada" : "didatica", b->id_thread,
+                    ticks_para_segundos(e->inicio - origem) * 1e6,
+                    ticks_para_segundos(e->duracao) * 1e6);
+            if (e->valor >= 0) {
+                fprintf(arquivo, ",\"args\":{\"valor\":%lld}", e->valor);
+            }
+            fprintf(arquivo, "}");
+        }
+    }
+    fprintf(arquivo, "\n],\"otherData\":{\"celulas_do_cache_sem_fases\":%d}}\n", num_celulas_cache);
+}
+
+/**
+ * @brief Escreve a tabela de totais por fase
+ */
+static void escrever_resumo_fases_callback(FILE* arquivo, void* dados, int tamanho) {
+    const ResumoFase *resumo = (const ResumoFase*)dados;
+
+    long long eventos = 0, descartados = 0;
+    for (BufferFases *b = atomic_load(&lista_buffers); b; b = b->proximo) {
+        eventos += b->num_eventos;
+        descartados += b->descartados;
+    }
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "              RESUMO DE TEMPO POR FASE DOS ALGORITMOS           \n");
+    fprintf(arquivo, "================================================================\n\n");
+
+    fprintf(arquivo, "+----------------------------+-----------+------------+--------------+--------------+\n");
+    fprintf(arquivo, "| Fase                       | Versao    | Chamadas   | Inclusivo(s) | Exclusivo(s) |\n");
+    fprintf(arquivo, "+----------------------------+-----------+------------+--------------+--------------+\n");
+    for (int i = 0; i < tamanho; i++) {
+        fprintf(arquivo, "| %-26s | %-9s | %10lld | %12.6f | %12.6f |\n",
+                resumo[i].nome,
+                resumo[i].otimizada ? "otimizada" : "didatica",
+                resumo[i].chamadas,
+                ticks_para_segundos(resumo[i].ticks_inclusivo),
+                ticks_para_segundos(resumo[i].ticks_exclusivo));
+    }
+    fprintf(arquivo, "+----------------------------+-----------+------------+--------------+--------------+\n\n");
+
+    if (num_celulas_cache > 0) {
+        fprintf(arquivo, "CELULAS REAPROVEITADAS DO CACHE (%d): nao rodaram nesta execucao e\n", num_celulas_cache);
+        fprintf(arquivo, "nao entram nos totais acima; apague output/cache_resultados.tsv (ou use\n");
+        fprintf(arquivo, "SORTS_SEM_CACHE=1) para medi-las de novo com fases\n");
+        int listadas = num_celulas_cache < MAX_CELULAS_CACHE_FASES ? num_celulas_cache : MAX_CELULAS_CACHE_FASES;
+        for (int i = 0; i < listadas; i++) {
+            fprintf(arquivo, "  %-20s %-9s %s (n=%d)\n", celulas_cache[i].algoritmo,
+                    celulas_cache[i].otimizada ? "otimizada" : "didatica",
+                    celulas_cache[i].arquivo, celulas_cache[i].tamanho);
+        }
+        if (num_celulas_cache > listadas) {
+            fprintf(arquivo, "  ... e mais %d\n", num_celulas_cache - listadas);
+        }
+        fprintf(arquivo, "\n");
+    }
+
+    fprintf(arquivo, "OBSERVACOES:\n");
+    fprintf(arquivo, "- Fases com o nome do algoritmo envolvem a ordenacao inteira (medir_algoritmo)\n");
+    fprintf(arquivo, "- Exclusivo = inclusivo menos as fases aninhadas; em fases recursivas\n");
+    fprintf(arquivo, "  (quick: recursao) o inclusivo conta o mesmo intervalo uma vez por nivel\n");
+    fprintf(arquivo, "- Shell Sort: o gap de cada fase esta no campo args.valor do trace\n");
+    fprintf(arquivo, "- Trace: %lld eventos ate o nivel %d em fases_trace.json", eventos,
+            PROFUNDIDADE_MAXIMA_TRACE);
+    if (descartados > 0) {
+        fprintf(arquivo, " (%lld descartados por falta de espaco)", descartados);
+    }
+    fprintf(arquivo, "\n- Abra o trace em https://ui.perfetto.dev ou chrome://tracing\n");
+}
+
+void gerar_relatorio_fases(void) {
+    if (!fases_instrumentacao_ativa()) {
+        printf("Instrumentacao por fases desativada nesta compilacao\n");
+        printf("(configure com -DSORTS_INSTRUMENTAR_FASES=ON para gerar o trace)\n");
+        return;
+    }
+
+    ResumoFase resumo[MAX_FASES_DISTINTAS];
+    int num_fases = fases_resumir(resumo, MAX_FASES_DISTINTAS);
+    if (num_fases == 0 && num_celulas_cache == 0) {
+        printf("Nenhuma fase registrada.\n");
+        return;
+    }
+
+    salvar_arquivo_multiplos_locais("relatorios", "fases_trace.json",
+                                    escrever_trace_fases_callback, NULL, 0);
+    salvar_arquivo_multiplos_locais("relatorios", "fases_resumo.txt",
+                                    escrever_resumo_fases_callback, resumo, num_fases);
+    if (num_celulas_cache > 0) {
+        printf("Fases: %d celula(s) vieram do cache e nao tem fases nesta execucao "
+               "(listadas em fases_resumo.txt)\n", num_celulas_cache);
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * ================================================================
+ * GERADOR DE DADOS SINTÉTICOS PARA EXPERIMENTOS DE ESCALA
+ * ================================================================
+ *
+ * @file gerador.c
+ * @brief Implementação das distribuições de entrada em tamanhos arbitrários
+ *
+ *  MOTIVAÇÃO:
+ * A validação empírica de complexidade exige medir cada algoritmo em uma
+ * progressão geométrica de tamanhos (2^8, 2^9, ..., 2^26). Não é viável
+ * manter arquivos para todos esses tamanhos, então os dados são gerados
+ * em memória, imitando as características dos arquivos de `data/`.
+ *
+ *  DISTRIBUIÇÕES:
+ * ┌──────────────┬──────────────────────────────────────────────────────┐
+ * │ aleatorios   │ Uniforme em [0, VALOR_MAXIMO_GERADO)                 │
+ * │ crescentes   │ Soma acumulada de passos aleatórios (com repetições) │
+ * │ decrescentes │ Espelho da sequência crescente                       │
+ * │ zipf         │ P(k) ∝ 1/k^EXPOENTE_ZIPF: cauda longa, muitas repet. │
+ * │ agrupados    │ NUM_AGRUPAMENTOS centros ± ruído triangular estreito │
+ * └──────────────┴──────────────────────────────────────────────────────┘
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <math.h>  // Para pow, floor
+
+#define EXPOENTE_ZIPF 1.1          ///< s > 1: a massa se concentra nos primeiros valores
+#define NUM_AGRUPAMENTOS 16        ///< Centros da distribuição agrupada
+#define LARGURA_AGRUPAMENTO 2000   ///< Meia-largura do ruído em torno de cada centro
+
+/* ================================================================
+ * GERADOR PSEUDOALEATÓRIO
+ * ================================================================ */
+
+/**
+ * @brief SplitMix64: gerador pequeno, rápido e de boa qualidade estatística
+ *
+ * Escolhido por não depender de rand() (cuja qualidade e período variam
+ * entre plataformas) e por manter todo o estado em uma única variável,
+ * o que torna a geração reprodutível e livre de estado global.
+ */
+uint64_t gerador_proximo(uint64_t *estado) {
+    uint64_t z = (*estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* ================================================================
+ * DISTRIBUIÇÕES DE ENTRADA
+ * ================================================================ */
+
+/**
+ * @brief Gera sequência não-decrescente cobrindo [0, VALOR_MAXIMO_GERADO)
+ *
+ * Cada passo é sorteado em [0, 2·VALOR_MAXIMO_GERADO/n], de modo que a
+ * sequência termina próxima do valor máximo independentemente de n.
+ * Para n > VALOR_MAXIMO_GERADO os passos são 0 ou 1 (muitas repetições),
+ * como acontece com dados reais ordenados.
+ */
+static void gerar_crescente(int *destino, int n, uint64_t *estado) {
+    double passo_maximo = 2.0 * VALOR_MAXIMO_GERADO / (double)n;
+    double acumulado = 0.0;
+
+    for (int i = 0; i < n; i++) {
+        // Fração uniforme em [0, 1) a partir dos 53 bits mais altos
+        double u = (double)(gerador_proximo(estado) >> 11) / 9007199254740992.0;
+        acumulado += u * passo_maximo;
+        if (acumulado > VALOR_MAXIMO_GERADO - 1) {
+            acumulado = VALOR_MAXIMO_GERADO - 1;
+        }
+        destino[i] = (int)acumulado;
+    }
+}
+
+/**
+ * @brief Zipf contínua em [0, VALOR_MAXIMO_GERADO) pela inversa da CDF
+ *
+ * Para densidade ∝ x^-s em [1, N], x = ((N^(1-s) − 1)·u + 1)^(1/(1-s));
+ * o piso dá valores inteiros com P(k) ≈ 1/k^s, sem tabela de N entradas.
+ */
+static void gerar_zipf(int *destino, int n, uint64_t *estado) {
+    double expoente = 1.0 - EXPOENTE_ZIPF;
+    double escala = pow((double)VALOR_MAXIMO_GERADO, expoente) - 1.0;
+
+    for (int i = 0; i < n; i++) {
+        double u = (double)(gerador_proximo(estado) >> 11) / 9007199254740992.0;
+        double x = floor(pow(escala * u + 1.0, 1.0 / expoente));
+        if (x > VALOR_MAXIMO_GERADO) x = VALOR_MAXIMO_GERADO;
+        destino[i] = (int)x - 1;
+    }
+}
+
+/**
+ * @brief Aglomerados: centro sorteado entre NUM_AGRUPAMENTOS + ruído triangular
+ *
+ * A CDF resultante tem degraus íngremes separados por faixas vazias, o
+ * pior caso de um modelo linear por partes com poucos segmentos.
+ */
+static void gerar_agrupada(int *destino, int n, uint64_t *estado) {
+    int centros[NUM_AGRUPAMENTOS];
+    for (int c = 0; c < NUM_AGRUPAMENTOS; c++) {
+        centros[c] = (int)(gerador_proximo(estado) % VALOR_MAXIMO_GERADO);
+    }
+
+    for (int i = 0; i < n; i++) {
+        uint64_t r = gerador_proximo(estado);
+        // Soma de dois uniformes: ruído triangular em [-LARGURA, LARGURA]
+        int ruido = (int)((r >> 8) % (LARGURA_AGRUPAMENTO + 1)) +
+                    (int)((r >> 36) % (LARGURA_AGRUPAMENTO + 1)) - LARGURA_AGRUPAMENTO;
+        int valor = centros[r % NUM_AGRUPAMENTOS] + ruido;
+        if (valor < 0) valor = 0;
+        if (valor > VALOR_MAXIMO_GERADO - 1) valor = VALOR_MAXIMO_GERADO - 1;
+        destino[i] = valor;
+    }
+}
+
+void gerar_numeros(int *destino, int n, DistribuicaoDados distribuicao, uint64_t semente) {
+    if (!destino || n <= 0) return;
+
+    uint64_t estado = semente;
+
+    switch (distribuicao) {
+        case DIST_CRESCENTE:
+            gerar_crescente(destino, n, &estado);
+            break;
+
+        case DIST_DECRESCENTE:
+            // Gera crescente e espelha: mantém o mesmo perfil de repetições
+            gerar_crescente(destino, n, &estado);
+            for (int i = 0, j = n - 1; i < j; i++, j--) {
+                int temp = destino[i];
+                destino[i] = destino[j];
+                destino[j] = temp;
+            }
+            break;
+
+        case DIST_ZIPF:
+            gerar_zipf(destino, n, &estado);
+            break;
+
+        case DIST_AGRUPADA:
+            gerar_agrupada(destino, n, &estado);
+            break;
+
+        case DIST_ALEATORIA:
+        default:
+            for (int i = 0; i < n; i++) {
+                destino[i] = (int)(gerador_proximo(&estado) % VALOR_MAXIMO_GERADO);
+            }
+            break;
+    }
+}
+
+const char* nome_distribuicao(DistribuicaoDados distribuicao) {
+    switch (distribuicao) {
+        case DIST_ALEATORIA:   return "aleatorios";
+        case DIST_CRESCENTE:   return "crescentes";
+        case DIST_DECRESCENTE: return "decrescentes";
+        case DIST_ZIPF:        return "zipf";
+        case DIST_AGRUPADA:    return "agrupados";
+        default:               return "desconhecida";
+    }
+}
@@ -71,8 +71,9 @@
 // Removendo definição local conflitante da estrutura Aluno
 // A definição correta está em tipos.h como typedef
 
-// Declaração da função auxiliar
+// Declaração das funções auxiliares
 static void criar_diretorio_se_necessario(const char* caminho);
+static uint64_t misturar_valor(int valor);
 
 /* ================================================================
  * FUNÇÕES DE COMPARAÇÃO OTIMIZADAS PARA DIFERENTES TIPOS
@@ -103,15 +104,16 @@ static void criar_diretorio_se_necessario(const char* caminho);
  * ┌─────────────────────────┬─────────────────┬─────────────────────────┐
  * │ Implementação           │ Operações CPU   │ Branches                │
  * ├─────────────────────────┼─────────────────┼─────────────────────────┤
- * │ Aritmética (esta)       │ 2 (load, sub)   │ 0                       │
+ * │ Subtração (a - b)       │ 2 (load, sub)   │ 0, mas transborda       │
  * │ If-else tradicional     │ 4+ (load,cmp,jmp│ 2-3                     │
- * │ Ternário otimizado      │ 3 (load,cmp,sel)│ 0-1 (dep. compilador)   │
+ * │ (a > b) - (a < b) (esta)│ 4 (cmp, setcc)  │ 0                       │
  * └─────────────────────────┴─────────────────┴─────────────────────────┘
  *
  *  SEGURANÇA NUMÉRICA:
- * Para dados controlados de teste (números típicos), a subtração direta
- * é segura. Em contextos com valores extremos próximos a INT_MAX/INT_MIN,
- * considerar implementação com validação de overflow.
+ * A subtração direta transborda quando os sinais diferem e a distância
+ * passa de INT_MAX (ex.: INT_MIN - 1 vira positivo), invertendo a ordem.
+ * As duas comparações compilam para setcc sem desvios e valem para toda
+ * a faixa de int (encontrado pela verificação diferencial).
  *
  *  INTEGRAÇÃO COM ALGORITMOS:
  * Esta função é chamada milhares de vezes durante algoritmos de ordenação.
@@ -120,7 +122,7 @@ static void criar_diretorio_se_necessario(const char* caminho);
  *
  * @param a Ponteiro para primeiro inteiro (será dereferenciado)
  * @param b Ponteiro para segundo inteiro (será dereferenciado)
- * @return Diferença aritmética (a - b):
+ * @return Sinal da comparação:
  *         - < 0 se a < b (ordem crescente: a deve vir antes de b)
  *         - = 0 se a == b (elementos equivalentes)
  *         - > 0 se a > b (ordem crescente: a deve vir depois de b)
@@ -132,8 +134,8 @@ int comparar_inteiros(const void *a, const void *b) {
     const int *ia = (const int *)a;
     const int *ib = (const int *)b;
 
-    // Comparação aritmética direta - mais eficiente que estruturas condicionais
-    return (*ia - *ib);
+    // Sem subtração: não transborda com valores de sinais opostos
+    return (*ia > *ib) - (*ia < *ib);
 }
 
 /**
@@ -243,6 +245,32 @@ int comparar_alunos(const void *a, const void *b) {
  * @return Ponteiro para array dinâmico com os números, ou NULL se erro
  */
 int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
+    return ler_numeros_com_estatisticas(caminho_arquivo, tamanho, NULL);
+}
+
+/**
+ * @brief Hash de 64 bits de um valor (finalizador do splitmix64)
+ *
+ * Somados, formam a assinatura de multiconjunto: a soma é comutativa,
+ * então qualquer permutação dos mesmos valores dá o mesmo resultado.
+ */
+static uint64_t misturar_valor(int valor) {
+    uint64_t z = (uint64_t)(uint32_t)valor + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Estágio fundido: conversão e estatísticas na mesma passada
+ *
+ * O laço de leitura já tem cada valor em registrador; atualizar as
+ * estatísticas ali evita que o registro de conjuntos, a conferência das
+ * saídas e o perfil da entrada percorram o array de novo.
+ */
+int* ler_numeros_com_estatisticas(const char* caminho_arquivo, int* tamanho,
+                                  EstatisticasCarga *estatisticas) {
+    SONDA_IO_INICIO(SONDA_IO_LER_NUMEROS, sizeof(int));
     // Lista de caminhos possíveis para encontrar o arquivo
 
     char caminho_completo[MAX_PATH];
@@ -266,6 +294,7 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
 
     if (!arquivo) {
         printf("ERRO: Nao foi possivel abrir o arquivo %s\n", caminho_arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_NUMEROS, -1, sizeof(int));
         return NULL;
     }
 
@@ -274,6 +303,7 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
     if (!fgets(linha, sizeof(linha), arquivo)) {
         printf("ERRO: Arquivo vazio ou formato invalido\n");
         fclose(arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_NUMEROS, -1, sizeof(int));
         return NULL;
     }
 
@@ -285,6 +315,7 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
     if (endptr == linha || count_from_file < 0 || count_from_file > INT_MAX) {
         printf("ERRO: Formato de cabecalho invalido\n");
         fclose(arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_NUMEROS, -1, sizeof(int));
         return NULL;
     }
 
@@ -295,11 +326,17 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
     if (!numeros) {
         printf("ERRO: Falha na alocacao de memoria\n");
         fclose(arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_NUMEROS, -1, sizeof(int));
         return NULL;
     }
 
     // Leitura dos dados (agora sem a primeira linha que já foi lida)
     int indice_valido = 0;
+    EstatisticasCarga e;
+    memset(&e, 0, sizeof(e));
+    e.checksum = CHECKSUM_DADOS_INICIAL;
+    e.minimo = INT_MAX;
+    e.maximo = INT_MIN;
 
     while (fgets(linha, sizeof(linha), arquivo) && indice_valido < count) {
         char *endptr_inner;
@@ -307,11 +344,27 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
 
         // Verifica se a conversão foi bem-sucedida e está dentro dos limites
         if (endptr_inner != linha && val >= INT_MIN && val <= INT_MAX) {
-            numeros[indice_valido] = (int)val;
+            int valor = (int)val;
+            numeros[indice_valido] = valor;
+
+            if (estatisticas) {
+                if (valor < e.minimo) e.minimo = valor;
+                if (valor > e.maximo) e.maximo = valor;
+                if (indice_valido == 0 || valor < numeros[indice_valido - 1]) e.corridas++;
+                e.histograma[((uint32_t)valor ^ 0x80000000u) >> 24]++;
+                e.checksum = continuar_checksum_dados(e.checksum, &valor, sizeof(valor));
+                e.assinatura += misturar_valor(valor);
+            }
             indice_valido++;
         }
     }
 
+    if (estatisticas) {
+        if (indice_valido == 0) e.minimo = e.maximo = 0;
+        e.calculadas = 1;
+        *estatisticas = e;
+    }
+
     fclose(arquivo);
 
     // Verifica se o número de elementos lidos corresponde ao declarado no cabeçalho
@@ -322,9 +375,26 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
     }
 
     *tamanho = indice_valido;
+    SONDA_IO_FIM(SONDA_IO_LER_NUMEROS, indice_valido, sizeof(int));
     return numeros;
 }
 
+int conferir_saida_ordenada(const int *saida, int tamanho, const EstatisticasCarga *estatisticas) {
+    if (!saida || !estatisticas || !estatisticas->calculadas) return 0;
+
+    uint64_t assinatura = 0;
+    for (int i = 0; i < tamanho; i++) {
+        if (i > 0 && saida[i] < saida[i - 1]) return 1;
+        assinatura += misturar_valor(saida[i]);
+    }
+
+    // Ordenada, os extremos ficam nas pontas
+    if (tamanho > 0 && (saida[0] != estatisticas->minimo || saida[tamanho - 1] != estatisticas->maximo)) {
+        return 2;
+    }
+    return assinatura == estatisticas->assinatura ? 0 : 2;
+}
+
 /**
  * @brief Lê dados de alunos de arquivo CSV com validação
  *
@@ -338,6 +408,10 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
  * João Silva,15/03/1995,Centro,São Paulo
  * Maria Santos,22/07/1994,Vila Nova,São Paulo
  *
+ * Registros de pessoas (data/registros_pessoas_1000.txt): primeira linha
+ * só com a contagem e colunas nome,sexo,data_nascimento,cidade. Sem
+ * bairro, o campo fica vazio e comparar_alunos desempata pelo nome.
+ *
  * Validações realizadas:
  * - Verificação de formato de linha
  * - Limite de tamanho dos campos
@@ -349,6 +423,7 @@ int* ler_numeros(const char* caminho_arquivo, int* tamanho) {
  * @return Ponteiro para array dinâmico de estruturas Aluno, ou NULL se erro
  */
 Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
+    SONDA_IO_INICIO(SONDA_IO_LER_ALUNOS, sizeof(Aluno));
     // Mesmo sistema de múltiplos caminhos usado para números
 
     char caminho_completo[MAX_PATH];
@@ -371,13 +446,20 @@ Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
 
     if (!arquivo) {
         printf("ERRO: Nao foi possivel abrir o arquivo %s\n", caminho_arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_ALUNOS, -1, sizeof(Aluno));
         return NULL;
     }
 
     // Primeira passagem: contar linhas válidas
     int count = 0;
+    int formato_pessoas = -1;  // Decidido pela primeira linha
     char linha[512];
     while (fgets(linha, sizeof(linha), arquivo)) {
+        if (formato_pessoas < 0) {
+            // Cabeçalho só com a contagem: layout nome,sexo,data,cidade
+            size_t digitos = strspn(linha, "0123456789");
+            formato_pessoas = digitos > 0 && strspn(linha + digitos, "\r\n") == strlen(linha + digitos);
+        }
         // Ignora linhas vazias ou muito curtas
         if (strlen(linha) > 10) { // Linha mínima: "a,b,c,d\n"
             count++;
@@ -387,14 +469,16 @@ Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
     if (count == 0) {
         printf("ERRO: Arquivo vazio ou sem dados validos\n");
         fclose(arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_ALUNOS, -1, sizeof(Aluno));
         return NULL;
     }
 
-    // Alocação para array de alunos
-    Aluno* alunos = malloc(count * sizeof(Aluno));
+    // Alocação para array de alunos (zerada: bytes após cada '\0' entram no checksum do cache)
+    Aluno* alunos = calloc(count, sizeof(Aluno));
     if (!alunos) {
         printf("ERRO: Falha na alocacao de memoria para alunos\n");
         fclose(arquivo);
+        SONDA_IO_FIM(SONDA_IO_LER_ALUNOS, -1, sizeof(Aluno));
         return NULL;
     }
 
@@ -426,6 +510,12 @@ Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
         *token4 = '\0';
         token4++;
 
+        if (formato_pessoas) {
+            // nome,sexo,data,cidade: o sexo é descartado e o bairro fica vazio
+            token2 = token3;
+            token3 = token4 + strlen(token4);  // String vazia
+        }
+
         // Copia dados para a estrutura com verificação de tamanho
         strncpy(alunos[indice].nome, token1, sizeof(alunos[indice].nome) - 1);
         strncpy(alunos[indice].data_nascimento, token2, sizeof(alunos[indice].data_nascimento) - 1);
@@ -443,6 +533,7 @@ Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
 
     fclose(arquivo);
     *tamanho = indice;
+    SONDA_IO_FIM(SONDA_IO_LER_ALUNOS, indice, sizeof(Aluno));
     return alunos;
 }
 
@@ -462,6 +553,7 @@ Aluno* ler_alunos(const char* caminho_arquivo, int* tamanho) {
  * @param tamanho Número de elementos no array
  */
 void salvar_numeros(const char* caminho_arquivo, int arr[], int tamanho) {
+    SONDA_IO_INICIO(SONDA_IO_SALVAR_NUMEROS, sizeof(int));
     // Lista de caminhos possíveis para salvar o arquivo
     const char* formato_caminhos[] = {
         "output/numeros/%s",     // Diretório padrão de saída
@@ -497,6 +589,7 @@ void salvar_numeros(const char* caminho_arquivo, int arr[], int tamanho) {
 
     if (!arquivo) {
         printf("ERRO: Nao foi possivel criar arquivo para salvar numeros: %s\n", caminho_arquivo);
+        SONDA_IO_FIM(SONDA_IO_SALVAR_NUMEROS, -1, sizeof(int));
         return;
     }
 
@@ -506,6 +599,7 @@ void salvar_numeros(const char* caminho_arquivo, int arr[], int tamanho) {
     }
 
     fclose(arquivo);
+    SONDA_IO_FIM(SONDA_IO_SALVAR_NUMEROS, tamanho, sizeof(int));
     printf("Arquivo de numeros salvo com sucesso: %d elementos\n", tamanho);
 }
 
@@ -524,6 +618,7 @@ void salvar_numeros(const char* caminho_arquivo, int arr[], int tamanho) {
  * @param tamanho Número de elementos no array
  */
 void salvar_alunos(const char* caminho_arquivo, Aluno arr[], int tamanho) {
+    SONDA_IO_INICIO(SONDA_IO_SALVAR_ALUNOS, sizeof(Aluno));
     // Lista de caminhos possíveis para salvar o arquivo
     const char* formato_caminhos[] = {
         "output/alunos/%s",      // Diretório padrão de saída
@@ -559,6 +654,7 @@ void salvar_alunos(const char* caminho_arquivo, Aluno arr[], int tamanho) {
 
     if (!arquivo) {
         printf("ERRO: Nao foi possivel criar arquivo para salvar alunos: %s\n", caminho_arquivo);
+        SONDA_IO_FIM(SONDA_IO_SALVAR_ALUNOS, -1, sizeof(Aluno));
         return;
     }
 
@@ -572,6 +668,7 @@ void salvar_alunos(const char* caminho_arquivo, Aluno arr[], int tamanho) {
     }
 
     fclose(arquivo);
+    SONDA_IO_FIM(SONDA_IO_SALVAR_ALUNOS, tamanho, sizeof(Aluno));
     printf("Arquivo de alunos salvo com sucesso: %d elementos\n", tamanho);
 }
 
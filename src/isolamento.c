@@ -0,0 +1,342 @@
+/**
+ * ================================================================
+ * CONTROLES DE ISOLAMENTO DAS MEDIÇÕES
+ * ================================================================
+ *
+ * @file isolamento.c
+ * @brief Fixação de CPU, pré-falha, mlock e preparação de cache
+ *
+ *  ONDE CADA CONTROLE ATUA EM medir_algoritmo():
+ * ┌─────────────────────┐   ┌──────────────────────┐   ┌─────────────────┐
+ * │ Antes do laço:      │ → │ Antes de cada        │ → │ Depois do laço: │
+ * │ prefault + mlock    │   │ execução: aquece ou  │   │ munlock         │
+ * │ (dados e backup)    │   │ esfria a cache       │   │                 │
+ * └─────────────────────┘   └──────────────────────┘   └─────────────────┘
+ *
+ * A fixação de CPU é aplicada uma vez, na thread que chama
+ * configurar_isolamento(). Threads de trabalho da matriz paralela já se
+ * fixam sozinhas; estado_fixacao_thread() consulta a thread corrente, então
+ * o registro em cada resultado reflete o que realmente aconteceu.
+ *
+ *  EXPULSÃO DA CACHE:
+ * O buffer de varredura é alocado uma única vez (FATOR_VARREDURA_LLC vezes
+ * a LLC, entre 16 e 256 MiB) e apenas LIDO antes de cada execução. Leitura
+ * basta para substituir as linhas dos dados e permite que várias threads
+ * compartilhem o mesmo buffer sem condição de corrida.
+ *
+ * ================================================================
+ */
+
+#if defined(__linux__)
+    #define _GNU_SOURCE      // Para sched_getaffinity e CPU_COUNT
+    #include <sched.h>
+#endif
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memset e snprintf
+
+#ifndef _WIN32
+    #include <unistd.h>    // Para sysconf
+    #include <sys/mman.h>  // Para mlock e munlock
+#endif
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+static ConfiguracaoIsolamento isolamento_atual = { 0, -1, 0, 0, CACHE_NEUTRO };
+
+/// Buffer somente leitura usado para expulsar os dados da cache
+static unsigned char *buffer_varredura = NULL;
+static size_t tamanho_varredura = 0;
+
+#if defined(__linux__)
+/// Afinidade anterior à fixação, restaurada quando a fixação é desligada
+static cpu_set_t afinidade_original;
+static int afinidade_salva = 0;
+#endif
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static size_t tamanho_pagina(void);
+static size_t calcular_tamanho_varredura(void);
+static int preparar_buffer_varredura(void);
+static void aplicar_fixacao(const ConfiguracaoIsolamento *config);
+
+/* ================================================================
+ * FUNÇÕES AUXILIARES
+ * ================================================================ */
+
+static size_t tamanho_pagina(void) {
+#ifndef _WIN32
+    long pagina = sysconf(_SC_PAGESIZE);
+    if (pagina > 0) return (size_t)pagina;
+#endif
+    return 4096;
+}
+
+/**
+ * @brief FATOR_VARREDURA_LLC × LLC, limitado a [16 MiB, 256 MiB]
+ *
+ * Sem informação de LLC, usa 64 MiB (maior que a LLC de quase todo desktop).
+ */
+static size_t calcular_tamanho_varredura(void) {
+    size_t llc = 0;
+#if !defined(_WIN32) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) llc = (size_t)l3;
+#endif
+    if (llc == 0) return 64u * 1024u * 1024u;
+
+    size_t tamanho = llc * FATOR_VARREDURA_LLC;
+    if (tamanho < TAMANHO_VARREDURA_MINIMO) tamanho = TAMANHO_VARREDURA_MINIMO;
+    if (tamanho > TAMANHO_VARREDURA_MAXIMO) tamanho = TAMANHO_VARREDURA_MAXIMO;
+    return tamanho;
+}
+
+/**
+ * @brief Aloca e preenche o buffer de expulsão (uma única vez)
+ *
+ * @return 1 se o buffer está disponível
+ */
+static int preparar_buffer_varredura(void) {
+    if (buffer_varredura) return 1;
+
+    size_t tamanho = calcular_tamanho_varredura();
+    buffer_varredura = malloc(tamanho);
+    if (!buffer_varredura) {
+        printf("AVISO: Sem memoria para o buffer de expulsao de cache (%zu MiB)\n",
+               tamanho / (1024 * 1024));
+        return 0;
+    }
+
+    // Escreve tudo para que as páginas existam de fato (e não sejam a página zero)
+    memset(buffer_varredura, 0x5A, tamanho);
+    tamanho_varredura = tamanho;
+    return 1;
+}
+
+static void aplicar_fixacao(const ConfiguracaoIsolamento *config) {
+#if defined(__linux__)
+    if (config->fixar_cpu) {
+        if (!afinidade_salva) {
+            CPU_ZERO(&afinidade_original);
+            afinidade_salva = (sched_getaffinity(0, sizeof(afinidade_original),
+                                                 &afinidade_original) == 0);
+        }
+
+        int cpu = config->cpu;
+        if (cpu < 0) {
+            int cpus[MAX_TRABALHADORES];
+            detectar_nucleos_fisicos(cpus, MAX_TRABALHADORES);
+            cpu = cpus[0];
+        }
+        if (fixar_thread_cpu(cpu) != 0) {
+            printf("AVISO: Nao foi possivel fixar a thread na CPU %d\n", cpu);
+        }
+    } else if (afinidade_salva) {
+        sched_setaffinity(0, sizeof(afinidade_original), &afinidade_original);
+        afinidade_salva = 0;
+    }
+#else
+    if (config->fixar_cpu) {
+        printf("AVISO: Fixacao de CPU nao suportada nesta plataforma\n");
+    }
+#endif
+}
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+ConfiguracaoIsolamento configuracao_isolamento_padrao(void) {
+    ConfiguracaoIsolamento config;
+    config.fixar_cpu = 0;
+    config.cpu = -1;
+    config.pre_falhar = 0;
+    config.travar_memoria = 0;
+    config.modo_cache = CACHE_NEUTRO;
+    return config;
+}
+
+void configurar_isolamento(const ConfiguracaoIsolamento *config) {
+    ConfiguracaoIsolamento padrao = configuracao_isolamento_padrao();
+    if (!config) config = &padrao;
+
+    isolamento_atual = *config;
+    aplicar_fixacao(config);
+
+    if (config->modo_cache == CACHE_FRIO && !preparar_buffer_varredura()) {
+        isolamento_atual.modo_cache = CACHE_NEUTRO;
+    }
+}
+
+const ConfiguracaoIsolamento* obter_isolamento(void) {
+    return &isolamento_atual;
+}
+
+/* ================================================================
+ * GANCHOS DE MEDIÇÃO
+ * ================================================================ */
+
+unsigned estado_fixacao_thread(void) {
+#if defined(__linux__)
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    if (sched_getaffinity(0, sizeof(conjunto), &conjunto) == 0 && CPU_COUNT(&conjunto) == 1) {
+        return ISOLAMENTO_FIXADO;
+    }
+#endif
+    return 0;
+}
+
+unsigned isolar_buffer(void *buffer, size_t bytes) {
+    unsigned aplicado = 0;
+    if (!buffer || bytes == 0) return 0;
+
+    if (isolamento_atual.pre_falhar) {
+        // Reescreve o próprio conteúdo: materializa a página sem alterar os dados
+        volatile unsigned char *p = (volatile unsigned char *)buffer;
+        size_t pagina = tamanho_pagina();
+        for (size_t i = 0; i < bytes; i += pagina) {
+            p[i] = p[i];
+        }
+        p[bytes - 1] = p[bytes - 1];
+        aplicado |= ISOLAMENTO_PREFAULT;
+    }
+
+#ifndef _WIN32
+    if (isolamento_atual.travar_memoria && mlock(buffer, bytes) == 0) {
+        aplicado |= ISOLAMENTO_MLOCK;
+    }
+#endif
+
+    return aplicado;
+}
+
+void liberar_buffer_isolado(void *buffer, size_t bytes, unsigned modo) {
+#ifndef _WIN32
+    if (buffer && bytes > 0 && (modo & ISOLAMENTO_MLOCK)) {
+        munlock(buffer, bytes);
+    }
+#else
+    (void)buffer;
+    (void)bytes;
+    (void)modo;
+#endif
+}
+
+unsigned preparar_cache(const void *dados, size_t bytes) {
+    volatile unsigned char acumulador = 0;
+
+    switch (isolamento_atual.modo_cache) {
+        case CACHE_QUENTE: {
+            // Uma leitura por linha de cache traz todos os dados para perto da CPU
+            const volatile unsigned char *p = (const volatile unsigned char *)dados;
+            for (size_t i = 0; i < bytes; i += 64) {
+                acumulador ^= p[i];
+            }
+            return ISOLAMENTO_CACHE_QUENTE;
+        }
+
+        case CACHE_FRIO: {
+            if (!buffer_varredura) return 0;
+            const volatile unsigned char *p = (const volatile unsigned char *)buffer_varredura;
+            for (size_t i = 0; i < tamanho_varredura; i += 64) {
+                acumulador ^= p[i];
+            }
+            return ISOLAMENTO_CACHE_FRIO;
+        }
+
+        case CACHE_NEUTRO:
+        default:
+            return 0;
+    }
+}
+
+void descrever_modo_isolamento(unsigned modo, char *buffer, size_t tamanho_buffer) {
+    if (!buffer || tamanho_buffer == 0) return;
+    buffer[0] = '\0';
+
+    static const struct { unsigned flag; const char *nome; } nomes[] = {
+        { ISOLAMENTO_FIXADO, "fixado" },
+        { ISOLAMENTO_PREFAULT, "prefault" },
+        { ISOLAMENTO_MLOCK, "mlock" },
+        { ISOLAMENTO_CACHE_QUENTE, "quente" },
+        { ISOLAMENTO_CACHE_FRIO, "frio" }
+    };
+
+    size_t usado = 0;
+    for (size_t i = 0; i < sizeof(nomes) / sizeof(nomes[0]); i++) {
+        if (!(modo & nomes[i].flag)) continue;
+        int escrito = snprintf(buffer + usado, tamanho_buffer - usado, "%s%s",
+                               usado > 0 ? "+" : "", nomes[i].nome);
+        if (escrito < 0 || (size_t)escrito >= tamanho_buffer - usado) return;
+        usado += (size_t)escrito;
+    }
+
+    if (usado == 0) snprintf(buffer, tamanho_buffer, "nenhum");
+}
+
+/* ================================================================
+ * INTERFACE DO MENU
+ * ================================================================ */
+
+void menu_isolamento(void) {
+    char descricao[64];
+    const ConfiguracaoIsolamento *atual = obter_isolamento();
+    unsigned modo_atual = (atual->fixar_cpu ? ISOLAMENTO_FIXADO : 0) |
+                          (atual->pre_falhar ? ISOLAMENTO_PREFAULT : 0) |
+                          (atual->travar_memoria ? ISOLAMENTO_MLOCK : 0) |
+                          (atual->modo_cache == CACHE_QUENTE ? ISOLAMENTO_CACHE_QUENTE : 0) |
+                          (atual->modo_cache == CACHE_FRIO ? ISOLAMENTO_CACHE_FRIO : 0);
+    descrever_modo_isolamento(modo_atual, descricao, sizeof(descricao));
+
+    printf("\n=== ISOLAMENTO DAS MEDICOES ===\n");
+    printf("Modo atual: %s\n\n", descricao);
+    printf("  1. Padrao (sem isolamento, comportamento original)\n");
+    printf("  2. Fixado + prefault + mlock, cache QUENTE\n");
+    printf("  3. Fixado + prefault + mlock, cache FRIA (varredura de %zu MiB)\n",
+           calcular_tamanho_varredura() / (1024 * 1024));
+    printf("  0. Manter o modo atual\n");
+    printf("Escolha uma opcao: ");
+
+    int opcao = obter_opcao_usuario();
+    ConfiguracaoIsolamento config = configuracao_isolamento_padrao();
+
+    switch (opcao) {
+        case 1:
+            break;
+        case 2:
+        case 3:
+            config.fixar_cpu = 1;
+            config.pre_falhar = 1;
+            config.travar_memoria = 1;
+            config.modo_cache = (opcao == 2) ? CACHE_QUENTE : CACHE_FRIO;
+            break;
+        case 0:
+            return;
+        default:
+            printf("\nOPCAO INVALIDA! Modo de isolamento mantido.\n");
+            return;
+    }
+
+    configurar_isolamento(&config);
+
+    // Relata o que de fato foi aplicado (mlock pode falhar sem privilégios)
+    unsigned aplicado = estado_fixacao_thread();
+    unsigned char teste[1] = { 0 };
+    unsigned buffer_aplicado = isolar_buffer(teste, sizeof(teste));
+    liberar_buffer_isolado(teste, sizeof(teste), buffer_aplicado);
+    aplicado |= buffer_aplicado;
+    if (config.modo_cache == CACHE_QUENTE) aplicado |= ISOLAMENTO_CACHE_QUENTE;
+    if (obter_isolamento()->modo_cache == CACHE_FRIO) aplicado |= ISOLAMENTO_CACHE_FRIO;
+
+    descrever_modo_isolamento(aplicado, descricao, sizeof(descricao));
+    printf("\nModo de isolamento ativo: %s\n", descricao);
+    if (config.travar_memoria && !(aplicado & ISOLAMENTO_MLOCK)) {
+        printf("AVISO: mlock indisponivel (verifique 'ulimit -l'); seguindo sem travar memoria\n");
+    }
+}
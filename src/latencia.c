@@ -0,0 +1,437 @@
+/**
+ * ================================================================
+ * LATÊNCIA DE ORDENAÇÕES PEQUENAS
+ * ================================================================
+ *
+ * @file latencia.c
+ * @brief Distribuição do tempo de ordenações individuais de 16-512 elementos
+ *
+ *  UMA AMOSTRA:
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ memcpy(pool[i % P])  │ → │ variante fria:       │ → │ iniciar → ordena →   │
+ * │ (fora da medição)    │   │ expulsar_cache_      │   │ parar; decorrido já  │
+ * │                      │   │ instrucoes()         │   │ sem o overhead       │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ *  POR QUE UM POOL:
+ * Ordenar sempre a mesma entrada deixa o preditor de desvios decorar as
+ * comparações e o p99 sai otimista. Com P entradas distintas o padrão de
+ * desvios muda a cada amostra, e a cópia sai de uma área de P·n·4 bytes
+ * (até 512 KB), não de uma linha já quente.
+ *
+ *  EXPULSÃO DA CACHE DE INSTRUÇÕES:
+ * 1024 funções geradas por macro, cada uma com constantes próprias (o
+ * compilador não pode fundi-las), chamadas em sequência por uma tabela de
+ * ponteiros: ~200 KB de código distinto, várias vezes a L1i de 32-64 KB,
+ * e 1024 alvos de desvio indireto no preditor. O código do algoritmo
+ * continua na L2, então a variante fria mede "L1i fria", não "código
+ * vindo da DRAM".
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy e memset
+
+/* ================================================================
+ * CONSTANTES INTERNAS
+ * ================================================================ */
+
+/// Consulta do orçamento a cada 256 amostras (potência de 2)
+#define MASCARA_CONSULTA_ORCAMENTO 255
+
+/// Funções de expulsão geradas (4^5)
+#define NUM_FUNCOES_EXPULSAO 1024
+
+#if defined(_MSC_VER)
+    #define NAO_INLINE __declspec(noinline)
+#else
+    #define NAO_INLINE __attribute__((noinline))
+#endif
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int comparar_ticks(const void *a, const void *b);
+static void imprimir_resumo_latencia(const RelatorioLatencia *relatorio);
+static void escrever_latencia_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_latencia_csv_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * CÓDIGO DE EXPULSÃO DA CACHE DE INSTRUÇÕES
+ * ================================================================ */
+
+/**
+ * Cada id é um número de 6 dígitos 0-3 (octal válido), usado no nome e
+ * como constante: as 1024 funções têm o mesmo formato e imediatos
+ * diferentes, ~200 bytes de código cada.
+ */
+#define FUNCAO_EXPULSAO(id)                                                   \
+    static NAO_INLINE uint64_t expulsar_##id(uint64_t x) {                    \
+        const uint64_t k = 0##id;                                             \
+        x ^= x >> 31; x *= 0x9E3779B97F4A7C15ULL ^ k;                         \
+        x ^= x >> 29; x += 0xBF58476D1CE4E5B9ULL + k;                         \
+        x ^= x << 17; x *= 0x94D049BB133111EBULL - k;                         \
+        x ^= x >> 23; x += 0xD6E8FEB86659FD93ULL ^ (k << 11);                 \
+        x ^= x << 13; x *= 0xA0761D6478BD642FULL + (k << 3);                  \
+        x ^= x >> 37; x += 0xE7037ED1A0B428DBULL - (k << 7);                  \
+        x ^= x << 5;  x *= 0x8EBC6AF09C88C6E3ULL ^ (k << 19);                 \
+        x ^= x >> 41; x += 0x589965CC75374CC3ULL + (k << 23);                 \
+        return x;                                                             \
+    }
+
+#define ENTRADA_EXPULSAO(id) expulsar_##id,
+
+#define EXPULSAO_4(M, p)    M(p##0) M(p##1) M(p##2) M(p##3)
+#define EXPULSAO_16(M, p)   EXPULSAO_4(M, p##0) EXPULSAO_4(M, p##1) \
+                            EXPULSAO_4(M, p##2) EXPULSAO_4(M, p##3)
+#define EXPULSAO_64(M, p)   EXPULSAO_16(M, p##0) EXPULSAO_16(M, p##1) \
+                            EXPULSAO_16(M, p##2) EXPULSAO_16(M, p##3)
+#define EXPULSAO_256(M, p)  EXPULSAO_64(M, p##0) EXPULSAO_64(M, p##1) \
+                            EXPULSAO_64(M, p##2) EXPULSAO_64(M, p##3)
+#define EXPULSAO_1024(M, p) EXPULSAO_256(M, p##0) EXPULSAO_256(M, p##1) \
+                            EXPULSAO_256(M, p##2) EXPULSAO_256(M, p##3)
+
+EXPULSAO_1024(FUNCAO_EXPULSAO, 0)
+
+typedef uint64_t (*FuncaoExpulsao)(uint64_t);
+
+static FuncaoExpulsao const funcoes_expulsao[NUM_FUNCOES_EXPULSAO] = {
+    EXPULSAO_1024(ENTRADA_EXPULSAO, 0)
+};
+
+/// Lido no início e escrito no fim: impede que a cadeia seja calculada em tempo de compilação
+static volatile uint64_t sumidouro_expulsao = 0x1234567887654321ULL;
+
+void expulsar_cache_instrucoes(void) {
+    uint64_t x = sumidouro_expulsao;
+    for (int i = 0; i < NUM_FUNCOES_EXPULSAO; i++) {
+        x = funcoes_expulsao[i](x);
+    }
+    sumidouro_expulsao = x;
+}
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+ConfiguracaoLatencia configuracao_latencia_padrao(void) {
+    ConfiguracaoLatencia config;
+    config.amostras_maximas = AMOSTRAS_MAXIMAS_LATENCIA;
+    config.orcamento_celula = ORCAMENTO_CELULA_LATENCIA;
+    config.tamanho_pool = TAMANHO_POOL_LATENCIA;
+    config.variantes = VARIANTE_LATENCIA_QUENTE | VARIANTE_LATENCIA_FRIA;
+    config.semente = SEMENTE_PADRAO_GERADOR;
+    return config;
+}
+
+/* ================================================================
+ * ESTATÍSTICAS
+ * ================================================================ */
+
+static int comparar_ticks(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+void ordenar_ticks(uint64_t *amostras, int n) {
+    if (n > 1) qsort(amostras, (size_t)n, sizeof(uint64_t), comparar_ticks);
+}
+
+double percentil_ticks_ns(const uint64_t *ordenadas, int n, double p) {
+    if (n <= 0) return 0.0;
+    int posto = (int)((double)n * p + 0.999999);  // ceil sem <math.h>
+    if (posto < 1) posto = 1;
+    if (posto > n) posto = n;
+    return ticks_para_segundos(ordenadas[posto - 1]) * 1e9;
+}
+
+/* ================================================================
+ * MEDIÇÃO
+ * ================================================================ */
+
+int medir_latencia(const AlgoritmoInfo *info, const int *pool, int tamanho, int fria,
+                   const ConfiguracaoLatencia *config, uint64_t *amostras,
+                   ResultadoLatencia *resultado) {
+    memset(resultado, 0, sizeof(*resultado));
+    resultado->indice_motor = indice_motor(info);
+    resultado->tamanho = tamanho;
+    resultado->fria = fria;
+
+    size_t bytes = (size_t)tamanho * sizeof(int);
+    int *trabalho = malloc(bytes);
+    if (!trabalho) return -1;
+
+    int pool_efetivo = config->tamanho_pool > 0 ? config->tamanho_pool : 1;
+
+    // Aquecimento: páginas do buffer, tabelas da libc e o próprio código
+    for (int i = 0; i < AQUECIMENTO_LATENCIA; i++) {
+        memcpy(trabalho, pool + (size_t)(i % pool_efetivo) * tamanho, bytes);
+        executar_ordenacao(info, trabalho, tamanho, sizeof(int), comparar_inteiros);
+    }
+
+    uint64_t limite_ticks = (uint64_t)(config->orcamento_celula *
+                                       obter_info_cronometro()->ticks_por_segundo);
+    uint64_t inicio_celula = cronometro_iniciar();
+    int n = 0;
+
+    while (n < config->amostras_maximas) {
+        memcpy(trabalho, pool + (size_t)(n % pool_efetivo) * tamanho, bytes);
+        if (fria) expulsar_cache_instrucoes();
+
+        uint64_t inicio = cronometro_iniciar();
+        executar_ordenacao(info, trabalho, tamanho, sizeof(int), comparar_inteiros);
+        uint64_t fim = cronometro_parar();
+        amostras[n++] = cronometro_decorrido(inicio, fim);
+
+        if ((n & MASCARA_CONSULTA_ORCAMENTO) == 0 && n >= AMOSTRAS_MINIMAS_LATENCIA &&
+            cronometro_parar() - inicio_celula > limite_ticks) {
+            break;
+        }
+    }
+    free(trabalho);
+
+    uint64_t soma = 0;
+    for (int i = 0; i < n; i++) {
+        soma += amostras[i];
+        if (amostras[i] == 0) resultado->abaixo_resolucao++;
+    }
+    ordenar_ticks(amostras, n);
+
+    resultado->amostras = n;
+    resultado->p50 = percentil_ticks_ns(amostras, n, 0.50);
+    resultado->p99 = percentil_ticks_ns(amostras, n, 0.99);
+    resultado->p999 = percentil_ticks_ns(amostras, n, 0.999);
+    resultado->maximo = n > 0 ? ticks_para_segundos(amostras[n - 1]) * 1e9 : 0.0;
+    resultado->media = n > 0 ? ticks_para_segundos(soma) * 1e9 / n : 0.0;
+    return 0;
+}
+
+int medir_latencias(const ConfiguracaoLatencia *config, RelatorioLatencia *relatorio) {
+    static const int tamanhos[NUM_TAMANHOS_LATENCIA] = {16, 32, 64, 128, 256, 512};
+
+    inicializar_cronometro();
+    memset(relatorio, 0, sizeof(*relatorio));
+    relatorio->config = *config;
+    memcpy(relatorio->tamanhos, tamanhos, sizeof(tamanhos));
+    relatorio->overhead_ns = ticks_para_segundos(obter_info_cronometro()->overhead_ticks) * 1e9;
+    relatorio->modo_isolamento = estado_fixacao_thread();
+    relatorio->num_motores = num_motores();
+
+    int pool_efetivo = config->tamanho_pool > 0 ? config->tamanho_pool : 1;
+    int maior = tamanhos[NUM_TAMANHOS_LATENCIA - 1];
+    int amostras_maximas = config->amostras_maximas > 0 ? config->amostras_maximas : 1;
+    uint64_t *amostras = malloc((size_t)amostras_maximas * sizeof(uint64_t));
+    int *pool = malloc((size_t)pool_efetivo * maior * sizeof(int));
+    if (!amostras || !pool) {
+        printf("ERRO: Sem memoria para a medicao de latencia\n");
+        free(amostras);
+        free(pool);
+        return -1;
+    }
+
+    int versao_original = usar_versao_otimizada;
+    configurar_otimizacao(1);
+    int status = 0;
+
+    for (int fria = 0; fria <= 1 && status == 0; fria++) {
+        unsigned variante = fria ? VARIANTE_LATENCIA_FRIA : VARIANTE_LATENCIA_QUENTE;
+        if (!(config->variantes & variante)) continue;
+        printf("\n--- Variante %s ---\n", fria ? "FRIA (L1i expulsa)" : "QUENTE");
+
+        for (int t = 0; t < NUM_TAMANHOS_LATENCIA && status == 0; t++) {
+            // Mesma semente nas duas variantes: entradas idênticas
+            gerar_numeros(pool, pool_efetivo * tamanhos[t], DIST_ALEATORIA,
+                          config->semente + (uint64_t)tamanhos[t]);
+
+            for (int m = 0; m < relatorio->num_motores; m++) {
+                ResultadoLatencia *celula = &relatorio->celulas[fria][m][t];
+                if (medir_latencia(obter_info_motor(m), pool, tamanhos[t], fria, config,
+                                   amostras, celula) != 0) {
+                    printf("ERRO: Sem memoria para a medicao de latencia\n");
+                    status = -1;
+                    break;
+                }
+                relatorio->total_ordenacoes += celula->amostras;
+                printf("  %-15s n=%4d  p50 %9.0f ns  p99 %9.0f ns  p99.9 %9.0f ns  max %10.0f ns  (%d)\n",
+                       obter_info_motor(m)->nome, tamanhos[t], celula->p50, celula->p99,
+                       celula->p999, celula->maximo, celula->amostras);
+            }
+        }
+    }
+
+    configurar_otimizacao(versao_original);
+    free(amostras);
+    free(pool);
+    return status;
+}
+
+/* ================================================================
+ * RESUMO NO TERMINAL
+ * ================================================================ */
+
+static void imprimir_resumo_latencia(const RelatorioLatencia *relatorio) {
+    for (int fria = 0; fria <= 1; fria++) {
+        if (relatorio->celulas[fria][0][0].amostras == 0) continue;
+
+        printf("\nMENORES LATENCIAS - VARIANTE %s:\n", fria ? "FRIA" : "QUENTE");
+        printf("+------+----------------------------+----------------------------+------------+\n");
+        printf("|   n  | Menor p50 (ns)             | Menor p99.9 (ns)           | qsort p50  |\n");
+        printf("+------+----------------------------+----------------------------+------------+\n");
+        for (int t = 0; t < NUM_TAMANHOS_LATENCIA; t++) {
+            int melhor_p50 = 0, melhor_p999 = 0;
+            for (int m = 1; m < relatorio->num_motores; m++) {
+                if (relatorio->celulas[fria][m][t].p50 < relatorio->celulas[fria][melhor_p50][t].p50) {
+                    melhor_p50 = m;
+                }
+                if (relatorio->celulas[fria][m][t].p999 < relatorio->celulas[fria][melhor_p999][t].p999) {
+                    melhor_p999 = m;
+                }
+            }
+            printf("| %4d | %-15s %10.0f | %-15s %10.0f | %10.0f |\n",
+                   relatorio->tamanhos[t],
+                   obter_info_motor(melhor_p50)->nome, relatorio->celulas[fria][melhor_p50][t].p50,
+                   obter_info_motor(melhor_p999)->nome, relatorio->celulas[fria][melhor_p999][t].p999,
+                   relatorio->celulas[fria][INDICE_QSORT][t].p50);
+        }
+        printf("+------+----------------------------+----------------------------+------------+\n");
+    }
+    printf("\nTotal: %lld ordenacoes medidas individualmente\n", relatorio->total_ordenacoes);
+}
+
+/* ================================================================
+ * RELATÓRIOS
+ * ================================================================ */
+
+static void escrever_latencia_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const RelatorioLatencia *relatorio = (const RelatorioLatencia*)dados;
+    char cronometro[128];
+    char modo[64];
+    descrever_cronometro(cronometro, sizeof(cronometro));
+    descrever_modo_isolamento(relatorio->modo_isolamento, modo, sizeof(modo));
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "         LATENCIA DE ORDENACOES PEQUENAS (16 a 512)            \n");
+    fprintf(arquivo, "================================================================\n\n");
+    fprintf(arquivo, "Cronometro: %s\n", cronometro);
+    fprintf(arquivo, "Overhead descontado de cada amostra: %.1f ns\n", relatorio->overhead_ns);
+    fprintf(arquivo, "Isolamento: %s\n", modo);
+    fprintf(arquivo, "Amostras por celula: ate %d ou %.2f s (minimo %d)\n",
+            relatorio->config.amostras_maximas, relatorio->config.orcamento_celula,
+            AMOSTRAS_MINIMAS_LATENCIA);
+    fprintf(arquivo, "Pool: %d entradas aleatorias distintas por tamanho (semente 0x%llX)\n",
+            relatorio->config.tamanho_pool, (unsigned long long)relatorio->config.semente);
+    fprintf(arquivo, "Versao: otimizada; comparador comparar_inteiros\n");
+
+    for (int fria = 0; fria <= 1; fria++) {
+        if (relatorio->celulas[fria][0][0].amostras == 0) continue;
+
+        fprintf(arquivo, "\nVARIANTE %s\n", fria ? "FRIA (L1i expulsa antes de cada ordenacao)"
+                                                : "QUENTE (ordenacoes seguidas)");
+        fprintf(arquivo, "+-----------------+------+---------+-----------+-----------+------------+------------+-----------+---------+----------+\n");
+        fprintf(arquivo, "| Algoritmo       |   n  | Amostras| p50 (ns)  | p99 (ns)  | p99.9 (ns) | max (ns)   | media (ns)| p999/p50| x qsort  |\n");
+        fprintf(arquivo, "+-----------------+------+---------+-----------+-----------+------------+------------+-----------+---------+----------+\n");
+        for (int m = 0; m < relatorio->num_motores; m++) {
+            for (int t = 0; t < NUM_TAMANHOS_LATENCIA; t++) {
+                const ResultadoLatencia *c = &relatorio->celulas[fria][m][t];
+                char aceleracao[16];
+                formatar_aceleracao(aceleracao_sobre_qsort(relatorio->celulas[fria][INDICE_QSORT][t].p50,
+                                                           c->p50),
+                                    aceleracao, sizeof(aceleracao));
+                fprintf(arquivo, "| %-15s | %4d | %7d | %9.0f | %9.0f | %10.0f | %10.0f | %9.0f | %7.2f | %8s |\n",
+                        t == 0 ? obter_info_motor(m)->nome : "", c->tamanho, c->amostras,
+                        c->p50, c->p99, c->p999, c->maximo, c->media,
+                        c->p50 > 0.0 ? c->p999 / c->p50 : 0.0, aceleracao);
+            }
+            fprintf(arquivo, "+-----------------+------+---------+-----------+-----------+------------+------------+-----------+---------+----------+\n");
+        }
+    }
+
+    if (relatorio->celulas[0][0][0].amostras > 0 && relatorio->celulas[1][0][0].amostras > 0) {
+        fprintf(arquivo, "\nPENALIDADE DA CACHE DE INSTRUCOES FRIA (p50 fria / p50 quente):\n");
+        fprintf(arquivo, "%-17s", "Algoritmo");
+        for (int t = 0; t < NUM_TAMANHOS_LATENCIA; t++) {
+            fprintf(arquivo, " %7d", relatorio->tamanhos[t]);
+        }
+        fprintf(arquivo, "\n");
+        for (int m = 0; m < relatorio->num_motores; m++) {
+            fprintf(arquivo, "%-17s", obter_info_motor(m)->nome);
+            for (int t = 0; t < NUM_TAMANHOS_LATENCIA; t++) {
+                double quente = relatorio->celulas[0][m][t].p50;
+                double fria = relatorio->celulas[1][m][t].p50;
+                fprintf(arquivo, " %6.2fx", quente > 0.0 ? fria / quente : 0.0);
+            }
+            fprintf(arquivo, "\n");
+        }
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Cada amostra e UMA ordenacao sobre uma entrada nova do pool; a copia\n");
+    fprintf(arquivo, "  da entrada fica fora da regiao medida\n");
+    fprintf(arquivo, "- Percentis pelo posto mais proximo (sem interpolacao)\n");
+    fprintf(arquivo, "- p999/p50 mede o peso da cauda: perto de 1 = latencia previsivel\n");
+    fprintf(arquivo, "- x qsort: p50 do qsort da libc / p50 do algoritmo (> 1 = mais rapido)\n");
+    fprintf(arquivo, "- Amostras abaixo da resolucao do cronometro (0 apos descontar o\n");
+    fprintf(arquivo, "  overhead) ficam no CSV, coluna abaixo_resolucao\n");
+    fprintf(arquivo, "- A variante fria expulsa a L1i, nao a L2: o codigo volta da L2\n");
+    fprintf(arquivo, "- O maximo inclui interrupcoes e trocas de contexto; fixe a thread\n");
+    fprintf(arquivo, "  (menu de isolamento) para reduzir a cauda causada pelo sistema\n");
+}
+
+static void escrever_latencia_csv_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const RelatorioLatencia *relatorio = (const RelatorioLatencia*)dados;
+
+    fprintf(arquivo, "variante,algoritmo,n,amostras,abaixo_resolucao,p50_ns,p99_ns,p999_ns,max_ns,media_ns\n");
+    for (int fria = 0; fria <= 1; fria++) {
+        for (int m = 0; m < relatorio->num_motores; m++) {
+            for (int t = 0; t < NUM_TAMANHOS_LATENCIA; t++) {
+                const ResultadoLatencia *c = &relatorio->celulas[fria][m][t];
+                if (c->amostras == 0) continue;
+                fprintf(arquivo, "%s,%s,%d,%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                        fria ? "fria" : "quente", obter_info_motor(m)->nome, c->tamanho,
+                        c->amostras, c->abaixo_resolucao, c->p50, c->p99, c->p999,
+                        c->maximo, c->media);
+            }
+        }
+    }
+}
+
+void gerar_relatorio_latencia(const RelatorioLatencia *relatorio) {
+    if (!relatorio) return;
+
+    salvar_arquivo_multiplos_locais("relatorios", "latencia_pequenos.txt",
+                                    escrever_latencia_callback, (void*)relatorio,
+                                    relatorio->num_motores * NUM_TAMANHOS_LATENCIA);
+    salvar_arquivo_multiplos_locais("relatorios", "latencia_pequenos.csv",
+                                    escrever_latencia_csv_callback, (void*)relatorio,
+                                    relatorio->num_motores * NUM_TAMANHOS_LATENCIA);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_latencia_pequenos(void) {
+    ConfiguracaoLatencia config = configuracao_latencia_padrao();
+
+    printf("\n=== LATENCIA DE ORDENACOES PEQUENAS (16 a 512 elementos) ===\n");
+    printf("Ate %d ordenacoes ou %.2f s por algoritmo e tamanho, variantes quente e fria.\n",
+           config.amostras_maximas, config.orcamento_celula);
+
+    criar_diretorios_output();
+
+    RelatorioLatencia *relatorio = malloc(sizeof(RelatorioLatencia));
+    if (!relatorio) {
+        printf("ERRO: Sem memoria para a medicao de latencia\n");
+        return;
+    }
+    if (medir_latencias(&config, relatorio) == 0) {
+        imprimir_resumo_latencia(relatorio);
+        gerar_relatorio_latencia(relatorio);
+    }
+    free(relatorio);
+}
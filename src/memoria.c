@@ -0,0 +1,269 @@
+/**
+ * ================================================================
+ * ANÁLISE DE ACESSOS À MEMÓRIA
+ * ================================================================
+ *
+ * @file memoria.c
+ * @brief Rastro por algoritmo, simulação de cache e relatório comparativo
+ *
+ *  FLUXO POR ALGORITMO:
+ * ┌──────────────┐   ┌───────────────┐   ┌──────────────┐   ┌────────────┐
+ * │ medição sem  │ → │ ordenação com │ → │ rastro .bin  │ → │ simulador  │
+ * │ rastro       │   │ rastro ativo  │   │ (output/     │   │ L1/L2/LLC  │
+ * │ (tempo real) │   │ (mesma entrada│   │  rastros/)   │   │ + TLB      │
+ * └──────────────┘   └───────────────┘   └──────────────┘   └────────────┘
+ *
+ * O tempo vem de uma execução sem rastro: registrar acessos deixa cada
+ * comparação várias vezes mais cara e distorceria a comparação.
+ *
+ * Os acessos registrados são os da camada de comparação/movimentação
+ * (comparar_e_contar, swap_elements, mover_elemento). Leituras feitas
+ * fora dela (cópia do pivô, buffers do Bingo Sort) não aparecem, e o
+ * buffer temporário da troca é omitido por estar sempre na L1.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para strstr e snprintf
+#include <ctype.h>   // Para tolower
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int tamanho_para_algoritmo(const AlgoritmoInfo *info);
+static void nome_arquivo_rastro(const char *algoritmo, int tamanho, char *buffer, size_t tamanho_buffer);
+static int salvar_rastro_multiplos_locais(const RastroMemoria *rastro, const char *nome_arquivo);
+static void rastrear_algoritmo(AlgoritmoInfo *info, const int *entrada, int *trabalho,
+                               RastroMemoria *rastro, const ConfiguracaoCache *cache,
+                               ResultadoMemoria *resultado);
+static void escrever_memoria_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * FUNÇÕES AUXILIARES
+ * ================================================================ */
+
+/**
+ * @brief Algoritmos O(n²) no caso médio usam entradas menores (o rastro cresce com n²)
+ */
+static int tamanho_para_algoritmo(const AlgoritmoInfo *info) {
+    return strstr(info->complexidade_media, "n²") ? TAMANHO_RASTRO_QUADRATICO : TAMANHO_RASTRO_NLOGN;
+}
+
+/**
+ * @brief "Heap Sort", 50000 → "heap_sort_50000.bin"
+ */
+static void nome_arquivo_rastro(const char *algoritmo, int tamanho, char *buffer, size_t tamanho_buffer) {
+    char nome[32];
+    size_t j = 0;
+    for (size_t i = 0; algoritmo[i] && j < sizeof(nome) - 1; i++) {
+        nome[j++] = (algoritmo[i] == ' ') ? '_' : (char)tolower((unsigned char)algoritmo[i]);
+    }
+    nome[j] = '\0';
+    snprintf(buffer, tamanho_buffer, "%s_%d.bin", nome, tamanho);
+}
+
+/**
+ * @brief Grava o rastro em output/rastros/, tentando os mesmos locais dos relatórios
+ *
+ * @return 0 em caso de sucesso, -1 se nenhum local aceitou o arquivo
+ */
+static int salvar_rastro_multiplos_locais(const RastroMemoria *rastro, const char *nome_arquivo) {
+    const char* caminhos_base[] = {
+        "output",           // Diretório atual
+        "../output",        // Um nível acima
+        "../../output"      // Dois níveis acima
+    };
+
+    for (int i = 0; i < 3; i++) {
+        char caminho_completo[MAX_PATH];
+        snprintf(caminho_completo, sizeof(caminho_completo),
+                 "%s/rastros/%s", caminhos_base[i], nome_arquivo);
+        if (salvar_rastro(rastro, caminho_completo) == 0) {
+            printf("Rastro salvo: %s\n", caminho_completo);
+            return 0;
+        }
+    }
+
+    printf("AVISO: Nao foi possivel salvar o rastro %s\n", nome_arquivo);
+    return -1;
+}
+
+/* ================================================================
+ * RASTREAMENTO E SIMULAÇÃO
+ * ================================================================ */
+
+static void rastrear_algoritmo(AlgoritmoInfo *info, const int *entrada, int *trabalho,
+                               RastroMemoria *rastro, const ConfiguracaoCache *cache,
+                               ResultadoMemoria *resultado) {
+    int tamanho = tamanho_para_algoritmo(info);
+    memset(resultado, 0, sizeof(*resultado));
+    snprintf(resultado->algoritmo, sizeof(resultado->algoritmo), "%s", info->nome);
+    resultado->tamanho = tamanho;
+
+    // Tempo de referência, sem rastro
+    copiar_array(entrada, trabalho, tamanho, sizeof(int));
+    ResultadoTempo medicao = medir_algoritmo(info, trabalho, tamanho, sizeof(int),
+                                             comparar_inteiros, "numeros");
+    resultado->tempo_execucao = medicao.tempo_execucao;
+    resultado->comparacoes = medicao.comparacoes;
+    resultado->movimentacoes = medicao.movimentacoes;
+
+    // Mesma entrada, agora com cada acesso registrado
+    copiar_array(entrada, trabalho, tamanho, sizeof(int));
+    rastro->total = 0;
+    ativar_rastro(rastro);
+    executar_ordenacao(info, trabalho, tamanho, sizeof(int), comparar_inteiros);
+    ativar_rastro(NULL);
+
+    resultado->acessos_totais = rastro->total;
+    resultado->acessos_retidos = rastro_retidos(rastro);
+
+    char nome_arquivo[64];
+    nome_arquivo_rastro(info->nome, tamanho, nome_arquivo, sizeof(nome_arquivo));
+    salvar_rastro_multiplos_locais(rastro, nome_arquivo);
+
+    if (simular_rastro(rastro, cache, &resultado->estatisticas) == 0) {
+        resultado->simulado = 1;
+    } else {
+        printf("AVISO: Falha ao simular o rastro de %s\n", info->nome);
+    }
+}
+
+int analisar_memoria(const ConfiguracaoCache *cache, RelatorioMemoria *relatorio) {
+    if (!cache || !relatorio) return -1;
+    memset(relatorio, 0, sizeof(*relatorio));
+    relatorio->cache = *cache;
+
+    int *entrada = malloc(TAMANHO_RASTRO_NLOGN * sizeof(int));
+    int *trabalho = malloc(TAMANHO_RASTRO_NLOGN * sizeof(int));
+    RastroMemoria *rastro = criar_rastro(CAPACIDADE_RASTRO_PADRAO, sizeof(int));
+    if (!entrada || !trabalho || !rastro) {
+        printf("ERRO: Sem memoria para a analise de acessos\n");
+        free(entrada);
+        free(trabalho);
+        liberar_rastro(rastro);
+        return -1;
+    }
+
+    // Entradas menores são prefixos da mesma sequência
+    gerar_numeros(entrada, TAMANHO_RASTRO_NLOGN, DIST_ALEATORIA, SEMENTE_PADRAO_GERADOR);
+
+    int versao_original = usar_versao_otimizada;
+    configurar_otimizacao(1);
+
+    AlgoritmoInfo *algoritmos = obter_info_algoritmos();
+    for (int i = 0; i < NUM_ALGORITMOS; i++) {
+        printf("Rastreando %s (%d elementos)...\n", algoritmos[i].nome,
+               tamanho_para_algoritmo(&algoritmos[i]));
+        rastrear_algoritmo(&algoritmos[i], entrada, trabalho, rastro, cache,
+                           &relatorio->algoritmos[relatorio->num_algoritmos++]);
+    }
+
+    configurar_otimizacao(versao_original);
+    free(entrada);
+    free(trabalho);
+    liberar_rastro(rastro);
+    return 0;
+}
+
+/* ================================================================
+ * RELATÓRIO
+ * ================================================================ */
+
+static void escrever_memoria_callback(FILE* arquivo, void* dados, int tamanho) {
+    const RelatorioMemoria *relatorio = (const RelatorioMemoria*)dados;
+    (void)tamanho;
+
+    fprintf(arquivo, "=== ACESSOS A MEMORIA E CACHE SIMULADA ===\n\n");
+    fprintf(arquivo, "Versao: otimizada | Dados: inteiros aleatorios (semente fixa)\n");
+    fprintf(arquivo, "Hierarquia simulada (associativa por conjunto, LRU):\n");
+    escrever_configuracao_cache(arquivo, &relatorio->cache);
+    fprintf(arquivo, "\nFalhas por mil acessos em cada nivel:\n");
+
+    fprintf(arquivo, "\n%-16s %7s %12s %12s %7s %7s %7s %7s\n",
+            "Algoritmo", "n", "Tempo (s)", "Acessos", "L1", "L2", "LLC", "TLB");
+    fprintf(arquivo, "----------------------------------------------------------------------------------\n");
+    for (int i = 0; i < relatorio->num_algoritmos; i++) {
+        const ResultadoMemoria *r = &relatorio->algoritmos[i];
+        const EstatisticasCache *e = &r->estatisticas;
+        fprintf(arquivo, "%-16s %7d %12.6f %12llu", r->algoritmo, r->tamanho,
+                r->tempo_execucao, (unsigned long long)r->acessos_totais);
+        if (!r->simulado) {
+            fprintf(arquivo, "   (simulacao indisponivel)\n");
+            continue;
+        }
+        for (int n = 0; n < MAX_NIVEIS_CACHE; n++) {
+            if (n < relatorio->cache.num_niveis) {
+                fprintf(arquivo, " %7.2f", falhas_por_mil_acessos(e, e->falhas_nivel[n]));
+            } else {
+                fprintf(arquivo, " %7s", "-");
+            }
+        }
+        fprintf(arquivo, " %7.2f\n", falhas_por_mil_acessos(e, e->falhas_tlb));
+    }
+
+    fprintf(arquivo, "\n=== DETALHES POR ALGORITMO ===\n");
+    for (int i = 0; i < relatorio->num_algoritmos; i++) {
+        const ResultadoMemoria *r = &relatorio->algoritmos[i];
+        if (!r->simulado) continue;
+
+        char titulo[128];
+        snprintf(titulo, sizeof(titulo), "%s (n = %d, %lld comparacoes, %lld movimentacoes)",
+                 r->algoritmo, r->tamanho, r->comparacoes, r->movimentacoes);
+        escrever_estatisticas_cache(arquivo, titulo, &relatorio->cache, &r->estatisticas);
+        if (r->acessos_retidos < r->acessos_totais) {
+            fprintf(arquivo, "  Rastro truncado: simulados os ultimos %llu de %llu acessos\n",
+                    (unsigned long long)r->acessos_retidos, (unsigned long long)r->acessos_totais);
+        }
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Tabela: falhas por mil acessos do rastro; taxa local = falhas / acessos que chegaram ao nivel\n");
+    fprintf(arquivo, "- Reuso: cache totalmente associativa de C linhas acerta distancias < C\n");
+    fprintf(arquivo, "- Tempo medido sem rastro; contadores de uma unica ordenacao\n");
+    fprintf(arquivo, "- Acessos fora de comparar/trocar/mover (pivo, buffers auxiliares) nao sao rastreados\n");
+    fprintf(arquivo, "- Reexecute com outra geometria: simular_cache --l1 32K:8:64 output/rastros/<arquivo>.bin\n");
+}
+
+void gerar_relatorio_memoria(const RelatorioMemoria *relatorio) {
+    if (!relatorio) return;
+    salvar_arquivo_multiplos_locais("relatorios", "cache_simulada.txt",
+                                    escrever_memoria_callback, (void*)relatorio,
+                                    relatorio->num_algoritmos);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_analise_memoria(void) {
+    printf("\n=== ACESSOS A MEMORIA E CACHE SIMULADA ===\n");
+    printf("Cada algoritmo e rastreado e o rastro reexecutado em L1/L2/LLC + TLB.\n\n");
+
+    criar_diretorios_output();
+
+    ConfiguracaoCache cache = configuracao_cache_padrao();
+    escrever_configuracao_cache(stdout, &cache);
+    printf("\n");
+
+    RelatorioMemoria *relatorio = malloc(sizeof(RelatorioMemoria));
+    if (!relatorio) return;
+
+    if (analisar_memoria(&cache, relatorio) == 0) {
+        printf("\n");
+        for (int i = 0; i < relatorio->num_algoritmos; i++) {
+            const ResultadoMemoria *r = &relatorio->algoritmos[i];
+            if (!r->simulado) continue;
+            const EstatisticasCache *e = &r->estatisticas;
+            printf("%-16s falhas por mil acessos: L1 %8.2f  LLC %8.2f  TLB %8.2f\n", r->algoritmo,
+                   falhas_por_mil_acessos(e, e->falhas_nivel[0]),
+                   falhas_por_mil_acessos(e, e->falhas_nivel[cache.num_niveis - 1]),
+                   falhas_por_mil_acessos(e, e->falhas_tlb));
+        }
+        printf("\n");
+        gerar_relatorio_memoria(relatorio);
+    }
+    free(relatorio);
+}
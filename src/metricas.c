@@ -0,0 +1,407 @@
+/**
+ * ================================================================
+ * MÉTRICAS OPENMETRICS PARA EXECUÇÕES LONGAS
+ * ================================================================
+ *
+ * @file metricas.c
+ * @brief Blocos de contadores por thread e exportação em textfile
+ *
+ *  BLOCOS (um por thread viva, numa pilha sem trava):
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ 1ª ordenação da      │ → │ Senão, calloc e      │ → │ Fim da thread: o     │
+ * │ thread: adota um     │   │ empilha com CAS na   │   │ bloco volta a ficar  │
+ * │ bloco livre (CAS)    │   │ cabeça da lista      │   │ livre (destrutor)    │
+ * └──────────────────────┘   └──────────────────────┘   └──────────────────────┘
+ *
+ * Só a thread dona escreve no bloco, com leitura e escrita relaxadas
+ * (sem read-modify-write); o exportador lê os mesmos campos também
+ * relaxado. Cada contador é monotônico por si; uma gravação pode pegar
+ * uma ordenação pela metade entre dois contadores, o que a próxima
+ * gravação corrige.
+ *
+ * O formato é o de exposição em texto do Prometheus (o que o coletor
+ * textfile do node_exporter lê), terminado em "# EOF" como no
+ * OpenMetrics.
+ *
+ * ================================================================
+ */
+
+#if defined(__linux__)
+    #define _GNU_SOURCE      // Para nanosleep com -std=c17
+    #include <pthread.h>
+    #include <time.h>
+#endif
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <stddef.h>     // Para offsetof
+#include <string.h>     // Para snprintf, memset
+#include <stdatomic.h>  // Para os contadores e a lista de blocos
+
+/* ================================================================
+ * ESTADO
+ * ================================================================ */
+
+#define NUM_VERSOES_METRICAS 3  ///< didatica, otimizada, unica
+#define PASSO_ESPERA_EXPORTADOR_NS 100000000L  ///< 100 ms entre checagens de parada
+
+static const char *const NOMES_VERSOES_METRICAS[NUM_VERSOES_METRICAS] = {
+    "didatica", "otimizada", "unica"
+};
+
+/// Limites superiores dos baldes de latência em ns (o último é +Inf)
+static const unsigned long long LIMITES_LATENCIA_NS[NUM_BALDES_LATENCIA - 1] = {
+    1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL
+};
+static const char *const ROTULOS_LATENCIA[NUM_BALDES_LATENCIA] = {
+    "1e-06", "1e-05", "0.0001", "0.001", "0.01", "0.1", "1", "10", "+Inf"
+};
+
+/**
+ * @brief Contadores de um (motor, versão)
+ */
+typedef struct {
+    atomic_ullong ordenacoes;
+    atomic_ullong elementos;
+    atomic_ullong bytes;
+    atomic_ullong soma_ns;
+    atomic_ullong baldes[NUM_BALDES_LATENCIA];  ///< Não cumulativos (acumulados na exportação)
+} ContadoresMotor;
+
+/**
+ * @brief Bloco de uma thread
+ */
+typedef struct BlocoMetricas {
+    ContadoresMotor motores[MAX_MOTORES][NUM_VERSOES_METRICAS];
+    atomic_ullong emprestimos;
+    atomic_ullong alocacoes;
+    atomic_int em_uso;                ///< 1 enquanto uma thread é dona
+    struct BlocoMetricas *proximo;    ///< Imutável depois de empilhado
+} BlocoMetricas;
+
+atomic_int metricas_ativas = 0;
+
+static _Atomic(BlocoMetricas*) lista_blocos = NULL;
+static THREAD_LOCAL BlocoMetricas *bloco_thread = NULL;
+
+static char caminho_metricas[512];
+static atomic_flag trava_exportacao = ATOMIC_FLAG_INIT;
+
+#if defined(__linux__)
+static pthread_t thread_exportadora;
+static int exportadora_criada = 0;
+static atomic_int parar_exportadora = 0;
+static double intervalo_exportacao = INTERVALO_METRICAS_PADRAO;
+static pthread_key_t chave_bloco;
+static pthread_once_t chave_bloco_criada = PTHREAD_ONCE_INIT;
+#endif
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static BlocoMetricas* obter_bloco_thread(void);
+static void somar_contador(atomic_ullong *contador, unsigned long long valor);
+static unsigned long long ler_contador(atomic_ullong *contador);
+static void escrever_rotulo(FILE *arquivo, const char *valor);
+static int escrever_metricas(FILE *arquivo);
+#if defined(__linux__)
+static void criar_chave_bloco(void);
+static void liberar_bloco_thread(void *bloco);
+static void* laco_exportadora(void *arg);
+#endif
+
+/* ================================================================
+ * BLOCOS POR THREAD
+ * ================================================================ */
+
+#if defined(__linux__)
+static void liberar_bloco_thread(void *bloco) {
+    atomic_store_explicit(&((BlocoMetricas*)bloco)->em_uso, 0, memory_order_release);
+}
+
+static void criar_chave_bloco(void) {
+    pthread_key_create(&chave_bloco, liberar_bloco_thread);
+}
+#endif
+
+static BlocoMetricas* obter_bloco_thread(void) {
+    if (bloco_thread) return bloco_thread;
+
+    // Adota o bloco de uma thread que já terminou
+    BlocoMetricas *b = atomic_load_explicit(&lista_blocos, memory_order_acquire);
+    for (; b; b = b->proximo) {
+        int livre = 0;
+        if (atomic_compare_exchange_strong_explicit(&b->em_uso, &livre, 1,
+                                                    memory_order_acquire,
+                                                    memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    if (!b) {
+        b = calloc(1, sizeof(BlocoMetricas));
+        if (!b) return NULL;
+        atomic_store_explicit(&b->em_uso, 1, memory_order_relaxed);
+        BlocoMetricas *cabeca = atomic_load_explicit(&lista_blocos, memory_order_relaxed);
+        do {
+            b->proximo = cabeca;
+        } while (!atomic_compare_exchange_weak_explicit(&lista_blocos, &cabeca, b,
+                                                        memory_order_release,
+                                                        memory_order_relaxed));
+    }
+
+#if defined(__linux__)
+    pthread_once(&chave_bloco_criada, criar_chave_bloco);
+    pthread_setspecific(chave_bloco, b);
+#endif
+    bloco_thread = b;
+    return b;
+}
+
+/// Só a dona escreve: leitura + escrita relaxadas bastam (sem lock no barramento)
+static void somar_contador(atomic_ullong *contador, unsigned long long valor) {
+    atomic_store_explicit(contador,
+                          atomic_load_explicit(contador, memory_order_relaxed) + valor,
+                          memory_order_relaxed);
+}
+
+static unsigned long long ler_contador(atomic_ullong *contador) {
+    return atomic_load_explicit(contador, memory_order_relaxed);
+}
+
+void metricas_registrar_ordenacao(int indice_motor, int otimizada, int n,
+                                  size_t elem_size, uint64_t ticks) {
+    if (indice_motor < 0 || indice_motor >= MAX_MOTORES || n < 0) return;
+    BlocoMetricas *b = obter_bloco_thread();
+    if (!b) return;
+
+    int versao = indice_motor >= NUM_ALGORITMOS ? 2 : (otimizada ? 1 : 0);
+    ContadoresMotor *c = &b->motores[indice_motor][versao];
+
+    unsigned long long ns = (unsigned long long)(ticks_para_segundos(ticks) * 1e9);
+    int balde = 0;
+    while (balde < NUM_BALDES_LATENCIA - 1 && ns > LIMITES_LATENCIA_NS[balde]) balde++;
+
+    somar_contador(&c->ordenacoes, 1);
+    somar_contador(&c->elementos, (unsigned long long)n);
+    somar_contador(&c->bytes, (unsigned long long)n * elem_size);
+    somar_contador(&c->soma_ns, ns);
+    somar_contador(&c->baldes[balde], 1);
+}
+
+void metricas_registrar_emprestimo(int alocou) {
+    BlocoMetricas *b = obter_bloco_thread();
+    if (!b) return;
+    somar_contador(&b->emprestimos, 1);
+    if (alocou) somar_contador(&b->alocacoes, 1);
+}
+
+/* ================================================================
+ * EXPORTAÇÃO
+ * ================================================================ */
+
+/// Valor de rótulo com as escapas do formato (\\, \" e \n)
+static void escrever_rotulo(FILE *arquivo, const char *valor) {
+    for (const char *p = valor; *p; p++) {
+        if (*p == '\\' || *p == '"') fputc('\\', arquivo);
+        if (*p == '\n') { fputs("\\n", arquivo); continue; }
+        fputc(*p, arquivo);
+    }
+}
+
+static int escrever_metricas(FILE *arquivo) {
+    static ContadoresMotor somas[MAX_MOTORES][NUM_VERSOES_METRICAS];
+    unsigned long long emprestimos = 0, alocacoes = 0;
+    int threads = 0;
+    memset(somas, 0, sizeof(somas));
+
+    // Soma todos os blocos (os de threads encerradas também: totais monotônicos)
+    for (BlocoMetricas *b = atomic_load_explicit(&lista_blocos, memory_order_acquire);
+         b; b = b->proximo) {
+        if (atomic_load_explicit(&b->em_uso, memory_order_relaxed)) threads++;
+        emprestimos += ler_contador(&b->emprestimos);
+        alocacoes += ler_contador(&b->alocacoes);
+        for (int m = 0; m < MAX_MOTORES; m++) {
+            for (int v = 0; v < NUM_VERSOES_METRICAS; v++) {
+                ContadoresMotor *origem = &b->motores[m][v];
+                ContadoresMotor *destino = &somas[m][v];
+                somar_contador(&destino->ordenacoes, ler_contador(&origem->ordenacoes));
+                somar_contador(&destino->elementos, ler_contador(&origem->elementos));
+                somar_contador(&destino->bytes, ler_contador(&origem->bytes));
+                somar_contador(&destino->soma_ns, ler_contador(&origem->soma_ns));
+                for (int k = 0; k < NUM_BALDES_LATENCIA; k++) {
+                    somar_contador(&destino->baldes[k], ler_contador(&origem->baldes[k]));
+                }
+            }
+        }
+    }
+
+    static const struct {
+        const char *nome;
+        const char *ajuda;
+        size_t campo;
+    } CONTADORES[] = {
+        { "sorts_ordenacoes_total", "Ordenacoes executadas por motor e versao",
+          offsetof(ContadoresMotor, ordenacoes) },
+        { "sorts_elementos_ordenados_total", "Elementos ordenados por motor e versao",
+          offsetof(ContadoresMotor, elementos) },
+        { "sorts_bytes_processados_total", "Bytes de entrada ordenados (n * elem_size)",
+          offsetof(ContadoresMotor, bytes) },
+    };
+    int num_motores_registrados = num_motores();
+
+    for (size_t i = 0; i < sizeof(CONTADORES) / sizeof(CONTADORES[0]); i++) {
+        fprintf(arquivo, "# HELP %s %s\n", CONTADORES[i].nome, CONTADORES[i].ajuda);
+        fprintf(arquivo, "# TYPE %s counter\n", CONTADORES[i].nome);
+        for (int m = 0; m < num_motores_registrados; m++) {
+            for (int v = 0; v < NUM_VERSOES_METRICAS; v++) {
+                ContadoresMotor *c = &somas[m][v];
+                if (ler_contador(&c->ordenacoes) == 0) continue;
+                atomic_ullong *valor = (atomic_ullong*)((char*)c + CONTADORES[i].campo);
+                fprintf(arquivo, "%s{motor=\"", CONTADORES[i].nome);
+                escrever_rotulo(arquivo, obter_info_motor(m)->id);
+                fprintf(arquivo, "\",versao=\"%s\"} %llu\n",
+                        NOMES_VERSOES_METRICAS[v], ler_contador(valor));
+            }
+        }
+    }
+
+    fprintf(arquivo, "# HELP sorts_latencia_segundos Duracao de cada ordenacao\n");
+    fprintf(arquivo, "# TYPE sorts_latencia_segundos histogram\n");
+    for (int m = 0; m < num_motores_registrados; m++) {
+        for (int v = 0; v < NUM_VERSOES_METRICAS; v++) {
+            ContadoresMotor *c = &somas[m][v];
+            unsigned long long total = ler_contador(&c->ordenacoes);
+            if (total == 0) continue;
+            unsigned long long acumulado = 0;
+            for (int k = 0; k < NUM_BALDES_LATENCIA; k++) {
+                acumulado += ler_contador(&c->baldes[k]);
+                fprintf(arquivo, "sorts_latencia_segundos_bucket{motor=\"");
+                escrever_rotulo(arquivo, obter_info_motor(m)->id);
+                fprintf(arquivo, "\",versao=\"%s\",le=\"%s\"} %llu\n",
+                        NOMES_VERSOES_METRICAS[v], ROTULOS_LATENCIA[k], acumulado);
+            }
+            fprintf(arquivo, "sorts_latencia_segundos_sum{motor=\"");
+            escrever_rotulo(arquivo, obter_info_motor(m)->id);
+            fprintf(arquivo, "\",versao=\"%s\"} %.9f\n", NOMES_VERSOES_METRICAS[v],
+                    (double)ler_contador(&c->soma_ns) / 1e9);
+            fprintf(arquivo, "sorts_latencia_segundos_count{motor=\"");
+            escrever_rotulo(arquivo, obter_info_motor(m)->id);
+            fprintf(arquivo, "\",versao=\"%s\"} %llu\n", NOMES_VERSOES_METRICAS[v], acumulado);
+        }
+    }
+
+    fprintf(arquivo, "# HELP sorts_buffers_emprestados_total Buffers de trabalho emprestados do pool\n");
+    fprintf(arquivo, "# TYPE sorts_buffers_emprestados_total counter\n");
+    fprintf(arquivo, "sorts_buffers_emprestados_total %llu\n", emprestimos);
+    fprintf(arquivo, "# HELP sorts_alocacoes_total Emprestimos do pool que chamaram malloc\n");
+    fprintf(arquivo, "# TYPE sorts_alocacoes_total counter\n");
+    fprintf(arquivo, "sorts_alocacoes_total %llu\n", alocacoes);
+    fprintf(arquivo, "# HELP sorts_threads_instrumentadas Threads vivas com bloco de metricas\n");
+    fprintf(arquivo, "# TYPE sorts_threads_instrumentadas gauge\n");
+    fprintf(arquivo, "sorts_threads_instrumentadas %d\n", threads);
+    fprintf(arquivo, "# EOF\n");
+
+    return ferror(arquivo) ? -1 : 0;
+}
+
+int exportar_metricas(void) {
+    if (caminho_metricas[0] == '\0') return -1;
+
+    // Uma gravação por vez (exportadora, atexit e chamadas explícitas)
+    while (atomic_flag_test_and_set_explicit(&trava_exportacao, memory_order_acquire)) { }
+
+    char temporario[sizeof(caminho_metricas) + 8];
+    snprintf(temporario, sizeof(temporario), "%s.tmp", caminho_metricas);
+
+    int status = -1;
+    FILE *arquivo = fopen(temporario, "w");
+    if (arquivo) {
+        status = escrever_metricas(arquivo);
+        if (fclose(arquivo) != 0) status = -1;
+        if (status == 0) {
+#ifdef _WIN32
+            remove(caminho_metricas);  // rename não sobrescreve no Windows
+#endif
+            if (rename(temporario, caminho_metricas) != 0) status = -1;
+        }
+        if (status != 0) remove(temporario);
+    }
+
+    atomic_flag_clear_explicit(&trava_exportacao, memory_order_release);
+    return status;
+}
+
+/* ================================================================
+ * CICLO DE VIDA
+ * ================================================================ */
+
+#if defined(__linux__)
+static void* laco_exportadora(void *arg) {
+    (void)arg;
+    long passos = (long)(intervalo_exportacao * 1e9 / PASSO_ESPERA_EXPORTADOR_NS);
+    if (passos < 1) passos = 1;
+    struct timespec passo = { 0, PASSO_ESPERA_EXPORTADOR_NS };
+
+    while (!atomic_load(&parar_exportadora)) {
+        for (long i = 0; i < passos && !atomic_load(&parar_exportadora); i++) {
+            nanosleep(&passo, NULL);
+        }
+        if (!atomic_load(&parar_exportadora)) exportar_metricas();
+    }
+    return NULL;
+}
+#endif
+
+int iniciar_metricas(const char *caminho, double intervalo_segundos) {
+    if (!caminho || caminho[0] == '\0') return -1;
+    if (atomic_load(&metricas_ativas)) return 0;
+
+    snprintf(caminho_metricas, sizeof(caminho_metricas), "%s", caminho);
+    if (exportar_metricas() != 0) {
+        fprintf(stderr, "ERRO: metricas: nao foi possivel gravar %s\n", caminho_metricas);
+        caminho_metricas[0] = '\0';
+        return -1;
+    }
+    inicializar_cronometro();  // Calibra antes da primeira ordenação cronometrada
+    atomic_store(&metricas_ativas, 1);
+
+#if defined(__linux__)
+    intervalo_exportacao = intervalo_segundos > 0 ? intervalo_segundos : INTERVALO_METRICAS_PADRAO;
+    atomic_store(&parar_exportadora, 0);
+    exportadora_criada = pthread_create(&thread_exportadora, NULL, laco_exportadora, NULL) == 0;
+    if (!exportadora_criada) {
+        fprintf(stderr, "AVISO: metricas: sem thread de exportacao; gravadas so ao final\n");
+    }
+#else
+    (void)intervalo_segundos;
+#endif
+    return 0;
+}
+
+int iniciar_metricas_ambiente(void) {
+    const char *caminho = getenv(VARIAVEL_AMBIENTE_METRICAS);
+    if (!caminho || caminho[0] == '\0') return 0;
+
+    double intervalo = INTERVALO_METRICAS_PADRAO;
+    const char *texto_intervalo = getenv(VARIAVEL_AMBIENTE_INTERVALO_METRICAS);
+    if (texto_intervalo && atof(texto_intervalo) > 0) intervalo = atof(texto_intervalo);
+
+    if (iniciar_metricas(caminho, intervalo) != 0) return -1;
+    atexit(parar_metricas);
+    return 1;
+}
+
+void parar_metricas(void) {
+    if (!atomic_exchange(&metricas_ativas, 0)) return;
+
+#if defined(__linux__)
+    if (exportadora_criada) {
+        atomic_store(&parar_exportadora, 1);
+        pthread_join(thread_exportadora, NULL);
+        exportadora_criada = 0;
+    }
+#endif
+    exportar_metricas();
+}
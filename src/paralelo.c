@@ -0,0 +1,558 @@
+/**
+ * ================================================================
+ * MATRIZ DE BENCHMARK PARALELA EM NÚCLEOS FIXADOS
+ * ================================================================
+ *
+ * @file paralelo.c
+ * @brief Escalonador de células (algoritmo, versão, conjunto) entre threads
+ *
+ *  ESCALONAMENTO:
+ * ┌──────────────────────┐   ┌─────────────────────────┐   ┌──────────────┐
+ * │ Células ordenadas    │ → │ Fila com índice atômico │ → │ Thread i     │
+ * │ por custo estimado   │   │ (próxima célula livre)  │   │ fixada na    │
+ * │ (maior primeiro)     │   │                         │   │ CPU cpus[i]  │
+ * └──────────────────────┘   └─────────────────────────┘   └──────────────┘
+ *
+ * Despachar as células mais caras primeiro (LPT - Longest Processing Time)
+ * evita que um Bubble Sort didático de 50000 elementos fique sozinho no
+ * final enquanto os outros núcleos ociosos esperam.
+ *
+ *  ISOLAMENTO ENTRE THREADS:
+ * - Conjuntos originais são somente leitura; cada célula copia para um
+ *   buffer próprio antes de medir
+ * - Contadores, comparador corrente e versão são THREAD_LOCAL
+ * - Cada thread roda em um núcleo físico distinto (sem irmãos de HT)
+ *
+ *  PROJEÇÕES DE TEMPO:
+ * O orçamento de projecao.c não é aplicado aqui: o histórico depende da
+ * ordem crescente de tamanhos, que o despacho LPT inverte de propósito.
+ *
+ * ================================================================
+ */
+
+#if defined(__linux__)
+    #define _GNU_SOURCE      // Para sched_setaffinity e CPU_SET
+    #include <sched.h>
+    #include <pthread.h>
+#endif
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>     // Para memset, snprintf e strcmp
+#include <math.h>       // Para pow e fabs
+#include <stdatomic.h>  // Para a fila de células sem trava
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+/// Estado compartilhado entre as threads de trabalho
+typedef struct {
+    ResultadoMatriz *resultado;
+    atomic_int proxima_celula;
+} FilaCelulas;
+
+/// Argumento de cada thread de trabalho
+typedef struct {
+    FilaCelulas *fila;
+    int cpu;
+} ContextoTrabalhador;
+
+static int carregar_conjuntos(ResultadoMatriz *resultado);
+static void montar_celulas(ResultadoMatriz *resultado);
+static int comparar_custo_celulas(const void *a, const void *b);
+static ResultadoTempo medir_celula(const ResultadoMatriz *resultado, const CelulaMatriz *celula);
+static void* trabalhador_matriz(void *arg);
+static void executar_fase_paralela(ResultadoMatriz *resultado, int num_trabalhadores);
+static void executar_fase_serial(ResultadoMatriz *resultado);
+static int contadores_iguais(const ResultadoTempo *a, const ResultadoTempo *b);
+static double tempo_qsort_conjunto(const ResultadoMatriz *resultado, int indice_conjunto);
+static void escrever_matriz_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * TOPOLOGIA E AFINIDADE
+ * ================================================================ */
+
+/**
+ * @brief Lê um inteiro de um arquivo de /sys (retorna -1 se indisponível)
+ */
+static int ler_inteiro_sys(const char *caminho) {
+    FILE *arquivo = fopen(caminho, "r");
+    if (!arquivo) return -1;
+    int valor = -1;
+    if (fscanf(arquivo, "%d", &valor) != 1) valor = -1;
+    fclose(arquivo);
+    return valor;
+}
+
+int detectar_nucleos_fisicos(int *cpus, int max_cpus) {
+#if defined(__linux__)
+    cpu_set_t permitidas;
+    CPU_ZERO(&permitidas);
+    if (sched_getaffinity(0, sizeof(permitidas), &permitidas) != 0) {
+        cpus[0] = -1;
+        return 1;
+    }
+
+    // Pares (pacote, núcleo) já representados por alguma CPU escolhida
+    int pacotes[MAX_TRABALHADORES];
+    int nucleos[MAX_TRABALHADORES];
+    int total = 0;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE && total < max_cpus && total < MAX_TRABALHADORES; cpu++) {
+        if (!CPU_ISSET(cpu, &permitidas)) continue;
+
+        char caminho[128];
+        snprintf(caminho, sizeof(caminho),
+                 "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        int pacote = ler_inteiro_sys(caminho);
+        snprintf(caminho, sizeof(caminho),
+                 "/sys/devices/system/cpu/cpu%d/topology/core_id", cpu);
+        int nucleo = ler_inteiro_sys(caminho);
+
+        // Sem topologia: cada CPU lógica conta como um núcleo
+        if (nucleo < 0) {
+            pacote = 0;
+            nucleo = cpu;
+        }
+
+        int repetido = 0;
+        for (int i = 0; i < total; i++) {
+            if (pacotes[i] == pacote && nucleos[i] == nucleo) {
+                repetido = 1;
+                break;
+            }
+        }
+        if (repetido) continue;  // Irmão de hyper-threading
+
+        pacotes[total] = pacote;
+        nucleos[total] = nucleo;
+        cpus[total] = cpu;
+        total++;
+    }
+
+    if (total == 0) {
+        cpus[0] = -1;
+        return 1;
+    }
+    return total;
+#else
+    (void)max_cpus;
+    cpus[0] = -1;
+    return 1;
+#endif
+}
+
+int fixar_thread_cpu(int cpu) {
+#if defined(__linux__)
+    if (cpu < 0) return -1;
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+    return sched_setaffinity(0, sizeof(conjunto), &conjunto) == 0 ? 0 : -1;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+/* ================================================================
+ * PREPARAÇÃO DA MATRIZ
+ * ================================================================ */
+
+ConfiguracaoParalela configuracao_paralela_padrao(void) {
+    ConfiguracaoParalela config;
+    config.limite_concorrencia = LIMITE_CONCORRENCIA_PADRAO;
+    config.verificar_serial = 1;
+    return config;
+}
+
+/**
+ * @brief Toma emprestadas as visões do registro de conjuntos (conjuntos.h)
+ *
+ * @return Número de conjuntos disponíveis
+ */
+static int carregar_conjuntos(ResultadoMatriz *resultado) {
+    int total = carregar_conjuntos_dados();
+
+    for (int i = 0; i < total && resultado->num_conjuntos < MAX_CONJUNTOS_MATRIZ; i++) {
+        const ConjuntoDados *origem = obter_conjunto_dados(i);
+        ConjuntoMatriz *c = &resultado->conjuntos[resultado->num_conjuntos++];
+        snprintf(c->nome, sizeof(c->nome), "%s", origem->nome);
+        snprintf(c->tipo_dados, sizeof(c->tipo_dados), "%s", origem->tipo_dados);
+        c->dados = origem->dados;
+        c->tamanho = origem->tamanho;
+        c->elem_size = origem->elem_size;
+        c->cmp = origem->cmp;
+    }
+
+    return resultado->num_conjuntos;
+}
+
+/**
+ * @brief Ordena células por custo estimado decrescente (despacho LPT)
+ */
+static int comparar_custo_celulas(const void *a, const void *b) {
+    const CelulaMatriz *ca = (const CelulaMatriz*)a;
+    const CelulaMatriz *cb = (const CelulaMatriz*)b;
+    if (ca->custo_estimado > cb->custo_estimado) return -1;
+    if (ca->custo_estimado < cb->custo_estimado) return 1;
+    return 0;
+}
+
+/**
+ * @brief Gera todas as células e estima o custo de cada uma
+ *
+ * O custo é n^k com k da complexidade média declarada; versões didáticas
+ * recebem peso maior por fazerem mais trabalho por elemento. Motores que
+ * não aceitam o tipo do conjunto (só inteiros) ou que já são paralelos
+ * (disputariam os núcleos fixados) ficam de fora.
+ */
+static void montar_celulas(ResultadoMatriz *resultado) {
+    resultado->num_celulas = 0;
+    for (int c = 0; c < resultado->num_conjuntos; c++) {
+        for (int v = 0; v < 2; v++) {
+            // Referências e plugins não têm versão didática: só entram na otimizada
+            int total = (v == 0) ? num_motores() : NUM_ALGORITMOS;
+            for (int a = 0; a < total; a++) {
+                const AlgoritmoInfo *info = obter_info_motor(a);
+                if ((info->capacidades & CAPACIDADE_PARALELO) ||
+                    !motor_aceita_dados(info, resultado->conjuntos[c].elem_size,
+                                        resultado->conjuntos[c].cmp)) {
+                    continue;
+                }
+
+                CelulaMatriz *celula = &resultado->celulas[resultado->num_celulas++];
+                memset(celula, 0, sizeof(*celula));
+                celula->indice_algoritmo = a;
+                celula->otimizada = (v == 0);
+                celula->indice_conjunto = c;
+                celula->cpu = -1;
+
+                double k = expoente_declarado(info->complexidade_media, NULL);
+                celula->custo_estimado = pow((double)resultado->conjuntos[c].tamanho, k)
+                                         * (celula->otimizada ? 1.0 : 1.5);
+            }
+        }
+    }
+
+    qsort(resultado->celulas, (size_t)resultado->num_celulas, sizeof(CelulaMatriz),
+          comparar_custo_celulas);
+}
+
+/* ================================================================
+ * EXECUÇÃO DAS CÉLULAS
+ * ================================================================ */
+
+/**
+ * @brief Mede uma célula na thread chamadora com buffer próprio
+ */
+static ResultadoTempo medir_celula(const ResultadoMatriz *resultado, const CelulaMatriz *celula) {
+    const ConjuntoMatriz *conjunto = &resultado->conjuntos[celula->indice_conjunto];
+    AlgoritmoInfo *info = obter_info_motor(celula->indice_algoritmo);
+    ResultadoTempo r;
+
+    void *copia = emprestar_buffer_trabalho((size_t)conjunto->tamanho * conjunto->elem_size);
+    if (!copia) {
+        memset(&r, 0, sizeof(r));
+        snprintf(r.algoritmo, sizeof(r.algoritmo), "%s", info->nome);
+        return r;
+    }
+
+    // Versão é THREAD_LOCAL: afeta apenas esta thread
+    configurar_otimizacao(celula->otimizada);
+    copiar_array(conjunto->dados, copia, conjunto->tamanho, conjunto->elem_size);
+    r = medir_algoritmo(info, copia, conjunto->tamanho,
+                        conjunto->elem_size, conjunto->cmp, conjunto->tipo_dados);
+    devolver_buffer_trabalho(copia);
+    return r;
+}
+
+static void* trabalhador_matriz(void *arg) {
+    ContextoTrabalhador *ctx = (ContextoTrabalhador*)arg;
+    ResultadoMatriz *resultado = ctx->fila->resultado;
+
+    int fixada = (fixar_thread_cpu(ctx->cpu) == 0);
+
+    for (;;) {
+        int i = atomic_fetch_add(&ctx->fila->proxima_celula, 1);
+        if (i >= resultado->num_celulas) break;
+
+        CelulaMatriz *celula = &resultado->celulas[i];
+        celula->cpu = fixada ? ctx->cpu : -1;
+        celula->paralelo = medir_celula(resultado, celula);
+
+        printf("  [cpu %2d] %-15s %-9s %-32s %10.6f s\n",
+               celula->cpu, obter_info_motor(celula->indice_algoritmo)->nome,
+               celula->otimizada ? "otimizada" : "didatica",
+               resultado->conjuntos[celula->indice_conjunto].nome,
+               celula->paralelo.tempo_execucao);
+    }
+
+    liberar_buffer_troca();
+    return NULL;
+}
+
+/**
+ * @brief Distribui as células entre as threads e espera todas terminarem
+ */
+static void executar_fase_paralela(ResultadoMatriz *resultado, int num_trabalhadores) {
+    FilaCelulas fila;
+    fila.resultado = resultado;
+    atomic_init(&fila.proxima_celula, 0);
+
+    ContextoTrabalhador contextos[MAX_TRABALHADORES];
+    for (int t = 0; t < num_trabalhadores; t++) {
+        contextos[t].fila = &fila;
+        contextos[t].cpu = resultado->cpus[t];
+    }
+
+#if defined(__linux__)
+    pthread_t threads[MAX_TRABALHADORES];
+    int criadas = 0;
+    for (int t = 0; t < num_trabalhadores; t++) {
+        if (pthread_create(&threads[criadas], NULL, trabalhador_matriz, &contextos[t]) != 0) {
+            printf("AVISO: Falha ao criar thread %d; seguindo com %d\n", t, criadas);
+            break;
+        }
+        criadas++;
+    }
+
+    if (criadas == 0) {
+        // Nenhuma thread disponível: executa a fila na thread chamadora
+        trabalhador_matriz(&contextos[0]);
+        resultado->num_trabalhadores = 1;
+        return;
+    }
+    for (int t = 0; t < criadas; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    resultado->num_trabalhadores = criadas;
+#else
+    trabalhador_matriz(&contextos[0]);
+    resultado->num_trabalhadores = 1;
+#endif
+}
+
+/**
+ * @brief Reexecuta todas as células em série, fixada no primeiro núcleo
+ */
+static void executar_fase_serial(ResultadoMatriz *resultado) {
+#if defined(__linux__)
+    cpu_set_t original;
+    int restaurar = (sched_getaffinity(0, sizeof(original), &original) == 0);
+#endif
+    int versao_original = usar_versao_otimizada;
+
+    fixar_thread_cpu(resultado->cpus[0]);
+    for (int i = 0; i < resultado->num_celulas; i++) {
+        resultado->celulas[i].serial = medir_celula(resultado, &resultado->celulas[i]);
+    }
+
+    configurar_otimizacao(versao_original);
+#if defined(__linux__)
+    if (restaurar) {
+        sched_setaffinity(0, sizeof(original), &original);
+    }
+#endif
+}
+
+static int contadores_iguais(const ResultadoTempo *a, const ResultadoTempo *b) {
+    return a->comparacoes == b->comparacoes &&
+           a->trocas == b->trocas &&
+           a->movimentacoes == b->movimentacoes;
+}
+
+ResultadoMatriz* executar_matriz_paralela(const ConfiguracaoParalela *config) {
+    ResultadoMatriz *resultado = calloc(1, sizeof(ResultadoMatriz));
+    if (!resultado) {
+        printf("ERRO: Falha na alocacao de memoria para a matriz\n");
+        return NULL;
+    }
+
+    if (carregar_conjuntos(resultado) == 0) {
+        printf("ERRO: Nenhum conjunto de dados carregado\n");
+        free(resultado);
+        return NULL;
+    }
+    montar_celulas(resultado);
+
+    resultado->nucleos_fisicos = detectar_nucleos_fisicos(resultado->cpus, MAX_TRABALHADORES);
+    int limite = (config && config->limite_concorrencia > 0)
+                 ? config->limite_concorrencia : LIMITE_CONCORRENCIA_PADRAO;
+    int num_trabalhadores = resultado->nucleos_fisicos;
+    if (num_trabalhadores > limite) num_trabalhadores = limite;
+    if (num_trabalhadores > resultado->num_celulas) num_trabalhadores = resultado->num_celulas;
+
+    printf("\nNucleos fisicos disponiveis: %d | threads de trabalho: %d | celulas: %d\n",
+           resultado->nucleos_fisicos, num_trabalhadores, resultado->num_celulas);
+
+    double inicio = obter_tempo_preciso();
+    executar_fase_paralela(resultado, num_trabalhadores);
+    resultado->tempo_parede_paralelo = obter_tempo_preciso() - inicio;
+
+    if (!config || config->verificar_serial) {
+        printf("\nConferencia serial (mesmas celulas, um nucleo)...\n");
+        inicio = obter_tempo_preciso();
+        executar_fase_serial(resultado);
+        resultado->tempo_parede_serial = obter_tempo_preciso() - inicio;
+        resultado->verificado = 1;
+    }
+
+    return resultado;
+}
+
+void liberar_resultado_matriz(ResultadoMatriz *resultado) {
+    if (!resultado) return;
+    free(resultado);  // Os dados pertencem ao registro de conjuntos
+}
+
+/* ================================================================
+ * RELATÓRIO
+ * ================================================================ */
+
+/**
+ * @brief Tempo da célula do qsort no mesmo conjunto (serial se conferido)
+ *
+ * @return Segundos, ou 0 se a célula não existir
+ */
+static double tempo_qsort_conjunto(const ResultadoMatriz *resultado, int indice_conjunto) {
+    for (int i = 0; i < resultado->num_celulas; i++) {
+        const CelulaMatriz *c = &resultado->celulas[i];
+        if (c->indice_algoritmo == INDICE_QSORT && c->indice_conjunto == indice_conjunto) {
+            return resultado->verificado ? c->serial.tempo_execucao : c->paralelo.tempo_execucao;
+        }
+    }
+    return 0.0;
+}
+
+static void escrever_matriz_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ResultadoMatriz *resultado = (const ResultadoMatriz*)dados;
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "          MATRIZ DE BENCHMARK PARALELA - NUCLEOS FIXADOS        \n");
+    fprintf(arquivo, "================================================================\n\n");
+    fprintf(arquivo, "Nucleos fisicos: %d | Threads de trabalho: %d | Celulas: %d\n",
+            resultado->nucleos_fisicos, resultado->num_trabalhadores, resultado->num_celulas);
+    fprintf(arquivo, "CPUs usadas:");
+    for (int t = 0; t < resultado->num_trabalhadores; t++) {
+        fprintf(arquivo, " %d", resultado->cpus[t]);
+    }
+    fprintf(arquivo, "\n\n");
+
+    fprintf(arquivo, "+-----------------+-----------+--------------------------------+-----+------------+------------+---------+-----------+----------+\n");
+    fprintf(arquivo, "| Algoritmo       | Versao    | Conjunto                       | CPU | Paralelo(s)| Serial (s) | Desvio  | Contadores| x qsort  |\n");
+    fprintf(arquivo, "+-----------------+-----------+--------------------------------+-----+------------+------------+---------+-----------+----------+\n");
+
+    double soma_desvios = 0.0, maior_desvio = 0.0;
+    int divergentes = 0, contadores_diferentes = 0;
+
+    for (int i = 0; i < resultado->num_celulas; i++) {
+        const CelulaMatriz *c = &resultado->celulas[i];
+        double desvio = 0.0;
+        const char *status_contadores = "-";
+
+        if (resultado->verificado && c->serial.tempo_execucao > 0.0) {
+            desvio = (c->paralelo.tempo_execucao - c->serial.tempo_execucao) / c->serial.tempo_execucao;
+            soma_desvios += fabs(desvio);
+            if (fabs(desvio) > maior_desvio) maior_desvio = fabs(desvio);
+            if (fabs(desvio) > DESVIO_MAXIMO_ACEITO) divergentes++;
+
+            int iguais = contadores_iguais(&c->paralelo, &c->serial);
+            contadores_diferentes += !iguais;
+            status_contadores = iguais ? "iguais" : "DIFEREM";
+        }
+
+        // Aceleração sobre o qsort no mesmo conjunto, com a mesma fase de medição
+        char aceleracao[16];
+        double tempo_qsort = tempo_qsort_conjunto(resultado, c->indice_conjunto);
+        double tempo = resultado->verificado ? c->serial.tempo_execucao : c->paralelo.tempo_execucao;
+        formatar_aceleracao(aceleracao_sobre_qsort(tempo_qsort, tempo), aceleracao, sizeof(aceleracao));
+
+        fprintf(arquivo, "| %-15s | %-9s | %-30s | %3d | %10.6f | %10.6f | %+6.1f%% | %-9s | %8s |\n",
+                obter_info_motor(c->indice_algoritmo)->nome,
+                eh_referencia(obter_info_motor(c->indice_algoritmo)) ? "libc" :
+                eh_plugin(obter_info_motor(c->indice_algoritmo)) ? "plugin" :
+                c->indice_algoritmo >= NUM_ALGORITMOS ? "unica" :
+                    (c->otimizada ? "otimizada" : "didatica"),
+                resultado->conjuntos[c->indice_conjunto].nome,
+                c->cpu,
+                c->paralelo.tempo_execucao,
+                c->serial.tempo_execucao,
+                desvio * 100.0,
+                status_contadores,
+                aceleracao);
+    }
+    fprintf(arquivo, "+-----------------+-----------+--------------------------------+-----+------------+------------+---------+-----------+----------+\n\n");
+
+    fprintf(arquivo, "RESUMO:\n");
+    fprintf(arquivo, "- Tempo de parede paralelo: %.3f s\n", resultado->tempo_parede_paralelo);
+    if (resultado->verificado) {
+        double economia = resultado->tempo_parede_serial - resultado->tempo_parede_paralelo;
+        fprintf(arquivo, "- Tempo de parede serial:   %.3f s\n", resultado->tempo_parede_serial);
+        fprintf(arquivo, "- Economia: %.3f s (speedup %.2fx)\n", economia,
+                resultado->tempo_parede_paralelo > 0.0
+                    ? resultado->tempo_parede_serial / resultado->tempo_parede_paralelo : 0.0);
+        fprintf(arquivo, "- Desvio medio |paralelo - serial|: %.1f%% (maior: %.1f%%)\n",
+                resultado->num_celulas > 0 ? 100.0 * soma_desvios / resultado->num_celulas : 0.0,
+                100.0 * maior_desvio);
+        fprintf(arquivo, "- Celulas com desvio acima de %.0f%%: %d\n",
+                100.0 * DESVIO_MAXIMO_ACEITO, divergentes);
+        fprintf(arquivo, "- Celulas com contadores diferentes: %d (esperado: 0)\n",
+                contadores_diferentes);
+    } else {
+        fprintf(arquivo, "- Conferencia serial desativada\n");
+    }
+
+    if (resultado->num_celulas > 0) {
+        char modo[64];
+        descrever_modo_isolamento(resultado->celulas[0].paralelo.modo_isolamento, modo, sizeof(modo));
+        fprintf(arquivo, "- Isolamento das medicoes paralelas: %s\n", modo);
+        if (resultado->verificado) {
+            descrever_modo_isolamento(resultado->celulas[0].serial.modo_isolamento, modo, sizeof(modo));
+            fprintf(arquivo, "- Isolamento da conferencia serial: %s\n", modo);
+        }
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- Uma thread por nucleo fisico; irmaos de hyper-threading nao sao usados\n");
+    fprintf(arquivo, "- Limite de concorrencia reduz disputa por banda de memoria e cache L3\n");
+    fprintf(arquivo, "- Celulas despachadas da mais cara para a mais barata (LPT)\n");
+    fprintf(arquivo, "- Contadores sao por thread; devem coincidir exatamente com o serial\n");
+    fprintf(arquivo, "- CPU -1: thread sem fixacao (plataforma sem sched_setaffinity)\n");
+    fprintf(arquivo, "- x qsort: tempo do qsort da libc no mesmo conjunto / tempo da celula\n");
+    fprintf(arquivo, "  (tempos da conferencia serial quando disponivel; > 1 = mais rapido)\n");
+}
+
+void gerar_relatorio_matriz(const ResultadoMatriz *resultado) {
+    if (!resultado) return;
+    salvar_arquivo_multiplos_locais("relatorios", "matriz_paralela.txt",
+                                    escrever_matriz_callback, (void*)resultado,
+                                    resultado->num_celulas);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_matriz_paralela_completa(void) {
+    printf("\n=== MATRIZ DE BENCHMARK PARALELA ===\n");
+    printf("Celulas (algoritmo, versao, conjunto) distribuidas entre nucleos fisicos.\n");
+
+    criar_diretorios_output();
+
+    ConfiguracaoParalela config = configuracao_paralela_padrao();
+    ResultadoMatriz *resultado = executar_matriz_paralela(&config);
+    if (!resultado) return;
+
+    printf("\nTempo de parede paralelo: %.3f s\n", resultado->tempo_parede_paralelo);
+    if (resultado->verificado) {
+        printf("Tempo de parede serial:   %.3f s (speedup %.2fx)\n",
+               resultado->tempo_parede_serial,
+               resultado->tempo_parede_paralelo > 0.0
+                   ? resultado->tempo_parede_serial / resultado->tempo_parede_paralelo : 0.0);
+    }
+
+    gerar_relatorio_matriz(resultado);
+    liberar_resultado_matriz(resultado);
+}
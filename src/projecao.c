@@ -0,0 +1,252 @@
+/**
+ * ================================================================
+ * PROJEÇÃO DE TEMPOS E ORÇAMENTO POR ALGORITMO
+ * ================================================================
+ *
+ * @file projecao.c
+ * @brief Histórico de medições, ajuste t ≈ c·n^k e corte por orçamento
+ *
+ *  FLUXO DE DECISÃO:
+ * ┌──────────────────┐    ┌───────────────────┐    ┌────────────────────┐
+ * │ Histórico (algo, │ →  │ Ajuste log-log    │ →  │ t(n) > orçamento?  │
+ * │ variante, dados) │    │ t ≈ c·n^k         │    │                    │
+ * └──────────────────┘    └───────────────────┘    └────────────────────┘
+ *                                                    │ sim          │ não
+ *                                                    ↓              ↓
+ *                                     ┌──────────────────────┐  executa
+ *                                     │ Amostra (prefixo) →  │  normalmente
+ *                                     │ refina o ajuste      │
+ *                                     └──────────────────────┘
+ *                                                    ↓
+ *                                        pula e marca PROJETADO
+ *
+ *  POR QUE A AMOSTRA:
+ * O ajuste só conhece tamanhos pequenos, onde constantes e efeitos de cache
+ * pesam mais. Executar um prefixo de tamanho intermediário (barato por
+ * construção) mede o erro da projeção e acrescenta um ponto mais próximo
+ * do n real, tornando a extrapolação final mais confiável.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para strcmp, strrchr e snprintf
+#include <ctype.h>   // Para isdigit
+#include <math.h>    // Para pow e log2
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+/// Registro de uma medição real
+typedef struct {
+    char algoritmo[30];
+    int otimizada;
+    char categoria[40];
+    int tamanho;
+    double tempo;
+} MedicaoHistorico;
+
+static MedicaoHistorico historico[MAX_HISTORICO_MEDICOES];
+static int num_medicoes = 0;
+static double orcamento_tempo = ORCAMENTO_TEMPO_PADRAO;
+static int validacao_amostra_ativa = 1;
+
+/// Tempos abaixo deste valor (s) são dominados pela resolução do relógio
+#define TEMPO_MINIMO_PROJECAO 0.00001
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int ajustar_historico(const char *algoritmo, int otimizada, const char *categoria,
+                             AjusteLinear *ajuste, int *maior_tamanho);
+static double avaliar_ajuste(const AjusteLinear *ajuste, int tamanho);
+
+/* ================================================================
+ * CONFIGURAÇÃO E HISTÓRICO
+ * ================================================================ */
+
+void configurar_orcamento_tempo(double segundos) {
+    orcamento_tempo = segundos;
+}
+
+double obter_orcamento_tempo(void) {
+    return orcamento_tempo;
+}
+
+void configurar_validacao_amostra(int ativa) {
+    validacao_amostra_ativa = ativa;
+}
+
+void limpar_historico_medicoes(void) {
+    num_medicoes = 0;
+}
+
+void registrar_medicao(const char *algoritmo, int otimizada, const char *categoria,
+                       int tamanho, double tempo) {
+    if (!algoritmo || !categoria || tamanho <= 0) return;
+
+    // Histórico cheio: descarta a medição mais antiga
+    if (num_medicoes == MAX_HISTORICO_MEDICOES) {
+        memmove(historico, historico + 1, (MAX_HISTORICO_MEDICOES - 1) * sizeof(MedicaoHistorico));
+        num_medicoes--;
+    }
+
+    MedicaoHistorico *m = &historico[num_medicoes++];
+    snprintf(m->algoritmo, sizeof(m->algoritmo), "%s", algoritmo);
+    snprintf(m->categoria, sizeof(m->categoria), "%s", categoria);
+    m->otimizada = otimizada;
+    m->tamanho = tamanho;
+    m->tempo = tempo;
+}
+
+void extrair_categoria_dados(const char *arquivo, char *categoria, size_t tamanho_categoria) {
+    if (!categoria || tamanho_categoria == 0) return;
+    snprintf(categoria, tamanho_categoria, "%s", arquivo ? arquivo : "");
+
+    // Remove extensão
+    char *ponto = strrchr(categoria, '.');
+    if (ponto) *ponto = '\0';
+
+    // Remove sufixo "_<tamanho>" quando composto apenas por dígitos
+    char *sublinhado = strrchr(categoria, '_');
+    if (sublinhado && sublinhado[1] != '\0') {
+        for (const char *c = sublinhado + 1; *c; c++) {
+            if (!isdigit((unsigned char)*c)) return;
+        }
+        *sublinhado = '\0';
+    }
+}
+
+/* ================================================================
+ * AJUSTE E PROJEÇÃO
+ * ================================================================ */
+
+/**
+ * @brief Ajusta t ≈ c·n^k às medições de um algoritmo/variante/família
+ *
+ * @return Número de tamanhos distintos usados no ajuste
+ */
+static int ajustar_historico(const char *algoritmo, int otimizada, const char *categoria,
+                             AjusteLinear *ajuste, int *maior_tamanho) {
+    int tamanhos[MAX_HISTORICO_MEDICOES];
+    double tempos[MAX_HISTORICO_MEDICOES];
+    int pontos = 0, distintos = 0;
+
+    *maior_tamanho = 0;
+    for (int i = 0; i < num_medicoes; i++) {
+        const MedicaoHistorico *m = &historico[i];
+        if (m->otimizada != otimizada || m->tempo < TEMPO_MINIMO_PROJECAO ||
+            strcmp(m->algoritmo, algoritmo) != 0 || strcmp(m->categoria, categoria) != 0) {
+            continue;
+        }
+
+        int repetido = 0;
+        for (int j = 0; j < pontos; j++) {
+            if (tamanhos[j] == m->tamanho) repetido = 1;
+        }
+        distintos += !repetido;
+
+        tamanhos[pontos] = m->tamanho;
+        tempos[pontos] = m->tempo;
+        pontos++;
+        if (m->tamanho > *maior_tamanho) *maior_tamanho = m->tamanho;
+    }
+
+    *ajuste = ajustar_lei_potencia(tamanhos, tempos, pontos);
+    return distintos;
+}
+
+/**
+ * @brief Avalia t(n) = 2^(intercepto + k·log2 n)
+ */
+static double avaliar_ajuste(const AjusteLinear *ajuste, int tamanho) {
+    return pow(2.0, ajuste->intercepto + ajuste->inclinacao * log2((double)tamanho));
+}
+
+ProjecaoTempo projetar_tempo(const char *algoritmo, int otimizada, const char *categoria,
+                             int tamanho) {
+    ProjecaoTempo projecao;
+    memset(&projecao, 0, sizeof(projecao));
+    projecao.tamanho = tamanho;
+
+    if (!algoritmo || !categoria || tamanho <= 0) return projecao;
+
+    AjusteLinear ajuste;
+    int maior_tamanho;
+    int distintos = ajustar_historico(algoritmo, otimizada, categoria, &ajuste, &maior_tamanho);
+
+    // Crescimento nulo ou negativo indica medições apenas de ruído
+    if (distintos < PONTOS_MINIMOS_PROJECAO || ajuste.inclinacao <= 0.0) {
+        return projecao;
+    }
+
+    projecao.valida = 1;
+    projecao.expoente = ajuste.inclinacao;
+    projecao.r2 = ajuste.r2;
+    projecao.pontos = ajuste.pontos;
+    projecao.tempo_projetado = avaliar_ajuste(&ajuste, tamanho);
+    return projecao;
+}
+
+/* ================================================================
+ * DECISÃO DE CORTE
+ * ================================================================ */
+
+int excede_orcamento(AlgoritmoInfo *info, const void *dados, int tamanho, size_t elem_size,
+                     CompareFn cmp, const char *categoria, ProjecaoTempo *projecao) {
+    ProjecaoTempo local = projetar_tempo(info->nome, usar_versao_otimizada, categoria, tamanho);
+    if (projecao) *projecao = local;
+
+    if (orcamento_tempo <= 0.0 || !local.valida || local.tempo_projetado <= orcamento_tempo) {
+        return 0;
+    }
+
+    if (validacao_amostra_ativa && dados) {
+        AjusteLinear ajuste;
+        int maior_tamanho;
+        ajustar_historico(info->nome, usar_versao_otimizada, categoria, &ajuste, &maior_tamanho);
+
+        // Maior prefixo m com t(m) <= fração do orçamento: log2 m = (log2 t - b) / k
+        double log_m = (log2(orcamento_tempo * FRACAO_ORCAMENTO_AMOSTRA) - ajuste.intercepto)
+                       / ajuste.inclinacao;
+        double m_real = pow(2.0, log_m);
+        int m = (m_real < tamanho / 2) ? (int)m_real : tamanho / 2;
+
+        // Só vale a pena se acrescentar um ponto além dos já medidos
+        if (m >= TAMANHO_MINIMO_AMOSTRA && m > maior_tamanho) {
+            void *amostra = malloc((size_t)m * elem_size);
+            if (amostra) {
+                copiar_array(dados, amostra, m, elem_size);
+                ResultadoTempo r = medir_algoritmo(info, amostra, m, elem_size, cmp, "amostra");
+                free(amostra);
+
+                double previsto = avaliar_ajuste(&ajuste, m);
+                registrar_medicao(info->nome, usar_versao_otimizada, categoria, m, r.tempo_execucao);
+
+                // Reprojeta com o ponto novo, preservando os dados da amostra
+                local = projetar_tempo(info->nome, usar_versao_otimizada, categoria, tamanho);
+                local.tamanho_amostra = m;
+                local.tempo_amostra_medido = r.tempo_execucao;
+                local.tempo_amostra_projetado = previsto;
+                local.erro_relativo_amostra = (r.tempo_execucao - previsto) / previsto;
+                if (projecao) *projecao = local;
+            }
+        }
+    }
+
+    return local.valida && local.tempo_projetado > orcamento_tempo;
+}
+
+ResultadoTempo resultado_projetado(const AlgoritmoInfo *info, const ProjecaoTempo *projecao,
+                                   const char *tipo_dados) {
+    ResultadoTempo resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    snprintf(resultado.algoritmo, sizeof(resultado.algoritmo), "%s", info->nome);
+    snprintf(resultado.tipo_dados, sizeof(resultado.tipo_dados), "%s", tipo_dados);
+    resultado.tamanho_dados = projecao->tamanho;
+    resultado.tempo_execucao = projecao->tempo_projetado;
+    resultado.projetado = 1;
+    return resultado;
+}
@@ -0,0 +1,162 @@
+/**
+ * ================================================================
+ * RASTRO DE ACESSOS À MEMÓRIA
+ * ================================================================
+ *
+ * @file rastro.c
+ * @brief Buffer circular de endereços e formato binário .bin
+ *
+ *  LAYOUT DO ARQUIVO:
+ * ┌───────────────────────────────────────────────────────────────┐
+ * │ uint32 assinatura ("SRTR") │ uint32 versão │ uint32 elem_size │
+ * │ uint32 reservado           │ uint64 total  │ uint64 retidos   │
+ * ├───────────────────────────────────────────────────────────────┤
+ * │ uint64 entrada[retidos]  (mais antiga → mais recente)         │
+ * └───────────────────────────────────────────────────────────────┘
+ *
+ * O arquivo usa a ordem de bytes da máquina que o gravou; a ferramenta
+ * simular_cache recusa arquivos cuja assinatura não confere.
+ *
+ * ================================================================
+ */
+
+#include "../include/rastro.h"
+#include <stdio.h>      // Para fopen, fwrite, fread
+#include <stdlib.h>     // Para malloc, free
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+THREAD_LOCAL RastroMemoria *rastro_ativo = NULL;
+
+/**
+ * @brief Cabeçalho do arquivo .bin
+ */
+typedef struct {
+    uint32_t assinatura;
+    uint32_t versao;
+    uint32_t elem_size;
+    uint32_t reservado;
+    uint64_t total;
+    uint64_t retidos;
+} CabecalhoRastro;
+
+/* ================================================================
+ * CICLO DE VIDA
+ * ================================================================ */
+
+RastroMemoria* criar_rastro(size_t capacidade, size_t elem_size) {
+    size_t potencia = 1;
+    while (potencia < capacidade) potencia <<= 1;
+
+    RastroMemoria *rastro = malloc(sizeof(RastroMemoria));
+    if (!rastro) return NULL;
+
+    rastro->entradas = malloc(potencia * sizeof(uint64_t));
+    if (!rastro->entradas) {
+        free(rastro);
+        return NULL;
+    }
+    rastro->capacidade = potencia;
+    rastro->total = 0;
+    rastro->elem_size = (uint32_t)elem_size;
+    return rastro;
+}
+
+void liberar_rastro(RastroMemoria *rastro) {
+    if (!rastro) return;
+    if (rastro_ativo == rastro) rastro_ativo = NULL;
+    free(rastro->entradas);
+    free(rastro);
+}
+
+void ativar_rastro(RastroMemoria *rastro) {
+    rastro_ativo = rastro;
+}
+
+/* ================================================================
+ * REGISTRO E LEITURA
+ * ================================================================ */
+
+void rastro_registrar(RastroMemoria *rastro, const void *endereco, int escrita) {
+    size_t posicao = (size_t)(rastro->total & (rastro->capacidade - 1));
+    rastro->entradas[posicao] = ((uint64_t)(uintptr_t)endereco << 1) | (escrita ? 1u : 0u);
+    rastro->total++;
+}
+
+size_t rastro_retidos(const RastroMemoria *rastro) {
+    return rastro->total < rastro->capacidade ? (size_t)rastro->total : rastro->capacidade;
+}
+
+uint64_t rastro_entrada(const RastroMemoria *rastro, size_t i) {
+    uint64_t primeira = rastro->total - rastro_retidos(rastro);
+    return rastro->entradas[(size_t)((primeira + i) & (rastro->capacidade - 1))];
+}
+
+/* ================================================================
+ * ARQUIVO BINÁRIO
+ * ================================================================ */
+
+int salvar_rastro(const RastroMemoria *rastro, const char *caminho) {
+    if (!rastro || !caminho) return -1;
+
+    FILE *arquivo = fopen(caminho, "wb");
+    if (!arquivo) return -1;
+
+    size_t retidos = rastro_retidos(rastro);
+    CabecalhoRastro cabecalho = {
+        ASSINATURA_RASTRO, VERSAO_RASTRO, rastro->elem_size, 0, rastro->total, retidos
+    };
+    int ok = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1;
+
+    // Grava em até dois blocos contíguos: do mais antigo ao fim do buffer, e do início
+    size_t inicio = (size_t)((rastro->total - retidos) & (rastro->capacidade - 1));
+    size_t primeiro_bloco = retidos;
+    if (inicio + primeiro_bloco > rastro->capacidade) primeiro_bloco = rastro->capacidade - inicio;
+
+    if (ok && primeiro_bloco > 0) {
+        ok = fwrite(rastro->entradas + inicio, sizeof(uint64_t), primeiro_bloco, arquivo) == primeiro_bloco;
+    }
+    if (ok && retidos > primeiro_bloco) {
+        size_t resto = retidos - primeiro_bloco;
+        ok = fwrite(rastro->entradas, sizeof(uint64_t), resto, arquivo) == resto;
+    }
+
+    if (fclose(arquivo) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+RastroMemoria* carregar_rastro(const char *caminho) {
+    if (!caminho) return NULL;
+
+    FILE *arquivo = fopen(caminho, "rb");
+    if (!arquivo) return NULL;
+
+    CabecalhoRastro cabecalho;
+    if (fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1 ||
+        cabecalho.assinatura != ASSINATURA_RASTRO ||
+        cabecalho.versao != VERSAO_RASTRO ||
+        cabecalho.retidos > cabecalho.total) {
+        fclose(arquivo);
+        return NULL;
+    }
+
+    RastroMemoria *rastro = criar_rastro(cabecalho.retidos > 0 ? (size_t)cabecalho.retidos : 1,
+                                         cabecalho.elem_size);
+    if (!rastro) {
+        fclose(arquivo);
+        return NULL;
+    }
+
+    size_t lidos = fread(rastro->entradas, sizeof(uint64_t), (size_t)cabecalho.retidos, arquivo);
+    fclose(arquivo);
+    if (lidos != cabecalho.retidos) {
+        liberar_rastro(rastro);
+        return NULL;
+    }
+
+    // O buffer foi arredondado para potência de 2: o total reflete só o que foi lido
+    rastro->total = cabecalho.retidos;
+    return rastro;
+}
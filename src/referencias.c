@@ -0,0 +1,126 @@
+/**
+ * ================================================================
+ * ORDENAÇÕES DE REFERÊNCIA (LIBC)
+ * ================================================================
+ *
+ * @file referencias.c
+ * @brief Adaptadores de qsort/mergesort/heapsort para a interface OrdenacaoFn
+ *
+ *  ADAPTADOR:
+ * ┌───────────────────┐   ┌────────────────────────┐   ┌──────────────────────┐
+ * │ ordenar(arr, n,   │ → │ configurar_comparacao_ │ → │ qsort(arr, n, size,  │
+ * │   size, cmp, ctx) │   │ contada(cmp)           │   │   comparar_e_contar) │
+ * └───────────────────┘   └────────────────────────┘   └──────────────────────┘
+ *
+ * Como as referências usam a mesma estrutura AlgoritmoInfo, entram em
+ * medir_algoritmo(), no orçamento de tempo e nos relatórios sem nenhum
+ * caminho especial; só o salvamento dos arrays ordenados as ignora.
+ *
+ * ================================================================
+ */
+
+#include <stdlib.h>  // Para qsort (e mergesort/heapsort em BSD)
+#include <string.h>  // Para strcmp
+#include <stdio.h>   // Para fprintf, snprintf
+#include "../include/sorts.h"
+
+/* ================================================================
+ * ADAPTADORES
+ * ================================================================ */
+
+void referencia_qsort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)contexto;
+    if (n < 2) return;
+    configurar_comparacao_contada(cmp);
+    qsort(arr, (size_t)n, elem_size, comparar_e_contar);
+}
+
+#ifdef SORTS_REFERENCIAS_BSD
+void referencia_mergesort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)contexto;
+    if (n < 2) return;
+    configurar_comparacao_contada(cmp);
+    // Falha com elem_size < sizeof(void*)/2 (EINVAL) ou sem memória (ENOMEM)
+    if (mergesort(arr, (size_t)n, elem_size, comparar_e_contar) != 0) {
+        fprintf(stderr, "AVISO: mergesort(3) falhou; usando qsort\n");
+        qsort(arr, (size_t)n, elem_size, comparar_e_contar);
+    }
+}
+
+void referencia_heapsort(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)contexto;
+    if (n < 2) return;
+    configurar_comparacao_contada(cmp);
+    if (heapsort(arr, (size_t)n, elem_size, comparar_e_contar) != 0) {
+        fprintf(stderr, "AVISO: heapsort(3) falhou; usando qsort\n");
+        qsort(arr, (size_t)n, elem_size, comparar_e_contar);
+    }
+}
+#endif
+
+/* ================================================================
+ * TABELA DE REFERÊNCIAS
+ * ================================================================ */
+
+/**
+ * @brief Complexidades do padrão C são indefinidas; valem as das libc comuns
+ *
+ * glibc usa intercalação (quicksort quando falta memória), musl smoothsort
+ * e as BSD introsort; todas são O(n log n) no caso médio. O padrão não
+ * garante estabilidade, então o qsort é declarado não estável.
+ */
+AlgoritmoInfo* obter_info_referencias(void) {
+    static AlgoritmoInfo referencias[NUM_REFERENCIAS] = {
+        {
+            "qsort libc", "O(n log n)", "O(n log n)", "O(n log n)", 0,
+            referencia_qsort, NULL, "qsort", "referencia,libc,n_log_n"
+        },
+#ifdef SORTS_REFERENCIAS_BSD
+        {
+            "mergesort BSD", "O(n log n)", "O(n log n)", "O(n log n)", CAPACIDADE_ESTAVEL,
+            referencia_mergesort, NULL, "mergesort", "referencia,libc,n_log_n"
+        },
+        {
+            "heapsort BSD", "O(n log n)", "O(n log n)", "O(n log n)", CAPACIDADE_EM_LUGAR,
+            referencia_heapsort, NULL, "heapsort", "referencia,libc,n_log_n"
+        }
+#endif
+    };
+    return referencias;
+}
+
+int eh_referencia(const AlgoritmoInfo *info) {
+    int indice = indice_motor(info);
+    return indice >= NUM_ALGORITMOS && indice < NUM_ALGORITMOS + NUM_REFERENCIAS;
+}
+
+/* ================================================================
+ * ACELERAÇÃO SOBRE O QSORT
+ * ================================================================ */
+
+double aceleracao_sobre_qsort(double tempo_qsort, double tempo) {
+    if (tempo_qsort <= 0.0 || tempo <= 0.0) return 0.0;
+    return tempo_qsort / tempo;
+}
+
+void formatar_aceleracao(double aceleracao, char *buffer, size_t tamanho_buffer) {
+    if (aceleracao <= 0.0) {
+        snprintf(buffer, tamanho_buffer, "-");
+    } else if (aceleracao >= 0.1) {
+        snprintf(buffer, tamanho_buffer, "%.2fx", aceleracao);
+    } else if (aceleracao >= 0.0001) {
+        snprintf(buffer, tamanho_buffer, "%.4fx", aceleracao);
+    } else {
+        snprintf(buffer, tamanho_buffer, "<0.0001x");
+    }
+}
+
+double tempo_qsort_resultados(const ResultadoTempo *resultados, int num_resultados) {
+    const char *nome_qsort = obter_info_referencias()[0].nome;
+    for (int i = 0; i < num_resultados; i++) {
+        if (strcmp(resultados[i].algoritmo, nome_qsort) == 0) {
+            return resultados[i].tempo_execucao;
+        }
+    }
+    return 0.0;
+}
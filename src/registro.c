@@ -0,0 +1,396 @@
+/**
+ * ================================================================
+ * REGISTRO DE MOTORES DE ORDENAÇÃO
+ * ================================================================
+ *
+ * @file registro.c
+ * @brief Tabela de motores, seleção por nome/etiqueta e carga de plugins
+ *
+ *  CARGA DE UM PLUGIN:
+ * ┌──────────────────────┐   ┌──────────────────────┐   ┌──────────────────────┐
+ * │ dlopen(caminho)      │ → │ dlsym("sorts_        │ → │ entrada(versão,      │
+ * │ RTLD_NOW | LOCAL     │   │ registrar_plugin")   │   │ registrar_motor)     │
+ * └──────────────────────┘   └──────────────────────┘   └──────────┬───────────┘
+ *                                                                  ↓
+ *                            ┌──────────────────────────────────────────────┐
+ *                            │ Falhou: descarta o que registrou e dlclose;  │
+ *                            │ sucesso: a biblioteca fica aberta até o fim  │
+ *                            └──────────────────────────────────────────────┘
+ *
+ * Os motores internos são apontados, não copiados: obter_info_motor(i)
+ * devolve o mesmo ponteiro que obter_info_algoritmos() + i. Motores
+ * externos são copiados para memória do registro (o plugin pode montar
+ * a estrutura na pilha).
+ *
+ * ================================================================
+ */
+
+#include <ctype.h>   // Para tolower, isalnum, isspace
+#include <string.h>  // Para strlen, strchr, strncmp, memcpy
+#include <stdatomic.h>  // Para a inicialização única
+#include "../include/sorts.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <dlfcn.h>
+    #define SORTS_TEM_DLOPEN 1
+#endif
+
+/* ================================================================
+ * ESTADO DO REGISTRO
+ * ================================================================ */
+
+/// 0 = vazio, 1 = montando, 2 = internos registrados
+static atomic_int estado_registro = 0;
+
+static AlgoritmoInfo *motores[MAX_MOTORES];
+static int total_motores = 0;
+
+/// Cópias dos motores externos (os internos ficam nas tabelas estáticas)
+static AlgoritmoInfo motores_externos[MAX_MOTORES - NUM_MOTORES_INTERNOS];
+static int total_externos = 0;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void garantir_registro(void);
+static int iguais_sem_caixa(const char *a, const char *b);
+static void derivar_id(const char *nome, char *id, size_t tamanho_id);
+static void acrescentar_etiqueta(char *etiquetas, size_t tamanho, const char *etiqueta);
+static int termo_casa(const AlgoritmoInfo *info, const char *termo);
+static char* proximo_termo(char **cursor, char separador);
+static void descartar_externos_desde(int total_anterior);
+
+/* ================================================================
+ * INICIALIZAÇÃO
+ * ================================================================ */
+
+static void garantir_registro(void) {
+    if (atomic_load_explicit(&estado_registro, memory_order_acquire) == 2) return;
+
+    int esperado = 0;
+    if (!atomic_compare_exchange_strong(&estado_registro, &esperado, 1)) {
+        // Outra thread montando: espera o término
+        while (atomic_load(&estado_registro) != 2) { }
+        return;
+    }
+
+    AlgoritmoInfo *algoritmos = obter_info_algoritmos();
+    AlgoritmoInfo *referencias = obter_info_referencias();
+    AlgoritmoInfo *especializados = obter_info_especializados();
+    for (int i = 0; i < NUM_ALGORITMOS; i++) motores[total_motores++] = &algoritmos[i];
+    for (int i = 0; i < NUM_REFERENCIAS; i++) motores[total_motores++] = &referencias[i];
+    for (int i = 0; i < NUM_ESPECIALIZADOS; i++) motores[total_motores++] = &especializados[i];
+
+    atomic_store_explicit(&estado_registro, 2, memory_order_release);
+}
+
+/* ================================================================
+ * CONSULTA
+ * ================================================================ */
+
+int num_motores(void) {
+    garantir_registro();
+    return total_motores;
+}
+
+AlgoritmoInfo* obter_info_motor(int indice) {
+    garantir_registro();
+    if (indice < 0 || indice >= total_motores) return NULL;
+    return motores[indice];
+}
+
+int indice_motor(const AlgoritmoInfo *info) {
+    garantir_registro();
+    // Comparação por igualdade: válida entre ponteiros de arrays diferentes
+    for (int i = 0; i < total_motores; i++) {
+        if (motores[i] == info) return i;
+    }
+    return -1;
+}
+
+int eh_plugin(const AlgoritmoInfo *info) {
+    return indice_motor(info) >= NUM_MOTORES_INTERNOS;
+}
+
+static int iguais_sem_caixa(const char *a, const char *b) {
+    while (*a && *b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return 0;
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+AlgoritmoInfo* buscar_motor(const char *nome_ou_id) {
+    if (!nome_ou_id) return NULL;
+    garantir_registro();
+    for (int i = 0; i < total_motores; i++) {
+        if (iguais_sem_caixa(motores[i]->id, nome_ou_id) ||
+            iguais_sem_caixa(motores[i]->nome, nome_ou_id)) {
+            return motores[i];
+        }
+    }
+    return NULL;
+}
+
+int motor_tem_etiqueta(const AlgoritmoInfo *info, const char *etiqueta) {
+    size_t tamanho = strlen(etiqueta);
+    if (tamanho == 0) return 0;
+
+    const char *p = info->etiquetas;
+    while (*p) {
+        const char *fim = strchr(p, ',');
+        size_t comprimento = fim ? (size_t)(fim - p) : strlen(p);
+        if (comprimento == tamanho && strncmp(p, etiqueta, tamanho) == 0) return 1;
+        if (!fim) break;
+        p = fim + 1;
+    }
+    return 0;
+}
+
+int motor_aceita_dados(const AlgoritmoInfo *info, size_t elem_size, CompareFn cmp) {
+    if (!(info->capacidades & CAPACIDADE_SO_INTEIROS)) return 1;
+    return elem_size == sizeof(int) && cmp == comparar_inteiros;
+}
+
+void descrever_capacidades(unsigned capacidades, char *buffer, size_t tamanho_buffer) {
+    static const struct { unsigned bit; const char *nome; } nomes[] = {
+        { CAPACIDADE_ESTAVEL, "estavel" },
+        { CAPACIDADE_EM_LUGAR, "em_lugar" },
+        { CAPACIDADE_SO_INTEIROS, "so_inteiros" },
+        { CAPACIDADE_PARALELO, "paralelo" }
+    };
+
+    if (tamanho_buffer == 0) return;
+    buffer[0] = '\0';
+    for (size_t i = 0; i < sizeof(nomes) / sizeof(nomes[0]); i++) {
+        if (capacidades & nomes[i].bit) acrescentar_etiqueta(buffer, tamanho_buffer, nomes[i].nome);
+    }
+    if (buffer[0] == '\0') snprintf(buffer, tamanho_buffer, "-");
+}
+
+/* ================================================================
+ * REGISTRO DE MOTORES EXTERNOS
+ * ================================================================ */
+
+/**
+ * @brief "Tim Sort (plugin)" → "tim_sort_plugin": minúsculas, '_' no resto
+ */
+static void derivar_id(const char *nome, char *id, size_t tamanho_id) {
+    size_t j = 0;
+    for (size_t i = 0; nome[i] && j + 1 < tamanho_id; i++) {
+        unsigned char c = (unsigned char)nome[i];
+        if (isalnum(c)) {
+            id[j++] = (char)tolower(c);
+        } else if (j > 0 && id[j - 1] != '_') {
+            id[j++] = '_';
+        }
+    }
+    while (j > 0 && id[j - 1] == '_') j--;
+    id[j] = '\0';
+}
+
+static void acrescentar_etiqueta(char *etiquetas, size_t tamanho, const char *etiqueta) {
+    size_t usado = strlen(etiquetas);
+    size_t necessario = strlen(etiqueta) + (usado > 0 ? 1 : 0);
+    if (usado + necessario >= tamanho) return;  // Não cabe: fica sem a etiqueta
+    snprintf(etiquetas + usado, tamanho - usado, "%s%s", usado > 0 ? "," : "", etiqueta);
+}
+
+int registrar_motor(const AlgoritmoInfo *info) {
+    garantir_registro();
+
+    if (!info || !info->ordenar || info->nome[0] == '\0') {
+        fprintf(stderr, "AVISO: motor sem nome ou sem implementacao; ignorado\n");
+        return -1;
+    }
+    if (total_motores >= MAX_MOTORES) {
+        fprintf(stderr, "AVISO: registro cheio (%d motores); '%s' ignorado\n", MAX_MOTORES, info->nome);
+        return -1;
+    }
+
+    AlgoritmoInfo copia = *info;
+    // Strings do plugin podem vir sem terminador: a cópia sempre termina
+    copia.nome[sizeof(copia.nome) - 1] = '\0';
+    copia.id[sizeof(copia.id) - 1] = '\0';
+    copia.etiquetas[sizeof(copia.etiquetas) - 1] = '\0';
+    copia.complexidade_melhor[sizeof(copia.complexidade_melhor) - 1] = '\0';
+    copia.complexidade_media[sizeof(copia.complexidade_media) - 1] = '\0';
+    copia.complexidade_pior[sizeof(copia.complexidade_pior) - 1] = '\0';
+    if (copia.id[0] == '\0') derivar_id(copia.nome, copia.id, sizeof(copia.id));
+
+    if (buscar_motor(copia.id) || buscar_motor(copia.nome)) {
+        fprintf(stderr, "AVISO: motor '%s' (%s) ja registrado; ignorado\n", copia.nome, copia.id);
+        return -1;
+    }
+    if (!motor_tem_etiqueta(&copia, "plugin")) {
+        acrescentar_etiqueta(copia.etiquetas, sizeof(copia.etiquetas), "plugin");
+    }
+
+    motores_externos[total_externos] = copia;
+    motores[total_motores] = &motores_externos[total_externos];
+    total_externos++;
+    return total_motores++;
+}
+
+static void descartar_externos_desde(int total_anterior) {
+    total_externos -= total_motores - total_anterior;
+    total_motores = total_anterior;
+}
+
+/* ================================================================
+ * SELEÇÃO
+ * ================================================================ */
+
+/**
+ * @brief Corta o próximo termo de *cursor (sem espaços nas pontas); NULL no fim
+ *
+ * Substitui strtok_r, que não existe no MSVC.
+ */
+static char* proximo_termo(char **cursor, char separador) {
+    char *termo = *cursor;
+    if (!termo) return NULL;
+
+    char *fim = strchr(termo, separador);
+    if (fim) {
+        *fim = '\0';
+        *cursor = fim + 1;
+    } else {
+        *cursor = NULL;
+    }
+
+    while (isspace((unsigned char)*termo)) termo++;
+    char *ultimo = termo + strlen(termo);
+    while (ultimo > termo && isspace((unsigned char)ultimo[-1])) *--ultimo = '\0';
+    return termo;
+}
+
+static int termo_casa(const AlgoritmoInfo *info, const char *termo) {
+    return iguais_sem_caixa(termo, "todos") || strcmp(termo, "*") == 0 ||
+           iguais_sem_caixa(info->id, termo) || iguais_sem_caixa(info->nome, termo) ||
+           motor_tem_etiqueta(info, termo);
+}
+
+int selecionar_motores(const char *seletor, int *indices, int max_indices) {
+    garantir_registro();
+
+    int escolhido[MAX_MOTORES] = {0};
+    int algum_inclusivo = 0;
+    char copia[256];
+    snprintf(copia, sizeof(copia), "%s", seletor ? seletor : "");
+
+    char *cursor = copia;
+    char *termo;
+    while ((termo = proximo_termo(&cursor, ',')) != NULL) {
+        if (*termo == '\0') continue;
+
+        int excluir = (*termo == '-');
+        if (excluir) {
+            termo++;
+        } else {
+            algum_inclusivo = 1;
+        }
+
+        int casou = 0;
+        for (int i = 0; i < total_motores; i++) {
+            if (termo_casa(motores[i], termo)) {
+                escolhido[i] = excluir ? -1 : (escolhido[i] == -1 ? -1 : 1);
+                casou = 1;
+            }
+        }
+        if (!casou) {
+            fprintf(stderr, "ERRO: '%s' nao e id, nome nem etiqueta de nenhum motor\n", termo);
+            return -1;
+        }
+    }
+
+    // Só exclusões (ou seletor vazio): parte de todos os motores
+    int quantidade = 0;
+    for (int i = 0; i < total_motores && quantidade < max_indices; i++) {
+        int incluido = algum_inclusivo ? escolhido[i] == 1 : escolhido[i] != -1;
+        if (incluido) indices[quantidade++] = i;
+    }
+    return quantidade;
+}
+
+/* ================================================================
+ * PLUGINS
+ * ================================================================ */
+
+int carregar_plugin_motores(const char *caminho) {
+    garantir_registro();
+
+#ifdef SORTS_TEM_DLOPEN
+    void *biblioteca = dlopen(caminho, RTLD_NOW | RTLD_LOCAL);
+    if (!biblioteca) {
+        fprintf(stderr, "ERRO: plugin '%s': %s\n", caminho, dlerror());
+        return -1;
+    }
+
+    // dlsym devolve void*; a cópia evita a conversão objeto → função (ISO C)
+    void *simbolo = dlsym(biblioteca, SIMBOLO_PLUGIN_MOTORES);
+    if (!simbolo) {
+        fprintf(stderr, "ERRO: plugin '%s' nao exporta %s\n", caminho, SIMBOLO_PLUGIN_MOTORES);
+        dlclose(biblioteca);
+        return -1;
+    }
+    PontoEntradaPluginFn entrada;
+    memcpy(&entrada, &simbolo, sizeof(entrada));
+
+    int total_anterior = total_motores;
+    int status = entrada(VERSAO_API_PLUGIN_MOTORES, registrar_motor);
+    if (status != 0) {
+        fprintf(stderr, "ERRO: plugin '%s' recusou a carga (codigo %d, API %d)\n",
+                caminho, status, VERSAO_API_PLUGIN_MOTORES);
+        descartar_externos_desde(total_anterior);
+        dlclose(biblioteca);
+        return -1;
+    }
+
+    // Sucesso: as funções do plugin estão no registro, a biblioteca fica aberta
+    return total_motores - total_anterior;
+#else
+    fprintf(stderr, "ERRO: plugin '%s': carga dinamica indisponivel nesta plataforma\n", caminho);
+    return -1;
+#endif
+}
+
+int carregar_plugins_ambiente(void) {
+    const char *valor = getenv(VARIAVEL_AMBIENTE_PLUGINS);
+    if (!valor || valor[0] == '\0') return 0;
+
+    char copia[1024];
+    snprintf(copia, sizeof(copia), "%s", valor);
+
+    int total = 0;
+    char *cursor = copia;
+    char *caminho;
+    while ((caminho = proximo_termo(&cursor, ':')) != NULL) {
+        if (*caminho == '\0') continue;
+        int registrados = carregar_plugin_motores(caminho);
+        if (registrados > 0) total += registrados;
+    }
+    return total;
+}
+
+/* ================================================================
+ * LISTAGEM
+ * ================================================================ */
+
+void listar_motores(FILE *saida) {
+    garantir_registro();
+
+    fprintf(saida, "%-3s %-12s %-20s %-8s %-22s %s\n",
+            "#", "Id", "Nome", "Origem", "Capacidades", "Etiquetas");
+    for (int i = 0; i < total_motores; i++) {
+        const AlgoritmoInfo *info = motores[i];
+        char capacidades[64];
+        descrever_capacidades(info->capacidades, capacidades, sizeof(capacidades));
+        const char *origem = i < NUM_ALGORITMOS ? "interno" :
+                             i < INDICE_APRENDIDA ? "libc" :
+                             i < NUM_MOTORES_INTERNOS ? "interno" : "plugin";
+        fprintf(saida, "%-3d %-12s %-20s %-8s %-22s %s\n",
+                i, info->id, info->nome, origem, capacidades, info->etiquetas);
+    }
+}
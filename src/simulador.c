@@ -0,0 +1,482 @@
+/**
+ * ================================================================
+ * SIMULADOR OFFLINE DE CACHE E TLB
+ * ================================================================
+ *
+ * @file simulador.c
+ * @brief Caches associativas LRU e distância de reuso por árvore de Fenwick
+ *
+ *  CAMINHO DE UM ACESSO:
+ * ┌──────────┐   ┌─────┐ falha ┌─────┐ falha ┌─────┐ falha ┌─────────┐
+ * │ endereço │ → │ L1  │ ────→ │ L2  │ ────→ │ LLC │ ────→ │ memória │
+ * └──────────┘   └─────┘       └─────┘       └─────┘       └─────────┘
+ *       │
+ *       └──→ TLB (página)            └──→ distância de reuso (linha do L1)
+ *
+ * Um acesso de elem_size bytes que cruza a fronteira de linha conta como
+ * um acesso por linha tocada.
+ *
+ *  DISTÂNCIA DE REUSO EM O(log N):
+ * Cada acesso recebe um instante t. A árvore de Fenwick marca, para cada
+ * linha, apenas o instante do seu acesso mais recente. A distância do
+ * acesso em t a uma linha vista pela última vez em p é o número de marcas
+ * em (p, t): exatamente as linhas distintas tocadas no intervalo. Um mapa
+ * de espalhamento guarda p para cada linha.
+ *
+ * ================================================================
+ */
+
+#include "../include/simulador.h"
+#include <stdlib.h>     // Para calloc, free, strtoull
+#include <string.h>     // Para memset, snprintf
+
+#ifndef _WIN32
+    #include <unistd.h>  // Para sysconf
+#endif
+
+/* ================================================================
+ * ESTRUTURAS INTERNAS
+ * ================================================================ */
+
+/**
+ * @brief Estado de um nível: vias de cada conjunto com carimbo LRU
+ */
+typedef struct {
+    uint64_t *blocos;       ///< Bloco + 1 (0 = via vazia)
+    uint64_t *carimbos;     ///< Instante do último uso de cada via
+    size_t conjuntos;
+    int vias;
+    int deslocamento;       ///< log2(linha)
+    uint64_t relogio;
+} CacheSimulada;
+
+/**
+ * @brief Mapa linha → instante do último acesso (endereçamento aberto)
+ */
+typedef struct {
+    uint64_t *chaves;       ///< Linha + 1 (0 = vazio)
+    uint64_t *instantes;
+    size_t capacidade;      ///< Potência de 2
+    size_t ocupados;
+} MapaUltimoAcesso;
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int log2_exato(size_t valor);
+static int nivel_valido(const NivelCache *nivel);
+static NivelCache nivel_sistema(const char *nome, long tamanho, long vias, long linha, NivelCache padrao);
+static int criar_cache(CacheSimulada *cache, const NivelCache *nivel);
+static void liberar_cache(CacheSimulada *cache);
+static int acessar_cache(CacheSimulada *cache, uint64_t endereco);
+static int criar_mapa(MapaUltimoAcesso *mapa, size_t capacidade);
+static int mapa_trocar(MapaUltimoAcesso *mapa, uint64_t linha, uint64_t instante, uint64_t *anterior);
+static void fenwick_somar(uint32_t *arvore, size_t tamanho, size_t i, int delta);
+static uint64_t fenwick_prefixo(const uint32_t *arvore, size_t i);
+static int balde_reuso(uint64_t distancia);
+static void formatar_bytes(size_t bytes, char *buffer, size_t tamanho_buffer);
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+static int log2_exato(size_t valor) {
+    if (valor == 0 || (valor & (valor - 1)) != 0) return -1;
+    int expoente = 0;
+    while ((valor >> expoente) != 1) expoente++;
+    return expoente;
+}
+
+static int nivel_valido(const NivelCache *nivel) {
+    if (nivel->associatividade <= 0 || log2_exato((size_t)nivel->linha) < 0) return 0;
+    size_t por_conjunto = (size_t)nivel->associatividade * (size_t)nivel->linha;
+    return nivel->tamanho >= por_conjunto && nivel->tamanho % por_conjunto == 0;
+}
+
+/**
+ * @brief Nível a partir dos valores do sysconf, ou o padrão se forem inconsistentes
+ */
+static NivelCache nivel_sistema(const char *nome, long tamanho, long vias, long linha, NivelCache padrao) {
+    NivelCache nivel = padrao;
+    if (tamanho > 0 && vias > 0 && linha > 0) {
+        nivel.tamanho = (size_t)tamanho;
+        nivel.associatividade = (int)vias;
+        nivel.linha = (int)linha;
+        if (!nivel_valido(&nivel)) nivel = padrao;
+    }
+    snprintf(nivel.nome, sizeof(nivel.nome), "%s", nome);
+    return nivel;
+}
+
+ConfiguracaoCache configuracao_cache_padrao(void) {
+    ConfiguracaoCache config;
+    memset(&config, 0, sizeof(config));
+
+    NivelCache l1 = { "L1", 32u * 1024u, 8, 64 };
+    NivelCache l2 = { "L2", 1024u * 1024u, 16, 64 };
+    NivelCache llc = { "LLC", 8u * 1024u * 1024u, 16, 64 };
+    NivelCache tlb = { "TLB", 64u * 4096u, 4, 4096 };
+
+#if !defined(_WIN32) && defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    l1 = nivel_sistema("L1", sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL1_DCACHE_ASSOC),
+                       sysconf(_SC_LEVEL1_DCACHE_LINESIZE), l1);
+    l2 = nivel_sistema("L2", sysconf(_SC_LEVEL2_CACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_ASSOC),
+                       sysconf(_SC_LEVEL2_CACHE_LINESIZE), l2);
+    llc = nivel_sistema("LLC", sysconf(_SC_LEVEL3_CACHE_SIZE), sysconf(_SC_LEVEL3_CACHE_ASSOC),
+                        sysconf(_SC_LEVEL3_CACHE_LINESIZE), llc);
+#endif
+#ifndef _WIN32
+    long pagina = sysconf(_SC_PAGESIZE);
+    if (pagina > 0 && log2_exato((size_t)pagina) >= 0) {
+        tlb.linha = (int)pagina;
+        tlb.tamanho = 64u * (size_t)pagina;
+    }
+#endif
+
+    config.niveis[0] = l1;
+    config.niveis[1] = l2;
+    config.niveis[2] = llc;
+    config.num_niveis = 3;
+    config.tlb = tlb;
+    return config;
+}
+
+int interpretar_nivel_cache(const char *texto, NivelCache *nivel) {
+    if (!texto || !nivel) return -1;
+
+    char *fim;
+    unsigned long long tamanho = strtoull(texto, &fim, 10);
+    if (fim == texto) return -1;
+    if (*fim == 'K' || *fim == 'k') { tamanho *= 1024ULL; fim++; }
+    else if (*fim == 'M' || *fim == 'm') { tamanho *= 1024ULL * 1024ULL; fim++; }
+    else if (*fim == 'G' || *fim == 'g') { tamanho *= 1024ULL * 1024ULL * 1024ULL; fim++; }
+    if (*fim != ':') return -1;
+
+    const char *resto = fim + 1;
+    unsigned long vias = strtoul(resto, &fim, 10);
+    if (fim == resto || *fim != ':') return -1;
+
+    resto = fim + 1;
+    unsigned long linha = strtoul(resto, &fim, 10);
+    if (fim == resto || *fim != '\0') return -1;
+
+    NivelCache candidato = *nivel;
+    candidato.tamanho = (size_t)tamanho;
+    candidato.associatividade = (int)vias;
+    candidato.linha = (int)linha;
+    if (!nivel_valido(&candidato)) return -1;
+
+    *nivel = candidato;
+    return 0;
+}
+
+/* ================================================================
+ * CACHE ASSOCIATIVA COM LRU
+ * ================================================================ */
+
+static int criar_cache(CacheSimulada *cache, const NivelCache *nivel) {
+    memset(cache, 0, sizeof(*cache));
+    if (!nivel_valido(nivel)) return -1;
+
+    cache->vias = nivel->associatividade;
+    cache->deslocamento = log2_exato((size_t)nivel->linha);
+    cache->conjuntos = nivel->tamanho / ((size_t)nivel->associatividade * (size_t)nivel->linha);
+
+    size_t vias_totais = cache->conjuntos * (size_t)cache->vias;
+    cache->blocos = calloc(vias_totais, sizeof(uint64_t));
+    cache->carimbos = calloc(vias_totais, sizeof(uint64_t));
+    if (!cache->blocos || !cache->carimbos) {
+        liberar_cache(cache);
+        return -1;
+    }
+    return 0;
+}
+
+static void liberar_cache(CacheSimulada *cache) {
+    free(cache->blocos);
+    free(cache->carimbos);
+    cache->blocos = NULL;
+    cache->carimbos = NULL;
+}
+
+/**
+ * @brief Acessa o bloco do endereço; instala-o no lugar da via LRU em caso de falha
+ *
+ * @return 1 em acerto, 0 em falha
+ */
+static int acessar_cache(CacheSimulada *cache, uint64_t endereco) {
+    uint64_t bloco = endereco >> cache->deslocamento;
+    size_t base = (size_t)(bloco % cache->conjuntos) * (size_t)cache->vias;
+    uint64_t *blocos = cache->blocos + base;
+    uint64_t *carimbos = cache->carimbos + base;
+
+    cache->relogio++;
+    int vitima = 0;
+    for (int via = 0; via < cache->vias; via++) {
+        if (blocos[via] == bloco + 1) {
+            carimbos[via] = cache->relogio;
+            return 1;
+        }
+        if (carimbos[via] < carimbos[vitima]) vitima = via;  // Vias vazias têm carimbo 0
+    }
+
+    blocos[vitima] = bloco + 1;
+    carimbos[vitima] = cache->relogio;
+    return 0;
+}
+
+/* ================================================================
+ * DISTÂNCIA DE REUSO
+ * ================================================================ */
+
+static int criar_mapa(MapaUltimoAcesso *mapa, size_t capacidade) {
+    size_t potencia = 1024;
+    while (potencia < capacidade) potencia <<= 1;
+
+    mapa->chaves = calloc(potencia, sizeof(uint64_t));
+    mapa->instantes = malloc(potencia * sizeof(uint64_t));
+    mapa->capacidade = potencia;
+    mapa->ocupados = 0;
+    if (!mapa->chaves || !mapa->instantes) {
+        free(mapa->chaves);
+        free(mapa->instantes);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Grava o instante da linha e devolve o anterior
+ *
+ * @return 1 se a linha já existia (anterior preenchido), 0 se é nova, -1 sem memória
+ */
+static int mapa_trocar(MapaUltimoAcesso *mapa, uint64_t linha, uint64_t instante, uint64_t *anterior) {
+    // Mantém o fator de carga abaixo de 1/2
+    if ((mapa->ocupados + 1) * 2 > mapa->capacidade) {
+        MapaUltimoAcesso maior;
+        if (criar_mapa(&maior, mapa->capacidade * 2) != 0) return -1;
+        for (size_t i = 0; i < mapa->capacidade; i++) {
+            if (mapa->chaves[i] == 0) continue;
+            size_t j = (size_t)((mapa->chaves[i] * 0x9E3779B97F4A7C15ULL) >> 20) & (maior.capacidade - 1);
+            while (maior.chaves[j] != 0) j = (j + 1) & (maior.capacidade - 1);
+            maior.chaves[j] = mapa->chaves[i];
+            maior.instantes[j] = mapa->instantes[i];
+        }
+        maior.ocupados = mapa->ocupados;
+        free(mapa->chaves);
+        free(mapa->instantes);
+        *mapa = maior;
+    }
+
+    uint64_t chave = linha + 1;
+    size_t i = (size_t)((chave * 0x9E3779B97F4A7C15ULL) >> 20) & (mapa->capacidade - 1);
+    while (mapa->chaves[i] != 0 && mapa->chaves[i] != chave) i = (i + 1) & (mapa->capacidade - 1);
+
+    if (mapa->chaves[i] == chave) {
+        *anterior = mapa->instantes[i];
+        mapa->instantes[i] = instante;
+        return 1;
+    }
+    mapa->chaves[i] = chave;
+    mapa->instantes[i] = instante;
+    mapa->ocupados++;
+    return 0;
+}
+
+/// Índices da árvore começam em 1
+static void fenwick_somar(uint32_t *arvore, size_t tamanho, size_t i, int delta) {
+    for (; i <= tamanho; i += i & (~i + 1)) arvore[i] = (uint32_t)((int64_t)arvore[i] + delta);
+}
+
+static uint64_t fenwick_prefixo(const uint32_t *arvore, size_t i) {
+    uint64_t soma = 0;
+    for (; i > 0; i -= i & (~i + 1)) soma += arvore[i];
+    return soma;
+}
+
+static int balde_reuso(uint64_t distancia) {
+    int balde = 0;
+    while (distancia > 0 && balde < BALDE_REUSO_FRIO - 1) {
+        distancia >>= 1;
+        balde++;
+    }
+    return balde;
+}
+
+/* ================================================================
+ * SIMULAÇÃO
+ * ================================================================ */
+
+int simular_rastro(const RastroMemoria *rastro, const ConfiguracaoCache *config,
+                   EstatisticasCache *estatisticas) {
+    if (!rastro || !config || !estatisticas) return -1;
+    if (config->num_niveis < 1 || config->num_niveis > MAX_NIVEIS_CACHE) return -1;
+    memset(estatisticas, 0, sizeof(*estatisticas));
+
+    int deslocamento_linha = log2_exato((size_t)config->niveis[0].linha);
+    if (deslocamento_linha < 0) return -1;
+
+    size_t retidos = rastro_retidos(rastro);
+    uint64_t bytes = rastro->elem_size > 0 ? rastro->elem_size : 1;
+
+    // Primeira passada: quantos acessos de linha o rastro gera (tamanho da árvore)
+    size_t instantes = 0;
+    for (size_t i = 0; i < retidos; i++) {
+        uint64_t endereco = rastro_entrada(rastro, i) >> 1;
+        instantes += (size_t)(((endereco + bytes - 1) >> deslocamento_linha) - (endereco >> deslocamento_linha) + 1);
+    }
+
+    CacheSimulada caches[MAX_NIVEIS_CACHE];
+    CacheSimulada tlb;
+    MapaUltimoAcesso mapa = { NULL, NULL, 0, 0 };
+    uint32_t *arvore = calloc(instantes + 1, sizeof(uint32_t));
+    int niveis_criados = 0;
+    int ok = arvore != NULL && criar_mapa(&mapa, 1024) == 0;
+
+    for (int n = 0; ok && n < config->num_niveis; n++) {
+        ok = criar_cache(&caches[n], &config->niveis[n]) == 0;
+        if (ok) niveis_criados++;
+    }
+    int tlb_criada = ok && criar_cache(&tlb, &config->tlb) == 0;
+    ok = ok && tlb_criada;
+
+    size_t instante = 0;
+    for (size_t i = 0; ok && i < retidos; i++) {
+        uint64_t entrada = rastro_entrada(rastro, i);
+        uint64_t endereco = entrada >> 1;
+        estatisticas->acessos++;
+        if (entrada & 1u) estatisticas->escritas++;
+
+        uint64_t primeira = endereco >> deslocamento_linha;
+        uint64_t ultima = (endereco + bytes - 1) >> deslocamento_linha;
+        for (uint64_t linha = primeira; ok && linha <= ultima; linha++) {
+            uint64_t endereco_linha = linha << deslocamento_linha;
+            instante++;
+
+            // Hierarquia: desce até acertar
+            for (int n = 0; n < config->num_niveis; n++) {
+                estatisticas->acessos_nivel[n]++;
+                if (acessar_cache(&caches[n], endereco_linha)) break;
+                estatisticas->falhas_nivel[n]++;
+            }
+
+            estatisticas->acessos_tlb++;
+            if (!acessar_cache(&tlb, endereco_linha)) estatisticas->falhas_tlb++;
+
+            // Distância de reuso
+            uint64_t anterior = 0;
+            int existia = mapa_trocar(&mapa, linha, instante, &anterior);
+            if (existia < 0) {
+                ok = 0;
+                break;
+            }
+            if (existia) {
+                fenwick_somar(arvore, instantes, (size_t)anterior, -1);
+                uint64_t distancia = fenwick_prefixo(arvore, instante - 1) - fenwick_prefixo(arvore, (size_t)anterior);
+                estatisticas->reuso[balde_reuso(distancia)]++;
+            } else {
+                estatisticas->reuso[BALDE_REUSO_FRIO]++;
+                estatisticas->linhas_distintas++;
+            }
+            fenwick_somar(arvore, instantes, instante, +1);
+        }
+    }
+
+    for (int n = 0; n < niveis_criados; n++) liberar_cache(&caches[n]);
+    if (tlb_criada) liberar_cache(&tlb);
+    free(mapa.chaves);
+    free(mapa.instantes);
+    free(arvore);
+    return ok ? 0 : -1;
+}
+
+/* ================================================================
+ * RELATÓRIO
+ * ================================================================ */
+
+static void formatar_bytes(size_t bytes, char *buffer, size_t tamanho_buffer) {
+    if (bytes >= 1024u * 1024u && bytes % (1024u * 1024u) == 0) {
+        snprintf(buffer, tamanho_buffer, "%zu MiB", bytes / (1024u * 1024u));
+    } else if (bytes >= 1024u && bytes % 1024u == 0) {
+        snprintf(buffer, tamanho_buffer, "%zu KiB", bytes / 1024u);
+    } else {
+        snprintf(buffer, tamanho_buffer, "%zu B", bytes);
+    }
+}
+
+double falhas_por_mil_acessos(const EstatisticasCache *estatisticas, uint64_t falhas) {
+    return estatisticas->acessos > 0 ? 1000.0 * (double)falhas / (double)estatisticas->acessos : 0.0;
+}
+
+void escrever_configuracao_cache(FILE *arquivo, const ConfiguracaoCache *config) {
+    char tamanho[32];
+    for (int n = 0; n < config->num_niveis; n++) {
+        const NivelCache *nivel = &config->niveis[n];
+        formatar_bytes(nivel->tamanho, tamanho, sizeof(tamanho));
+        fprintf(arquivo, "- %-4s %10s, %2d vias, linha de %d B (%zu conjuntos)\n",
+                nivel->nome, tamanho, nivel->associatividade, nivel->linha,
+                nivel->tamanho / ((size_t)nivel->associatividade * (size_t)nivel->linha));
+    }
+    formatar_bytes((size_t)config->tlb.linha, tamanho, sizeof(tamanho));
+    fprintf(arquivo, "- %-4s %10zu entradas, %2d vias, pagina de %s\n",
+            config->tlb.nome, config->tlb.tamanho / (size_t)config->tlb.linha,
+            config->tlb.associatividade, tamanho);
+}
+
+void escrever_estatisticas_cache(FILE *arquivo, const char *titulo,
+                                 const ConfiguracaoCache *config,
+                                 const EstatisticasCache *estatisticas) {
+    fprintf(arquivo, "\n%s\n", titulo);
+    fprintf(arquivo, "  Acessos: %llu (%llu escritas), linhas distintas: %llu\n",
+            (unsigned long long)estatisticas->acessos,
+            (unsigned long long)estatisticas->escritas,
+            (unsigned long long)estatisticas->linhas_distintas);
+
+    for (int n = 0; n < config->num_niveis; n++) {
+        uint64_t acessos = estatisticas->acessos_nivel[n];
+        fprintf(arquivo, "  %-4s acessos %12llu  falhas %12llu  taxa local %7.3f%%  por mil acessos %8.3f\n",
+                config->niveis[n].nome, (unsigned long long)acessos,
+                (unsigned long long)estatisticas->falhas_nivel[n],
+                acessos > 0 ? 100.0 * (double)estatisticas->falhas_nivel[n] / (double)acessos : 0.0,
+                falhas_por_mil_acessos(estatisticas, estatisticas->falhas_nivel[n]));
+    }
+    fprintf(arquivo, "  %-4s acessos %12llu  falhas %12llu  taxa local %7.3f%%  por mil acessos %8.3f\n",
+            config->tlb.nome, (unsigned long long)estatisticas->acessos_tlb,
+            (unsigned long long)estatisticas->falhas_tlb,
+            estatisticas->acessos_tlb > 0
+                ? 100.0 * (double)estatisticas->falhas_tlb / (double)estatisticas->acessos_tlb : 0.0,
+            falhas_por_mil_acessos(estatisticas, estatisticas->falhas_tlb));
+
+    uint64_t total = 0;
+    for (int b = 0; b < BALDES_REUSO; b++) total += estatisticas->reuso[b];
+    if (total == 0) return;
+
+    fprintf(arquivo, "  Distancia de reuso (linhas distintas entre acessos a mesma linha):\n");
+    uint64_t acumulado = 0;
+    for (int b = 0; b < BALDE_REUSO_FRIO; b++) {
+        uint64_t contagem = estatisticas->reuso[b];
+        acumulado += contagem;
+        if (contagem == 0) continue;
+
+        char faixa[48];
+        if (b == 0) {
+            snprintf(faixa, sizeof(faixa), "0");
+        } else if (b == BALDE_REUSO_FRIO - 1) {
+            snprintf(faixa, sizeof(faixa), ">= %llu", 1ULL << (b - 1));
+        } else {
+            snprintf(faixa, sizeof(faixa), "%llu .. %llu", 1ULL << (b - 1), (1ULL << b) - 1);
+        }
+
+        double fracao = (double)contagem / (double)total;
+        int barra = (int)(fracao * 40.0 + 0.5);
+        fprintf(arquivo, "    %-24s %12llu %6.2f%% (acum. %6.2f%%) ",
+                faixa, (unsigned long long)contagem, 100.0 * fracao,
+                100.0 * (double)acumulado / (double)total);
+        for (int i = 0; i < barra; i++) fputc('#', arquivo);
+        fputc('\n', arquivo);
+    }
+    fprintf(arquivo, "    %-24s %12llu %6.2f%%\n", "frio (primeiro acesso)",
+            (unsigned long long)estatisticas->reuso[BALDE_REUSO_FRIO],
+            100.0 * (double)estatisticas->reuso[BALDE_REUSO_FRIO] / (double)total);
+}
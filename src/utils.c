@@ -56,6 +56,7 @@
 #include "../include/io.h"     // Para funções de I/O (ler_numeros, ler_alunos)
 #include <stdio.h>   // Para printf e funções de I/O
 #include <string.h>  // Para manipulação de strings
+#include <limits.h>  // Para INT_MIN e INT_MAX
 
 // Headers específicos por plataforma para operações de diretório
 #ifdef _WIN32
@@ -136,11 +137,12 @@ void criar_diretorios_output(void) {
         MKDIR(caminhos_base[i]);
 
         // Cria cada subdiretório especializado
-        for (int j = 0; j < 3; j++) {
+        for (int j = 0; j < 4; j++) {
             const char* subdiretorios[] = {
                 "/numeros",         // Arrays de números ordenados
                 "/alunos",          // Estruturas de alunos ordenados
-                "/relatorios"       // Relatórios de análise e performance
+                "/relatorios",      // Relatórios de análise e performance
+                "/rastros"          // Rastros binários de acessos à memória
             };
             char caminho_completo[MAX_PATH];
             snprintf(caminho_completo, sizeof(caminho_completo),
@@ -236,6 +238,7 @@ void escrever_alunos_callback(FILE* arquivo, void* dados, int tamanho) {
 void salvar_arquivo_multiplos_locais(const char* subdir, const char* nome_arquivo,
                                    void (*conteudo_callback)(FILE*, void*, int),
                                    void* dados, int tamanho) {
+    SONDA_IO_INICIO(SONDA_IO_SALVAR_ARQUIVO, 0);
 
     // Múltiplos caminhos base para tentar salvamento
 
@@ -266,12 +269,14 @@ void salvar_arquivo_multiplos_locais(const char* subdir, const char* nome_arquiv
             fclose(arquivo);
 
             printf("Arquivo salvo: %s\n", caminho_completo);
+            SONDA_IO_FIM(SONDA_IO_SALVAR_ARQUIVO, tamanho, 0);
             return; // Sucesso: interrompe tentativas adicionais
         }
     }
 
     // Se chegou aqui, todas as tentativas falharam
     printf("AVISO: Nao foi possivel salvar %s em nenhum local\n", nome_arquivo);
+    SONDA_IO_FIM(SONDA_IO_SALVAR_ARQUIVO, -1, 0);
 }
 
 /* ================================================================
@@ -314,6 +319,21 @@ void copiar_array(const void *origem, void *destino, int tamanho, size_t elem_si
     memcpy(destino, origem, tamanho * elem_size);
 }
 
+#define FNV_PRIMO_64 0x100000001b3ULL
+
+uint64_t checksum_dados(const void *dados, size_t bytes) {
+    return continuar_checksum_dados(CHECKSUM_DADOS_INICIAL, dados, bytes);
+}
+
+uint64_t continuar_checksum_dados(uint64_t parcial, const void *dados, size_t bytes) {
+    const unsigned char *p = dados;
+    for (size_t i = 0; i < bytes; i++) {
+        parcial ^= p[i];
+        parcial *= FNV_PRIMO_64;
+    }
+    return parcial;
+}
+
 /* ================================================================
  * DECLARAÇÕES ANTECIPADAS DAS FUNÇÕES AUXILIARES
  * ================================================================ */
@@ -322,6 +342,7 @@ void copiar_array(const void *origem, void *destino, int tamanho, size_t elem_si
 AlgoritmoInfo* obter_info_algoritmos(void);
 void analisar_estabilidade(void);
 void gerar_relatorio_comparativo_final(void);
+static int executar_fase_relatorio(const char *versao);
 
 
 /* ================================================================
@@ -356,6 +377,22 @@ void imprimir_menu(void) {
     printf("================================================================\n");
     printf("  1. Gerar relatorio completo de todos os testes               \n");
     printf("     (Inclui analise de ambas as versoes dos algoritmos)       \n");
+    printf("  2. Varredura de escala (2^8 a 2^26 elementos)                \n");
+    printf("     (Expoentes empiricos, vereditos e pontos de cruzamento)   \n");
+    printf("  3. Matriz paralela em nucleos fisicos fixados               \n");
+    printf("     (Compara tempo de parede e confere com execucao serial)   \n");
+    printf("  4. Isolamento das medicoes (fixacao, mlock, cache)          \n");
+    printf("     (Separa o custo do algoritmo de efeitos do sistema)       \n");
+    printf("  5. Acessos a memoria e cache simulada (L1/L2/LLC + TLB)     \n");
+    printf("     (Taxas de falha e distancia de reuso por algoritmo)       \n");
+    printf("  6. Modelo de custo: comparacoes x bytes movidos             \n");
+    printf("     (Varre elem_size 4-1024 B e o custo do comparador)        \n");
+    printf("  7. Latencia de arrays pequenos (p50/p99/p99.9)              \n");
+    printf("     (16-512 elementos, cache de instrucoes quente e fria)     \n");
+    printf("  8. Vazao sob contencao (1 a N threads simultaneas)          \n");
+    printf("     (Eficiencia de escala e lentidao por thread)              \n");
+    printf("  9. Autoajuste dos motores (perfil desta maquina)            \n");
+    printf("     (Corte do Quick, gaps do Shell, aridade do Heap)          \n");
     printf("  0. Sair do programa                                           \n");
     printf("================================================================\n");
     printf("O relatorio completo incluira analise de AMBAS as versoes:     \n");
@@ -441,12 +478,12 @@ void exibir_info_algoritmos(void) {
                algoritmos[i].complexidade_melhor,     // Melhor: ex: "O(n)"
                algoritmos[i].complexidade_media,      // Média: ex: "O(n²)"
                algoritmos[i].complexidade_pior,       // Pior: ex: "O(n²)"
-               algoritmos[i].eh_estavel ? "Sim" : "Não"); // Estável: testa se é 1 (Sim) ou 0 (Não)
+               (algoritmos[i].capacidades & CAPACIDADE_ESTAVEL) ? "Sim" : "Não"); // Estável: testa o bit de estabilidade
 
         // EXPLICAÇÃO DO OPERADOR TERNÁRIO (?:):
-        // algoritmos[i].eh_estavel ? "Sim" : "Não"
+        // (algoritmos[i].capacidades & CAPACIDADE_ESTAVEL) ? "Sim" : "Não"
         // É uma forma abreviada de escrever:
-        // if (algoritmos[i].eh_estavel == 1) {
+        // if (algoritmos[i].capacidades & CAPACIDADE_ESTAVEL) {
         //     printf("Sim");
         // } else {
         //     printf("Não");
@@ -522,8 +559,8 @@ void listar_arquivos_disponiveis(void) {
 
     printf("\nARQUIVOS DE DADOS ESTRUTURADOS:\n");
     printf("─────────────────────────────────────────────────────────────\n");
-    printf("• alunos.txt              - Dados de estudantes (nome, data,\n");
-    printf("                           bairro, cidade) para testes de\n");
+    printf("• registros_pessoas_1000.txt - Dados de estudantes (nome, sexo,\n");
+    printf("                           data, cidade) para testes de\n");
     printf("                           estabilidade e múltiplos critérios\n");
 
     printf("\nCARACTERÍSTICAS DOS CONJUNTOS:\n");
@@ -606,6 +643,56 @@ void pausar(void) {
     getchar();
 }
 
+/**
+ * @brief Lista dos arquivos numéricos de data/ usados nos experimentos
+ *
+ * Ordenada por família e, dentro de cada família, por tamanho crescente:
+ * as projeções de tempo (projecao.c) dependem de os tamanhos menores
+ * serem medidos antes dos maiores.
+ */
+const char* const* obter_arquivos_numeros(int *quantidade) {
+    static const char* const arquivos[] = {
+        "numeros_aleatorios_500.txt",
+        "numeros_aleatorios_5000.txt",
+        "numeros_aleatorios_10000.txt",
+        "numeros_aleatorios_50000.txt",
+        "numeros_crescentes_500.txt",
+        "numeros_crescentes_5000.txt",
+        "numeros_crescentes_10000.txt",
+        "numeros_crescentes_50000.txt",
+        "numeros_decrescentes_500.txt",
+        "numeros_decrescentes_5000.txt",
+        "numeros_decrescentes_10000.txt",
+        "numeros_decrescentes_50000.txt"
+    };
+    if (quantidade) {
+        *quantidade = (int)(sizeof(arquivos) / sizeof(arquivos[0]));
+    }
+    return arquivos;
+}
+
+/**
+ * @brief Mede todos os conjuntos (números e alunos) em uma versão
+ *
+ * @param versao "nao_otimizada" ou "otimizada" (a versão já configurada)
+ * @return 0 se concluída, 1 se um Ctrl-C interrompeu
+ */
+static int executar_fase_relatorio(const char *versao) {
+    // Visões do registro de conjuntos: carregados uma vez para as duas versões
+    int total = carregar_conjuntos_dados();
+
+    for (int i = 0; i < total; i++) {
+        if (relatorio_interrompido()) return 1;
+        const ConjuntoDados *conjunto = obter_conjunto_dados(i);
+        printf("\nTestando arquivo: %s (%s)\n", conjunto->nome, versao);
+
+        executar_todos_algoritmos_com_salvamento(conjunto->dados, conjunto->tamanho,
+                                               conjunto->elem_size, conjunto->cmp,
+                                               conjunto->tipo_dados, conjunto->nome, versao);
+    }
+    return relatorio_interrompido();
+}
+
 /**
  * @brief Executa bateria completa de testes com ambas as versões dos algoritmos
  *
@@ -630,6 +717,10 @@ void pausar(void) {
  * - Análise de estabilidade (output/analise_estabilidade.txt)
  * - Relatório comparativo final (output/relatorios/)
  *
+ * Retomada: células já medidas por este build nesta máquina vêm do
+ * cache de resultados (cache_resultados.h); um Ctrl-C para a análise
+ * depois da célula em andamento e a próxima execução continua dali.
+ *
  * @note Esta função pode levar vários minutos para executar completamente,
  *       dependendo do hardware e do tamanho dos conjuntos de dados
  */
@@ -640,86 +731,42 @@ void executar_relatorio_completo(void) {
 
     // Inicialização: cria estrutura de diretórios necessária
     criar_diretorios_output();
+    carregar_conjuntos_dados();
 
-    // Lista de arquivos de números para teste automatizado
-    const char* arquivos_numeros[] = {
-        "numeros_aleatorios_500.txt",
-        "numeros_aleatorios_5000.txt",
-        "numeros_aleatorios_10000.txt",
-        "numeros_aleatorios_50000.txt",
-        "numeros_crescentes_500.txt",
-        "numeros_crescentes_5000.txt",
-        "numeros_crescentes_10000.txt",
-        "numeros_crescentes_50000.txt",
-        "numeros_decrescentes_500.txt",
-        "numeros_decrescentes_5000.txt",
-        "numeros_decrescentes_10000.txt",
-        "numeros_decrescentes_50000.txt"
-    };
+    // Projeções, fases e o CSV de desordem partem apenas das medições desta análise
+    limpar_historico_medicoes();
+    fases_limpar();
+    desordem_limpar();
+    printf("Orcamento por execucao: %.1f s (acima disso o tempo e projetado)\n",
+           obter_orcamento_tempo());
+
+    // Células já medidas por este build são reaproveitadas; Ctrl-C para após a célula atual
+    abrir_cache_resultados();
+    instalar_interrupcao_relatorio();
+    printf("Ctrl-C interrompe apos a celula em andamento; rode de novo para retomar\n\n");
 
     printf("FASE 1: Testando versão NÃO OTIMIZADA (didática)\n");
     printf("================================================\n");
     configurar_otimizacao(0); // Usa versões não otimizadas
+    int interrompido = executar_fase_relatorio("nao_otimizada");
 
-    // Testa todos os conjuntos de números com versão não otimizada
-    for (int i = 0; i < 12; i++) {
-        printf("\nTestando arquivo: %s\n", arquivos_numeros[i]);
-
-        int tamanho;
-        int* dados = ler_numeros(arquivos_numeros[i], &tamanho);
-
-        if (dados) {
-            executar_todos_algoritmos_com_salvamento(dados, tamanho, sizeof(int),
-                                                   comparar_inteiros, "numeros",
-                                                   arquivos_numeros[i], "nao_otimizada");
-            free(dados);
-        } else {
-            printf("AVISO: Não foi possível carregar %s\n", arquivos_numeros[i]);
-        }
+    if (!interrompido) {
+        printf("\n\nFASE 2: Testando versão OTIMIZADA (performance)\n");
+        printf("===============================================\n");
+        configurar_otimizacao(1); // Usa versões otimizadas
+        interrompido = executar_fase_relatorio("otimizada");
     }
 
-    // Testa dados de alunos com versão não otimizada
-    printf("\nTestando dados de alunos (não otimizada)...\n");
-    int tamanho_alunos;
-    Aluno* alunos = ler_alunos("alunos.txt", &tamanho_alunos);
-
-    if (alunos) {
-        executar_todos_algoritmos_com_salvamento(alunos, tamanho_alunos, sizeof(Aluno),
-                                               comparar_alunos, "alunos",
-                                               "alunos.txt", "nao_otimizada");
-        free(alunos);
-    }
-
-    printf("\n\nFASE 2: Testando versão OTIMIZADA (performance)\n");
-    printf("===============================================\n");
-    configurar_otimizacao(1); // Usa versões otimizadas
-
-    // Testa todos os conjuntos de números com versão otimizada
-    for (int i = 0; i < 12; i++) {
-        printf("\nTestando arquivo: %s\n", arquivos_numeros[i]);
-
-        int tamanho;
-        int* dados = ler_numeros(arquivos_numeros[i], &tamanho);
-
-        if (dados) {
-            executar_todos_algoritmos_com_salvamento(dados, tamanho, sizeof(int),
-                                                   comparar_inteiros, "numeros",
-                                                   arquivos_numeros[i], "otimizada");
-            free(dados);
-        } else {
-            printf("AVISO: Não foi possível carregar %s\n", arquivos_numeros[i]);
-        }
-    }
-
-    // Testa dados de alunos com versão otimizada
-    printf("\nTestando dados de alunos (otimizada)...\n");
-    alunos = ler_alunos("alunos.txt", &tamanho_alunos);
-
-    if (alunos) {
-        executar_todos_algoritmos_com_salvamento(alunos, tamanho_alunos, sizeof(Aluno),
-                                               comparar_alunos, "alunos",
-                                               "alunos.txt", "otimizada");
-        free(alunos);
+    // Restaura configuração padrão
+    configurar_otimizacao(1);
+    restaurar_interrupcao_relatorio();
+
+    if (interrompido) {
+        fechar_cache_resultados();
+        printf("\n=== ANALISE INTERROMPIDA ===\n");
+        printf("As celulas concluidas estao no cache; execute a analise completa\n");
+        printf("de novo para retomar de onde parou.\n");
+        return;
     }
 
     printf("\n\nFASE 3: Análise de estabilidade dos algoritmos\n");
@@ -729,9 +776,9 @@ void executar_relatorio_completo(void) {
     printf("\n\nFASE 4: Gerando relatório comparativo final\n");
     printf("===========================================\n");
     gerar_relatorio_comparativo_final();
-
-    // Restaura configuração padrão
-    configurar_otimizacao(1);
+    gerar_relatorio_fases();
+    gerar_relatorio_desordem();
+    fechar_cache_resultados();
 
     printf("\n=== ANALISE COMPLETA FINALIZADA COM SUCESSO ===\n");
     printf("Verifique a pasta 'output/' para todos os resultados gerados.\n");
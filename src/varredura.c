@@ -0,0 +1,592 @@
+/**
+ * ================================================================
+ * VARREDURA DE ESCALA - VALIDAÇÃO EMPÍRICA DE COMPLEXIDADE
+ * ================================================================
+ *
+ * @file varredura.c
+ * @brief Mede os algoritmos em tamanhos 2^k e ajusta o crescimento observado
+ *
+ *  FLUXO DA VARREDURA:
+ * ┌────────────────────┐   ┌──────────────────────┐   ┌───────────────────┐
+ * │ Gera 2^k elementos │ → │ Mede algoritmos      │ → │ k++ enquanto houver│
+ * │ (gerador.c)        │   │ ainda ativos         │   │ algoritmo ativo    │
+ * └────────────────────┘   └──────────────────────┘   └───────────────────┘
+ *                                    ↓
+ *            ┌──────────────────────────────────────────────┐
+ *            │ Ajustes log-log, constante n·log n,          │
+ *            │ vereditos e pontos de cruzamento              │
+ *            └──────────────────────────────────────────────┘
+ *
+ *  POR QUE O LIMITE DE TEMPO:
+ * Algoritmos O(n²) levariam horas em 2^26 elementos. Antes de cada medição
+ * o tempo é projetado a partir dos tamanhos anteriores (projecao.c); se a
+ * projeção ou a própria medição ultrapassa o limite, o algoritmo deixa a
+ * varredura naquela distribuição, pois o tempo só cresce com n.
+ *
+ *  VEREDITO:
+ * O expoente de COMPARAÇÕES é usado no veredito por ser livre de ruído de
+ * cache e de escalonamento; o expoente de TEMPO é exibido ao lado para
+ * mostrar quanto o hardware se afasta do modelo teórico.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para strstr e strchr
+#include <math.h>    // Para log2, pow, sqrt e fabs
+
+/* ================================================================
+ * CONSTANTES INTERNAS
+ * ================================================================ */
+
+/// Tolerância aceita entre expoente empírico e declarado
+#define TOLERANCIA_EXPOENTE 0.25
+
+/// Folga adicional quando a notação declarada possui fator log n
+#define FOLGA_LOGARITMO 0.20
+
+/// Tempos abaixo deste valor (s) são dominados pela resolução do relógio
+#define TEMPO_MINIMO_AJUSTE 0.00001
+
+/// Diferença mínima (em log2) para considerar um algoritmo mais rápido
+#define DIFERENCA_DECISIVA_LOG2 0.10
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static void calcular_ajustes_curva(CurvaEscala *curva);
+static void detectar_cruzamentos(ResultadoVarredura *resultado);
+static const char* veredito_curva(const CurvaEscala *curva, const AlgoritmoInfo *info);
+static double aceleracao_curva(const ResultadoVarredura *resultado, const CurvaEscala *curva);
+static void imprimir_resumo_varredura(const ResultadoVarredura *resultado);
+static void escrever_celula(FILE *arquivo, const char *texto, int largura);
+static void escrever_varredura_callback(FILE* arquivo, void* dados, int tamanho);
+static void escrever_varredura_csv_callback(FILE* arquivo, void* dados, int tamanho);
+
+/* ================================================================
+ * CONFIGURAÇÃO
+ * ================================================================ */
+
+ConfiguracaoVarredura configuracao_varredura_padrao(void) {
+    ConfiguracaoVarredura config;
+    config.expoente_minimo = EXPOENTE_MINIMO_VARREDURA;
+    config.expoente_maximo = EXPOENTE_MAXIMO_VARREDURA;
+    config.limite_tempo = LIMITE_TEMPO_VARREDURA_PADRAO;
+    config.incluir_didaticas = 1;
+    config.semente = SEMENTE_PADRAO_GERADOR;
+    return config;
+}
+
+/* ================================================================
+ * COMPLEXIDADE DECLARADA
+ * ================================================================ */
+
+double expoente_declarado(const char *notacao, int *tem_logaritmo) {
+    if (tem_logaritmo) {
+        *tem_logaritmo = (notacao && strstr(notacao, "log") != NULL);
+    }
+    if (!notacao) return 0.0;
+
+    // "O(n^1.25)": expoente explícito
+    const char *potencia = strstr(notacao, "n^");
+    if (potencia) {
+        return strtod(potencia + 2, NULL);
+    }
+
+    // "O(n²)": sobrescrito UTF-8
+    if (strstr(notacao, "n²")) {
+        return 2.0;
+    }
+
+    // "O(n)" e "O(n log n)"
+    return strchr(notacao, 'n') ? 1.0 : 0.0;
+}
+
+/**
+ * @brief Compara o expoente de comparações com a faixa [melhor, pior] declarada
+ */
+static const char* veredito_curva(const CurvaEscala *curva, const AlgoritmoInfo *info) {
+    if (curva->ajuste_comparacoes.pontos < 3) {
+        return "INSUFICIENTE";
+    }
+
+    int log_melhor = 0, log_pior = 0;
+    double minimo = expoente_declarado(info->complexidade_melhor, &log_melhor);
+    double maximo = expoente_declarado(info->complexidade_pior, &log_pior);
+
+    // Um fator log n eleva a inclinação log-log um pouco acima do expoente
+    double limite_inferior = minimo - TOLERANCIA_EXPOENTE;
+    double limite_superior = maximo + TOLERANCIA_EXPOENTE + (log_pior ? FOLGA_LOGARITMO : 0.0);
+
+    double k = curva->ajuste_comparacoes.inclinacao;
+    return (k >= limite_inferior && k <= limite_superior) ? "CONFERE" : "DIVERGE";
+}
+
+/* ================================================================
+ * AJUSTES POR CURVA
+ * ================================================================ */
+
+/**
+ * @brief Calcula expoentes empíricos e a constante do modelo n·log2 n
+ */
+static void calcular_ajustes_curva(CurvaEscala *curva) {
+    double comparacoes[MAX_PONTOS_VARREDURA];
+    int tamanhos_tempo[MAX_PONTOS_VARREDURA];
+    double tempos_validos[MAX_PONTOS_VARREDURA];
+    int pontos_tempo = 0;
+
+    for (int i = 0; i < curva->num_pontos; i++) {
+        comparacoes[i] = (double)curva->comparacoes[i];
+
+        // Ignora tempos abaixo da resolução útil do relógio
+        if (curva->tempos[i] >= TEMPO_MINIMO_AJUSTE) {
+            tamanhos_tempo[pontos_tempo] = curva->tamanhos[i];
+            tempos_validos[pontos_tempo] = curva->tempos[i];
+            pontos_tempo++;
+        }
+    }
+
+    curva->ajuste_comparacoes = ajustar_lei_potencia(curva->tamanhos, comparacoes, curva->num_pontos);
+    curva->ajuste_tempo = ajustar_lei_potencia(tamanhos_tempo, tempos_validos, pontos_tempo);
+
+    // Constante c de t ≈ c·n·log2(n): média e coeficiente de variação.
+    // CV baixo indica que o modelo n log n descreve bem a curva.
+    double soma = 0.0, soma_quadrados = 0.0;
+    for (int i = 0; i < pontos_tempo; i++) {
+        double n = (double)tamanhos_tempo[i];
+        double c = tempos_validos[i] / (n * log2(n));
+        soma += c;
+        soma_quadrados += c * c;
+    }
+
+    curva->constante_nlogn = 0.0;
+    curva->variacao_nlogn = 0.0;
+    if (pontos_tempo > 0) {
+        double media = soma / pontos_tempo;
+        double variancia = soma_quadrados / pontos_tempo - media * media;
+        curva->constante_nlogn = media;
+        curva->variacao_nlogn = (media > 0.0 && variancia > 0.0) ? sqrt(variancia) / media : 0.0;
+    }
+}
+
+/* ================================================================
+ * PONTOS DE CRUZAMENTO
+ * ================================================================ */
+
+/**
+ * @brief Encontra tamanhos em que dois algoritmos trocam de posição
+ *
+ * Para cada par na mesma distribuição e variante, acompanha o sinal de
+ * d = log2(tA) - log2(tB). Só diferenças maiores que DIFERENCA_DECISIVA_LOG2
+ * contam, evitando cruzamentos espúrios quando os tempos são praticamente
+ * iguais. O tamanho do cruzamento é interpolado linearmente em log2(n).
+ */
+static void detectar_cruzamentos(ResultadoVarredura *resultado) {
+    resultado->num_cruzamentos = 0;
+
+    for (int a = 0; a < resultado->num_curvas; a++) {
+        for (int b = a + 1; b < resultado->num_curvas; b++) {
+            const CurvaEscala *ca = &resultado->curvas[a];
+            const CurvaEscala *cb = &resultado->curvas[b];
+
+            if (ca->distribuicao != cb->distribuicao || ca->otimizada != cb->otimizada) {
+                continue;
+            }
+
+            int comuns = (ca->num_pontos < cb->num_pontos) ? ca->num_pontos : cb->num_pontos;
+            int sinal_anterior = 0;
+            double d_anterior = 0.0;
+            double log_n_anterior = 0.0;
+
+            for (int i = 0; i < comuns; i++) {
+                double d = log2(ca->tempos[i]) - log2(cb->tempos[i]);
+                if (fabs(d) < DIFERENCA_DECISIVA_LOG2) {
+                    continue;
+                }
+
+                int sinal = (d < 0.0) ? -1 : 1;
+                double log_n = log2((double)ca->tamanhos[i]);
+
+                if (sinal_anterior != 0 && sinal != sinal_anterior &&
+                    resultado->num_cruzamentos < MAX_CRUZAMENTOS_VARREDURA) {
+                    // Interpolação: ponto em que d cruza zero
+                    double fracao = d_anterior / (d_anterior - d);
+                    double log_cruzamento = log_n_anterior + fracao * (log_n - log_n_anterior);
+
+                    PontoCruzamento *p = &resultado->cruzamentos[resultado->num_cruzamentos++];
+                    p->algoritmo_a = ca->indice_algoritmo;
+                    p->algoritmo_b = cb->indice_algoritmo;
+                    p->otimizada = ca->otimizada;
+                    p->distribuicao = ca->distribuicao;
+                    p->tamanho = pow(2.0, log_cruzamento);
+                    p->a_vence_acima = (sinal < 0);
+                }
+
+                sinal_anterior = sinal;
+                d_anterior = d;
+                log_n_anterior = log_n;
+            }
+        }
+    }
+}
+
+/* ================================================================
+ * EXECUÇÃO DA VARREDURA
+ * ================================================================ */
+
+ResultadoVarredura* executar_varredura_escala(const ConfiguracaoVarredura *config) {
+    if (!config || config->expoente_minimo < 1 ||
+        config->expoente_maximo > EXPOENTE_MAXIMO_VARREDURA ||
+        config->expoente_minimo > config->expoente_maximo) {
+        printf("ERRO: Configuracao de varredura invalida\n");
+        return NULL;
+    }
+
+    ResultadoVarredura *resultado = calloc(1, sizeof(ResultadoVarredura));
+    if (!resultado) {
+        printf("ERRO: Falha na alocacao de memoria para a varredura\n");
+        return NULL;
+    }
+    resultado->config = *config;
+
+    int versao_original = usar_versao_otimizada;
+
+    // Projeções da varredura partem apenas das medições desta execução
+    limpar_historico_medicoes();
+    int num_variantes = config->incluir_didaticas ? 2 : 1;
+
+    for (int d = 0; d < NUM_DISTRIBUICOES; d++) {
+        DistribuicaoDados distribuicao = (DistribuicaoDados)d;
+        printf("\n--- Distribuicao: %s ---\n", nome_distribuicao(distribuicao));
+
+        // Uma curva por (variante, algoritmo); variante 0 = otimizada, que
+        // também recebe as referências da libc e os plugins (sem versão didática)
+        int indice_curva[2][MAX_MOTORES];
+        int ativos[2][MAX_MOTORES];
+        int motores[2] = { num_motores(), NUM_ALGORITMOS };
+        for (int v = 0; v < num_variantes; v++) {
+            for (int a = 0; a < motores[v]; a++) {
+                indice_curva[v][a] = resultado->num_curvas;
+                CurvaEscala *curva = &resultado->curvas[resultado->num_curvas++];
+                curva->indice_algoritmo = a;
+                curva->otimizada = (v == 0);
+                curva->distribuicao = distribuicao;
+                ativos[v][a] = 1;
+            }
+        }
+
+        for (int expoente = config->expoente_minimo; expoente <= config->expoente_maximo; expoente++) {
+            int restantes = 0;
+            for (int v = 0; v < num_variantes; v++) {
+                for (int a = 0; a < motores[v]; a++) {
+                    restantes += ativos[v][a];
+                }
+            }
+            if (restantes == 0) break;
+
+            int n = 1 << expoente;
+            int *base = malloc((size_t)n * sizeof(int));
+            int *copia = malloc((size_t)n * sizeof(int));
+            if (!base || !copia) {
+                printf("AVISO: Memoria insuficiente para n = %d; varredura encerrada\n", n);
+                free(base);
+                free(copia);
+                break;
+            }
+
+            // Mesma semente por tamanho: todas as variantes veem os mesmos dados
+            gerar_numeros(base, n, distribuicao, config->semente + (uint64_t)expoente);
+
+            double tempo_maior = 0.0;
+            const char *mais_lento = "-";
+            int medicoes = 0;
+
+            for (int v = 0; v < num_variantes; v++) {
+                configurar_otimizacao(v == 0);
+
+                for (int a = 0; a < motores[v]; a++) {
+                    if (!ativos[v][a]) continue;
+
+                    AlgoritmoInfo *info = obter_info_motor(a);
+                    CurvaEscala *curva = &resultado->curvas[indice_curva[v][a]];
+
+                    // Evita a medição se a projeção já ultrapassa o limite
+                    ProjecaoTempo projecao = projetar_tempo(info->nome, v == 0,
+                                                            nome_distribuicao(distribuicao), n);
+                    if (projecao.valida && projecao.tempo_projetado > config->limite_tempo) {
+                        curva->interrompida = 1;
+                        curva->tamanho_projetado = n;
+                        curva->tempo_projetado = projecao.tempo_projetado;
+                        ativos[v][a] = 0;
+                        continue;
+                    }
+
+                    copiar_array(base, copia, n, sizeof(int));
+                    ResultadoTempo r = medir_algoritmo(info, copia, n, sizeof(int),
+                                                       comparar_inteiros, "numeros");
+                    registrar_medicao(info->nome, v == 0, nome_distribuicao(distribuicao),
+                                      n, r.tempo_execucao);
+                    medicoes++;
+
+                    int p = curva->num_pontos++;
+                    curva->tamanhos[p] = n;
+                    curva->tempos[p] = r.tempo_execucao;
+                    curva->ticks[p] = r.ticks;
+                    curva->comparacoes[p] = r.comparacoes;
+                    curva->trocas[p] = r.trocas;
+                    curva->movimentacoes[p] = r.movimentacoes;
+                    curva->modos_isolamento[p] = r.modo_isolamento;
+
+                    if (r.tempo_execucao > tempo_maior) {
+                        tempo_maior = r.tempo_execucao;
+                        mais_lento = info->nome;
+                    }
+
+                    // Tempo cresce com n: a próxima medição seria ainda mais cara
+                    if (r.tempo_execucao > config->limite_tempo) {
+                        curva->interrompida = (expoente < config->expoente_maximo);
+                        ativos[v][a] = 0;
+                    }
+                }
+            }
+
+            printf("  n = 2^%-2d (%9d): %2d medicoes, mais lenta %10.6f s (%s)\n",
+                   expoente, n, medicoes, tempo_maior, mais_lento);
+
+            free(base);
+            free(copia);
+        }
+    }
+
+    configurar_otimizacao(versao_original);
+
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        calcular_ajustes_curva(&resultado->curvas[c]);
+    }
+    detectar_cruzamentos(resultado);
+
+    return resultado;
+}
+
+/* ================================================================
+ * RELATÓRIOS
+ * ================================================================ */
+
+/**
+ * @brief Aceleração sobre o qsort no maior n medido pelas duas curvas
+ *
+ * As curvas da mesma distribuição começam no mesmo expoente e não têm
+ * lacunas, então o índice do ponto identifica o mesmo n nas duas.
+ *
+ * @return tempo do qsort / tempo da curva, ou 0 sem curva do qsort
+ */
+static double aceleracao_curva(const ResultadoVarredura *resultado, const CurvaEscala *curva) {
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaEscala *qsort_curva = &resultado->curvas[c];
+        if (qsort_curva->indice_algoritmo != INDICE_QSORT ||
+            qsort_curva->distribuicao != curva->distribuicao) {
+            continue;
+        }
+        int comuns = (curva->num_pontos < qsort_curva->num_pontos)
+                     ? curva->num_pontos : qsort_curva->num_pontos;
+        if (comuns == 0) return 0.0;
+        return aceleracao_sobre_qsort(qsort_curva->tempos[comuns - 1], curva->tempos[comuns - 1]);
+    }
+    return 0.0;
+}
+
+/**
+ * @brief Tabela resumida no terminal (apenas versões otimizadas)
+ */
+static void imprimir_resumo_varredura(const ResultadoVarredura *resultado) {
+
+    printf("\n================================================================\n");
+    printf("           EXPOENTES EMPIRICOS (VERSAO OTIMIZADA)              \n");
+    printf("================================================================\n");
+    printf("%-13s %-15s %-12s %8s %8s %8s %-12s\n",
+           "Distribuicao", "Algoritmo", "Maior n", "k tempo", "k comp.", "x qsort", "Veredito");
+
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaEscala *curva = &resultado->curvas[c];
+        if (!curva->otimizada || curva->num_pontos == 0) continue;
+
+        const AlgoritmoInfo *info = obter_info_motor(curva->indice_algoritmo);
+        char aceleracao[16];
+        formatar_aceleracao(aceleracao_curva(resultado, curva), aceleracao, sizeof(aceleracao));
+        printf("%-13s %-15s %-12d %8.3f %8.3f %8s %-12s\n",
+               nome_distribuicao(curva->distribuicao), info->nome,
+               curva->tamanhos[curva->num_pontos - 1],
+               curva->ajuste_tempo.inclinacao, curva->ajuste_comparacoes.inclinacao,
+               aceleracao, veredito_curva(curva, info));
+    }
+    printf("================================================================\n");
+    printf("Cruzamentos detectados: %d (detalhes no relatorio)\n", resultado->num_cruzamentos);
+}
+
+/**
+ * @brief Escreve texto alinhado à esquerda contando caracteres, não bytes
+ *
+ * As notações declaradas usam "²" (2 bytes em UTF-8); o "%-*s" do printf
+ * contaria bytes e desalinharia a tabela.
+ */
+static void escrever_celula(FILE *arquivo, const char *texto, int largura) {
+    int visiveis = 0;
+    for (const unsigned char *c = (const unsigned char*)texto; *c; c++) {
+        if ((*c & 0xC0) != 0x80) visiveis++;  // Ignora bytes de continuação
+    }
+    fputs(texto, arquivo);
+    for (int i = visiveis; i < largura; i++) {
+        fputc(' ', arquivo);
+    }
+}
+
+static void escrever_varredura_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ResultadoVarredura *resultado = (const ResultadoVarredura*)dados;
+
+    fprintf(arquivo, "================================================================\n");
+    fprintf(arquivo, "        VARREDURA DE ESCALA - COMPLEXIDADE EMPIRICA            \n");
+    fprintf(arquivo, "================================================================\n\n");
+    fprintf(arquivo, "Tamanhos: 2^%d a 2^%d (progressao geometrica de razao 2)\n",
+            resultado->config.expoente_minimo, resultado->config.expoente_maximo);
+    fprintf(arquivo, "Limite por medicao: %.3f s (acima disso o algoritmo sai da varredura)\n",
+            resultado->config.limite_tempo);
+    fprintf(arquivo, "Semente do gerador: 0x%llX\n\n", (unsigned long long)resultado->config.semente);
+
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaEscala *curva = &resultado->curvas[c];
+        const AlgoritmoInfo *info = obter_info_motor(curva->indice_algoritmo);
+
+        // Cabeçalho a cada novo bloco (distribuição, variante)
+        if (c == 0 || curva->distribuicao != resultado->curvas[c - 1].distribuicao ||
+            curva->otimizada != resultado->curvas[c - 1].otimizada) {
+            fprintf(arquivo, "\n%s - VERSAO %s\n", nome_distribuicao(curva->distribuicao),
+                    curva->otimizada ? "OTIMIZADA" : "DIDATICA");
+            fprintf(arquivo, "+----------------+--------------------------------------+---------+-------+---------+---------------+-------+--------------+----------+\n");
+            fprintf(arquivo, "| Algoritmo      | Declarado (melhor / medio / pior)    | k tempo |  R2   | k comp. | c n.log2n (ns)|  CV   | Veredito     | x qsort  |\n");
+            fprintf(arquivo, "+----------------+--------------------------------------+---------+-------+---------+---------------+-------+--------------+----------+\n");
+        }
+
+        char declarado[64];
+        snprintf(declarado, sizeof(declarado), "%s / %s / %s",
+                 info->complexidade_melhor, info->complexidade_media, info->complexidade_pior);
+
+        fprintf(arquivo, "| %-14s | ", info->nome);
+        escrever_celula(arquivo, declarado, 36);
+        char aceleracao[16];
+        formatar_aceleracao(aceleracao_curva(resultado, curva), aceleracao, sizeof(aceleracao));
+        fprintf(arquivo, " | %7.3f | %5.3f | %7.3f | %13.4f | %5.2f | %-12s | %8s |\n",
+                curva->ajuste_tempo.inclinacao, curva->ajuste_tempo.r2,
+                curva->ajuste_comparacoes.inclinacao,
+                curva->constante_nlogn * 1e9, curva->variacao_nlogn,
+                veredito_curva(curva, info), aceleracao);
+
+        if (c + 1 == resultado->num_curvas ||
+            resultado->curvas[c + 1].distribuicao != curva->distribuicao ||
+            resultado->curvas[c + 1].otimizada != curva->otimizada) {
+            fprintf(arquivo, "+----------------+--------------------------------------+---------+-------+---------+---------------+-------+--------------+----------+\n");
+        }
+    }
+
+    fprintf(arquivo, "\nALCANCE DAS CURVAS (maior n medido):\n");
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaEscala *curva = &resultado->curvas[c];
+        if (curva->num_pontos == 0) continue;
+        fprintf(arquivo, "  %-12s %-9s %-15s ate n = %-9d",
+                nome_distribuicao(curva->distribuicao),
+                curva->otimizada ? "otimizada" : "didatica",
+                obter_info_motor(curva->indice_algoritmo)->nome,
+                curva->tamanhos[curva->num_pontos - 1]);
+        if (curva->tamanho_projetado > 0) {
+            fprintf(arquivo, " (PROJETADO %.3f s em n = %d)\n",
+                    curva->tempo_projetado, curva->tamanho_projetado);
+        } else {
+            fprintf(arquivo, "%s\n", curva->interrompida ? " (limite de tempo)" : "");
+        }
+    }
+
+    fprintf(arquivo, "\nPONTOS DE CRUZAMENTO:\n");
+    if (resultado->num_cruzamentos == 0) {
+        fprintf(arquivo, "  Nenhum cruzamento detectado.\n");
+    }
+    for (int i = 0; i < resultado->num_cruzamentos; i++) {
+        const PontoCruzamento *p = &resultado->cruzamentos[i];
+        const char *vencedor = obter_info_motor(p->a_vence_acima ? p->algoritmo_a : p->algoritmo_b)->nome;
+        const char *perdedor = obter_info_motor(p->a_vence_acima ? p->algoritmo_b : p->algoritmo_a)->nome;
+        fprintf(arquivo, "  %-12s %-9s n ~ %10.0f: %s passa a superar %s\n",
+                nome_distribuicao(p->distribuicao),
+                p->otimizada ? "otimizada" : "didatica",
+                p->tamanho, vencedor, perdedor);
+    }
+
+    fprintf(arquivo, "\nOBSERVACOES:\n");
+    fprintf(arquivo, "- k tempo / k comp.: inclinacao do ajuste log2-log2 (t ~ n^k)\n");
+    fprintf(arquivo, "- n log n aparece como k ligeiramente acima de 1\n");
+    fprintf(arquivo, "- R2: qualidade do ajuste do tempo (1 = crescimento perfeitamente regular)\n");
+    fprintf(arquivo, "- c n.log2n: media de t/(n.log2 n); CV baixo indica bom ajuste a n log n\n");
+    fprintf(arquivo, "- x qsort: tempo do qsort da libc / tempo da curva, no maior n medido\n");
+    fprintf(arquivo, "  pelas duas (> 1 = mais rapido que a libc)\n");
+    fprintf(arquivo, "- Veredito usa o expoente de comparacoes contra a faixa [melhor, pior]\n");
+    fprintf(arquivo, "  declarada, com tolerancia de %.2f\n", TOLERANCIA_EXPOENTE);
+    fprintf(arquivo, "- Tempos abaixo de %.0f us sao ignorados no ajuste de tempo\n",
+            TEMPO_MINIMO_AJUSTE * 1e6);
+    fprintf(arquivo, "- Dados brutos de cada ponto: varredura_escala.csv\n");
+}
+
+static void escrever_varredura_csv_callback(FILE* arquivo, void* dados, int tamanho) {
+    (void)tamanho;
+    const ResultadoVarredura *resultado = (const ResultadoVarredura*)dados;
+
+    fprintf(arquivo, "distribuicao,versao,algoritmo,n,tempo_s,ticks,comparacoes,trocas,movimentacoes,"
+                     "bytes_movidos,gb_s,fracao_teto_banda,isolamento\n");
+    for (int c = 0; c < resultado->num_curvas; c++) {
+        const CurvaEscala *curva = &resultado->curvas[c];
+        for (int i = 0; i < curva->num_pontos; i++) {
+            char modo[64];
+            descrever_modo_isolamento(curva->modos_isolamento[i], modo, sizeof(modo));
+            // Leitura + escrita de um int por movimentação (banda.h)
+            long long bytes = curva->movimentacoes[i] * 2LL * (long long)sizeof(int);
+            double gb_s = curva->tempos[i] > 0.0 ? (double)bytes / curva->tempos[i] / 1e9 : 0.0;
+            fprintf(arquivo, "%s,%s,%s,%d,%.9f,%llu,%lld,%lld,%lld,%lld,%.4f,%.4f,%s\n",
+                    nome_distribuicao(curva->distribuicao),
+                    curva->otimizada ? "otimizada" : "didatica",
+                    obter_info_motor(curva->indice_algoritmo)->nome,
+                    curva->tamanhos[i], curva->tempos[i], curva->ticks[i],
+                    curva->comparacoes[i], curva->trocas[i], curva->movimentacoes[i],
+                    bytes, gb_s, fracao_teto_banda(gb_s), modo);
+        }
+    }
+}
+
+void gerar_relatorio_varredura(const ResultadoVarredura *resultado) {
+    if (!resultado) return;
+
+    salvar_arquivo_multiplos_locais("relatorios", "varredura_escala.txt",
+                                    escrever_varredura_callback, (void*)resultado,
+                                    resultado->num_curvas);
+    salvar_arquivo_multiplos_locais("relatorios", "varredura_escala.csv",
+                                    escrever_varredura_csv_callback, (void*)resultado,
+                                    resultado->num_curvas);
+}
+
+/* ================================================================
+ * PONTO DE ENTRADA DO MENU
+ * ================================================================ */
+
+void executar_varredura_completa(void) {
+    printf("\n=== VARREDURA DE ESCALA (2^%d a 2^%d) ===\n",
+           EXPOENTE_MINIMO_VARREDURA, EXPOENTE_MAXIMO_VARREDURA);
+    printf("Cada algoritmo e medido ate uma execucao ultrapassar %.2f s.\n",
+           LIMITE_TEMPO_VARREDURA_PADRAO);
+
+    criar_diretorios_output();
+
+    ConfiguracaoVarredura config = configuracao_varredura_padrao();
+    ResultadoVarredura *resultado = executar_varredura_escala(&config);
+    if (!resultado) return;
+
+    imprimir_resumo_varredura(resultado);
+    gerar_relatorio_varredura(resultado);
+    free(resultado);
+}
@@ -0,0 +1,414 @@
+/**
+ * ================================================================
+ * VERIFICAÇÃO DIFERENCIAL DOS ALGORITMOS
+ * ================================================================
+ *
+ * @file verificacao.c
+ * @brief Geração de casos, referência por qsort e conferências
+ *
+ *  TRÊS CONFERÊNCIAS POR EXECUÇÃO:
+ * ┌──────────────┐   ┌──────────────────────────────────────────────┐
+ * │ ordem        │ → │ cmp(saida[i], qsort[i]) == 0 para todo i     │
+ * │ permutação   │ → │ saída e entrada ordenadas por bytes (memcmp) │
+ * │              │   │ são idênticas                                │
+ * │ estabilidade │ → │ chaves iguais mantêm o índice original       │
+ * │              │   │ crescente (só CAPACIDADE_ESTAVEL)            │
+ * └──────────────┘   └──────────────────────────────────────────────┘
+ *
+ * A referência não precisa ser estável: a ordem é conferida pela classe
+ * de equivalência de cada posição, não pelos bytes.
+ *
+ * ================================================================
+ */
+
+#include "../include/sorts.h"  // Inclui toda a estrutura modular
+#include <string.h>  // Para memcpy, memcmp e memset
+#include <stdlib.h>  // Para qsort
+#include <limits.h>  // Para INT_MIN e INT_MAX
+
+/* ================================================================
+ * ESTADO DO MÓDULO
+ * ================================================================ */
+
+/// Tamanhos de elemento sorteados: múltiplos de 4 (chave int alinhada) e o Aluno real
+static const size_t tamanhos_elemento[] = {
+    sizeof(int), 8, 12, 16, 24, 40, 64, sizeof(Aluno), MAX_ELEM_SIZE_VERIFICACAO
+};
+#define NUM_TAMANHOS_ELEMENTO ((int)(sizeof(tamanhos_elemento) / sizeof(tamanhos_elemento[0])))
+
+/// Tamanho usado por comparar_bytes (qsort não repassa contexto ao comparador)
+static THREAD_LOCAL size_t tamanho_bytes_comparacao = 0;
+
+/// Parâmetros conferidos além dos em vigor: os cortes, gaps e aridades que o
+/// autoajuste pode escolher, inclusive os tetos aceitos
+static const ParametrosMotores parametros_verificacao[NUM_PARAMETROS_VERIFICACAO] = {
+    {16, SEQUENCIA_SHELL_CIURA, 3},
+    {4, SEQUENCIA_SHELL_TOKUDA, 4},
+    {64, SEQUENCIA_SHELL_KNUTH, 8},
+    {LIMITE_INSERCAO_QUICK_MAXIMO, SEQUENCIA_SHELL_CIURA, ARIDADE_HEAP_MAXIMA},
+};
+
+/* ================================================================
+ * DECLARAÇÕES DE FUNÇÕES INTERNAS
+ * ================================================================ */
+
+static int ler_chave(const void *elemento);
+static int ler_indice(const void *elemento);
+static int comparar_chave_crescente(const void *a, const void *b);
+static int comparar_chave_decrescente(const void *a, const void *b);
+static int comparar_chave_resto(const void *a, const void *b);
+static int comparar_bytes(const void *a, const void *b);
+static void gerar_chaves(int *chaves, int n, PadraoVerificacao padrao, uint64_t *estado);
+static void montar_registros(char *destino, const int *chaves, int n, size_t elem_size);
+static int conferir_motor(const CasoVerificacao *caso, const int *chaves, int indice,
+                          int otimizada, ResultadoVerificacao *resultado, FILE *saida);
+
+/* ================================================================
+ * COMPARADORES
+ * ================================================================ */
+
+static int ler_chave(const void *elemento) {
+    int chave;
+    memcpy(&chave, elemento, sizeof(chave));
+    return chave;
+}
+
+static int ler_indice(const void *elemento) {
+    int indice;
+    memcpy(&indice, (const char*)elemento + sizeof(int), sizeof(indice));
+    return indice;
+}
+
+static int comparar_chave_crescente(const void *a, const void *b) {
+    int x = ler_chave(a), y = ler_chave(b);
+    return (x > y) - (x < y);
+}
+
+static int comparar_chave_decrescente(const void *a, const void *b) {
+    int x = ler_chave(a), y = ler_chave(b);
+    return (x < y) - (x > y);
+}
+
+static int comparar_chave_resto(const void *a, const void *b) {
+    unsigned x = (unsigned)ler_chave(a) & 7u, y = (unsigned)ler_chave(b) & 7u;
+    return (x > y) - (x < y);
+}
+
+static int comparar_bytes(const void *a, const void *b) {
+    return memcmp(a, b, tamanho_bytes_comparacao);
+}
+
+CompareFn funcao_comparador_verificacao(ComparadorVerificacao comparador) {
+    switch (comparador) {
+        case COMPARADOR_DECRESCENTE: return comparar_chave_decrescente;
+        case COMPARADOR_RESTO:       return comparar_chave_resto;
+        case COMPARADOR_INTEIROS:    return comparar_inteiros;
+        case COMPARADOR_CRESCENTE:
+        default:                     return comparar_chave_crescente;
+    }
+}
+
+const char* nome_comparador_verificacao(ComparadorVerificacao comparador) {
+    switch (comparador) {
+        case COMPARADOR_CRESCENTE:   return "crescente";
+        case COMPARADOR_DECRESCENTE: return "decrescente";
+        case COMPARADOR_RESTO:       return "resto8";
+        case COMPARADOR_INTEIROS:    return "comparar_inteiros";
+        default:                     return "?";
+    }
+}
+
+/* ================================================================
+ * GERAÇÃO DOS CASOS
+ * ================================================================ */
+
+const char* nome_padrao_verificacao(PadraoVerificacao padrao) {
+    switch (padrao) {
+        case PADRAO_ALEATORIO:        return "aleatorio";
+        case PADRAO_CRESCENTE:        return "crescente";
+        case PADRAO_DECRESCENTE:      return "decrescente";
+        case PADRAO_POUCOS_DISTINTOS: return "poucos_distintos";
+        case PADRAO_CONSTANTE:        return "constante";
+        case PADRAO_SERRA:            return "serra";
+        case PADRAO_EXTREMOS:         return "extremos";
+        default:                      return "?";
+    }
+}
+
+/**
+ * @brief Chaves em toda a faixa de int (inclusive negativas e extremos)
+ */
+static void gerar_chaves(int *chaves, int n, PadraoVerificacao padrao, uint64_t *estado) {
+    int constante = (int)(uint32_t)gerador_proximo(estado);
+
+    for (int i = 0; i < n; i++) {
+        switch (padrao) {
+            case PADRAO_POUCOS_DISTINTOS:
+                chaves[i] = (int)(gerador_proximo(estado) % 4) - 2;
+                break;
+            case PADRAO_CONSTANTE:
+                chaves[i] = constante;
+                break;
+            case PADRAO_SERRA:
+                chaves[i] = i < n / 2 ? i : n - i;
+                break;
+            case PADRAO_EXTREMOS: {
+                // Os extremos esticam a CDF do modelo e o bit de sinal do radix
+                uint64_t sorteio = gerador_proximo(estado);
+                if (sorteio % 8 == 0) chaves[i] = INT_MIN;
+                else if (sorteio % 8 == 1) chaves[i] = INT_MAX;
+                else chaves[i] = (int)(uint32_t)(sorteio >> 32);
+                break;
+            }
+            default:
+                chaves[i] = (int)(uint32_t)gerador_proximo(estado);
+                break;
+        }
+    }
+
+    if (padrao == PADRAO_CRESCENTE) {
+        qsort(chaves, (size_t)n, sizeof(int), comparar_chave_crescente);
+    } else if (padrao == PADRAO_DECRESCENTE) {
+        qsort(chaves, (size_t)n, sizeof(int), comparar_chave_decrescente);
+    }
+}
+
+/**
+ * @brief Registro i = [chave][índice i][bytes derivados de i ...]
+ */
+static void montar_registros(char *destino, const int *chaves, int n, size_t elem_size) {
+    for (int i = 0; i < n; i++) {
+        char *registro = destino + (size_t)i * elem_size;
+        memcpy(registro, &chaves[i], sizeof(int));
+        if (elem_size >= 2 * sizeof(int)) memcpy(registro + sizeof(int), &i, sizeof(int));
+        for (size_t b = 2 * sizeof(int); b < elem_size; b++) {
+            registro[b] = (char)(unsigned char)((unsigned)i * 31u + (unsigned)b);
+        }
+    }
+}
+
+OpcoesVerificacao opcoes_verificacao_padrao(void) {
+    OpcoesVerificacao opcoes;
+    opcoes.semente = SEMENTE_PADRAO_GERADOR;
+    opcoes.casos = CASOS_VERIFICACAO_PADRAO;
+    opcoes.tamanho_maximo = TAMANHO_MAXIMO_VERIFICACAO;
+    opcoes.verboso = 0;
+    return opcoes;
+}
+
+CasoVerificacao sortear_caso_verificacao(uint64_t semente, int tamanho_maximo) {
+    CasoVerificacao caso;
+    uint64_t estado = semente;
+    if (tamanho_maximo < 0) tamanho_maximo = 0;
+
+    caso.semente = semente;
+    // Um quarto dos casos fica em n <= 16: é onde moram os erros de borda
+    if (gerador_proximo(&estado) % 4 == 0) {
+        caso.tamanho = (int)(gerador_proximo(&estado) % 17);
+    } else {
+        caso.tamanho = (int)(gerador_proximo(&estado) % (uint64_t)(tamanho_maximo + 1));
+    }
+    if (caso.tamanho > tamanho_maximo) caso.tamanho = tamanho_maximo;
+    caso.elem_size = tamanhos_elemento[gerador_proximo(&estado) % NUM_TAMANHOS_ELEMENTO];
+    caso.padrao = (PadraoVerificacao)(gerador_proximo(&estado) % NUM_PADROES_VERIFICACAO);
+    caso.comparador = (ComparadorVerificacao)(gerador_proximo(&estado) % NUM_COMPARADORES_VERIFICACAO);
+    // Int puro: o único formato aceito pelos motores CAPACIDADE_SO_INTEIROS
+    if (gerador_proximo(&estado) % FRACAO_INTEIROS_VERIFICACAO == 0) {
+        caso.elem_size = sizeof(int);
+        caso.comparador = COMPARADOR_INTEIROS;
+    }
+    return caso;
+}
+
+/* ================================================================
+ * CONFERÊNCIA DE UM ALGORITMO
+ * ================================================================ */
+
+int verificar_algoritmo(const AlgoritmoInfo *algoritmo, int otimizada, const int *chaves,
+                        int tamanho, size_t elem_size, ComparadorVerificacao comparador,
+                        FILE *saida) {
+    if (!algoritmo || tamanho < 0 || elem_size < sizeof(int) || (tamanho > 0 && !chaves)) return -1;
+
+    CompareFn cmp = funcao_comparador_verificacao(comparador);
+    size_t bytes = (size_t)tamanho * elem_size;
+    size_t alocar = bytes > 0 ? bytes : 1;
+    char *entrada = malloc(alocar);
+    char *resultado = malloc(alocar);
+    char *referencia = malloc(alocar);
+    if (!entrada || !resultado || !referencia) {
+        free(entrada);
+        free(resultado);
+        free(referencia);
+        return -1;
+    }
+
+    montar_registros(entrada, chaves, tamanho, elem_size);
+    memcpy(resultado, entrada, bytes);
+    memcpy(referencia, entrada, bytes);
+
+    int versao_anterior = usar_versao_otimizada;
+    configurar_otimizacao(otimizada);
+    executar_ordenacao(algoritmo, resultado, tamanho, elem_size, cmp);
+    configurar_otimizacao(versao_anterior);
+
+    qsort(referencia, (size_t)tamanho, elem_size, cmp);
+
+    int falhas = 0;
+
+    // Ordem: cada posição na mesma classe de equivalência que a do qsort
+    for (int i = 0; i < tamanho; i++) {
+        const char *obtido = resultado + (size_t)i * elem_size;
+        const char *esperado = referencia + (size_t)i * elem_size;
+        if (cmp(obtido, esperado) != 0) {
+            falhas |= 1;
+            if (saida) {
+                fprintf(saida, "    ordem: indice %d tem chave %d, qsort tem %d\n",
+                        i, ler_chave(obtido), ler_chave(esperado));
+            }
+            break;
+        }
+    }
+
+    // Estabilidade: índice original crescente dentro de cada grupo de iguais
+    if ((algoritmo->capacidades & CAPACIDADE_ESTAVEL) && elem_size >= 2 * sizeof(int) && !(falhas & 1)) {
+        for (int i = 0; i + 1 < tamanho; i++) {
+            const char *atual = resultado + (size_t)i * elem_size;
+            const char *seguinte = atual + elem_size;
+            if (cmp(atual, seguinte) == 0 && ler_indice(atual) > ler_indice(seguinte)) {
+                falhas |= 4;
+                if (saida) {
+                    fprintf(saida, "    estabilidade: indices originais %d e %d invertidos na posicao %d\n",
+                            ler_indice(atual), ler_indice(seguinte), i);
+                }
+                break;
+            }
+        }
+    }
+
+    // Permutação: mesma multiconjunto de registros, byte a byte
+    tamanho_bytes_comparacao = elem_size;
+    qsort(entrada, (size_t)tamanho, elem_size, comparar_bytes);
+    qsort(resultado, (size_t)tamanho, elem_size, comparar_bytes);
+    if (memcmp(entrada, resultado, bytes) != 0) {
+        falhas |= 2;
+        if (saida) fprintf(saida, "    permutacao: registros perdidos, duplicados ou corrompidos\n");
+    }
+
+    free(entrada);
+    free(resultado);
+    free(referencia);
+    return falhas;
+}
+
+/* ================================================================
+ * CASOS E EXECUÇÃO COMPLETA
+ * ================================================================ */
+
+/**
+ * @brief Confere um motor numa versão e contabiliza o resultado
+ *
+ * @return 1 se falhou, 0 se passou, -1 se faltar memória
+ */
+static int conferir_motor(const CasoVerificacao *caso, const int *chaves, int indice,
+                          int otimizada, ResultadoVerificacao *resultado, FILE *saida) {
+    AlgoritmoInfo *info = obter_info_motor(indice);
+    int falhas = verificar_algoritmo(info, otimizada, chaves, caso->tamanho,
+                                     caso->elem_size, caso->comparador, NULL);
+    resultado->execucoes++;
+    if (falhas <= 0) return falhas;
+
+    if (falhas & 1) resultado->falhas_ordem++;
+    if (falhas & 2) resultado->falhas_permutacao++;
+    if (falhas & 4) resultado->falhas_estabilidade++;
+    if (saida) {
+        char parametros[96];
+        descrever_parametros_motores(obter_parametros_motores(), parametros, sizeof(parametros));
+        fprintf(saida, "FALHA %s (%s): n=%d elem=%zu padrao=%s cmp=%s semente=%llu [%s]\n",
+                info->nome, indice >= NUM_MOTORES_INTERNOS ? "plugin" :
+                            indice >= NUM_ALGORITMOS ? "unica" :
+                            otimizada ? "otimizada" : "didatica", caso->tamanho,
+                caso->elem_size, nome_padrao_verificacao(caso->padrao),
+                nome_comparador_verificacao(caso->comparador),
+                (unsigned long long)caso->semente, parametros);
+        // Repete com detalhes: a entrada é determinística
+        verificar_algoritmo(info, otimizada, chaves, caso->tamanho,
+                            caso->elem_size, caso->comparador, saida);
+    }
+    return 1;
+}
+
+int verificar_caso(const CasoVerificacao *caso, ResultadoVerificacao *resultado, FILE *saida) {
+    if (!caso || !resultado) return -1;
+
+    int *chaves = malloc((size_t)(caso->tamanho > 0 ? caso->tamanho : 1) * sizeof(int));
+    if (!chaves) return -1;
+    uint64_t estado = caso->semente ^ 0xC0FFEEULL;
+    gerar_chaves(chaves, caso->tamanho, caso->padrao, &estado);
+
+    int falhas_caso = 0;
+    int erro = 0;
+    resultado->casos++;
+    CompareFn cmp = funcao_comparador_verificacao(caso->comparador);
+
+    // Algoritmos nas duas versões, especializados e plugins (só uma versão);
+    // as referências da libc são o próprio oráculo e ficam de fora
+    int total_motores = num_motores();
+    for (int a = 0; a < total_motores && !erro; a++) {
+        AlgoritmoInfo *info = obter_info_motor(a);
+        if (eh_referencia(info)) continue;
+        // Motores só de int entram nos casos com elem_size 4 e comparar_inteiros
+        if (!motor_aceita_dados(info, caso->elem_size, cmp)) continue;
+
+        for (int otimizada = (a < NUM_ALGORITMOS) ? 0 : 1; otimizada <= 1; otimizada++) {
+            int falhou = conferir_motor(caso, chaves, a, otimizada, resultado, saida);
+            if (falhou < 0) { erro = 1; break; }
+            falhas_caso += falhou;
+        }
+    }
+
+    // Versões otimizadas internas sob os demais parâmetros (os plugins não os
+    // leem); os parâmetros em vigor voltam ao final, mesmo após erro
+    ParametrosMotores em_vigor = *obter_parametros_motores();
+    for (int p = 0; p < NUM_PARAMETROS_VERIFICACAO && !erro; p++) {
+        configurar_parametros_motores(&parametros_verificacao[p]);
+        for (int a = 0; a < NUM_MOTORES_INTERNOS && !erro; a++) {
+            AlgoritmoInfo *info = obter_info_motor(a);
+            if (eh_referencia(info) || !motor_aceita_dados(info, caso->elem_size, cmp)) continue;
+            int falhou = conferir_motor(caso, chaves, a, 1, resultado, saida);
+            if (falhou < 0) erro = 1;
+            else falhas_caso += falhou;
+        }
+    }
+    configurar_parametros_motores(&em_vigor);
+
+    free(chaves);
+    return erro ? -1 : falhas_caso;
+}
+
+int verificar_algoritmos(const OpcoesVerificacao *opcoes, ResultadoVerificacao *resultado,
+                         FILE *saida) {
+    if (!opcoes || !resultado || opcoes->casos < 0) return -1;
+    memset(resultado, 0, sizeof(*resultado));
+
+    uint64_t estado = opcoes->semente;
+    int total_falhas = 0;
+
+    for (int c = 0; c < opcoes->casos; c++) {
+        CasoVerificacao caso = sortear_caso_verificacao(gerador_proximo(&estado), opcoes->tamanho_maximo);
+        if (opcoes->verboso && saida) {
+            fprintf(saida, "caso %4d: n=%-5d elem=%-4zu padrao=%-16s cmp=%-17s semente=%llu\n",
+                    c, caso.tamanho, caso.elem_size, nome_padrao_verificacao(caso.padrao),
+                    nome_comparador_verificacao(caso.comparador), (unsigned long long)caso.semente);
+        }
+        int falhas = verificar_caso(&caso, resultado, saida);
+        if (falhas < 0) return -1;
+        total_falhas += falhas;
+    }
+
+    if (saida) {
+        fprintf(saida, "\n%d caso(s), %d execucao(oes): %d falha(s) de ordem, %d de permutacao, %d de estabilidade\n",
+                resultado->casos, resultado->execucoes, resultado->falhas_ordem,
+                resultado->falhas_permutacao, resultado->falhas_estabilidade);
+    }
+    return total_falhas;
+}
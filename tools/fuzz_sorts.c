@@ -0,0 +1,76 @@
+/**
+ * ==============================================================
+ * PONTO DE ENTRADA PARA O LIBFUZZER
+ * ==============================================================
+ *
+ * @file fuzz_sorts.c
+ * @brief Entrada do fuzzer → (motor, versão, elemento, comparador, chaves)
+ *
+ * Layout dos bytes:
+ *
+ *   [0] motor do registro (módulo num_motores(): algoritmos, referências
+ *       da libc, ordenação aprendida e plugins de SORTS_PLUGINS)
+ *   [1] bit 0 = versão otimizada (só algoritmos), bits 1-2 = comparador
+ *   [2] tamanho do elemento (índice em tamanhos_fuzz)
+ *   [3..] chaves int32, 4 bytes cada (no máximo MAX_CHAVES_FUZZ)
+ *
+ * Combinações que o motor não aceita (motor_aceita_dados: motores só de
+ * int fora de elem_size 4 com comparar_inteiros) são descartadas.
+ *
+ * Qualquer divergência (ordem, permutação, estabilidade) chama abort(),
+ * que o libFuzzer grava como crash-<hash> para reprodução.
+ *
+ * Compilação (Clang):
+ *   cmake -S . -B build-fuzz -DCMAKE_C_COMPILER=clang -DSORTS_FUZZ=ON
+ *   cmake --build build-fuzz --target fuzz_sorts
+ *   ./build-fuzz/fuzz_sorts -max_len=4096 corpus/
+ *
+ * ==============================================================
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/sorts.h"
+
+#define MAX_CHAVES_FUZZ 1024  ///< Limita o custo dos algoritmos O(n²) por entrada
+
+static const size_t tamanhos_fuzz[] = { sizeof(int), 8, 12, 24, sizeof(Aluno) };
+
+int LLVMFuzzerInitialize(int *argc, char ***argv);
+int LLVMFuzzerTestOneInput(const uint8_t *dados, size_t tamanho);
+
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+    (void)argc;
+    (void)argv;
+    carregar_plugins_ambiente();  // Plugins entram no registro antes da primeira entrada
+    return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *dados, size_t tamanho) {
+    if (tamanho < 3) return 0;
+
+    int indice = dados[0] % num_motores();
+    const AlgoritmoInfo *algoritmo = obter_info_motor(indice);
+    int otimizada = indice < NUM_ALGORITMOS ? dados[1] & 1 : 1;  // Os demais têm versão única
+    ComparadorVerificacao comparador =
+        (ComparadorVerificacao)(((unsigned)dados[1] >> 1) % NUM_COMPARADORES_VERIFICACAO);
+    size_t elem_size = tamanhos_fuzz[dados[2] % (sizeof(tamanhos_fuzz) / sizeof(tamanhos_fuzz[0]))];
+    if (!motor_aceita_dados(algoritmo, elem_size, funcao_comparador_verificacao(comparador))) return 0;
+
+    size_t n = (tamanho - 3) / sizeof(int);
+    if (n > MAX_CHAVES_FUZZ) n = MAX_CHAVES_FUZZ;
+
+    int chaves[MAX_CHAVES_FUZZ];
+    if (n > 0) memcpy(chaves, dados + 3, n * sizeof(int));
+
+    int falhas = verificar_algoritmo(algoritmo, otimizada, chaves, (int)n, elem_size, comparador, stderr);
+    if (falhas > 0) {
+        fprintf(stderr, "FALHA %s (%s): n=%zu elem=%zu cmp=%s\n", algoritmo->nome,
+                indice >= NUM_MOTORES_INTERNOS ? "plugin" : indice >= NUM_ALGORITMOS ? "unica" :
+                otimizada ? "otimizada" : "didatica", n, elem_size,
+                nome_comparador_verificacao(comparador));
+        abort();
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * ==============================================================
+ * PLUGIN DE EXEMPLO PARA O REGISTRO DE MOTORES
+ * ==============================================================
+ *
+ * @file plugin_exemplo.c
+ * @brief Merge Sort e Radix Sort LSD carregados em tempo de execução
+ *
+ * Mostra o contrato de registro.h: o plugin só depende de tipos.h,
+ * monta um AlgoritmoInfo por motor (na pilha: o registro copia) e o
+ * entrega a registrar().
+ *
+ *  ┌──────────────────┬──────────────────────────────────────────┐
+ *  │ merge_plugin     │ genérico, estável, memória auxiliar O(n) │
+ *  │ radix_plugin     │ só int crescente (ignora cmp), estável,  │
+ *  │                  │ bits por dígito vêm do contexto          │
+ *  └──────────────────┴──────────────────────────────────────────┘
+ *
+ * Uso:
+ *   SORTS_PLUGINS=_build/libplugin_exemplo.so ./trabalho_po_1
+ *   sort_bench --plugin _build/libplugin_exemplo.so --motores plugin,qsort --smoke
+ *
+ * O plugin não enxerga os contadores do programa. Como nas referências
+ * da libc, executar_ordenacao() lhe entrega comparar_e_contar no lugar
+ * do comparador, então as comparações do merge_plugin são contadas;
+ * trocas e movimentações ficam em zero (o radix_plugin não compara).
+ *
+ * ==============================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tipos.h"
+#include "../include/registro.h"
+
+/* ==============================================================
+ * FALHA DE ALOCAÇÃO
+ * ============================================================== */
+
+/**
+ * @brief Encerra como os algoritmos do programa: nunca devolve o vetor sem ordenar
+ */
+static void sem_memoria(const char *motor, size_t bytes) {
+    fprintf(stderr, "ERRO CRÍTICO: %s nao conseguiu alocar %zu bytes\n", motor, bytes);
+    exit(EXIT_FAILURE);
+}
+
+/* ==============================================================
+ * MERGE SORT
+ * ============================================================== */
+
+#define LIMITE_INSERCAO_MERGE 16
+
+static void insercao_intervalo(char *base, int inicio, int fim, size_t elem_size,
+                               CompareFn cmp, char *temp) {
+    for (int i = inicio + 1; i <= fim; i++) {
+        memcpy(temp, base + (size_t)i * elem_size, elem_size);
+        int j = i - 1;
+        while (j >= inicio && cmp(base + (size_t)j * elem_size, temp) > 0) {
+            memcpy(base + (size_t)(j + 1) * elem_size, base + (size_t)j * elem_size, elem_size);
+            j--;
+        }
+        memcpy(base + (size_t)(j + 1) * elem_size, temp, elem_size);
+    }
+}
+
+static void merge_recursivo(char *base, char *aux, int inicio, int fim, size_t elem_size,
+                            CompareFn cmp) {
+    if (fim - inicio < LIMITE_INSERCAO_MERGE) {
+        insercao_intervalo(base, inicio, fim, elem_size, cmp, aux + (size_t)inicio * elem_size);
+        return;
+    }
+
+    int meio = inicio + (fim - inicio) / 2;
+    merge_recursivo(base, aux, inicio, meio, elem_size, cmp);
+    merge_recursivo(base, aux, meio + 1, fim, elem_size, cmp);
+
+    // Metades já em ordem: nada a intercalar
+    if (cmp(base + (size_t)meio * elem_size, base + (size_t)(meio + 1) * elem_size) <= 0) return;
+
+    size_t bytes = (size_t)(fim - inicio + 1) * elem_size;
+    memcpy(aux + (size_t)inicio * elem_size, base + (size_t)inicio * elem_size, bytes);
+
+    int i = inicio, j = meio + 1, k = inicio;
+    while (i <= meio && j <= fim) {
+        // <= mantém a estabilidade: empate fica com a metade esquerda
+        const char *origem = cmp(aux + (size_t)i * elem_size, aux + (size_t)j * elem_size) <= 0
+                             ? aux + (size_t)i++ * elem_size : aux + (size_t)j++ * elem_size;
+        memcpy(base + (size_t)k++ * elem_size, origem, elem_size);
+    }
+    if (i <= meio) {
+        memcpy(base + (size_t)k * elem_size, aux + (size_t)i * elem_size,
+               (size_t)(meio - i + 1) * elem_size);
+    }
+    // Resto da metade direita já está no lugar
+}
+
+static void merge_plugin(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)contexto;
+    if (n < 2) return;
+    char *aux = malloc((size_t)n * elem_size);
+    if (!aux) sem_memoria("merge_plugin", (size_t)n * elem_size);
+    merge_recursivo(arr, aux, 0, n - 1, elem_size, cmp);
+    free(aux);
+}
+
+/* ==============================================================
+ * RADIX SORT LSD
+ * ============================================================== */
+
+static void radix_plugin(void *arr, int n, size_t elem_size, CompareFn cmp, void *contexto) {
+    (void)elem_size;
+    (void)cmp;
+    if (n < 2) return;
+
+    int bits = *(const int*)contexto;
+    unsigned baldes = 1u << bits;
+    unsigned mascara = baldes - 1;
+    unsigned *chaves = arr;
+    unsigned *aux = malloc((size_t)n * sizeof(unsigned));
+    size_t *contagem = malloc(baldes * sizeof(size_t));
+    if (!aux || !contagem) sem_memoria("radix_plugin", (size_t)n * sizeof(unsigned) + baldes * sizeof(size_t));
+
+    // Inverter o bit de sinal põe os negativos antes dos positivos
+    for (int i = 0; i < n; i++) chaves[i] ^= 0x80000000u;
+
+    unsigned *origem = chaves, *destino = aux;
+    for (int deslocamento = 0; deslocamento < 32; deslocamento += bits) {
+        memset(contagem, 0, baldes * sizeof(size_t));
+        for (int i = 0; i < n; i++) contagem[(origem[i] >> deslocamento) & mascara]++;
+
+        size_t soma = 0;
+        for (unsigned b = 0; b < baldes; b++) {
+            size_t c = contagem[b];
+            contagem[b] = soma;
+            soma += c;
+        }
+        for (int i = 0; i < n; i++) destino[contagem[(origem[i] >> deslocamento) & mascara]++] = origem[i];
+
+        unsigned *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    if (origem != chaves) memcpy(chaves, origem, (size_t)n * sizeof(unsigned));
+
+    for (int i = 0; i < n; i++) chaves[i] ^= 0x80000000u;
+    free(aux);
+    free(contagem);
+}
+
+/* ==============================================================
+ * PONTO DE ENTRADA
+ * ============================================================== */
+
+/// 8 bits por dígito: 4 passadas em int de 32 bits
+static int bits_digito_radix = 8;
+
+int sorts_registrar_plugin(int versao_api, RegistrarMotorFn registrar);
+
+int sorts_registrar_plugin(int versao_api, RegistrarMotorFn registrar) {
+    if (versao_api != VERSAO_API_PLUGIN_MOTORES) return 1;  // Compilado contra outro tipos.h
+
+    AlgoritmoInfo merge = {
+        "Merge (plugin)", "O(n)", "O(n log n)", "O(n log n)", CAPACIDADE_ESTAVEL,
+        merge_plugin, NULL, "merge_plugin", "plugin,n_log_n"
+    };
+    AlgoritmoInfo radix = {
+        "Radix LSD (plugin)", "O(n)", "O(n)", "O(n)", CAPACIDADE_ESTAVEL | CAPACIDADE_SO_INTEIROS,
+        radix_plugin, &bits_digito_radix, "radix_plugin", "plugin,linear"
+    };
+
+    if (registrar(&merge) < 0) return 2;
+    if (registrar(&radix) < 0) return 2;
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * ==============================================================
+ * FERRAMENTA OFFLINE DE SIMULAÇÃO DE CACHE
+ * ==============================================================
+ *
+ * @file simular_cache.c
+ * @brief Reexecuta rastros .bin gravados pelo programa principal
+ *
+ * Permite testar outras geometrias de cache (ou de outra máquina) sem
+ * rodar os algoritmos de novo. Sem opções, usa a hierarquia da máquina
+ * atual, como o relatório cache_simulada.txt.
+ *
+ * Uso:
+ *   simular_cache [--l1 T:V:L] [--l2 T:V:L] [--llc T:V:L] [--tlb E:V:P]
+ *                 [--sem-l2] [--sem-llc] rastro.bin [rastro.bin ...]
+ *
+ *   T = tamanho (aceita K, M, G), V = vias, L = linha em bytes
+ *   E = entradas da TLB, P = tamanho da página em bytes
+ *
+ * Exemplo:
+ *   simular_cache --l1 48K:12:64 --llc 32M:16:64 output/rastros/heap_sort_50000.bin
+ *
+ * ==============================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/rastro.h"
+#include "../include/simulador.h"
+
+/* ==============================================================
+ * FUNÇÕES AUXILIARES
+ * ============================================================== */
+
+static void imprimir_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [--l1 T:V:L] [--l2 T:V:L] [--llc T:V:L] [--tlb E:V:P]\n"
+            "       [--sem-l2] [--sem-llc] rastro.bin [rastro.bin ...]\n"
+            "  T = tamanho (K, M, G), V = vias, L = linha em bytes\n"
+            "  E = entradas da TLB, P = pagina em bytes\n",
+            programa);
+}
+
+/**
+ * @brief "E:V:P" → tamanho = E × P, vias = V, linha = P
+ */
+static int interpretar_tlb(const char *texto, NivelCache *tlb) {
+    unsigned long entradas, vias, pagina;
+    char resto;
+    if (sscanf(texto, "%lu:%lu:%lu%c", &entradas, &vias, &pagina, &resto) != 3) return -1;
+
+    char geometria[64];
+    snprintf(geometria, sizeof(geometria), "%lu:%lu:%lu", entradas * pagina, vias, pagina);
+    return interpretar_nivel_cache(geometria, tlb);
+}
+
+/* ==============================================================
+ * PROGRAMA PRINCIPAL
+ * ============================================================== */
+
+int main(int argc, char **argv) {
+    ConfiguracaoCache config = configuracao_cache_padrao();
+    int usar_l2 = 1;
+    int usar_llc = 1;
+    int primeiro_arquivo = argc;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opcao = argv[i];
+        int com_valor = strcmp(opcao, "--l1") == 0 || strcmp(opcao, "--l2") == 0 ||
+                        strcmp(opcao, "--llc") == 0 || strcmp(opcao, "--tlb") == 0;
+
+        if (com_valor) {
+            if (i + 1 >= argc) {
+                imprimir_uso(argv[0]);
+                return 1;
+            }
+            const char *valor = argv[++i];
+            int erro;
+            if (strcmp(opcao, "--l1") == 0)       erro = interpretar_nivel_cache(valor, &config.niveis[0]);
+            else if (strcmp(opcao, "--l2") == 0)  erro = interpretar_nivel_cache(valor, &config.niveis[1]);
+            else if (strcmp(opcao, "--llc") == 0) erro = interpretar_nivel_cache(valor, &config.niveis[2]);
+            else                                  erro = interpretar_tlb(valor, &config.tlb);
+            if (erro) {
+                fprintf(stderr, "ERRO: geometria invalida para %s: %s\n", opcao, valor);
+                return 1;
+            }
+        } else if (strcmp(opcao, "--sem-l2") == 0) {
+            usar_l2 = 0;
+        } else if (strcmp(opcao, "--sem-llc") == 0) {
+            usar_llc = 0;
+        } else if (strcmp(opcao, "--ajuda") == 0 || strcmp(opcao, "-h") == 0) {
+            imprimir_uso(argv[0]);
+            return 0;
+        } else if (opcao[0] == '-') {
+            fprintf(stderr, "ERRO: opcao desconhecida: %s\n", opcao);
+            imprimir_uso(argv[0]);
+            return 1;
+        } else {
+            primeiro_arquivo = i;
+            break;
+        }
+    }
+
+    if (primeiro_arquivo >= argc) {
+        imprimir_uso(argv[0]);
+        return 1;
+    }
+
+    // Remove níveis desligados mantendo a ordem L1 → L2 → LLC
+    NivelCache niveis[MAX_NIVEIS_CACHE];
+    int num_niveis = 0;
+    niveis[num_niveis++] = config.niveis[0];
+    if (usar_l2) niveis[num_niveis++] = config.niveis[1];
+    if (usar_llc) niveis[num_niveis++] = config.niveis[2];
+    memcpy(config.niveis, niveis, sizeof(NivelCache) * (size_t)num_niveis);
+    config.num_niveis = num_niveis;
+
+    printf("Hierarquia simulada (associativa por conjunto, LRU):\n");
+    escrever_configuracao_cache(stdout, &config);
+
+    int falhas = 0;
+    for (int i = primeiro_arquivo; i < argc; i++) {
+        RastroMemoria *rastro = carregar_rastro(argv[i]);
+        if (!rastro) {
+            fprintf(stderr, "ERRO: rastro invalido ou ilegivel: %s\n", argv[i]);
+            falhas++;
+            continue;
+        }
+
+        EstatisticasCache estatisticas;
+        if (simular_rastro(rastro, &config, &estatisticas) != 0) {
+            fprintf(stderr, "ERRO: falha ao simular %s\n", argv[i]);
+            falhas++;
+        } else {
+            escrever_estatisticas_cache(stdout, argv[i], &config, &estatisticas);
+        }
+        liberar_rastro(rastro);
+    }
+
+    return falhas > 0 ? 1 : 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * ==============================================================
+ * VERIFICADOR DIFERENCIAL DOS ALGORITMOS
+ * ==============================================================
+ *
+ * @file verificar_sorts.c
+ * @brief Confere todos os algoritmos contra o qsort em casos aleatórios
+ *
+ * Uso:
+ *   verificar_sorts [--casos N] [--semente S] [--tamanho-maximo N]
+ *                   [--caso SEMENTE] [--verboso]
+ *
+ * Exemplos:
+ *   verificar_sorts                         # 300 casos, n até 600
+ *   verificar_sorts --casos 5000 --semente 42
+ *   verificar_sorts --caso 1234567          # repete um caso que falhou
+ *
+ * Plugins listados em SORTS_PLUGINS (registro.h) também são conferidos,
+ * na única versão que têm.
+ *
+ * Código de saída: 0 se tudo conferiu, 1 se alguma execução falhou,
+ * 2 em erro de uso ou falta de memória. Compilado com
+ * -DSORTS_SANITIZERS=ON, roda sob AddressSanitizer e UBSan.
+ *
+ * ==============================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/sorts.h"
+
+/* ==============================================================
+ * FUNÇÕES AUXILIARES
+ * ============================================================== */
+
+static void imprimir_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [--casos N] [--semente S] [--tamanho-maximo N]\n"
+            "       [--caso SEMENTE] [--verboso]\n"
+            "  --caso: repete um unico caso (semente impressa na falha)\n",
+            programa);
+}
+
+/* ==============================================================
+ * PROGRAMA PRINCIPAL
+ * ============================================================== */
+
+int main(int argc, char **argv) {
+    OpcoesVerificacao opcoes = opcoes_verificacao_padrao();
+    int caso_unico = 0;
+    uint64_t semente_caso = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opcao = argv[i];
+        int com_valor = strcmp(opcao, "--casos") == 0 || strcmp(opcao, "--semente") == 0 ||
+                        strcmp(opcao, "--tamanho-maximo") == 0 || strcmp(opcao, "--caso") == 0;
+
+        if (com_valor) {
+            if (i + 1 >= argc) {
+                imprimir_uso(argv[0]);
+                return 2;
+            }
+            const char *valor = argv[++i];
+            if (strcmp(opcao, "--casos") == 0)               opcoes.casos = (int)strtol(valor, NULL, 10);
+            else if (strcmp(opcao, "--semente") == 0)        opcoes.semente = strtoull(valor, NULL, 10);
+            else if (strcmp(opcao, "--tamanho-maximo") == 0) opcoes.tamanho_maximo = (int)strtol(valor, NULL, 10);
+            else {
+                semente_caso = strtoull(valor, NULL, 10);
+                caso_unico = 1;
+            }
+        } else if (strcmp(opcao, "--verboso") == 0) {
+            opcoes.verboso = 1;
+        } else if (strcmp(opcao, "--ajuda") == 0 || strcmp(opcao, "-h") == 0) {
+            imprimir_uso(argv[0]);
+            return 0;
+        } else {
+            fprintf(stderr, "ERRO: opcao desconhecida: %s\n", opcao);
+            imprimir_uso(argv[0]);
+            return 2;
+        }
+    }
+
+    if (opcoes.casos < 0 || opcoes.tamanho_maximo < 0) {
+        fprintf(stderr, "ERRO: casos e tamanho maximo devem ser >= 0\n");
+        return 2;
+    }
+
+    int plugins = carregar_plugins_ambiente();
+
+    ResultadoVerificacao resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    int falhas;
+
+    if (caso_unico) {
+        CasoVerificacao caso = sortear_caso_verificacao(semente_caso, opcoes.tamanho_maximo);
+        printf("caso: n=%d elem=%zu padrao=%s cmp=%s semente=%llu\n", caso.tamanho,
+               caso.elem_size, nome_padrao_verificacao(caso.padrao),
+               nome_comparador_verificacao(caso.comparador), (unsigned long long)semente_caso);
+        falhas = verificar_caso(&caso, &resultado, stdout);
+        if (falhas == 0) printf("todas as %d execucoes conferiram\n", resultado.execucoes);
+    } else {
+        // As referências da libc são o oráculo e não entram na contagem
+        int motores = 0;
+        for (int a = 0; a < num_motores(); a++) motores += !eh_referencia(obter_info_motor(a));
+        printf("Verificando %d motores do registro (algoritmos x 2 versoes", motores);
+        if (plugins > 0) printf(", %d plugin(s)", plugins);
+        printf("; otimizados sob %d parametros alternativos)", NUM_PARAMETROS_VERIFICACAO);
+        printf(" em %d casos (n <= %d, semente %llu)\n", opcoes.casos, opcoes.tamanho_maximo,
+               (unsigned long long)opcoes.semente);
+        falhas = verificar_algoritmos(&opcoes, &resultado, stdout);
+    }
+
+    liberar_buffer_troca();
+    if (falhas < 0) {
+        fprintf(stderr, "ERRO: falha de alocacao durante a verificacao\n");
+        return 2;
+    }
+    return falhas > 0 ? 1 : 0;
+}